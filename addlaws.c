@@ -845,6 +845,475 @@ twisted_hessian_to_weierstrass(mpz_t f, mpres_t x, mpres_t y, mpres_t c, mpres_t
     return ret;
 }
 
+/******************** extended twisted Edwards form ********************/
+
+/* a*X^2*Z^2+Y^2*Z^2 = Z^4+d*X^2*Y^2 with X*Y = T*Z, a = E->a4, d = E->a6.
+   Source: Hisil, Wong, Carter and Dawson, Twisted Edwards curves
+   revisited, Asiacrypt 2008.
+   O_E = [0:1:1:0]
+   -[X:Y:Z:T] = [-X:Y:Z:-T]
+   The doubling does not read T, thus T is only computed when the next
+   operation is an addition.
+   An ell_point_t holds the projective point [X:Y:Z] only; the extended
+   coordinates live in edwards_point_t, which is private to this file.
+*/
+
+typedef struct
+{
+    mpres_t x;
+    mpres_t y;
+    mpres_t z;
+    mpres_t t;
+} __edwards_point_struct;
+typedef __edwards_point_struct edwards_point_t[1];
+
+static void
+edwards_point_init(edwards_point_t P, mpmod_t n)
+{
+    mpres_init(P->x, n);
+    mpres_init(P->y, n);
+    mpres_init(P->z, n);
+    mpres_init(P->t, n);
+}
+
+static void
+edwards_point_clear(edwards_point_t P, mpmod_t n)
+{
+    mpres_clear(P->x, n);
+    mpres_clear(P->y, n);
+    mpres_clear(P->z, n);
+    mpres_clear(P->t, n);
+}
+
+/* R <- [X*Z:Y*Z:Z^2:X*Y] for P = [X:Y:Z], 3M+1S */
+static void
+twisted_edwards_extend(edwards_point_t R, ell_point_t P, mpmod_t n)
+{
+    mpres_mul(R->t, P->x, P->y, n);
+    mpres_mul(R->x, P->x, P->z, n);
+    mpres_mul(R->y, P->y, P->z, n);
+    mpres_sqr(R->z, P->z, n);
+}
+
+/* R <- [X:Y:Z] for P = [X:Y:Z:T] */
+static void
+twisted_edwards_project(ell_point_t R, edwards_point_t P,
+			 ATTRIBUTE_UNUSED mpmod_t n)
+{
+    mpres_set(R->x, P->x, n);
+    mpres_set(R->y, P->y, n);
+    mpres_set(R->z, P->z, n);
+}
+
+int
+twisted_edwards_is_zero(ell_point_t P, ATTRIBUTE_UNUSED ell_curve_t E, mpmod_t n)
+{
+    return mpres_is_zero(P->x, n) && mpres_equal(P->y, P->z, n);
+}
+
+void
+twisted_edwards_set_to_zero(ell_point_t P, ATTRIBUTE_UNUSED ell_curve_t E, mpmod_t n)
+{
+    mpres_set_ui(P->x, 0, n);
+    mpres_set_ui(P->y, 1, n);
+    mpres_set_ui(P->z, 1, n);
+}
+
+void
+twisted_edwards_negate(ell_point_t P, ATTRIBUTE_UNUSED ell_curve_t E, mpmod_t n)
+{
+    mpres_neg(P->x, P->x, n);
+}
+
+static void
+twisted_edwards_negate_ext(edwards_point_t P, mpmod_t n)
+{
+    mpres_neg(P->x, P->x, n);
+    mpres_neg(P->t, P->t, n);
+}
+
+/* 4M+4S+1M_a, or 3M+4S+1M_a without T */
+static void
+twisted_edwards_duplicate(edwards_point_t R, edwards_point_t P, ell_curve_t E,
+			  mpmod_t n, int want_t)
+{
+    /* A:=X1^2; */
+    mpres_sqr(E->buf[0], P->x, n);
+    /* B:=Y1^2; */
+    mpres_sqr(E->buf[1], P->y, n);
+    /* C:=2*Z1^2; */
+    mpres_sqr(E->buf[2], P->z, n);
+    mpres_add(E->buf[2], E->buf[2], E->buf[2], n);
+    /* D:=a*A; */
+    mpres_mul(E->buf[3], E->buf[0], E->a4, n);
+    /* E:=(X1+Y1)^2-A-B; */
+    mpres_add(E->buf[4], P->x, P->y, n);
+    mpres_sqr(E->buf[4], E->buf[4], n);
+    mpres_sub(E->buf[4], E->buf[4], E->buf[0], n);
+    mpres_sub(E->buf[4], E->buf[4], E->buf[1], n);
+    /* G:=D+B; F:=G-C; H:=D-B; */
+    mpres_add(E->buf[5], E->buf[3], E->buf[1], n);
+    mpres_sub(E->buf[2], E->buf[5], E->buf[2], n);
+    mpres_sub(E->buf[3], E->buf[3], E->buf[1], n);
+    /* X3:=E*F; Y3:=G*H; T3:=E*H; Z3:=F*G; */
+    mpres_mul(R->x, E->buf[4], E->buf[2], n);
+    mpres_mul(R->y, E->buf[5], E->buf[3], n);
+    if(want_t)
+	mpres_mul(R->t, E->buf[4], E->buf[3], n);
+    mpres_mul(R->z, E->buf[2], E->buf[5], n);
+}
+
+/* unified addition, which also doubles: 9M+1M_a, or 8M+1M_a without T */
+static void
+twisted_edwards_plus(edwards_point_t R, edwards_point_t P, edwards_point_t Q,
+		     ell_curve_t E, mpmod_t n, int want_t)
+{
+    /* A:=X1*X2; */
+    mpres_mul(E->buf[0], P->x, Q->x, n);
+    /* B:=Y1*Y2; */
+    mpres_mul(E->buf[1], P->y, Q->y, n);
+    /* C:=d*T1*T2; */
+    mpres_mul(E->buf[2], P->t, Q->t, n);
+    mpres_mul(E->buf[2], E->buf[2], E->a6, n);
+    /* D:=Z1*Z2; */
+    mpres_mul(E->buf[3], P->z, Q->z, n);
+    /* E:=(X1+Y1)*(X2+Y2)-A-B; */
+    mpres_add(E->buf[4], P->x, P->y, n);
+    mpres_add(E->buf[5], Q->x, Q->y, n);
+    mpres_mul(E->buf[4], E->buf[4], E->buf[5], n);
+    mpres_sub(E->buf[4], E->buf[4], E->buf[0], n);
+    mpres_sub(E->buf[4], E->buf[4], E->buf[1], n);
+    /* F:=D-C; G:=D+C; */
+    mpres_sub(E->buf[5], E->buf[3], E->buf[2], n);
+    mpres_add(E->buf[3], E->buf[3], E->buf[2], n);
+    /* H:=B-a*A; */
+    mpres_mul(E->buf[0], E->buf[0], E->a4, n);
+    mpres_sub(E->buf[1], E->buf[1], E->buf[0], n);
+    /* X3:=E*F; Y3:=G*H; T3:=E*H; Z3:=F*G; */
+    mpres_mul(R->x, E->buf[4], E->buf[5], n);
+    mpres_mul(R->y, E->buf[3], E->buf[1], n);
+    if(want_t)
+	mpres_mul(R->t, E->buf[4], E->buf[1], n);
+    mpres_mul(R->z, E->buf[5], E->buf[3], n);
+}
+
+int
+twisted_edwards_add(ell_point_t R, ell_point_t P, ell_point_t Q, ell_curve_t E, mpmod_t n)
+{
+    edwards_point_t P1, Q1;
+
+    edwards_point_init(P1, n);
+    edwards_point_init(Q1, n);
+    twisted_edwards_extend(P1, P, n);
+    twisted_edwards_extend(Q1, Q, n);
+    twisted_edwards_plus(P1, P1, Q1, E, n, 0);
+    twisted_edwards_project(R, P1, n);
+    edwards_point_clear(P1, n);
+    edwards_point_clear(Q1, n);
+    return 1;
+}
+
+#if USE_ADD_SUB_CHAINS > 0
+int
+twisted_edwards_sub(ell_point_t R, ell_point_t P, ell_point_t Q, ell_curve_t E, mpmod_t n)
+{
+    edwards_point_t P1, Q1;
+
+    edwards_point_init(P1, n);
+    edwards_point_init(Q1, n);
+    twisted_edwards_extend(P1, P, n);
+    twisted_edwards_extend(Q1, Q, n);
+    twisted_edwards_negate_ext(Q1, n);
+    twisted_edwards_plus(P1, P1, Q1, E, n, 0);
+    twisted_edwards_project(R, P1, n);
+    edwards_point_clear(P1, n);
+    edwards_point_clear(Q1, n);
+    return 1;
+}
+#endif
+
+/* the doubling does not read T, thus the projective coordinates are
+   copied as they are */
+static int
+twisted_edwards_double(ell_point_t R, ell_point_t P, ell_curve_t E, mpmod_t n)
+{
+    edwards_point_t P1;
+
+    edwards_point_init(P1, n);
+    mpres_set(P1->x, P->x, n);
+    mpres_set(P1->y, P->y, n);
+    mpres_set(P1->z, P->z, n);
+    twisted_edwards_duplicate(P1, P1, E, n, 0);
+    twisted_edwards_project(R, P1, n);
+    edwards_point_clear(P1, n);
+    return 1;
+}
+
+/* the exponent is recoded by blocks of that many bits */
+#define EDWARDS_NAF_BLOCK 65536
+#define EDWARDS_NAF_WMAX 12
+
+/* the width of the window minimizing the number of additions, with
+   2^(w-2) for the table and l/(w+1) for an exponent of l bits */
+static int
+twisted_edwards_naf_width(size_t l)
+{
+    int w = 2;
+
+    while(w < EDWARDS_NAF_WMAX
+	  && (1 << (w - 1)) + (double) l / (w + 2)
+	     < (1 << (w - 2)) + (double) l / (w + 1))
+	w++;
+    return w;
+}
+
+/* D[0..len] <- the width-w NAF of the bits lo..lo+len-1 of e, with odd
+   digits of absolute value less than 2^(w-1). A window cut by the end of
+   the bits takes a positive digit, and D[len] is the last carry, 0 or 1,
+   thus the blocks of the exponent are recoded independently. */
+static void
+twisted_edwards_naf(short *D, mpz_t e, size_t lo, size_t len, int w)
+{
+    size_t i, j;
+    int c = 0, u;
+
+    memset(D, 0, (len + 1) * sizeof(short));
+    for(i = 0; i < len; ){
+	if(mpz_tstbit(e, lo + i) == c){
+	    /* bit + carry is even */
+	    i++;
+	    continue;
+	}
+	u = c;
+	for(j = 0; j < (size_t) w && i + j < len; j++)
+	    u += mpz_tstbit(e, lo + i + j) << j;
+	if(i + w <= len && u >= (1 << (w - 1))){
+	    u -= 1 << w;
+	    c = 1;
+	}
+	else
+	    c = 0;
+	D[i] = u;
+	i += w;
+    }
+    D[len] = c;
+}
+
+/* Q <- [e]*P for e > 0, with a width-w NAF of e, since the negation is
+   free. Return value: 1, since the addition law does not fail; a factor
+   shows up as a zero coordinate Z (or X) modulo p. */
+static int
+twisted_edwards_mul(ell_point_t Q, mpz_t e, ell_point_t P, ell_curve_t E,
+		    mpmod_t n)
+{
+    size_t l = mpz_sizeinbase(e, 2), lo, len;
+    int w, k, i, started = 0;
+    long j;
+    short *D;
+    edwards_point_t P0, iP[1 << (EDWARDS_NAF_WMAX - 2)];
+
+    w = twisted_edwards_naf_width(l);
+    k = 1 << (w - 2);
+    /* iP[i] <- (2*i+1)*P */
+    for(i = 0; i < k; i++)
+	edwards_point_init(iP[i], n);
+    edwards_point_init(P0, n);
+    twisted_edwards_extend(iP[0], P, n);
+    if(k > 1){
+	twisted_edwards_duplicate(P0, iP[0], E, n, 1);
+	for(i = 1; i < k; i++)
+	    twisted_edwards_plus(iP[i], iP[i-1], P0, E, n, 1);
+    }
+
+    D = (short *) malloc((EDWARDS_NAF_BLOCK + 1) * sizeof(short));
+    ASSERT_ALWAYS(D != NULL);
+    /* e = sum of D*2^lo over the blocks, from the top one, which is the
+       only one that is not full */
+    len = l % EDWARDS_NAF_BLOCK;
+    if(len == 0)
+	len = EDWARDS_NAF_BLOCK;
+    for(lo = l - len; ; lo -= EDWARDS_NAF_BLOCK){
+	twisted_edwards_naf(D, e, lo, len, w);
+	for(j = len; j >= 0; j--){
+	    if(started && j < (long) len)
+		/* the doubling at bit 0 computes T for the carry of the
+		   next block */
+		twisted_edwards_duplicate(P0, P0, E, n, D[j] != 0 || j == 0);
+	    if(D[j] == 0)
+		continue;
+	    if(!started){
+		/* the leading digit is positive */
+		mpres_set(P0->x, iP[D[j] >> 1]->x, n);
+		mpres_set(P0->y, iP[D[j] >> 1]->y, n);
+		mpres_set(P0->z, iP[D[j] >> 1]->z, n);
+		mpres_set(P0->t, iP[D[j] >> 1]->t, n);
+		started = 1;
+	    }
+	    else if(D[j] > 0)
+		twisted_edwards_plus(P0, P0, iP[D[j] >> 1], E, n, 1);
+	    else{
+		twisted_edwards_negate_ext(iP[(-D[j]) >> 1], n);
+		twisted_edwards_plus(P0, P0, iP[(-D[j]) >> 1], E, n, 1);
+		twisted_edwards_negate_ext(iP[(-D[j]) >> 1], n);
+	    }
+	}
+	if(lo == 0)
+	    break;
+	len = EDWARDS_NAF_BLOCK;
+    }
+    free(D);
+
+    twisted_edwards_project(Q, P0, n);
+    edwards_point_clear(P0, n);
+    for(i = 0; i < k; i++)
+	edwards_point_clear(iP[i], n);
+    return 1;
+}
+
+/* INPUT: x^3+A*x^2+x = g, so that (x, 1) is on g*y^2 = x^3+A*x^2+x.
+   OUTPUT: the isomorphic curve a*x^2+y^2 = 1+d*x^2*y^2 with a = (A+2)*g and
+   d = (A-2)*g in E, and the image [x*(x+1):(x-1)*g:(x+1)*g] of (x, 1)
+   in P, without any inverse.
+*/
+void
+montgomery_to_twisted_edwards(ell_curve_t E, ell_point_t P, mpres_t x,
+			      mpres_t A, mpmod_t n)
+{
+    mpres_t g;
+
+    mpres_init(g, n);
+    mpres_add(g, x, A, n);
+    mpres_mul(g, g, x, n);
+    mpres_add_ui(g, g, 1, n);
+    mpres_mul(g, g, x, n);
+    mpres_add_ui(E->a4, A, 2, n);
+    mpres_mul(E->a4, E->a4, g, n);
+    mpres_sub_ui(E->a6, A, 2, n);
+    mpres_mul(E->a6, E->a6, g, n);
+    mpres_add_ui(P->z, x, 1, n);
+    mpres_sub_ui(P->y, x, 1, n);
+    mpres_mul(P->x, x, P->z, n);
+    mpres_mul(P->y, P->y, g, n);
+    mpres_mul(P->z, P->z, g, n);
+    mpres_clear(g, n);
+}
+
+/* INPUT: [X:Y:Z] on a twisted Edwards curve from
+   montgomery_to_twisted_edwards.
+   OUTPUT: x <- (Z+Y)/(Z-Y), the x-coordinate on the Montgomery curve.
+   Return value: ECM_FACTOR_FOUND_STEP1 with the factor in f if Z*(Z-Y) is
+   not invertible, ECM_NO_FACTOR_FOUND otherwise. Z-Y = 0 mod p when the
+   point is zero mod p, and Z = 0 mod p when the addition law was not
+   complete mod p, which also happens for a point of smooth order.
+*/
+int
+twisted_edwards_to_montgomery(mpz_t f, mpres_t x, mpres_t y, mpres_t z,
+			      mpmod_t n)
+{
+    mpres_t tmp;
+    int ret = ECM_NO_FACTOR_FOUND;
+
+    mpres_init(tmp, n);
+    mpres_sub(tmp, z, y, n);
+    mpres_mul(tmp, tmp, z, n);
+    mpres_add(x, z, y, n);
+    mpres_mul(x, x, z, n);
+    if(mpres_invert(y, tmp, n) == 0){
+	mpres_gcd(f, tmp, n);
+	ret = ECM_FACTOR_FOUND_STEP1;
+    }
+    else
+	mpres_mul(x, x, y, n);
+    mpres_clear(tmp, n);
+    return ret;
+}
+
+/******************** batched inversions ********************/
+
+/* Computes inv[i] = 1/x[i] using only one inversion, a la Montgomery.
+   If takeit[i] != 1, do not compute 1/x[i] (it is probably 0, or irrelevant).
+   We should have inv != x.
+   x[nx] is a buffer.
+   When a factor is found, the i s.t. x[i] is not invertible are looked for
+   and the corresponding values of takeit put to 2.
+*/
+int
+compute_all_inverses(mpz_t f, mpres_t *inv, mpres_t *x, int nx, mpmod_t n, char *takeit)
+{
+    int i;
+
+#if 0
+    /* plain version, to debug the architecture */
+    for(i = 0; i < nx; i++){
+	if(takeit[i] != 1)
+	    continue;
+	if(!mpres_invert(inv[i], x[i], n)){
+	    mpres_gcd(inv[0], x[i], n); // FIXME!!
+#if DEBUG_ADD_LAWS >= 1
+	    gmp_printf ("Factor[%d]: %Zd\n", i, inv[0]);
+#endif
+	    return 0;
+	}
+    }
+#else
+    /* Montgomery's trick */
+    for(i = 0; i < nx; i++){
+	if(takeit[i] != 1){
+	    if(i == 0)
+		mpres_set_ui(inv[i], 1, n);
+	    else
+		mpres_set(inv[i], inv[i-1], n);
+	}
+	else{
+	    if(i == 0)
+		mpres_set(inv[i], x[i], n);
+	    else
+		mpres_mul(inv[i], inv[i-1], x[i], n);
+	}
+    }
+    /* invert */
+    if(!mpres_invert(x[nx], inv[nx-1], n)){
+	mpres_gcd(f, inv[nx-1], n);
+#if DEBUG_ADD_LAWS >= 1
+	gmp_printf ("Factor[%d]: %Zd\n", i, f);
+#endif
+	/* identifying the x[i]'s */
+	for(i = 0; i < nx; i++){
+	    if(takeit[i] != 1)
+		continue;
+	    mpres_gcd(f, x[i], n);
+	    if(mpz_cmp_ui(f, 1) != 0){
+		outputf (OUTPUT_VERBOSE, "# x[%d] not invertible: %Zd\n", i, f);
+		/* ONE DAY: if x[nx] != inv[0], we have another factor! */
+		takeit[i] = 2;
+	    }
+	}
+	return 0;
+    }
+    /* get inverses back */
+    /* say inv = 1/(x1*x2*x3) */
+    for(i = nx-1; i > 0; i--)
+	if(takeit[i] == 1){
+	    mpres_mul(inv[i], x[nx], inv[i-1], n); /* 1/x3 = inv * (x1*x2) */
+	    mpres_mul(x[nx], x[nx], x[i], n); /* inv = 1/(x1*x2) */
+	}
+    mpres_set(inv[0], x[nx], n);
+#endif
+#if DEBUG_ADD_LAWS >= 1
+    /*    printf("# checking inverses\n"); */
+    mpres_t tmp;
+    mpres_init(tmp, n);
+    for(i = 0; i < nx; i++){
+	mpres_mul(tmp, inv[i], x[i], n);
+	mpres_get_z(tmp, tmp, n);
+	if(mpz_cmp_ui(tmp, 1) != 0)
+	    printf("ERROR in compute_all_inverses[%d]\n", i);
+    }
+    mpres_clear(tmp, n);
+#endif
+    return 1;
+}
+
 /******************** generic ec's ********************/
 
 void
@@ -860,7 +1329,8 @@ ell_point_init(ell_point_t P, ell_curve_t E, mpmod_t n)
 	mpres_set_ui(P->z, 1, n);
     }
     else if(E->type == ECM_EC_TYPE_HESSIAN 
-	    || E->type == ECM_EC_TYPE_TWISTED_HESSIAN)
+	    || E->type == ECM_EC_TYPE_TWISTED_HESSIAN
+	    || E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
 	mpres_set_ui(P->z, 1, n);
 }
 
@@ -883,13 +1353,14 @@ ell_point_print(ell_point_t P, ell_curve_t E, mpmod_t n)
 	hessian_print(P, E, n);
     else if(E->type == ECM_EC_TYPE_TWISTED_HESSIAN)
 	twisted_hessian_print(P, E, n);
+    else if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
+	pt_w_print(P->x, P->y, P->z, E, n);
 }
 #endif
 
-/* TODO: should depend on E->type... */
 void
 ell_point_set(ell_point_t Q, ell_point_t P,
-	     ATTRIBUTE_UNUSED ell_curve_t E, ATTRIBUTE_UNUSED mpmod_t n)
+	      ATTRIBUTE_UNUSED ell_curve_t E, ATTRIBUTE_UNUSED mpmod_t n)
 {
     mpres_set(Q->x, P->x, n);
     mpres_set(Q->y, P->y, n);
@@ -977,6 +1448,11 @@ ell_curve_print(ell_curve_t E, mpmod_t n)
 	printf("d:="); print_mpz_from_mpres(E->a6, n); printf(";\n");
 	printf("E:=[a, d];\n");
     }
+    else if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS){
+	printf("a:="); print_mpz_from_mpres(E->a4, n); printf(";\n");
+	printf("d:="); print_mpz_from_mpres(E->a6, n); printf(";\n");
+	printf("E:=[a, d];\n");
+    }
 }
 #endif
 
@@ -990,6 +1466,8 @@ ell_point_is_zero(ell_point_t P, ell_curve_t E, mpmod_t n)
 	return hessian_is_zero(P, E, n);
     else if(E->type == ECM_EC_TYPE_TWISTED_HESSIAN)
 	return twisted_hessian_is_zero(P, E, n);
+    else if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
+	return twisted_edwards_is_zero(P, E, n);
     return ECM_ERROR;
 }
 
@@ -1002,6 +1480,8 @@ ell_point_set_to_zero(ell_point_t P, ell_curve_t E, mpmod_t n)
 	hessian_set_to_zero(P, E, n);
     else if(E->type == ECM_EC_TYPE_TWISTED_HESSIAN)
 	twisted_hessian_set_to_zero(P, E, n);
+    else if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
+	twisted_edwards_set_to_zero(P, E, n);
 }
 
 int
@@ -1138,6 +1618,8 @@ ell_point_add(mpz_t f, ell_point_t R, ell_point_t P, ell_point_t Q, ell_curve_t
 	return hessian_add(R, P, Q, E, n);
     else if(E->type == ECM_EC_TYPE_TWISTED_HESSIAN)
 	return twisted_hessian_add(R, P, Q, E, n);
+    else if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
+	return twisted_edwards_add(R, P, Q, E, n);
     else
 	return ECM_ERROR;
 }
@@ -1154,6 +1636,8 @@ ell_point_sub(mpz_t f, ell_point_t R, ell_point_t P, ell_point_t Q, ell_curve_t
 	return hessian_sub(R, P, Q, E, n);
     else if(E->type == ECM_EC_TYPE_TWISTED_HESSIAN)
 	return twisted_hessian_sub(R, P, Q, E, n);
+    else if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
+	return twisted_edwards_sub(R, P, Q, E, n);
     else
 	return ECM_ERROR;
 }
@@ -1172,6 +1656,8 @@ ell_point_duplicate(mpz_t f, ell_point_t R, ell_point_t P, ell_curve_t E, mpmod_
 	return hessian_duplicate(R, P, E, n);
     else if(E->type == ECM_EC_TYPE_TWISTED_HESSIAN)
 	return twisted_hessian_duplicate(R, P, E, n);
+    else if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
+	return twisted_edwards_double(R, P, E, n);
     else
 	return ECM_ERROR;
 }
@@ -1199,6 +1685,8 @@ ell_point_negate(ell_point_t P, ell_curve_t E, mpmod_t n)
 		mpres_neg(P->y, P->y, n);
 	    }
 	}
+	else if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
+	    twisted_edwards_negate(P, E, n);
 #if USE_ADD_SUB_CHAINS > 0
 	else if(E->type == ECM_EC_TYPE_HESSIAN)
 	    hessian_negate(P, E, n);
@@ -1296,6 +1784,8 @@ ell_point_mul_plain_end:
 int
 ell_point_mul(mpz_t f, ell_point_t Q, mpz_t e, ell_point_t P, ell_curve_t E, mpmod_t n)
 {
+    if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS && mpz_cmp_ui(e, 1) > 0)
+	return twisted_edwards_mul(Q, e, P, E, n);
 #if 1 /* keeping it simple */
     return ell_point_mul_plain(f, Q, e, P, E, n);
 #else
@@ -14,12 +14,16 @@ void pt_neg(ell_point_t P, mpmod_t n);
 int hessian_to_weierstrass(mpz_t f, mpres_t x, mpres_t y, mpres_t D, mpmod_t n);
 int
 twisted_hessian_to_weierstrass(mpz_t f, mpres_t x, mpres_t y, mpres_t c, mpres_t d, mpmod_t n);
+void montgomery_to_twisted_edwards(ell_curve_t E, ell_point_t P, mpres_t x, mpres_t A, mpmod_t n);
+int twisted_edwards_to_montgomery(mpz_t f, mpres_t x, mpres_t y, mpres_t z, mpmod_t n);
 
 size_t build_MO_chain(short *S, size_t Slen, mpz_t e, int w);
 size_t build_add_sub_chain(short *S, size_t Slen, mpz_t e, int w);
 int compute_s_4_add_sub(mpz_t s, ecm_uint B1, int disc);
 
 int mult_by_3(mpz_t f, mpres_t x, mpres_t y, mpres_t A, mpmod_t n);
+int compute_all_inverses(mpz_t f, mpres_t *inv, mpres_t *x, int nx, mpmod_t n,
+			 char *takeit);
 void ell_point_init(ell_point_t P, ell_curve_t E, mpmod_t n);
 void ell_point_clear(ell_point_t P, ATTRIBUTE_UNUSED ell_curve_t E, mpmod_t n);
 void ell_point_print(ell_point_t P, ell_curve_t E, mpmod_t n);
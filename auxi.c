@@ -125,7 +125,7 @@ int
 process_newfactor (mpz_t g, int result, mpcandi_t *n, int method, 
                    int returncode, int gpu, unsigned int *cnt, 
                    int *resume_wasPrp, mpz_t resume_lastfac, 
-                   FILE *resumefile, int verbose, int deep)
+                   int resuming, int verbose, int deep)
 {
   int factor_is_prime = 0;
         /* If a factor was found, indicate whether factor, cofactor are */
@@ -192,7 +192,7 @@ process_newfactor (mpz_t g, int result, mpcandi_t *n, int method,
           printf ("\n");
         }
       
-      if (resumefile != NULL)
+      if (resuming)
         {
           /* If we are resuming from a save file, add factor to the
              discovered factors for the current number */
@@ -23,6 +23,8 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 /* need stdio.h and stdarg.h for gmp.h to declare gmp_vfprintf */
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 #include <gmp.h>
 #include "ecm-impl.h"
 
@@ -37,6 +39,10 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 # endif
 #endif
 
+#ifdef HAVE_SYS_STATVFS_H
+# include <sys/statvfs.h>
+#endif
+
 #ifdef HAVE_LIMITS_H
 # include <limits.h>
 #else
@@ -54,8 +60,41 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #endif
 #endif
 
-#define VERBOSE __ECM(verbose)
-static int VERBOSE = OUTPUT_NORMAL;
+/* The default context of each thread, and the one set by ecm_ctx_set.
+   Without thread-local storage, they are threadprivate for the OpenMP
+   threads, and shared by other threads. */
+#ifdef ECM_THREAD_LOCAL
+static ECM_THREAD_LOCAL struct __ecm_ctx_struct ecm_ctx_default =
+  {.verbose = OUTPUT_NORMAL};
+static ECM_THREAD_LOCAL ecm_ctx_t ecm_ctx_current = NULL;
+#else
+static struct __ecm_ctx_struct ecm_ctx_default = {.verbose = OUTPUT_NORMAL};
+static ecm_ctx_t ecm_ctx_current = NULL;
+#ifdef _OPENMP
+#pragma omp threadprivate (ecm_ctx_default, ecm_ctx_current)
+#endif
+#endif
+
+#define VERBOSE (ECM_CTX->verbose)
+
+/* Return the current context of the calling thread */
+ecm_ctx_t
+ecm_ctx_get (void)
+{
+  return (ecm_ctx_current != NULL) ? ecm_ctx_current : &ecm_ctx_default;
+}
+
+/* Make ctx the current context of the calling thread (its default one if
+   ctx is NULL), and return the previous one, to be given back to
+   ecm_ctx_set when done */
+ecm_ctx_t
+ecm_ctx_set (ecm_ctx_t ctx)
+{
+  ecm_ctx_t old = ecm_ctx_current;
+
+  ecm_ctx_current = ctx;
+  return old;
+}
 
 void 
 mpz_add_si (mpz_t r, mpz_t s, long i)
@@ -269,7 +308,6 @@ writechkfile (char *chkfilename, int method, double p, mpmod_t modulus,
   fclose (chkfile);
 }
 
-#if 0 /* currently unused (only used in listz_handle.c, currently inactive) */
 int 
 aux_fseek64(FILE *f, const int64_t offset, const int whence)
 {
@@ -282,7 +320,44 @@ aux_fseek64(FILE *f, const int64_t offset, const int whence)
   ASSERT_ALWAYS (offset <= LONG_MAX);
   return fseek (f, (long) offset, whence);
 }
+
+/* Return the number of bytes available to an unprivileged user in the 
+   file system that holds files named stem.*, or SIZE_MAX if we can't
+   tell. */
+size_t
+ecm_disk_free (const char *stem)
+{
+#if defined(HAVE_STATVFS) && defined(HAVE_SYS_STATVFS_H)
+  struct statvfs buf;
+  char *dir;
+  const char *slash;
+  size_t len;
+  double avail;
+
+  slash = strrchr (stem, '/');
+  len = (slash == NULL) ? 1 : (size_t) (slash - stem) + 1;
+  dir = (char *) malloc (len + 1);
+  if (dir == NULL)
+    return SIZE_MAX;
+  if (slash == NULL)
+    strcpy (dir, ".");
+  else
+    {
+      strncpy (dir, stem, len);
+      dir[len] = '\0';
+    }
+  if (statvfs (dir, &buf) != 0)
+    {
+      free (dir);
+      return SIZE_MAX;
+    }
+  free (dir);
+  avail = (double) buf.f_bavail * (double) buf.f_frsize;
+  return (avail >= (double) SIZE_MAX) ? SIZE_MAX : (size_t) avail;
+#else
+  return SIZE_MAX;
 #endif
+}
 
 int
 ecm_tstbit (mpz_srcptr u, ecm_uint bit_index)
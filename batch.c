@@ -30,6 +30,12 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 */
 
 #include <stdlib.h>
+#include <string.h> /* for memcmp */
+#include <math.h> /* for sqrt */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "ecm-gmp.h"
 #include "ecm-impl.h"
 #include "getprime_r.h"
 
@@ -51,60 +57,84 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #define MAX_B1_BATCH 50685770166ULL
 #endif
 
+/* The primes are cut into ranges of at most COMPUTE_S_MAX_SPAN integers,
+   so that their table stays small, and at least COMPUTE_S_MIN_SPAN, so that
+   small values of B1 do not pay for the product tree. */
+#define COMPUTE_S_MIN_SPAN 65536
+#define COMPUTE_S_MAX_SPAN 16777216
+
 /* If forbiddenres != NULL, forbiddenres = "m r_1 ... r_k -1" indicating that
    if p = r_i mod m, then p^2 should be considered instead of p. This has
    only a sense for CM curves. We assume r_1 < r_2 < ... < r_k.
    Typical example: "4 3 -1" for curves Y^2 = X^3 + a * X.
+
+   Returns the power of the prime p in the batch exponent for B1, which is
+   1 if p > B1.
 */
-void
-compute_s (mpz_t s, ecm_uint B1, int *forbiddenres ATTRIBUTE_UNUSED)
+static ecm_uint
+prime_power (ecm_uint p, ecm_uint B1, int *forbiddenres ATTRIBUTE_UNUSED)
+{
+  ecm_uint pp, qi, maxpp;
+
+  if (p > B1)
+    return 1;
+
+  pp = qi = p;
+  maxpp = B1 / qi;
+#ifdef HAVE_ADDLAWS
+  if (forbiddenres != NULL && p > 2)
+    {
+      /* non splitting primes can occur in even powers only */
+      int rp = (int)(p % forbiddenres[0]);
+      unsigned int j;
+      for (j = 1; forbiddenres[j] >= 0; j++)
+        if (rp >= forbiddenres[j])
+          break;
+      if (rp == forbiddenres[j])
+        {
+          /* printf("p=%lu is forbidden\n", p); */
+          if (qi > maxpp)
+            return 1; /* qi is too large */
+          /* qi <= B1/qi => qi^2 <= B1, let it go */
+          qi *= qi;
+        }
+    }
+#endif
+  while (pp <= maxpp)
+      pp *= qi;
+
+  return pp;
+}
+
+/* Sets s to the product of prime_power (p, B1) / prime_power (p, B0) over
+   the primes lo <= p < hi. */
+static void
+compute_s_range (mpz_t s, ecm_uint lo, ecm_uint hi, ecm_uint B0, ecm_uint B1,
+                 int *forbiddenres)
 {
   mpz_t acc[MAX_HEIGHT]; /* To accumulate products of prime powers */
   mpz_t ppz;
   unsigned int i, j;
-  ecm_uint pi = 2, pp, maxpp, qi;
-  prime_info_t prime_info;
+  ecm_uint *primes, n, k, pp;
 
-  prime_info_init (prime_info);
-
-  ASSERT_ALWAYS (B1 <= MAX_B1_BATCH);
+  primes = getprimes_range (lo, hi, &n);
+  if (primes == NULL)
+    {
+      fprintf (stderr, "Cannot allocate memory in compute_s\n");
+      exit (EXIT_FAILURE);
+    }
 
   for (j = 0; j < MAX_HEIGHT; j++)
     mpz_init (acc[j]); /* sets acc[j] to 0 */
   mpz_init (ppz);
 
   i = 0;
-  while (pi <= B1)
+  for (k = 0; k < n; k++)
     {
-      pp = qi = pi;
-      maxpp = B1 / qi;
-#ifdef HAVE_ADDLAWS
-      if (forbiddenres != NULL && pi > 2)
-        {
-          /* non splitting primes can occur in even powers only */
-          int rp = (int)(pi % forbiddenres[0]);
-          for (j = 1; forbiddenres[j] >= 0; j++)
-            if (rp >= forbiddenres[j])
-              break;
-          if (rp == forbiddenres[j])
-            {
-              /* printf("p=%lu is forbidden\n", pi); */
-              if (qi <= maxpp)
-                {
-                  /* qi <= B1/qi => qi^2 <= B1, let it go */
-                  qi *= qi;
-                }
-              else
-                {
-                  /* qi is too large, do not increment i */
-                  pi = getprime_mt (prime_info);
-                  continue;
-                }
-            }
-        }
-#endif
-      while (pp <= maxpp)
-          pp *= qi;
+      pp = prime_power (primes[k], B1, forbiddenres)
+        / prime_power (primes[k], B0, forbiddenres);
+      if (pp == 1) /* do not increment i */
+        continue;
 
 #if ECM_UINT_MAX == 4294967295
       mpz_set_ui (ppz, pp);
@@ -135,19 +165,197 @@ compute_s (mpz_t s, ecm_uint B1, int *forbiddenres ATTRIBUTE_UNUSED)
         }
 
       i++;
-      pi = getprime_mt (prime_info);
     }
 
-  for (mpz_set (s, acc[0]), j = 1; mpz_cmp_ui (acc[j], 0) != 0; j++)
-    mpz_mul (s, s, acc[j]);
+  if (i == 0)
+    mpz_set_ui (s, 1);
+  else
+    for (mpz_set (s, acc[0]), j = 1; mpz_cmp_ui (acc[j], 0) != 0; j++)
+      mpz_mul (s, s, acc[j]);
 
-  prime_info_clear (prime_info); /* free the prime tables */
+  free (primes);
   
   for (i = 0; i < MAX_HEIGHT; i++)
     mpz_clear (acc[i]);
   mpz_clear (ppz);
 }
 
+/* Same as compute_s_range, but the interval is cut into pieces, whose
+   products are computed in parallel with OpenMP and multiplied together
+   with a balanced product tree. */
+static void
+compute_s_tree (mpz_t s, ecm_uint lo, ecm_uint hi, ecm_uint B0, ecm_uint B1,
+                int *forbiddenres)
+{
+  ecm_uint span;
+  long i, m, npieces;
+  int nthreads = 1;
+  mpz_t *t;
+
+  if (lo >= hi)
+    {
+      mpz_set_ui (s, 1);
+      return;
+    }
+
+#ifdef _OPENMP
+  nthreads = omp_get_max_threads ();
+#endif
+  span = (hi - lo - 1) / (4 * nthreads) + 1;
+  if (span < COMPUTE_S_MIN_SPAN)
+    span = COMPUTE_S_MIN_SPAN;
+  if (span > COMPUTE_S_MAX_SPAN)
+    span = COMPUTE_S_MAX_SPAN;
+  npieces = (long) ((hi - lo - 1) / span + 1);
+
+  t = (mpz_t *) malloc (npieces * sizeof (mpz_t));
+  if (t == NULL)
+    {
+      fprintf (stderr, "Cannot allocate memory in compute_s\n");
+      exit (EXIT_FAILURE);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (npieces > 1)
+#endif
+  for (i = 0; i < npieces; i++)
+    {
+      ecm_uint a = lo + (ecm_uint) i * span;
+      ecm_uint b = (hi - a > span) ? a + span : hi;
+
+      mpz_init (t[i]);
+      compute_s_range (t[i], a, b, B0, B1, forbiddenres);
+    }
+
+  for (m = 1; m < npieces; m *= 2)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (npieces > 4 * m)
+#endif
+      for (i = 0; i < npieces - m; i += 2 * m)
+        {
+          mpz_mul (t[i], t[i], t[i + m]);
+          mpz_clear (t[i + m]);
+        }
+    }
+
+  mpz_swap (s, t[0]);
+  mpz_clear (t[0]);
+  free (t);
+}
+
+/* Sets s to the product of the prime powers p^e <= B1 (see prime_power). */
+void
+compute_s (mpz_t s, ecm_uint B1, int *forbiddenres)
+{
+  ASSERT_ALWAYS (B1 <= MAX_B1_BATCH);
+
+  compute_s_tree (s, 2, B1 + 1, 0, B1, forbiddenres);
+}
+
+/* Assuming s is the batch exponent for B1old <= B1, multiplies it by the
+   missing prime powers to get the one for B1. Only the primes up to
+   sqrt(B1), whose powers may increase, and the primes in ]B1old, B1] are
+   considered. */
+void
+compute_s_extend (mpz_t s, ecm_uint B1old, ecm_uint B1, int *forbiddenres)
+{
+  ecm_uint r;
+  mpz_t t;
+
+  ASSERT_ALWAYS (B1 <= MAX_B1_BATCH);
+  ASSERT_ALWAYS (B1old <= B1);
+
+  /* r = floor(sqrt(B1)) */
+  for (r = (ecm_uint) sqrt ((double) B1); r * r > B1; r--);
+  for ( ; (r + 1) * (r + 1) <= B1; r++);
+
+  mpz_init (t);
+  compute_s_tree (t, 2, MIN (r, B1old) + 1, B1old, B1, forbiddenres);
+  mpz_mul (s, s, t);
+  compute_s_tree (t, B1old + 1, B1 + 1, B1old, B1, forbiddenres);
+  mpz_mul (s, s, t);
+  mpz_clear (t);
+}
+
+/* The key of the cache file of the batch exponent for B1 and param */
+static void
+batch_s_key (uint64_t *key, double B1, int param)
+{
+  memset (key, 0, CACHEFILE_KEYS * sizeof (uint64_t));
+  key[0] = (uint64_t) B1;
+  key[1] = (uint64_t) (int64_t) param;
+}
+
+/* Writes s, the batch exponent for B1 with parametrization param, to the
+   cache file fn. Returns 0 on success, 1 on error. */
+int
+batch_s_write (const char *fn, mpz_t s, double B1, int param)
+{
+  uint64_t key[CACHEFILE_KEYS];
+
+  batch_s_key (key, B1, param);
+  return cachefile_write (fn, CACHEFILE_BATCH_S, key, PTR(s),
+                          mpz_size (s) * sizeof (mp_limb_t));
+}
+
+/* Reads the batch exponent for B1 and param from the cache file fn into s.
+   Returns 0 on success, -1 if fn is not a cache file of a batch exponent,
+   1 if it is one for another B1 or param, 2 if it cannot be read. */
+int
+batch_s_read (mpz_t s, const char *fn, double B1, int param)
+{
+  uint64_t key[CACHEFILE_KEYS], filekey[CACHEFILE_KEYS];
+  mp_limb_t *data;
+  size_t size, n;
+
+  batch_s_key (key, B1, param);
+  if (cachefile_key (fn, CACHEFILE_BATCH_S, filekey) != 0)
+    return -1;
+  if (memcmp (key, filekey, sizeof (key)) != 0)
+    return 1;
+  data = (mp_limb_t *) cachefile_map (fn, CACHEFILE_BATCH_S, key, &size);
+  if (data == NULL)
+    return 2;
+  n = size / sizeof (mp_limb_t);
+  if (n == 0 || data[n - 1] == 0)
+    {
+      cachefile_unmap (data, size);
+      return 2;
+    }
+  /* s is modified by compute_s_extend, thus the limbs are copied */
+  mpz_realloc2 (s, n * GMP_NUMB_BITS);
+  memcpy (PTR(s), data, n * sizeof (mp_limb_t));
+  SIZ(s) = n;
+  cachefile_unmap (data, size);
+  return 0;
+}
+
+/* Sets s to the batch exponent for B1 and param, where s is the one for
+   *last_B1, and sets *last_B1 to B1. The exponent is read from the cache
+   directory if it holds it, otherwise it is extended from s when
+   *last_B1 < B1, or computed, and written to the cache directory. */
+void
+batch_s_update (mpz_t s, double B1, double *last_B1, int param)
+{
+  char *fn;
+
+  fn = cachefile_name ("s-%.0f-%d", B1, param);
+  if (fn != NULL && batch_s_read (s, fn, B1, param) == 0)
+    outputf (OUTPUT_VERBOSE, "Read batch product from %s\n", fn);
+  else
+    {
+      if (mpz_cmp_ui (s, 1) > 0 && *last_B1 >= 2.0 && *last_B1 < B1)
+        compute_s_extend (s, (ecm_uint) *last_B1, (ecm_uint) B1, NULL);
+      else
+        compute_s (s, (ecm_uint) B1, NULL);
+      if (fn != NULL && batch_s_write (fn, s, B1, param) != 0)
+        outputf (OUTPUT_ERROR, "Could not write batch product to %s\n", fn);
+    }
+  free (fn);
+  *last_B1 = B1;
+}
+
 #if 0
 /* this function is useful in debug mode to print non-normalized residues */
 static void
@@ -0,0 +1,618 @@
+/* batchsimd.c - multi-curve batch stage 1 of ECM on the CPU
+
+Copyright 2022 Paul Zimmermann, Alexander Kruppa, Cyril Bouvier.
+
+This file is part of the ECM Library.
+
+The ECM Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The ECM Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the ECM Library; see the file COPYING.LIB.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* This is the CPU counterpart of the GPU code in cudawrapper.c: with
+   param = ECM_PARAM_BATCH_32BITS_D, all curves sigma = firstsigma + i share
+   the same starting point (2:1), the same exponent s and therefore the same
+   ladder, and only differ in the 32-bit value sigma (d = sigma/2^32 mod N).
+
+   We thus run the Montgomery ladder of batch.c on a group of curves at once.
+   Residues are stored "limb-sliced": limb j of the residue of lane l is at
+   index j*lanes+l, so that each vector instruction works on the same limb
+   of several curves. Limbs have 28 bits and are stored in 64-bit words,
+   so that products (32x32->64 bit multiplies, which exist on all vector
+   instruction sets) can be accumulated without carry propagation.
+   The arithmetic is in batchsimd_impl.h, which is compiled for AVX-512
+   (16 lanes), AVX2 (8 lanes) when the compiler supports it, and in
+   portable C (4 lanes); the version matching the CPU is chosen at run time.
+
+   Residues are kept in Montgomery form with R = 2^(28*L), where L is chosen
+   such that 4N < R, which allows lazy reduction: all values stay in [0, 2N)
+   without final subtractions after the products. */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "ecm-impl.h"
+
+#ifdef HAVE_X86_TARGET_ATTRIBUTE
+#include <immintrin.h>
+#endif
+
+#define TWO32 4294967296 /* 2^32 */
+
+#define BS_LIMB_BITS 28
+#define BS_LIMB_MASK ((UINT64_C(1) << BS_LIMB_BITS) - 1)
+
+/* maximal number of limbs of the modulus (thus N < 2^1062), and of lanes */
+#define BATCH_SIMD_MAX_LIMBS 38
+#define BATCH_SIMD_MAX_LANES 16
+
+typedef struct
+{
+  unsigned int L;                     /* number of limbs */
+  uint64_t N[BATCH_SIMD_MAX_LIMBS];   /* the modulus */
+  uint64_t N2[BATCH_SIMD_MAX_LIMBS];  /* 2*N */
+  uint64_t Nprim;                     /* -1/N mod 2^BS_LIMB_BITS */
+} batch_simd_mod_t;
+
+typedef void (*ladder_func_t) (uint64_t *, uint64_t *, uint64_t *, uint64_t *,
+                               const uint64_t *, const batch_simd_mod_t *,
+                               mpz_t);
+
+#if defined(__GNUC__)
+#define BS_ALWAYS_INLINE __attribute__ ((always_inline))
+#else
+#define BS_ALWAYS_INLINE
+#endif
+
+/* portable code, with 4 lanes of one word */
+#define BS_FN(name) name ## _generic
+#define BS_INLINE static inline BS_ALWAYS_INLINE
+#define BS_ATTR static
+#define BS_VEC uint64_t
+#define BS_VL 1
+#define BS_NV 4
+#define BS_LOAD(p) (*(p))
+#define BS_STORE(p, x) (*(p) = (x))
+#define BS_SET1(x) ((uint64_t) (x))
+#define BS_ZERO ((uint64_t) 0)
+#define BS_ADD(x, y) ((x) + (y))
+#define BS_SUB(x, y) ((x) - (y))
+#define BS_MUL32(x, y) ((uint64_t) (uint32_t) (x) * (uint32_t) (y))
+#define BS_AND(x, y) ((x) & (y))
+#define BS_ANDNOT(x, y) (~(x) & (y))
+#define BS_OR(x, y) ((x) | (y))
+#define BS_SRLI(x, k) ((x) >> (k))
+#define BS_SLLI(x, k) ((x) << (k))
+#include "batchsimd_impl.h"
+#undef BS_FN
+#undef BS_INLINE
+#undef BS_ATTR
+#undef BS_VEC
+#undef BS_VL
+#undef BS_NV
+#undef BS_LOAD
+#undef BS_STORE
+#undef BS_SET1
+#undef BS_ZERO
+#undef BS_ADD
+#undef BS_SUB
+#undef BS_MUL32
+#undef BS_AND
+#undef BS_ANDNOT
+#undef BS_OR
+#undef BS_SRLI
+#undef BS_SLLI
+
+#ifdef HAVE_X86_TARGET_ATTRIBUTE
+/* AVX2, with 2 vectors of 4 lanes */
+#define BS_FN(name) name ## _avx2
+#define BS_INLINE static inline BS_ALWAYS_INLINE __attribute__ ((target ("avx2")))
+#define BS_ATTR static __attribute__ ((target ("avx2")))
+#define BS_VEC __m256i
+#define BS_VL 4
+#define BS_NV 2
+#define BS_LOAD(p) _mm256_loadu_si256 ((const __m256i *) (p))
+#define BS_STORE(p, x) _mm256_storeu_si256 ((__m256i *) (p), x)
+#define BS_SET1(x) _mm256_set1_epi64x ((long long) (x))
+#define BS_ZERO _mm256_setzero_si256 ()
+#define BS_ADD(x, y) _mm256_add_epi64 (x, y)
+#define BS_SUB(x, y) _mm256_sub_epi64 (x, y)
+#define BS_MUL32(x, y) _mm256_mul_epu32 (x, y)
+#define BS_AND(x, y) _mm256_and_si256 (x, y)
+#define BS_ANDNOT(x, y) _mm256_andnot_si256 (x, y)
+#define BS_OR(x, y) _mm256_or_si256 (x, y)
+#define BS_SRLI(x, k) _mm256_srli_epi64 (x, k)
+#define BS_SLLI(x, k) _mm256_slli_epi64 (x, k)
+#include "batchsimd_impl.h"
+#undef BS_FN
+#undef BS_INLINE
+#undef BS_ATTR
+#undef BS_VEC
+#undef BS_VL
+#undef BS_NV
+#undef BS_LOAD
+#undef BS_STORE
+#undef BS_SET1
+#undef BS_ZERO
+#undef BS_ADD
+#undef BS_SUB
+#undef BS_MUL32
+#undef BS_AND
+#undef BS_ANDNOT
+#undef BS_OR
+#undef BS_SRLI
+#undef BS_SLLI
+
+/* AVX-512, with 2 vectors of 8 lanes */
+#define BS_FN(name) name ## _avx512
+#define BS_INLINE static inline BS_ALWAYS_INLINE __attribute__ ((target ("avx512f")))
+#define BS_ATTR static __attribute__ ((target ("avx512f")))
+#define BS_VEC __m512i
+#define BS_VL 8
+#define BS_NV 2
+#define BS_LOAD(p) _mm512_loadu_si512 ((const void *) (p))
+#define BS_STORE(p, x) _mm512_storeu_si512 ((void *) (p), x)
+#define BS_SET1(x) _mm512_set1_epi64 ((long long) (x))
+#define BS_ZERO _mm512_setzero_si512 ()
+#define BS_ADD(x, y) _mm512_add_epi64 (x, y)
+#define BS_SUB(x, y) _mm512_sub_epi64 (x, y)
+#define BS_MUL32(x, y) _mm512_mul_epu32 (x, y)
+#define BS_AND(x, y) _mm512_and_si512 (x, y)
+#define BS_ANDNOT(x, y) _mm512_andnot_si512 (x, y)
+#define BS_OR(x, y) _mm512_or_si512 (x, y)
+#define BS_SRLI(x, k) _mm512_srli_epi64 (x, k)
+#define BS_SLLI(x, k) _mm512_slli_epi64 (x, k)
+#include "batchsimd_impl.h"
+#undef BS_FN
+#undef BS_INLINE
+#undef BS_ATTR
+#undef BS_VEC
+#undef BS_VL
+#undef BS_NV
+#undef BS_LOAD
+#undef BS_STORE
+#undef BS_SET1
+#undef BS_ZERO
+#undef BS_ADD
+#undef BS_SUB
+#undef BS_MUL32
+#undef BS_AND
+#undef BS_ANDNOT
+#undef BS_OR
+#undef BS_SRLI
+#undef BS_SLLI
+#endif /* HAVE_X86_TARGET_ATTRIBUTE */
+
+/* Return the number of lanes to use on this CPU, and set *ladder to the
+   corresponding ladder function */
+static unsigned int
+batch_simd_select (ladder_func_t *ladder)
+{
+#ifdef HAVE_X86_TARGET_ATTRIBUTE
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx512f"))
+    {
+      *ladder = ladder_avx512;
+      return 16;
+    }
+  if (__builtin_cpu_supports ("avx2"))
+    {
+      *ladder = ladder_avx2;
+      return 8;
+    }
+#endif
+  *ladder = ladder_generic;
+  return 4;
+}
+
+/* Return non-zero if N can be used by ecm_stage1_batch_simd, otherwise
+   print an error message and return 0 */
+static int
+batch_simd_check (mpz_t N)
+{
+  if (mpz_sizeinbase (N, 2) + 2 > BS_LIMB_BITS * BATCH_SIMD_MAX_LIMBS
+      || mpz_even_p (N))
+    {
+      outputf (OUTPUT_ERROR, "Error, multi-curve stage 1 needs an odd input"
+               " number < 2^%u\n", BS_LIMB_BITS * BATCH_SIMD_MAX_LIMBS - 2);
+      return 0;
+    }
+  return 1;
+}
+
+/* Store a*R mod N, with 0 <= a < N, in lane l of r */
+static void
+lane_set_mont (uint64_t *r, unsigned int l, unsigned int lanes, const mpz_t a,
+               const mpz_t N, const batch_simd_mod_t *m, mpz_t t)
+{
+  uint64_t limbs[BATCH_SIMD_MAX_LIMBS];
+  size_t j, count;
+
+  mpz_mul_2exp (t, a, BS_LIMB_BITS * m->L);
+  mpz_mod (t, t, N);
+  mpz_export (limbs, &count, -1, sizeof (uint64_t), 0,
+              64 - BS_LIMB_BITS, t);
+  for (j = 0; j < m->L; j++)
+    r[j * lanes + l] = (j < count) ? limbs[j] : 0;
+}
+
+/* Set r to a/R mod N, where a is stored in lane l of a, and Rinv = 1/R */
+static void
+lane_get_mont (mpz_t r, const uint64_t *a, unsigned int l, unsigned int lanes,
+               const mpz_t N, const batch_simd_mod_t *m, const mpz_t Rinv)
+{
+  uint64_t limbs[BATCH_SIMD_MAX_LIMBS];
+  unsigned int j;
+
+  for (j = 0; j < m->L; j++)
+    limbs[j] = a[j * lanes + l];
+  mpz_import (r, m->L, -1, sizeof (uint64_t), 0, 64 - BS_LIMB_BITS, limbs);
+  mpz_mul (r, r, Rinv);
+  mpz_mod (r, r, N);
+}
+
+/* Try to reduce all composite factors to primes.
+ * This can be hard if factors overlap e.g. (a*b, a*c*d, b*c)
+ */
+void
+reducefactors (mpz_t *factors, int *array_found, unsigned int nb_curves)
+{
+  unsigned int i, j;
+  unsigned int found;
+  unsigned int updates;
+  mpz_t gcd;
+  mpz_init (gcd);
+
+  found = 0;
+  mpz_t *reduced = (mpz_t *) malloc (nb_curves * sizeof (mpz_t));
+  ASSERT_ALWAYS (reduced != NULL);
+
+  /* Add all unique factors to reduced */
+  for (i = 0; i < nb_curves; i++)
+    {
+      if (array_found[i] == ECM_NO_FACTOR_FOUND)
+        continue;
+
+      /* Scan for match */
+      updates = 0;
+      for (j = 0; j < found; j++) {
+          if (mpz_cmp (factors[i], reduced[j]) == 0) {
+              updates = 1;
+              break;
+          }
+      }
+      if (!updates)
+          mpz_init_set (reduced[found++], factors[i]);
+    }
+
+  do {
+    outputf (OUTPUT_DEVVERBOSE, "Reducing %d factors\n", found);
+    updates = 0;
+
+    /* remove any trivial factor */
+    for (i = 0; i < found; i++)
+      {
+        while (mpz_cmp_ui (reduced[i], 1) == 0) {
+          found--;
+          mpz_swap (reduced[i], reduced[found]);
+          mpz_clear (reduced[found]);
+          if (i == found)
+              break;
+        }
+      }
+
+    for (i = 0; i < found; i++)
+      {
+        /* Try to reduce an existing factor */
+        for (j = i+1; j < found; j++)
+          {
+            /* if i == j remove reduced[j] */
+            if (mpz_cmp (reduced[i], reduced[j]) == 0)
+              {
+                  updates += 1;
+                  found--;
+                  mpz_swap (reduced[j], reduced[found]);
+                  mpz_clear (reduced[found]);
+                  if (j == found)
+                      break;
+              }
+
+            mpz_gcd (gcd, reduced[i], reduced[j]);
+            if (mpz_cmp_ui (gcd, 1) > 0)
+              {
+                /* gcd(2*3, 2*3*5) remove 2*3 from F2 leaving 2*3 and 5 */
+                if (mpz_cmp (gcd, reduced[i]) == 0)
+                  {
+                    updates += 1;
+                    ASSERT (mpz_divisible_p (reduced[j], gcd));
+                    mpz_divexact (reduced[j], reduced[j], gcd);
+                  }
+                /* gcd(2*3*5, 2*3) == 2*3 from F1 leaving 5 and 2*3 */
+                else if (mpz_cmp (gcd, reduced[j]) == 0)
+                  {
+                    updates += 1;
+                    ASSERT (mpz_divisible_p (reduced[i], gcd));
+                    mpz_divexact (reduced[i], reduced[i], gcd);
+                  }
+
+                /* hard case gcd(2*3, 3*5) = 3, remove 3 from both, add 3 as new factor */
+                else if (found < nb_curves)
+                  {
+                    updates += 1;
+                    mpz_divexact (reduced[j], reduced[j], gcd);
+                    mpz_divexact (reduced[i], reduced[i], gcd);
+
+                    mpz_init (reduced[found]);
+                    mpz_set (reduced[found], gcd);
+                    found++;
+                  }
+              }
+            if (mpz_cmp_ui (reduced[i], 1) == 0)
+                break;
+          }
+      }
+  } while (updates > 0);
+
+  /* bubble_sort, fast enough because found < num_curves */
+  do {
+    updates = 0;
+    for (j = 1; j < found; j++)
+      {
+        if (mpz_cmp(reduced[j-1], reduced[j]) > 0)
+          {
+            updates += 1;
+            mpz_swap(reduced[j-1], reduced[j]);
+          }
+      }
+  } while (updates > 0);
+
+  outputf (OUTPUT_DEVVERBOSE, "Reduced to %d factors\n", found);
+  /* write out reduced[i], update array_found */
+  for (i = 0; i < found; i++)
+    {
+      mpz_swap(factors[i], reduced[i]);
+      mpz_clear(reduced[i]);
+      array_found[i] = ECM_FACTOR_FOUND_STEP1;
+      outputf (OUTPUT_DEVVERBOSE, "Reduced factor %d: %Zd\n", i+1, factors[i]);
+    }
+
+  for (i = found; i < nb_curves; i++)
+    array_found[i] = ECM_NO_FACTOR_FOUND;
+
+  mpz_clear (gcd);
+  free(reduced);
+}
+
+
+/* A = 4d-2 with d = sigma/2^32 mod n, for param = ECM_PARAM_BATCH_32BITS_D */
+void
+A_from_sigma (mpz_t A, unsigned int sigma, mpz_t n)
+{
+  mpz_t tmp;
+  int i;
+  mpz_init_set_ui (tmp, sigma);
+  /* Compute d = sigma/2^32 */
+  for (i = 0; i < 32; i++)
+    {
+      if (mpz_tstbit (tmp, 0) == 1)
+      mpz_add (tmp, tmp, n);
+      mpz_div_2exp (tmp, tmp, 1);
+    }
+  mpz_mul_2exp (tmp, tmp, 2);           /* 4d */
+  mpz_sub_ui (tmp, tmp, 2);             /* 4d-2 */
+
+  mpz_set (A, tmp);
+
+  mpz_clear (tmp);
+}
+
+/* Run stage 1 on curves firstsigma, ..., firstsigma + nb_curves - 1 with
+   param = ECM_PARAM_BATCH_32BITS_D, starting from (x:z) = (2:1), with the
+   exponent s.
+   Output: if array_found[i] = ECM_NO_FACTOR_FOUND, factors[i] contains the
+           x-coordinate of the stage 1 residue of curve i (with z normalized
+           to 1), i.e., the same values cgbn_ecm_stage1 returns for the GPU;
+           otherwise array_found[i] = ECM_FACTOR_FOUND_STEP1 and factors[i]
+           is a non-trivial divisor of N (possibly N itself).
+   Return value: ECM_ERROR if N is too large (or even),
+           ECM_FACTOR_FOUND_STEP1 if a factor was found on some curve,
+           ECM_NO_FACTOR_FOUND otherwise. */
+int
+ecm_stage1_batch_simd (mpz_t *factors, int *array_found, mpz_t N, mpz_t s,
+                       unsigned int nb_curves, unsigned int firstsigma)
+{
+  batch_simd_mod_t m[1];
+  ladder_func_t ladder;
+  unsigned int lanes, i, j;
+  size_t count;
+  int youpi = ECM_NO_FACTOR_FOUND;
+  mpz_t t, Rinv, inv2_32;
+
+  if (!batch_simd_check (N))
+    return ECM_ERROR;
+  ASSERT_ALWAYS ((uint64_t) firstsigma + nb_curves <= TWO32);
+
+  /* the smallest L such that 4N < R = 2^(28L) */
+  m->L = (mpz_sizeinbase (N, 2) + 2 + BS_LIMB_BITS - 1) / BS_LIMB_BITS;
+  mpz_init (t);
+  mpz_export (m->N, &count, -1, sizeof (uint64_t), 0, 64 - BS_LIMB_BITS, N);
+  for (j = count; j < m->L; j++)
+    m->N[j] = 0;
+  mpz_mul_2exp (t, N, 1);
+  mpz_export (m->N2, &count, -1, sizeof (uint64_t), 0, 64 - BS_LIMB_BITS, t);
+  for (j = count; j < m->L; j++)
+    m->N2[j] = 0;
+  m->Nprim = m->N[0];   /* 3 correct bits */
+  for (j = 0; j < 5; j++) /* Newton iteration for 1/N mod 2^64 */
+    m->Nprim *= 2 - m->N[0] * m->Nprim;
+  m->Nprim = (-m->Nprim) & BS_LIMB_MASK;
+
+  mpz_init_set_ui (Rinv, 1);
+  mpz_mul_2exp (Rinv, Rinv, BS_LIMB_BITS * m->L);
+  mpz_invert (Rinv, Rinv, N);
+  mpz_init_set_ui (inv2_32, 1);
+  mpz_mul_2exp (inv2_32, inv2_32, 32);
+  mpz_invert (inv2_32, inv2_32, N);
+
+  lanes = batch_simd_select (&ladder);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (i = 0; i < nb_curves; i += lanes)
+    {
+      uint64_t x1[BATCH_SIMD_MAX_LIMBS * BATCH_SIMD_MAX_LANES];
+      uint64_t z1[BATCH_SIMD_MAX_LIMBS * BATCH_SIMD_MAX_LANES];
+      uint64_t x2[BATCH_SIMD_MAX_LIMBS * BATCH_SIMD_MAX_LANES];
+      uint64_t z2[BATCH_SIMD_MAX_LIMBS * BATCH_SIMD_MAX_LANES];
+      uint64_t sigma[BATCH_SIMD_MAX_LANES];
+      mpz_t u, v, tmp;
+      unsigned int l;
+
+      mpz_init (u);
+      mpz_init (v);
+      mpz_init (tmp);
+
+      /* the last group is padded with copies of the last curve */
+      for (l = 0; l < lanes; l++)
+        sigma[l] = firstsigma + ((i + l < nb_curves) ? i + l : nb_curves - 1);
+
+      for (l = 0; l < lanes; l++)
+        {
+          /* P1 <- P = (2:1) */
+          mpz_set_ui (u, 2);
+          lane_set_mont (x1, l, lanes, u, N, m, tmp);
+          mpz_set_ui (u, 1);
+          lane_set_mont (z1, l, lanes, u, N, m, tmp);
+          /* P2 <- 2P = (9 : 64d+8) with d = sigma/2^32 */
+          mpz_set_ui (u, 9);
+          lane_set_mont (x2, l, lanes, u, N, m, tmp);
+          mpz_mul_ui (u, inv2_32, (unsigned long) sigma[l]);
+          mpz_mul_2exp (u, u, 6);
+          mpz_add_ui (u, u, 8);
+          mpz_mod (u, u, N);
+          lane_set_mont (z2, l, lanes, u, N, m, tmp);
+        }
+
+      ladder (x1, z1, x2, z2, sigma, m, s);
+
+      for (l = 0; l < lanes && i + l < nb_curves; l++)
+        {
+          lane_get_mont (u, x1, l, lanes, N, m, Rinv);
+          lane_get_mont (v, z1, l, lanes, N, m, Rinv);
+          if (mpz_invert (tmp, v, N))
+            {
+              mpz_mul (u, u, tmp);
+              mpz_mod (factors[i + l], u, N);
+              array_found[i + l] = ECM_NO_FACTOR_FOUND;
+            }
+          else
+            {
+              mpz_gcd (factors[i + l], v, N);
+              array_found[i + l] = ECM_FACTOR_FOUND_STEP1;
+            }
+        }
+
+      mpz_clear (u);
+      mpz_clear (v);
+      mpz_clear (tmp);
+    }
+
+  for (i = 0; i < nb_curves; i++)
+    if (array_found[i] != ECM_NO_FACTOR_FOUND)
+      youpi = ECM_FACTOR_FOUND_STEP1;
+
+  mpz_clear (t);
+  mpz_clear (Rinv);
+  mpz_clear (inv2_32);
+  return youpi;
+}
+
+/* The stage 1 backend of cpu_batch_ecm for ecm_pipeline */
+static int
+batch_simd_stage1 (void *data ATTRIBUTE_UNUSED, mpz_t *factors,
+                   int *array_found, mpz_t N, mpz_t s, unsigned int nb_curves,
+                   unsigned int firstsigma)
+{
+  return ecm_stage1_batch_simd (factors, array_found, N, s, nb_curves,
+                                firstsigma);
+}
+
+/* The report of batch_simd_stage1 for ecm_batch_curves */
+static long
+batch_simd_report (stage1_backend_t *backend ATTRIBUTE_UNUSED,
+                   mpz_t *factors, int *array_found, unsigned int nb_curves,
+                   unsigned int firstsigma, long time1)
+{
+  unsigned int i;
+
+  for (i = 0; i < nb_curves; i++)
+    if (array_found[i] == ECM_FACTOR_FOUND_STEP1)
+      outputf (OUTPUT_NORMAL, "Factor %Zd found in Step 1 with curve %u "
+               "(-sigma %d:%u)\n", factors[i], i, ECM_PARAM_BATCH_32BITS_D,
+               firstsigma + i);
+  outputf (OUTPUT_NORMAL, "Computing %u Step 1 took %ldms\n", nb_curves,
+           time1);
+  if (time1 > 0)
+    outputf (OUTPUT_VERBOSE, "Throughput: %.3f curves per second per thread ",
+             1000.0 * (double) nb_curves / (double) time1);
+  outputf (OUTPUT_VERBOSE, "(on average %.2fms per Step 1)\n",
+           (double) time1 / (double) nb_curves);
+  return time1;
+}
+
+/* Same as gpu_ecm (see cudawrapper.c), but with stage 1 done on the CPU by
+   ecm_stage1_batch_simd, on *nb_curves curves of param
+   ECM_PARAM_BATCH_32BITS_D with sigma = firstsigma, ..., firstsigma +
+   *nb_curves - 1. On output, x contains the stage 1 residues as
+   x = x0 + x1 * 2^bits + ... and f the factors found as f = f0 + f1*n + ...
+   where bits is the number of bits of n. */
+int
+cpu_batch_ecm (mpz_t f, mpz_t x, int param, mpz_t firstsigma, mpz_t n,
+               mpz_t go, double *B1done, double B1, mpz_t B2min_parm,
+               mpz_t B2_parm, unsigned long k, const int S, int verbose,
+               int repr, int nobase2step2, int use_ntt, int sigma_is_A,
+               FILE *os, FILE* es, char *TreeFilename, double maxmem,
+               int (*stop_asap)(void), mpz_t batch_s,
+               double *batch_last_B1_used, unsigned int *nb_curves)
+{
+  stage1_backend_t backend;
+  ladder_func_t ladder;
+
+  ASSERT (*nb_curves > 0);
+
+  /* Set global VERBOSE to avoid the need to explicitly passing verbose */
+  set_verbose (verbose);
+  ECM_STDOUT = (os == NULL) ? stdout : os;
+  ECM_STDERR = (es == NULL) ? stdout : es;
+
+  if (!batch_simd_check (n))
+    return ECM_ERROR;
+
+  /* one chunk of the pipeline is one group of lanes */
+  backend.stage1 = batch_simd_stage1;
+  backend.data = NULL;
+  backend.chunk = batch_simd_select (&ladder);
+  backend.concurrent = 1;
+  backend.init = NULL;
+  backend.report = batch_simd_report;
+  backend.name = "";
+  outputf (OUTPUT_VERBOSE, "Multi-curve stage 1 with %u lanes of %u-bit "
+           "residues\n", backend.chunk, BS_LIMB_BITS * (unsigned int)
+           ((mpz_sizeinbase (n, 2) + 2 + BS_LIMB_BITS - 1) / BS_LIMB_BITS));
+
+  return ecm_batch_curves (f, x, param, firstsigma, n, go, B1done, B1,
+                           B2min_parm, B2_parm, k, S, verbose, repr,
+                           nobase2step2, use_ntt, sigma_is_A, TreeFilename,
+                           maxmem, stop_asap, batch_s, batch_last_B1_used,
+                           nb_curves, &backend);
+}
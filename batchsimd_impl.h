@@ -0,0 +1,339 @@
+/* batchsimd_impl.h - lane-parallel arithmetic for batchsimd.c
+
+Copyright 2022 Paul Zimmermann, Alexander Kruppa, Cyril Bouvier.
+
+This file is part of the ECM Library.
+
+The ECM Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The ECM Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the ECM Library; see the file COPYING.LIB.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* This file is included several times by batchsimd.c, once for each
+   vector instruction set. Before inclusion, the following must be defined:
+   BS_FN(name)   name of the function for this instruction set
+   BS_INLINE     qualifiers of the inner functions (always inlined)
+   BS_ATTR       qualifiers of the ladder function
+   BS_VEC        the vector type, with BS_VL lanes of 64 bits
+   BS_NV         the number of vectors per group, thus a group has
+                 BS_NV * BS_VL lanes
+   and the vector operations BS_LOAD, BS_STORE, BS_SET1, BS_ZERO, BS_ADD,
+   BS_SUB, BS_MUL32 (product of the low 32 bits of each lane), BS_AND,
+   BS_ANDNOT (~x & y), BS_OR, BS_SRLI, BS_SLLI (shifts by a constant).
+
+   A residue is an array of L limbs of BS_LIMB_BITS bits for each lane,
+   limb j of lane l being at index j * lanes + l. */
+
+#define BS_LANES (BS_NV * BS_VL)
+#define BS_PTR(p, j, v) ((p) + (j) * BS_LANES + (v) * BS_VL)
+
+/* r <- s - 2N if s >= 2N, otherwise r <- s, for normalized s < 4N.
+   r and s may be equal. */
+BS_INLINE void
+BS_FN(csub) (uint64_t *r, const uint64_t *s, const batch_simd_mod_t *m)
+{
+  BS_VEC d[BATCH_SIMD_MAX_LIMBS][BS_NV], br[BS_NV], x, mask;
+  const BS_VEC M = BS_SET1 (BS_LIMB_MASK), bias = BS_SET1 (BS_LIMB_MASK + 1);
+  const BS_VEC one = BS_SET1 (1);
+  unsigned int j, v;
+
+  for (v = 0; v < BS_NV; v++)
+    br[v] = BS_ZERO;
+  for (j = 0; j < m->L; j++)
+    for (v = 0; v < BS_NV; v++)
+      {
+        /* 2^k + s[j] - 2N[j] - borrow is in [1, 2^(k+1)) */
+        x = BS_SUB (BS_ADD (BS_LOAD (BS_PTR (s, j, v)), bias),
+                    BS_ADD (BS_SET1 (m->N2[j]), br[v]));
+        d[j][v] = BS_AND (x, M);
+        br[v] = BS_SUB (one, BS_SRLI (x, BS_LIMB_BITS));
+      }
+  for (v = 0; v < BS_NV; v++)
+    {
+      mask = BS_SUB (br[v], one); /* all ones iff no borrow, i.e., s >= 2N */
+      for (j = 0; j < m->L; j++)
+        BS_STORE (BS_PTR (r, j, v),
+                  BS_OR (BS_AND (mask, d[j][v]),
+                         BS_ANDNOT (mask, BS_LOAD (BS_PTR (s, j, v)))));
+    }
+}
+
+/* r <- a + b, with 0 <= a, b < 2N, and 0 <= r < 2N */
+BS_INLINE void
+BS_FN(add) (uint64_t *r, const uint64_t *a, const uint64_t *b,
+            const batch_simd_mod_t *m)
+{
+  uint64_t s[BATCH_SIMD_MAX_LIMBS * BS_LANES];
+  BS_VEC cy[BS_NV], x;
+  const BS_VEC M = BS_SET1 (BS_LIMB_MASK);
+  unsigned int j, v;
+
+  for (v = 0; v < BS_NV; v++)
+    cy[v] = BS_ZERO;
+  /* since 4N < R, there is no carry out */
+  for (j = 0; j < m->L; j++)
+    for (v = 0; v < BS_NV; v++)
+      {
+        x = BS_ADD (BS_ADD (BS_LOAD (BS_PTR (a, j, v)),
+                            BS_LOAD (BS_PTR (b, j, v))), cy[v]);
+        BS_STORE (BS_PTR (s, j, v), BS_AND (x, M));
+        cy[v] = BS_SRLI (x, BS_LIMB_BITS);
+      }
+  BS_FN(csub) (r, s, m);
+}
+
+/* r <- a - b, with 0 <= a, b < 2N, and 0 <= r < 2N */
+BS_INLINE void
+BS_FN(sub) (uint64_t *r, const uint64_t *a, const uint64_t *b,
+            const batch_simd_mod_t *m)
+{
+  BS_VEC d[BATCH_SIMD_MAX_LIMBS][BS_NV], br[BS_NV], cy[BS_NV], x;
+  const BS_VEC M = BS_SET1 (BS_LIMB_MASK), bias = BS_SET1 (BS_LIMB_MASK + 1);
+  const BS_VEC one = BS_SET1 (1);
+  unsigned int j, v;
+
+  for (v = 0; v < BS_NV; v++)
+    br[v] = cy[v] = BS_ZERO;
+  for (j = 0; j < m->L; j++)
+    for (v = 0; v < BS_NV; v++)
+      {
+        x = BS_SUB (BS_ADD (BS_LOAD (BS_PTR (a, j, v)), bias),
+                    BS_ADD (BS_LOAD (BS_PTR (b, j, v)), br[v]));
+        d[j][v] = BS_AND (x, M);
+        br[v] = BS_SUB (one, BS_SRLI (x, BS_LIMB_BITS));
+      }
+  /* add back 2N where a - b was negative */
+  for (v = 0; v < BS_NV; v++)
+    br[v] = BS_SUB (BS_ZERO, br[v]);
+  for (j = 0; j < m->L; j++)
+    for (v = 0; v < BS_NV; v++)
+      {
+        x = BS_ADD (BS_ADD (d[j][v], BS_AND (BS_SET1 (m->N2[j]), br[v])),
+                    cy[v]);
+        BS_STORE (BS_PTR (r, j, v), BS_AND (x, M));
+        cy[v] = BS_SRLI (x, BS_LIMB_BITS);
+      }
+}
+
+/* r <- a * b / R mod N, with 0 <= a, b < 2N, and 0 <= r < 2N.
+   We use product scanning: column s accumulates all a[j]*b[s-j] and
+   q[s-j]*N[j] without carry propagation, which is possible since the
+   limbs have only BS_LIMB_BITS bits. r may be equal to a or b. */
+BS_INLINE void
+BS_FN(mulredc) (uint64_t *r, const uint64_t *a, const uint64_t *b,
+                const batch_simd_mod_t *m)
+{
+  BS_VEC q[BATCH_SIMD_MAX_LIMBS][BS_NV], acc[BS_NV], x[BS_NV], y[BS_NV], Nj;
+  BS_VEC res[BATCH_SIMD_MAX_LIMBS][BS_NV];
+  const BS_VEC M = BS_SET1 (BS_LIMB_MASK), Nprim = BS_SET1 (m->Nprim);
+  const BS_VEC N0 = BS_SET1 (m->N[0]);
+  const unsigned int L = m->L;
+  unsigned int s, j, v;
+
+  for (v = 0; v < BS_NV; v++)
+    acc[v] = BS_ZERO;
+
+  for (s = 0; s < L; s++)
+    {
+      for (v = 0; v < BS_NV; v++)
+        {
+          x[v] = acc[v];
+          y[v] = BS_ZERO;
+        }
+      for (j = 0; j <= s; j++)
+        for (v = 0; v < BS_NV; v++)
+          x[v] = BS_ADD (x[v], BS_MUL32 (BS_LOAD (BS_PTR (a, j, v)),
+                                         BS_LOAD (BS_PTR (b, s - j, v))));
+      for (j = 1; j <= s; j++)
+        {
+          Nj = BS_SET1 (m->N[j]);
+          for (v = 0; v < BS_NV; v++)
+            y[v] = BS_ADD (y[v], BS_MUL32 (q[s - j][v], Nj));
+        }
+      for (v = 0; v < BS_NV; v++)
+        {
+          x[v] = BS_ADD (x[v], y[v]);
+          q[s][v] = BS_AND (BS_MUL32 (BS_AND (x[v], M), Nprim), M);
+          x[v] = BS_ADD (x[v], BS_MUL32 (q[s][v], N0));
+          acc[v] = BS_SRLI (x[v], BS_LIMB_BITS); /* low bits are zero */
+        }
+    }
+
+  for (s = L; s < 2 * L - 1; s++)
+    {
+      for (v = 0; v < BS_NV; v++)
+        {
+          x[v] = acc[v];
+          y[v] = BS_ZERO;
+        }
+      for (j = s - L + 1; j < L; j++)
+        {
+          Nj = BS_SET1 (m->N[j]);
+          for (v = 0; v < BS_NV; v++)
+            {
+              x[v] = BS_ADD (x[v], BS_MUL32 (BS_LOAD (BS_PTR (a, j, v)),
+                                             BS_LOAD (BS_PTR (b, s - j, v))));
+              y[v] = BS_ADD (y[v], BS_MUL32 (q[s - j][v], Nj));
+            }
+        }
+      for (v = 0; v < BS_NV; v++)
+        {
+          x[v] = BS_ADD (x[v], y[v]);
+          res[s - L][v] = BS_AND (x[v], M);
+          acc[v] = BS_SRLI (x[v], BS_LIMB_BITS);
+        }
+    }
+
+  /* since a, b < 2N and 4N < R, the result is < 2N and fits in L limbs */
+  for (v = 0; v < BS_NV; v++)
+    res[L - 1][v] = acc[v];
+  for (j = 0; j < L; j++)
+    for (v = 0; v < BS_NV; v++)
+      BS_STORE (BS_PTR (r, j, v), res[j][v]);
+}
+
+/* r <- a * sigma / 2^32 mod N, where sigma differs in each lane,
+   with 0 <= a < 2N and 0 <= r < 2N. This is the multiplication by
+   d = sigma/2^32 as in cgbn_stage1.cu. We divide by 2^32 as 2^k * 2^(32-k),
+   with intermediate results on L+1 limbs. r may be equal to a. */
+BS_INLINE void
+BS_FN(mul_d) (uint64_t *r, const uint64_t *a, const uint64_t *sigma,
+              const batch_simd_mod_t *m)
+{
+  BS_VEC u[BATCH_SIMD_MAX_LIMBS + 1][BS_NV], sig[BS_NV], cy[BS_NV], q[BS_NV];
+  BS_VEC x, Nj;
+  const BS_VEC M = BS_SET1 (BS_LIMB_MASK), Nprim = BS_SET1 (m->Nprim);
+  const BS_VEC M2 = BS_SET1 ((1 << (32 - BS_LIMB_BITS)) - 1);
+  const unsigned int L = m->L;
+  unsigned int j, v;
+
+  /* u <- a * sigma < 2N * 2^32 */
+  for (v = 0; v < BS_NV; v++)
+    {
+      sig[v] = BS_LOAD (sigma + v * BS_VL);
+      cy[v] = BS_ZERO;
+    }
+  for (j = 0; j < L; j++)
+    for (v = 0; v < BS_NV; v++)
+      {
+        x = BS_ADD (BS_MUL32 (BS_LOAD (BS_PTR (a, j, v)), sig[v]), cy[v]);
+        u[j][v] = BS_AND (x, M);
+        cy[v] = BS_SRLI (x, BS_LIMB_BITS);
+      }
+  for (v = 0; v < BS_NV; v++)
+    u[L][v] = cy[v];
+
+  /* u <- (u + q * N) / 2^k < 33N */
+  for (v = 0; v < BS_NV; v++)
+    {
+      q[v] = BS_AND (BS_MUL32 (u[0][v], Nprim), M);
+      x = BS_ADD (u[0][v], BS_MUL32 (q[v], BS_SET1 (m->N[0])));
+      cy[v] = BS_SRLI (x, BS_LIMB_BITS);
+    }
+  for (j = 1; j < L; j++)
+    {
+      Nj = BS_SET1 (m->N[j]);
+      for (v = 0; v < BS_NV; v++)
+        {
+          x = BS_ADD (BS_ADD (u[j][v], BS_MUL32 (q[v], Nj)), cy[v]);
+          u[j - 1][v] = BS_AND (x, M);
+          cy[v] = BS_SRLI (x, BS_LIMB_BITS);
+        }
+    }
+  for (v = 0; v < BS_NV; v++)
+    {
+      x = BS_ADD (u[L][v], cy[v]);
+      u[L - 1][v] = BS_AND (x, M);
+      u[L][v] = BS_SRLI (x, BS_LIMB_BITS);
+    }
+
+  /* u <- (u + q * N) / 2^(32-k) < 4N */
+  for (v = 0; v < BS_NV; v++)
+    {
+      q[v] = BS_AND (BS_MUL32 (u[0][v], Nprim), M2);
+      cy[v] = BS_ZERO;
+    }
+  for (j = 0; j < L; j++)
+    {
+      Nj = BS_SET1 (m->N[j]);
+      for (v = 0; v < BS_NV; v++)
+        {
+          x = BS_ADD (BS_ADD (u[j][v], BS_MUL32 (q[v], Nj)), cy[v]);
+          u[j][v] = BS_AND (x, M);
+          cy[v] = BS_SRLI (x, BS_LIMB_BITS);
+        }
+    }
+  for (v = 0; v < BS_NV; v++)
+    u[L][v] = BS_ADD (u[L][v], cy[v]);
+  for (j = 0; j < L; j++)
+    for (v = 0; v < BS_NV; v++)
+      BS_STORE (BS_PTR (r, j, v),
+                BS_OR (BS_SRLI (u[j][v], 32 - BS_LIMB_BITS),
+                       BS_AND (BS_SLLI (u[j + 1][v], 2 * BS_LIMB_BITS - 32),
+                               M)));
+
+  BS_FN(csub) (r, r, m);
+}
+
+/* Same as dup_add_batch1 in batch.c, on all lanes:
+   (x1:z1) <- 2(x1:z1)
+   (x2:z2) <- (x1:z1) + (x2:z2)
+   assuming (x2:z2) - (x1:z1) = (2:1). */
+BS_INLINE void
+BS_FN(dup_add) (uint64_t *x1, uint64_t *z1, uint64_t *x2, uint64_t *z2,
+                uint64_t *t, uint64_t *w, const uint64_t *sigma,
+                const batch_simd_mod_t *m)
+{
+  BS_FN(add) (w, x1, z1, m);        /* w = x1+z1 */
+  BS_FN(sub) (z1, x1, z1, m);       /* z1 = x1-z1 */
+  BS_FN(add) (x1, x2, z2, m);       /* x1 = x2+z2 */
+  BS_FN(sub) (x2, x2, z2, m);       /* x2 = x2-z2 */
+
+  BS_FN(mulredc) (z2, w, x2, m);    /* z2 = (x1+z1)(x2-z2) */
+  BS_FN(mulredc) (x2, z1, x1, m);   /* x2 = (x1-z1)(x2+z2) */
+  BS_FN(mulredc) (t, z1, z1, m);    /* t = (x1-z1)^2 */
+  BS_FN(mulredc) (z1, w, w, m);     /* z1 = (x1+z1)^2 */
+
+  BS_FN(mulredc) (x1, z1, t, m);    /* xdup = (x1+z1)^2 * (x1-z1)^2 */
+  BS_FN(sub) (w, z1, t, m);         /* w = (x1+z1)^2 - (x1-z1)^2 */
+  BS_FN(mul_d) (z1, w, sigma, m);   /* z1 = d * w */
+  BS_FN(add) (t, t, z1, m);         /* t = (x1-z1)^2 + d * w */
+  BS_FN(mulredc) (z1, w, t, m);     /* zdup = w * t */
+
+  BS_FN(add) (w, x2, z2, m);
+  BS_FN(sub) (z2, x2, z2, m);
+  BS_FN(mulredc) (x2, w, w, m);
+  BS_FN(mulredc) (w, z2, z2, m);
+  BS_FN(add) (z2, w, w, m);
+}
+
+/* Montgomery ladder over the bits of s, as in ecm_stage1_batch */
+BS_ATTR void
+BS_FN(ladder) (uint64_t *x1, uint64_t *z1, uint64_t *x2, uint64_t *z2,
+               const uint64_t *sigma, const batch_simd_mod_t *m, mpz_t s)
+{
+  uint64_t t[BATCH_SIMD_MAX_LIMBS * BS_LANES];
+  uint64_t w[BATCH_SIMD_MAX_LIMBS * BS_LANES];
+  ecm_uint i;
+
+  for (i = mpz_sizeinbase (s, 2) - 1; i-- > 0;)
+    {
+      if (ecm_tstbit (s, i) == 0) /* (j,j+1) -> (2j,2j+1) */
+        BS_FN(dup_add) (x1, z1, x2, z2, t, w, sigma, m);
+      else /* (j,j+1) -> (2j+1,2j+2) */
+        BS_FN(dup_add) (x2, z2, x1, z1, t, w, sigma, m);
+    }
+}
+
+#undef BS_LANES
+#undef BS_PTR
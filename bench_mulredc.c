@@ -22,6 +22,7 @@
 
 int tune_mul[MAXSIZE+1], tune_sqr[MAXSIZE+1], redc_n_ok[MAXSIZE+1];
 int verbose = 0;
+int adx = 0; /* non-zero if the cpu can run the MULX/ADX kernels */
 
 #include <gmp.h>
 #ifdef USE_ASM_REDC
@@ -110,6 +111,9 @@ void bench(mp_size_t N)
 #ifdef HAVE_NATIVE_MULREDC1_N
   long t3 = 0;
 #endif
+#ifdef HAVE_MULREDC_ADX
+  long t_adx_mul = 0, t_adx_sqr = 0;
+#endif
 #ifdef HAVE___GMPN_REDC_2
   long tredc_2, t_mulredc_2, t_sqrredc_2;
 #endif
@@ -597,6 +601,30 @@ void bench(mp_size_t N)
   t3 = cputime() - t3;
 #endif /* ifdef HAVE_NATIVE_MULREDC1_N */
 
+  /* The MULX/ADX kernels are not in the tuning tables: mpmod.c uses them
+     for all sizes when the cpu has BMI2 and ADX */
+#ifdef HAVE_MULREDC_ADX
+  if (adx)
+    {
+      mulredc_fn mul = mulredc_adx_table[N];
+      sqrredc_fn sqr = sqrredc_adx_table[N];
+
+      t_adx_mul = cputime();
+      for (i = 0; i < iter; ++i) {
+        mul (z, x, y, m, invm[0]);
+        x[0] += tmp[0];
+      }
+      t_adx_mul = cputime() - t_adx_mul;
+
+      t_adx_sqr = cputime();
+      for (i = 0; i < iter; ++i) {
+        sqr (z, x, m, invm[0]);
+        x[0] += tmp[0];
+      }
+      t_adx_sqr = cputime() - t_adx_sqr;
+    }
+#endif
+
   if (verbose)
     {
       fprintf (stderr, "******************\n");
@@ -671,6 +699,11 @@ void bench(mp_size_t N)
   else
     fprintf (stderr, "mul+redc_n = disabled\n");
 #endif
+#ifdef HAVE_MULREDC_ADX
+      if (adx)
+        fprintf (stderr, "mulredc_adx= %.3f\n",
+                 (double) t_adx_mul * 1e3 / (double) iter);
+#endif
 
       fprintf (stderr, "\n");
 
@@ -708,6 +741,11 @@ void bench(mp_size_t N)
   else
     fprintf (stderr, "sqr+redc_n = disabled\n");
 #endif
+#ifdef HAVE_MULREDC_ADX
+      if (adx)
+        fprintf (stderr, "sqrredc_adx= %.3f\n",
+                 (double) t_adx_sqr * 1e3 / (double) iter);
+#endif
 
 #ifdef HAVE_NATIVE_MULREDC1_N
       /* multiplication of n limbs by one limb */
@@ -732,6 +770,10 @@ main (int argc, char** argv)
   int i;
   int minsize = 1, maxsize = MAXSIZE;
 
+#ifdef HAVE_MULREDC_ADX
+  adx = mulredc_adx_available ();
+#endif
+
   if (argc >= 2 && strcmp (argv[1], "-v") == 0)
     {
       verbose = 1;
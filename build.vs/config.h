@@ -206,6 +206,9 @@
 /* How to specify hot-spot attribute, if available */
 #define ATTRIBUTE_HOT
 
+/* Define to the storage class of thread-local variables, if supported */
+#define ECM_THREAD_LOCAL __declspec(thread)
+
 #define HAVE___GMPN_REDC_1 1
 
 #define HAVE___GMPN_REDC_2 1
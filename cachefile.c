@@ -0,0 +1,360 @@
+/* cachefile.c - binary cache files for precomputed data, read with mmap.
+
+Copyright 2026 Paul Zimmermann, Alexander Kruppa.
+
+This file is part of the ECM Library.
+
+The ECM Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The ECM Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the ECM Library; see the file COPYING.LIB.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* A cache file is a header of CACHEFILE_HEADER bytes followed by the data,
+   in the byte order and word sizes of the machine that wrote it. The header
+   holds a magic string, the format version, the kind of data, the number
+   of bits of a limb, CACHEFILE_KEYS 64-bit words identifying the data (for
+   example B1 for the batch exponent), the size of the data and a checksum
+   of it. A file whose header does not match exactly what the reader
+   expects is ignored, so the data can be used in place, without parsing:
+   it is mapped with mmap when available, otherwise read into memory. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "ecm-impl.h"
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define CACHEFILE_MMAP 1
+#else
+#define CACHEFILE_MMAP 0
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h> /* getpid, close */
+#endif
+#ifdef HAVE_MKSTEMP
+#include <sys/stat.h> /* fchmod */
+#endif
+#if !defined(HAVE_MKSTEMP) && defined(_WIN32)
+#include <process.h>
+#define getpid _getpid
+#endif
+
+#define CACHEFILE_MAGIC "GMP-ECM\032"
+#define CACHEFILE_VERSION 1
+
+typedef struct
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t kind;
+  uint32_t limb_bits;
+  uint32_t unused;
+  uint64_t key[CACHEFILE_KEYS];
+  uint64_t size;       /* number of bytes of data */
+  uint64_t checksum;   /* cachefile_checksum of the data */
+} cachefile_header_t;
+
+/* The directory for the cache files (NULL if there is none), in the
+   current context. Each thread of the -t curve pool sets its own. */
+#define cachefile_dir (ECM_CTX->cachedir)
+
+void
+cachefile_set_dir (const char *dir)
+{
+  free (cachefile_dir);
+  cachefile_dir = NULL;
+  if (dir != NULL)
+    {
+      cachefile_dir = (char *) malloc (strlen (dir) + 1);
+      if (cachefile_dir != NULL)
+        strcpy (cachefile_dir, dir);
+    }
+}
+
+/* The directory set by cachefile_set_dir in the current thread */
+const char *
+cachefile_get_dir (void)
+{
+  return cachefile_dir;
+}
+
+/* Returns the name of the file in the cache directory made from format and
+   the following arguments as in printf, in a newly allocated string, or
+   NULL if there is no cache directory. */
+char *
+cachefile_name (const char *format, ...)
+{
+  va_list ap;
+  char *fn;
+  int len, dirlen;
+
+  if (cachefile_dir == NULL)
+    return NULL;
+
+  va_start (ap, format);
+  len = vsnprintf (NULL, 0, format, ap);
+  va_end (ap);
+  dirlen = strlen (cachefile_dir);
+  fn = (char *) malloc (dirlen + 1 + len + 1);
+  if (fn == NULL)
+    return NULL;
+  sprintf (fn, "%s/", cachefile_dir);
+  va_start (ap, format);
+  vsprintf (fn + dirlen + 1, format, ap);
+  va_end (ap);
+  return fn;
+}
+
+/* A checksum of the size bytes at data, which is 8-byte aligned */
+uint64_t
+cachefile_checksum (const void *data, size_t size)
+{
+  const uint64_t *w = (const uint64_t *) data;
+  uint64_t h0 = 0xcbf29ce484222325ULL, h1 = 0, t = 0;
+  size_t i, n = size / 8;
+
+  /* two independent chains, so that the multiplications overlap */
+  for (i = 0; i + 1 < n; i += 2)
+    {
+      h0 = (h0 ^ w[i]) * 0x100000001b3ULL;
+      h1 = (h1 ^ w[i + 1]) * 0x100000001b3ULL;
+    }
+  if (i < n)
+    h0 = (h0 ^ w[i]) * 0x100000001b3ULL;
+  if (size % 8 != 0)
+    {
+      memcpy (&t, w + n, size % 8);
+      h1 = (h1 ^ t) * 0x100000001b3ULL;
+    }
+  return h0 ^ (h1 + size);
+}
+
+static void
+cachefile_header_set (cachefile_header_t *h, unsigned int kind,
+                      const uint64_t *key, size_t size)
+{
+  memset (h, 0, sizeof (cachefile_header_t));
+  memcpy (h->magic, CACHEFILE_MAGIC, 8);
+  h->version = CACHEFILE_VERSION;
+  h->kind = kind;
+  h->limb_bits = 8 * sizeof (mp_limb_t);
+  memcpy (h->key, key, CACHEFILE_KEYS * sizeof (uint64_t));
+  h->size = size;
+}
+
+/* Creates a temporary file in the directory of fn, for writing, and stores
+   its name in tmp, which must have room for strlen (fn) + 40 characters.
+   Returns NULL on error. */
+static FILE *
+cachefile_tmp (char *tmp, const char *fn)
+{
+#ifdef HAVE_MKSTEMP
+  int fd;
+  FILE *file;
+
+  sprintf (tmp, "%s.XXXXXX", fn);
+  fd = mkstemp (tmp);
+  if (fd == -1)
+    return NULL;
+  /* mkstemp makes it private, but the cache directory may be shared */
+  fchmod (fd, 0644);
+  file = fdopen (fd, "wb");
+  if (file == NULL)
+    {
+      close (fd);
+      remove (tmp);
+    }
+  return file;
+#else
+  /* unique for the processes and threads writing at the same time, since
+     the threads have different stacks */
+  sprintf (tmp, "%s.%lx.%lx.tmp", fn, (unsigned long) getpid (),
+           (unsigned long) (size_t) &tmp);
+  return fopen (tmp, "wb");
+#endif
+}
+
+/* Writes the size bytes at data, of the given kind and with the given key,
+   to the cache file fn. The file is written under a temporary name in the
+   same directory and renamed at the end, so that a reader never sees an
+   incomplete file. Returns 0 on success, 1 on error. */
+int
+cachefile_write (const char *fn, unsigned int kind, const uint64_t *key,
+                 const void *data, size_t size)
+{
+  char header[CACHEFILE_HEADER], *tmp;
+  cachefile_header_t h;
+  FILE *file;
+  int ok;
+
+  ASSERT (sizeof (cachefile_header_t) <= CACHEFILE_HEADER);
+
+  tmp = (char *) malloc (strlen (fn) + 40);
+  if (tmp == NULL)
+    return 1;
+
+  cachefile_header_set (&h, kind, key, size);
+  h.checksum = cachefile_checksum (data, size);
+  memset (header, 0, CACHEFILE_HEADER);
+  memcpy (header, &h, sizeof (cachefile_header_t));
+
+  file = cachefile_tmp (tmp, fn);
+  if (file == NULL)
+    {
+      free (tmp);
+      return 1;
+    }
+  ok = fwrite (header, 1, CACHEFILE_HEADER, file) == CACHEFILE_HEADER
+    && fwrite (data, 1, size, file) == size;
+  ok = (fclose (file) == 0) && ok;
+  ok = ok && rename (tmp, fn) == 0;
+  if (!ok)
+    remove (tmp);
+  free (tmp);
+  return !ok;
+}
+
+/* Reads the header of the cache file fn into h. Returns 0 if it is a cache
+   file of the given kind written by this version on a machine like this
+   one, 1 otherwise. */
+static int
+cachefile_header_read (const char *fn, unsigned int kind,
+                       cachefile_header_t *h)
+{
+  cachefile_header_t g;
+  FILE *file;
+  size_t n;
+
+  file = fopen (fn, "rb");
+  if (file == NULL)
+    return 1;
+  n = fread (h, sizeof (cachefile_header_t), 1, file);
+  fclose (file);
+  if (n != 1)
+    return 1;
+  cachefile_header_set (&g, kind, h->key, h->size);
+  g.checksum = h->checksum;
+  return memcmp (&g, h, sizeof (cachefile_header_t)) != 0
+    || h->size != (size_t) h->size;
+}
+
+/* Sets key to the key of the cache file fn, and returns 0, if it is a cache
+   file of the given kind that cachefile_map can read. Returns 1 otherwise,
+   for example if fn was written by another program. */
+int
+cachefile_key (const char *fn, unsigned int kind, uint64_t *key)
+{
+  cachefile_header_t h;
+
+  if (cachefile_header_read (fn, kind, &h) != 0)
+    return 1;
+  memcpy (key, h.key, CACHEFILE_KEYS * sizeof (uint64_t));
+  return 0;
+}
+
+/* Maps the cache file fn, and returns a pointer to its data (aligned on 64
+   bytes) if its header matches kind and key and the checksum is right, with
+   its size in *size. Returns NULL otherwise, for example if the file does
+   not exist. The data is read-only and must be released with
+   cachefile_unmap. */
+void *
+cachefile_map (const char *fn, unsigned int kind, const uint64_t *key,
+               size_t *size)
+{
+  cachefile_header_t h;
+  char *base;
+  size_t len;
+
+  if (cachefile_header_read (fn, kind, &h) != 0)
+    return NULL;
+  if (memcmp (h.key, key, CACHEFILE_KEYS * sizeof (uint64_t)) != 0)
+    {
+      outputf (OUTPUT_VERBOSE, "Ignoring cache file %s: it is for other "
+               "parameters\n", fn);
+      return NULL;
+    }
+  len = CACHEFILE_HEADER + (size_t) h.size;
+
+#if CACHEFILE_MMAP
+  {
+    int fd = open (fn, O_RDONLY);
+    struct stat st;
+
+    if (fd < 0)
+      return NULL;
+    if (fstat (fd, &st) != 0 || (size_t) st.st_size != len)
+      {
+        close (fd);
+        return NULL;
+      }
+    base = (char *) mmap (NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close (fd);
+    if (base == (char *) MAP_FAILED)
+      return NULL;
+  }
+#else
+  {
+    char *buf;
+    FILE *file;
+
+    file = fopen (fn, "rb");
+    if (file == NULL)
+      return NULL;
+    buf = (char *) malloc (len + 64);
+    if (buf == NULL)
+      {
+        fclose (file);
+        return NULL;
+      }
+    /* base + CACHEFILE_HEADER is aligned on 64 bytes, and the pointer to
+       free is kept just before the data */
+    base = buf + (64 - (size_t) buf % 64) % 64;
+    *((char **) (base + CACHEFILE_HEADER) - 1) = buf;
+    if (fseek (file, CACHEFILE_HEADER, SEEK_SET) != 0
+        || fread (base + CACHEFILE_HEADER, 1, h.size, file) != h.size)
+      {
+        fclose (file);
+        free (buf);
+        return NULL;
+      }
+    fclose (file);
+  }
+#endif
+
+  if (cachefile_checksum (base + CACHEFILE_HEADER, h.size) != h.checksum)
+    {
+      outputf (OUTPUT_ERROR, "Ignoring cache file %s: wrong checksum\n", fn);
+      cachefile_unmap (base + CACHEFILE_HEADER, h.size);
+      return NULL;
+    }
+
+  *size = h.size;
+  return base + CACHEFILE_HEADER;
+}
+
+void
+cachefile_unmap (void *data, size_t size)
+{
+#if CACHEFILE_MMAP
+  munmap ((char *) data - CACHEFILE_HEADER, CACHEFILE_HEADER + size);
+#else
+  free (*((char **) data - 1));
+#endif
+}
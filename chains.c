@@ -0,0 +1,205 @@
+/* chains.c - tables of precomputed Lucas chains for stage 1 of ECM.
+
+Copyright 2026 Paul Zimmermann, Alexander Kruppa.
+
+This file is part of the ECM Library.
+
+The ECM Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The ECM Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the ECM Library; see the file COPYING.LIB.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* A PRAC chain for k (see prac in ecm_mont.h) is determined by k and by
+   the integer r it starts from, with k/2 < r < k and gcd(k, r) = 1. The
+   program ecmchains searches for each prime p <= B1 the r giving the
+   cheapest chain, and whether the chain for p*q with a prime q a little
+   larger than p is cheaper than the chains for p and q. It writes the
+   result to the cache file "chains-B1" (see cachefile.c), which stage 1
+   reads instead of searching a few values of r for each prime.
+
+   The data is a sequence of entries, one for each prime p >= 5 that is
+   not the larger prime of a pair, in increasing order of p, each made of
+   three numbers written with chains_put:
+     (p - p') / 2, where p' is the prime of the previous entry (3 for the
+                   first one),
+     (q - p) / 2, where q is the other prime of a pair, or 0,
+     the zigzag code of r - chains_r0 (k), where k = p or k = p*q.
+   The number of primes between p and q is less than CHAINS_WINDOW. */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ecm-impl.h"
+
+/* round(2^32 * (sqrt(5) - 1) / 2) */
+#define CHAINS_PHI 2654435769UL
+
+/* An approximation of k*(sqrt(5)-1)/2, computed with integers only so
+   that the program writing a table and the one reading it agree */
+uint64_t
+chains_r0 (uint64_t k)
+{
+  return (k >> 32) * CHAINS_PHI
+    + (((k & 0xffffffffUL) * CHAINS_PHI) >> 32);
+}
+
+/* Writes u in 7-bit groups, least significant first, with the high bit of
+   each byte set if more follow, to buf, and returns the number of bytes */
+int
+chains_put (unsigned char *buf, uint64_t u)
+{
+  int i = 0;
+
+  while (u >= 0x80)
+    {
+      buf[i++] = (unsigned char) (u | 0x80);
+      u >>= 7;
+    }
+  buf[i++] = (unsigned char) u;
+  return i;
+}
+
+/* Reads a number written by chains_put from c, stopping at end. Returns 0
+   if end was reached first. */
+static int
+chains_get (chains_t c, uint64_t *u)
+{
+  int s = 0;
+
+  *u = 0;
+  while (c->ptr < c->end && s < 64)
+    {
+      *u |= (uint64_t) (*c->ptr & 0x7f) << s;
+      if ((*c->ptr++ & 0x80) == 0)
+        return 1;
+      s += 7;
+    }
+  return 0;
+}
+
+/* Reads the next entry of c into c->p, c->q and c->r. When the data ends,
+   c->p is set to the largest possible value, so that the primes from there
+   on are not covered by the table. */
+static void
+chains_read (chains_t c)
+{
+  uint64_t g, h, z, k;
+
+  if (!chains_get (c, &g) || !chains_get (c, &h) || !chains_get (c, &z))
+    {
+      c->p = UINT64_MAX;
+      return;
+    }
+  c->p += 2 * g;
+  c->q = (h == 0) ? 0 : c->p + 2 * h;
+  k = (c->q == 0) ? c->p : c->p * c->q;
+  c->r = chains_r0 (k) + ((z & 1) ? ~(z >> 1) : (z >> 1));
+}
+
+/* Sets c to the start of the table of chains for B1 in the cache
+   directory. Returns 0 if there is one, 1 otherwise. The table is mapped
+   once, and stays mapped in the context until chains_clear_cache or until
+   another table is asked for, so that the curves with the same B1 share
+   it. */
+int
+chains_init (chains_t c, double B1)
+{
+  uint64_t key[CACHEFILE_KEYS];
+  char *fn;
+
+  memset (c, 0, sizeof (__chains_struct));
+  fn = cachefile_name ("chains-%.0f", B1);
+  if (fn == NULL)
+    return 1;
+  if (ECM_CTX->chains_file == NULL || strcmp (fn, ECM_CTX->chains_file) != 0)
+    {
+      chains_clear_cache ();
+      memset (key, 0, CACHEFILE_KEYS * sizeof (uint64_t));
+      key[0] = (uint64_t) B1;
+      ECM_CTX->chains_data = (unsigned char *)
+        cachefile_map (fn, CACHEFILE_CHAINS, key, &ECM_CTX->chains_size);
+      /* a missing table is remembered as well */
+      ECM_CTX->chains_file = fn;
+    }
+  else
+    free (fn);
+  if (ECM_CTX->chains_data == NULL)
+    return 1;
+  outputf (OUTPUT_VERBOSE, "Using Lucas chains from %s\n",
+           ECM_CTX->chains_file);
+  c->data = ECM_CTX->chains_data;
+  c->size = ECM_CTX->chains_size;
+  c->ptr = c->data;
+  c->end = c->data + c->size;
+  c->p = 3;
+  chains_read (c);
+  return 0;
+}
+
+/* The table stays mapped, see chains_clear_cache */
+void
+chains_clear (chains_t c)
+{
+  c->data = NULL;
+}
+
+/* Unmaps the table of chains of the context */
+void
+chains_clear_cache (void)
+{
+  if (ECM_CTX->chains_data != NULL)
+    cachefile_unmap ((void *) ECM_CTX->chains_data, ECM_CTX->chains_size);
+  ECM_CTX->chains_data = NULL;
+  ECM_CTX->chains_size = 0;
+  free (ECM_CTX->chains_file);
+  ECM_CTX->chains_file = NULL;
+}
+
+/* For the primes p given in increasing order, tells how to multiply by p
+   when stage 1 goes up to B1:
+   returns 0 if the table has no chain for p,
+   returns 1 if p was the larger prime of a pair, and is done already,
+   returns 2 and sets *k and *r to the chain to use, where k is p or p*q
+   with q <= B1. */
+int
+chains_next (chains_t c, uint64_t p, uint64_t B1, uint64_t *k, uint64_t *r)
+{
+  int i;
+
+  for (i = 0; i < c->npending; i++)
+    if (c->pending[i] == p)
+      {
+        c->pending[i] = c->pending[--c->npending];
+        return 1;
+      }
+
+  while (c->p < p)
+    chains_read (c);
+  if (c->p != p)
+    return 0;
+
+  *r = c->r;
+  if (c->q == 0)
+    *k = p;
+  else if (c->q <= B1 && c->npending < CHAINS_WINDOW)
+    {
+      *k = p * c->q;
+      c->pending[c->npending++] = c->q;
+    }
+  else /* the chain is for a product with a prime we do not want */
+    {
+      chains_read (c);
+      return 0;
+    }
+  chains_read (c);
+  return 2;
+}
@@ -0,0 +1,1052 @@
+/* dwt.c - multiplication modulo k*2^n+c with a floating-point FFT.
+
+Copyright 2026 Paul Zimmermann, Alexander Kruppa.
+
+This file is part of the ECM Library.
+
+The ECM Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The ECM Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the ECM Library; see the file COPYING.LIB.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* The numbers are cut into len digits, which are multiplied as polynomials
+   with a complex FFT of length m = len/2 in double precision, the digits
+   being balanced (in [-2^(b-1), 2^(b-1)] for digits of b bits) to keep the
+   round-off error small.
+
+   Modulo k*2^n+c, we use the irrational-base discrete weighted transform
+   (IBDWT) of Crandall and Fagin, with weights for k and c: digit j starts
+   at bit ceil(n*j/len) and is multiplied by the weight
+   2^(ceil(n*j/len)-n*j/len) * a^(j/len), where a = |c|/k, before the
+   transform. The cyclic (for c < 0) or negacyclic (for c > 0) convolution
+   of length len then gives the product in which the part above 2^n is
+   multiplied by -c/k instead of 2^n, which is the same modulo k*2^n+c.
+   The digits of k times this convolution are integers, so that we get
+   k*S1*S2 modulo k*2^n+c, which an exact division by k corrects. There is
+   no zero padding. For k = 1 and c = +/-1, this is the usual IBDWT modulo
+   2^n-/+1. The cyclic convolution of real inputs uses the usual packing of
+   x[2j] + i*x[2j+1] in one complex FFT of length m. The negacyclic one
+   multiplies x[j] + i*x[j+m] by exp(i*pi*j/len) (the "right-angle"
+   convolution).
+
+   The factor k, and a^2 for a > 1 or 1/a for a < 1, multiply the
+   round-off error, which costs half their log2 in bits per digit. If k and c are so large that zero padding needs a
+   shorter transform, or if they are not coprime, the digits all have the
+   same size, the numbers are zero-padded to twice their size, and the full
+   product is computed with the negacyclic convolution. The caller reduces
+   it.
+
+   When the round-off error is too large, the full product is computed
+   exactly with a number-theoretic transform modulo two primes of
+   SP_NUMB_BITS bits, with the transforms of ntt_gfp.c.
+
+   The tables depend only on k, n and c, and are shared by the plans made
+   with dwt_init_set, which have their own signals only.
+
+   The complex signals are stored as the m real parts followed by the m
+   imaginary parts, so that the passes of the FFT work on contiguous
+   arrays, which the compiler can vectorize. The forward transform is a
+   radix-4 decimation in frequency, which leaves the spectrum in
+   bit-reversed order, and the inverse one a decimation in time from that
+   order, so that no permutation is needed. */
+
+#include <stdlib.h>
+#include <math.h>
+#include "ecm-gmp.h"
+#include "ecm-impl.h"
+#include "sp.h"
+
+#define DWT_CYCLIC 0     /* modulo k*2^n+c with c < 0 */
+#define DWT_NEGACYCLIC 1 /* modulo k*2^n+c with c > 0 */
+#define DWT_PADDED 2     /* full product */
+
+/* the inputs of the weighted transforms have at most n + log2(k) +
+   DWT_HIBITS bits */
+#define DWT_HIBITS 8
+
+/* for |x| < 2^51, (x + DWT_ROUND) - DWT_ROUND rounds x to an integer */
+#define DWT_ROUND 6755399441055744.0
+
+/* added to the carries to make them non-negative before shifting */
+#define DWT_BIAS (((uint64_t) 1) << 62)
+
+/* the product is recomputed exactly when a convolution term is further
+   than this from an integer */
+#define DWT_MAXERR 0.375
+
+#define DWT_PI 3.14159265358979323846
+
+/* the transforms of up to DWT_BLOCK complex numbers are done pass after
+   pass, the larger ones recursively, so that the parts stay in the cache */
+#ifndef DWT_BLOCK
+#define DWT_BLOCK 1024
+#endif
+
+/* the iterations of the loop that follows are independent, which GCC
+   cannot prove, and needs to know to vectorize it */
+#if defined(__GNUC__) && __GNUC__ >= 5 && !defined(__clang__) && \
+  !defined(__ICC)
+#define DWT_IVDEP _Pragma ("GCC ivdep")
+#else
+#define DWT_IVDEP
+#endif
+
+/* the read-only part of a plan */
+struct __dwt_tables
+{
+  int type;
+  unsigned long n;      /* for DWT_PADDED, the maximal size of the inputs */
+  unsigned long len;    /* number of digits, a power of 2 */
+  unsigned long m;      /* len / 2, the length of the complex FFT */
+  unsigned int bits;    /* digits have bits or bits + 1 bits */
+  unsigned long k;      /* the products are done modulo k*2^n+c */
+  long c;
+  unsigned long cinv;   /* 1/c mod k, if k > 1 */
+  mpz_t M;              /* k*2^n+c */
+  unsigned long maxbits; /* the largest size of the inputs */
+  unsigned char *big;   /* big[j] = 1 if digit j has bits + 1 bits */
+  double *weight;       /* the IBDWT weights, 1 for DWT_PADDED */
+  double *iweight;      /* k divided by the weights and by m */
+  double *tw;           /* the twiddle factors of the radix-4 passes */
+  double *ra;           /* exp(i pi j / len) for DWT_NEGACYCLIC/PADDED,
+                           exp(-2 i pi k / len) for DWT_CYCLIC */
+  unsigned long *br;    /* the bit-reversal permutation, for DWT_CYCLIC */
+  spm_t spm[2];         /* the primes of the NTT, or NULL */
+  sp_t p1inv;           /* 1/spm[0]->sp mod spm[1]->sp */
+  unsigned int ntt_bits;       /* the NTT digits have ntt_bits bits */
+  spv_size_t ntt_log2_len;     /* the NTT length is 2^ntt_log2_len */
+};
+
+struct __dwt_struct
+{
+  struct __dwt_tables *tab;
+  int owner;            /* 1 if tab belongs to this plan */
+  double *a, *b;        /* the signals */
+  spv_t x;              /* the signals of the NTT, allocated when needed */
+  mpz_t t, u;           /* temporary variables */
+};
+
+/* The number of bits per digit for which a convolution of length 2^l with
+   balanced digits has a round-off error well below 1/2 */
+static unsigned int
+dwt_maxbits (unsigned int l)
+{
+  double b = (49.0 - 0.5 * (double) l - log ((double) l) / log (2.0)) / 2.0;
+
+  return (b > 24.0) ? 24 : (unsigned int) b;
+}
+
+/* The passes work on blocks of 4q complex numbers, with the real parts at
+   re and the imaginary ones at im. The twiddle factors w^j, w^(2j) and
+   w^(3j) for 0 <= j < q, where w = exp(-2 i pi/(4q)), are the 6q numbers
+   (real parts of the w^j, imaginary parts, then the same for w^(2j) and
+   w^(3j)) ending 2q numbers before tw_end - 8q, where tw_end = tw + 2m:
+   the ones for q = m/4 start at tw, those for q = m/16 follow, etc. */
+
+/* One radix-4 pass of the decimation in frequency, on the n numbers */
+static void
+dwt_dif_pass (double *re, double *im, const double *tw_end, unsigned long n,
+              unsigned long q)
+{
+  const double *w1r = tw_end - 8 * q, *w1i = w1r + q, *w2r = w1i + q,
+    *w2i = w2r + q, *w3r = w2i + q, *w3i = w3r + q;
+  double *r0, *r1, *r2, *r3, *i0, *i1, *i2, *i3;
+  double t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+  unsigned long s, j;
+
+  for (s = 0; s < n; s += 4 * q)
+    {
+      r0 = re + s;
+      r1 = r0 + q;
+      r2 = r1 + q;
+      r3 = r2 + q;
+      i0 = im + s;
+      i1 = i0 + q;
+      i2 = i1 + q;
+      i3 = i2 + q;
+      DWT_IVDEP
+      for (j = 0; j < q; j++)
+        {
+          t0r = r0[j] + r2[j];
+          t0i = i0[j] + i2[j];
+          t2r = r0[j] - r2[j];
+          t2i = i0[j] - i2[j];
+          t1r = r1[j] + r3[j];
+          t1i = i1[j] + i3[j];
+          /* t3 = (x1 - x3) * (-i) */
+          t3r = i1[j] - i3[j];
+          t3i = r3[j] - r1[j];
+          r0[j] = t0r + t1r;
+          i0[j] = t0i + t1i;
+          t0r -= t1r;
+          t0i -= t1i;
+          t1r = t2r + t3r;
+          t1i = t2i + t3i;
+          t2r -= t3r;
+          t2i -= t3i;
+          r1[j] = t0r * w2r[j] - t0i * w2i[j];
+          i1[j] = t0r * w2i[j] + t0i * w2r[j];
+          r2[j] = t1r * w1r[j] - t1i * w1i[j];
+          i2[j] = t1r * w1i[j] + t1i * w1r[j];
+          r3[j] = t2r * w3r[j] - t2i * w3i[j];
+          i3[j] = t2r * w3i[j] + t2i * w3r[j];
+        }
+    }
+}
+
+/* The inverse of dwt_dif_pass, multiplied by 4 */
+static void
+dwt_dit_pass (double *re, double *im, const double *tw_end, unsigned long n,
+              unsigned long q)
+{
+  const double *w1r = tw_end - 8 * q, *w1i = w1r + q, *w2r = w1i + q,
+    *w2i = w2r + q, *w3r = w2i + q, *w3i = w3r + q;
+  double *r0, *r1, *r2, *r3, *i0, *i1, *i2, *i3;
+  double u0r, u0i, u1r, u1i, u2r, u2i, u3r, u3i, tr, ti;
+  unsigned long s, j;
+
+  for (s = 0; s < n; s += 4 * q)
+    {
+      r0 = re + s;
+      r1 = r0 + q;
+      r2 = r1 + q;
+      r3 = r2 + q;
+      i0 = im + s;
+      i1 = i0 + q;
+      i2 = i1 + q;
+      i3 = i2 + q;
+      DWT_IVDEP
+      for (j = 0; j < q; j++)
+        {
+          /* multiply by the conjugate twiddle factors */
+          u1r = r1[j] * w2r[j] + i1[j] * w2i[j];
+          u1i = i1[j] * w2r[j] - r1[j] * w2i[j];
+          u2r = r2[j] * w1r[j] + i2[j] * w1i[j];
+          u2i = i2[j] * w1r[j] - r2[j] * w1i[j];
+          u3r = r3[j] * w3r[j] + i3[j] * w3i[j];
+          u3i = i3[j] * w3r[j] - r3[j] * w3i[j];
+          u0r = r0[j] + u1r;
+          u0i = i0[j] + u1i;
+          u1r = r0[j] - u1r;
+          u1i = i0[j] - u1i;
+          /* u3 <- (u2 - u3) * i, u2 <- u2 + u3 */
+          tr = u2r - u3r;
+          ti = u2i - u3i;
+          u2r += u3r;
+          u2i += u3i;
+          u3r = -ti;
+          u3i = tr;
+          r0[j] = u0r + u2r;
+          i0[j] = u0i + u2i;
+          r2[j] = u0r - u2r;
+          i2[j] = u0i - u2i;
+          r1[j] = u1r + u3r;
+          i1[j] = u1i + u3i;
+          r3[j] = u1r - u3r;
+          i3[j] = u1i - u3i;
+        }
+    }
+}
+
+/* The radix-2 pass on the pairs of the n numbers, which is its own inverse
+   up to a factor 2 */
+static void
+dwt_pass2 (double *re, double *im, unsigned long n)
+{
+  unsigned long s;
+  double tr, ti;
+
+  for (s = 0; s < n; s += 2)
+    {
+      tr = re[s] - re[s + 1];
+      ti = im[s] - im[s + 1];
+      re[s] += re[s + 1];
+      im[s] += im[s + 1];
+      re[s + 1] = tr;
+      im[s + 1] = ti;
+    }
+}
+
+/* Forward transform of the n complex numbers at re, im, in place, with
+   radix-4 passes and a last radix-2 pass if log2(n) is odd. The output is
+   in bit-reversed order. */
+static void
+dwt_fft_dif (double *re, double *im, const double *tw_end, unsigned long n)
+{
+  unsigned long q;
+
+  if (n > DWT_BLOCK)
+    {
+      q = n / 4;
+      dwt_dif_pass (re, im, tw_end, n, q);
+      dwt_fft_dif (re, im, tw_end, q);
+      dwt_fft_dif (re + q, im + q, tw_end, q);
+      dwt_fft_dif (re + 2 * q, im + 2 * q, tw_end, q);
+      dwt_fft_dif (re + 3 * q, im + 3 * q, tw_end, q);
+      return;
+    }
+
+  for (q = n / 4; q >= 1; q /= 4)
+    dwt_dif_pass (re, im, tw_end, n, q);
+  for (q = 1; 4 * q <= n; q *= 4);
+  if (q < n)
+    dwt_pass2 (re, im, n);
+}
+
+/* the inverse of dwt_fft_dif, multiplied by n */
+static void
+dwt_fft_dit (double *re, double *im, const double *tw_end, unsigned long n)
+{
+  unsigned long q;
+
+  if (n > DWT_BLOCK)
+    {
+      q = n / 4;
+      dwt_fft_dit (re, im, tw_end, q);
+      dwt_fft_dit (re + q, im + q, tw_end, q);
+      dwt_fft_dit (re + 2 * q, im + 2 * q, tw_end, q);
+      dwt_fft_dit (re + 3 * q, im + 3 * q, tw_end, q);
+      dwt_dit_pass (re, im, tw_end, n, q);
+      return;
+    }
+
+  for (q = 1; 4 * q <= n; q *= 4);
+  if (q < n)
+    {
+      dwt_pass2 (re, im, n);
+      q = 2;
+    }
+  else
+    q = 1;
+  for (; 4 * q <= n; q *= 4)
+    dwt_dit_pass (re, im, tw_end, n, q);
+}
+
+/* The smallest transform length for numbers of bits bits whose digits
+   have loss bits less than dwt_maxbits allows, knowing that the inputs
+   take only half of the digits if padded is non-zero, or 0 if there is
+   none. */
+static unsigned long
+dwt_choose_length (unsigned long bits, unsigned int loss, int padded)
+{
+  unsigned long l, len, p;
+
+  for (l = 2, len = 4; l < 30; l++, len *= 2)
+    {
+      p = padded ? len / 2 : len;
+      if ((bits - 1) / p + 1 + loss <= dwt_maxbits (l))
+        return len;
+    }
+  return 0;
+}
+
+/* Returns the type of the transform for products modulo k*2^n+c, and sets
+   len to its length and cinv to 1/c mod k for a weighted one, or returns
+   -1 if there is none. */
+static int
+dwt_choose (unsigned long k, unsigned long n, long c, unsigned long *len,
+            unsigned long *cinv)
+{
+  unsigned long plen, wlen = 0, bits, j;
+  unsigned int loss;
+  double a = (double) labs (c), x;
+  mpz_t t, u;
+
+  /* the inputs have at most n + log2(k) + 1 bits, plus two bits for the
+     sums and differences of residues */
+  for (bits = n + 3, j = k; j > 1; j >>= 1)
+    bits ++;
+  plen = dwt_choose_length (bits, 0, 1);
+
+  /* The round-off error of the weighted transform is multiplied by k, and
+     by a^2 if the weights go up to a = |c|/k > 1, or by 1/a if they go
+     down to a < 1, since the outputs are divided by the weights */
+  x = (a >= (double) k) ? a * a / (double) k : (double) k * (double) k / a;
+  loss = (unsigned int) ceil (log (x) / log (2.0) / 2.0);
+  *cinv = 0;
+  if (k > 1)
+    {
+      mpz_init_set_si (t, c);
+      mpz_init_set_ui (u, k);
+      if (mpz_invert (t, t, u))
+        {
+          *cinv = mpz_get_ui (t);
+          wlen = dwt_choose_length (n, loss, 0);
+        }
+      mpz_clear (t);
+      mpz_clear (u);
+    }
+  else
+    wlen = dwt_choose_length (n, loss, 0);
+
+  /* the zero-padded transform is no faster than mpz_mul, the weighted one
+     is worth it only if it is shorter */
+  if (wlen != 0 && (plen == 0 || wlen < plen))
+    {
+      *len = wlen;
+      return (c < 0) ? DWT_CYCLIC : DWT_NEGACYCLIC;
+    }
+  *len = plen;
+  return (plen != 0) ? DWT_PADDED : -1;
+}
+
+/* Chooses the primes and the size of the digits of the NTT for inputs of
+   up to T->maxbits bits. Leaves T->spm[1] = NULL if there are none. */
+static void
+dwt_ntt_init (struct __dwt_tables *T)
+{
+  unsigned long d;
+  spv_size_t len;
+  unsigned int b, l, i;
+  sp_t p;
+
+  /* a coefficient of the product is the sum of at most len/2 products of
+     digits of b bits, which must be smaller than the product of the
+     primes, which is at least 2^(2*SP_NUMB_BITS-2) */
+  for (b = MIN (SP_NUMB_BITS, GMP_NUMB_BITS) - 1; ; b--)
+    {
+      d = (T->maxbits - 1) / b + 1;
+      for (l = 1, len = 2; len < 2 * d; l++, len *= 2);
+      if (2 * b + l < 2 * SP_NUMB_BITS - 2)
+        break;
+    }
+  if (l >= NTT_GFP_MAX_LOG2_LEN)
+    return;
+  T->ntt_bits = b;
+  T->ntt_log2_len = l;
+
+  /* as in mpzspm_init, the largest primes = 1 (mod len) */
+  p = ((SP_MAX - 1) / (sp_t) len) * (sp_t) len + 1;
+  for (i = 0; i < 2; i++, p -= (sp_t) len)
+    {
+      while (p >= SP_MIN && p > (sp_t) len && !sp_prime (p))
+        p -= (sp_t) len;
+      if (p < SP_MIN || p <= (sp_t) len ||
+          (T->spm[i] = spm_init (len, p, 1)) == NULL)
+        break;
+    }
+  if (i < 2)
+    {
+      if (i == 1)
+        spm_clear (T->spm[0]);
+      T->spm[0] = NULL;
+      return;
+    }
+  /* the primes are in [2^(SP_NUMB_BITS-1), 2^SP_NUMB_BITS), so that
+     spm[0]->sp - spm[1]->sp = spm[0]->sp mod spm[1]->sp */
+  T->p1inv = sp_inv (T->spm[0]->sp - T->spm[1]->sp, T->spm[1]->sp,
+                     T->spm[1]->mul_c);
+}
+
+/* Returns the plan for products modulo k*2^n+c, or NULL if there is no
+   transform length for numbers that large. */
+dwt_t
+dwt_init (unsigned long k, unsigned long n, long c)
+{
+  dwt_t dwt;
+  struct __dwt_tables *T;
+  unsigned long j, len, m, l, p, q, r, s, cinv;
+  double *w, la;
+  int type;
+
+  type = dwt_choose (k, n, c, &len, &cinv);
+  if (type < 0)
+    return NULL;
+
+  dwt = (dwt_t) calloc (1, sizeof (struct __dwt_struct));
+  if (dwt == NULL)
+    return NULL;
+  T = (struct __dwt_tables *) calloc (1, sizeof (struct __dwt_tables));
+  if (T == NULL)
+    {
+      free (dwt);
+      return NULL;
+    }
+  dwt->tab = T;
+  dwt->owner = 1;
+  mpz_init (dwt->t);
+  mpz_init (dwt->u);
+  mpz_init_set_ui (T->M, k);
+  mpz_mul_2exp (T->M, T->M, n);
+  if (c < 0)
+    mpz_sub_ui (T->M, T->M, (unsigned long) -c);
+  else
+    mpz_add_ui (T->M, T->M, (unsigned long) c);
+
+  T->type = type;
+  T->k = k;
+  T->c = c;
+  T->cinv = cinv;
+  T->len = len;
+  T->m = m = len / 2;
+  if (type == DWT_PADDED)
+    {
+      /* all digits have the same size */
+      for (T->n = n + 3, j = k; j > 1; j >>= 1)
+        T->n ++;
+      T->maxbits = T->n;
+      T->bits = (T->n - 1) / m + 1;
+      la = 0.0;
+    }
+  else
+    {
+      T->n = n;
+      for (T->maxbits = n + DWT_HIBITS, j = k; j != 0; j >>= 1)
+        T->maxbits ++;
+      T->bits = n / len;
+      /* log2(|c|/k) */
+      la = (log ((double) labs (c)) - log ((double) k)) / log (2.0);
+    }
+
+  T->big = (unsigned char *) malloc (len);
+  T->weight = (double *) malloc (len * sizeof (double));
+  T->iweight = (double *) malloc (len * sizeof (double));
+  T->tw = (double *) malloc (2 * m * sizeof (double));
+  T->ra = (double *) malloc (2 * m * sizeof (double));
+  T->br = (unsigned long *) malloc (m * sizeof (unsigned long));
+  dwt->a = (double *) malloc (2 * m * sizeof (double));
+  dwt->b = (double *) malloc (2 * m * sizeof (double));
+  if (T->big == NULL || T->weight == NULL || T->iweight == NULL ||
+      T->tw == NULL || T->ra == NULL || T->br == NULL ||
+      dwt->a == NULL || dwt->b == NULL)
+    {
+      dwt_clear (dwt);
+      return NULL;
+    }
+
+  for (q = m / 4; q >= 1; q /= 4)
+    for (j = 0, w = T->tw + 2 * m - 8 * q; j < q; j++)
+      {
+        w[j] = cos (-2.0 * DWT_PI * (double) j / (double) (4 * q));
+        w[q + j] = sin (-2.0 * DWT_PI * (double) j / (double) (4 * q));
+        w[2 * q + j] = cos (-2.0 * DWT_PI * (double) (2 * j)
+                            / (double) (4 * q));
+        w[3 * q + j] = sin (-2.0 * DWT_PI * (double) (2 * j)
+                            / (double) (4 * q));
+        w[4 * q + j] = cos (-2.0 * DWT_PI * (double) (3 * j)
+                            / (double) (4 * q));
+        w[5 * q + j] = sin (-2.0 * DWT_PI * (double) (3 * j)
+                            / (double) (4 * q));
+      }
+
+  for (j = 0; j < m; j++)
+    {
+      if (type == DWT_CYCLIC)
+        {
+          T->ra[j] = cos (-2.0 * DWT_PI * (double) j / (double) len);
+          T->ra[m + j] = sin (-2.0 * DWT_PI * (double) j / (double) len);
+        }
+      else
+        {
+          T->ra[j] = cos (DWT_PI * (double) j / (double) len);
+          T->ra[m + j] = sin (DWT_PI * (double) j / (double) len);
+        }
+      for (p = j, q = 0, l = 1; l < m; l <<= 1, p >>= 1)
+        q = 2 * q + (p & 1);
+      T->br[j] = q;
+    }
+
+  for (j = 0, q = 0, s = 0; j < len; j++)
+    if (type == DWT_PADDED)
+      {
+        T->big[j] = 0;
+        T->weight[j] = 1.0;
+        T->iweight[j] = 1.0 / (double) m;
+      }
+    else
+      {
+        /* digit j starts at bit p = ceil(n*j/len), with r = n*j mod len,
+           and the next one at q */
+        p = q;
+        r = s;
+        s = (r + n % len) % len;
+        q = p + n / len + (r + n % len >= len) + (s != 0) - (r != 0);
+        T->big[j] = (q - p > T->bits);
+        T->weight[j] = pow (2.0, (((r == 0) ? 0.0 : (double) (len - r))
+                                  + (double) j * la) / (double) len);
+        T->iweight[j] = (double) k / (T->weight[j] * (double) m);
+      }
+
+  dwt_ntt_init (T);
+
+  return dwt;
+}
+
+/* Returns a plan for the same products as dwt, which shares its tables
+   and has its own signals, or NULL. It must be cleared before dwt. */
+dwt_t
+dwt_init_set (const dwt_t dwt)
+{
+  dwt_t r;
+  unsigned long m = dwt->tab->m;
+
+  r = (dwt_t) calloc (1, sizeof (struct __dwt_struct));
+  if (r == NULL)
+    return NULL;
+  r->tab = dwt->tab;
+  r->owner = 0;
+  mpz_init (r->t);
+  mpz_init (r->u);
+  r->a = (double *) malloc (2 * m * sizeof (double));
+  r->b = (double *) malloc (2 * m * sizeof (double));
+  if (r->a == NULL || r->b == NULL)
+    {
+      dwt_clear (r);
+      return NULL;
+    }
+
+  return r;
+}
+
+void
+dwt_clear (dwt_t dwt)
+{
+  struct __dwt_tables *T = dwt->tab;
+
+  if (dwt->owner)
+    {
+      mpz_clear (T->M);
+      free (T->big);
+      free (T->weight);
+      free (T->iweight);
+      free (T->tw);
+      free (T->ra);
+      free (T->br);
+      if (T->spm[1] != NULL)
+        {
+          spm_clear (T->spm[0]);
+          spm_clear (T->spm[1]);
+        }
+      free (T);
+    }
+  mpz_clear (dwt->t);
+  mpz_clear (dwt->u);
+  free (dwt->a);
+  free (dwt->b);
+  sp_aligned_free (dwt->x);
+  free (dwt);
+}
+
+/* the number of digits (i.e., of real numbers) of the transforms */
+unsigned long
+dwt_length (const dwt_t dwt)
+{
+  return dwt->tab->len;
+}
+
+/* Returns 1 if the products modulo k*2^n+c use a weighted transform,
+   which is then shorter than the zero-padded one, 0 otherwise */
+int
+dwt_weighted (unsigned long k, unsigned long n, long c)
+{
+  unsigned long len, cinv;
+  int type = dwt_choose (k, n, c, &len, &cinv);
+
+  return type == DWT_CYCLIC || type == DWT_NEGACYCLIC;
+}
+
+/* Puts the balanced and weighted digits of S into the signal a, and
+   transforms it. Digit j goes to a[j] (the real parts for j < m, the
+   imaginary ones otherwise), except for DWT_CYCLIC, where digit j goes to
+   a[j/2] if j is even, and a[m + (j-1)/2] if j is odd. Returns 1 if S is
+   too large. */
+static int
+dwt_forward (double *a, const mpz_t S, dwt_t dwt)
+{
+  const struct __dwt_tables *T = dwt->tab;
+  mp_srcptr sp;
+  mp_size_t sn, li;
+  unsigned long j, m = T->m, n = T->n, odd, shift, hi = 0, q;
+  unsigned int b, ab = 0;
+  mp_limb_t d, l, acc = 0;
+  long carry = 0, v, r;
+  double sgn, re;
+  const double *ra = T->ra;
+
+  if (mpz_sizeinbase (S, 2) > T->maxbits)
+    return 1;
+  sgn = (mpz_sgn (S) < 0) ? -1.0 : 1.0;
+  /* the digits take the n low bits of |S|, the rest is hi */
+  if (T->type != DWT_PADDED)
+    {
+      mpz_tdiv_q_2exp (dwt->t, S, n);
+      hi = mpz_get_ui (dwt->t);
+    }
+
+  /* digit j goes to a[(j & odd) * m + (j >> shift)] */
+  odd = shift = (T->type == DWT_CYCLIC);
+
+  /* read the digits of b bits from acc, which has ab bits, and then from
+     the limbs of |S| */
+  sp = PTR(S);
+  sn = ABSIZ(S);
+  for (j = 0, li = 0; j < T->len; j++)
+    {
+      b = T->bits + T->big[j];
+      if (ab < b)
+        {
+          l = (li < sn) ? sp[li++] : 0;
+          d = (acc | (l << ab)) & ((((mp_limb_t) 1) << b) - 1);
+          acc = l >> (b - ab);
+          ab += GMP_NUMB_BITS - b;
+        }
+      else
+        {
+          d = acc & ((((mp_limb_t) 1) << b) - 1);
+          acc >>= b;
+          ab -= b;
+        }
+      /* balance the digit: carry = 1 if v >= 2^(b-1), without branch,
+         since 0 <= v <= 2^b */
+      v = (long) d + carry;
+      carry = (v + (1L << (b - 1))) >> b;
+      v -= carry << b;
+      a[(j & odd) * m + (j >> shift)] = (double) v * sgn * T->weight[j];
+    }
+
+  /* For the weighted transforms, the carry out and hi are worth
+     (hi + carry)*2^n = q*k*2^n + r*2^n = -c*q + r*2^n modulo k*2^n+c:
+     -c*q goes to digit 0, whose weight is 1, and r to the last one */
+  if (T->type != DWT_PADDED)
+    {
+      hi += (unsigned long) carry;
+      q = hi / T->k;
+      r = (long) (hi % T->k);
+      if (2 * (unsigned long) r > T->k)
+        {
+          r -= (long) T->k;
+          q ++;
+        }
+      j = T->len - 1;
+      if (r != 0)
+        a[(j & odd) * m + (j >> shift)] += sgn * T->weight[j]
+          * ldexp ((double) r, T->bits + T->big[j]);
+      a[0] -= sgn * (double) T->c * (double) q;
+    }
+  ASSERT (T->type != DWT_PADDED || carry == 0);
+
+  if (T->type != DWT_CYCLIC)
+    for (j = 0; j < m; j++)
+      {
+        re = a[j];
+        a[j] = re * ra[j] - a[m + j] * ra[m + j];
+        a[m + j] = re * ra[m + j] + a[m + j] * ra[j];
+      }
+
+  dwt_fft_dif (a, a + m, T->tw + 2 * m, m);
+  return 0;
+}
+
+/* a <- a * b for the spectra of real signals x[2j] + i*x[2j+1], in
+   bit-reversed order. The spectrum X of the real signal x of length 2m is
+   X[k] = E[k] + w^k O[k] and X[k+m] = E[k] - w^k O[k] with
+   E[k] = (Z[k] + conj(Z[m-k]))/2, O[k] = (Z[k] - conj(Z[m-k]))/(2i) and
+   w = exp(-2 i pi/(2m)), and X[m-k] = conj(X[k+m]), so that the
+   frequencies k and m-k can be dealt with together. */
+static void
+dwt_cyclic_mul (double *a, const double *b, const struct __dwt_tables *T)
+{
+  unsigned long k, kk, m = T->m, pa, pb;
+  double wr, wi, er, ei, odr, odi, x0r, x0i, x1r, x1i, y0r, y0i, y1r, y1i;
+  double p0r, p0i, p1r, p1i, tr, ti;
+  const double *ai = a + m, *bi = b + m;
+
+  for (k = 0; k <= m / 2; k++)
+    {
+      kk = (m - k) & (m - 1);
+      pa = T->br[k];
+      pb = T->br[kk];
+      wr = T->ra[k];
+      wi = T->ra[m + k];
+
+#define DWT_SPLIT(zr, zi, xr0, xi0, xr1, xi1)                   \
+      er = (zr[pa] + zr[pb]) * 0.5;                             \
+      ei = (zi[pa] - zi[pb]) * 0.5;                             \
+      /* O = (Z[k] - conj(Z[m-k])) / (2i) */                    \
+      odr = (zi[pa] + zi[pb]) * 0.5;                            \
+      odi = (zr[pb] - zr[pa]) * 0.5;                            \
+      tr = wr * odr - wi * odi;                                 \
+      ti = wr * odi + wi * odr;                                 \
+      xr0 = er + tr;                                            \
+      xi0 = ei + ti;                                            \
+      xr1 = er - tr;                                            \
+      xi1 = ei - ti
+
+      DWT_SPLIT(a, ai, x0r, x0i, x1r, x1i);
+      if (b != a)
+        {
+          DWT_SPLIT(b, bi, y0r, y0i, y1r, y1i);
+        }
+      else
+        {
+          y0r = x0r; y0i = x0i; y1r = x1r; y1i = x1i;
+        }
+#undef DWT_SPLIT
+
+      /* P[k] and P[k+m] */
+      p0r = x0r * y0r - x0i * y0i;
+      p0i = x0r * y0i + x0i * y0r;
+      p1r = x1r * y1r - x1i * y1i;
+      p1i = x1r * y1i + x1i * y1r;
+
+      /* E' = (P[k] + P[k+m])/2, O' = (P[k] - P[k+m]) * conj(w^k)/2 */
+      er = (p0r + p1r) * 0.5;
+      ei = (p0i + p1i) * 0.5;
+      tr = (p0r - p1r) * 0.5;
+      ti = (p0i - p1i) * 0.5;
+      odr = tr * wr + ti * wi;
+      odi = ti * wr - tr * wi;
+
+      /* Z'[k] = E' + i O', Z'[m-k] = conj(E') + i conj(O') */
+      a[pa] = er - odi;
+      a[m + pa] = ei + odr;
+      a[pb] = er + odi;
+      a[m + pb] = odr - ei;
+    }
+}
+
+/* Adds c*2^shift to R */
+static void
+dwt_add_int64 (mpz_t R, int64_t c, unsigned long shift, mpz_t t)
+{
+  uint64_t u = (c < 0) ? - (uint64_t) c : (uint64_t) c;
+
+  if (c == 0)
+    return;
+  mpz_import (t, 1, -1, sizeof (uint64_t), 0, 0, &u);
+  mpz_mul_2exp (t, t, shift);
+  if (c < 0)
+    mpz_sub (R, R, t);
+  else
+    mpz_add (R, R, t);
+}
+
+/* Puts the len digits of b bits of |S| into x */
+static void
+dwt_ntt_digits (spv_t x, const mpz_t S, unsigned int b, spv_size_t len)
+{
+  mp_srcptr sp = PTR(S);
+  mp_size_t sn = ABSIZ(S), li = 0;
+  mp_limb_t l, acc = 0, mask = (((mp_limb_t) 1) << b) - 1;
+  unsigned int ab = 0;
+  spv_size_t j;
+
+  for (j = 0; j < len; j++)
+    if (ab < b)
+      {
+        l = (li < sn) ? sp[li++] : 0;
+        x[j] = (sp_t) ((acc | (l << ab)) & mask);
+        acc = l >> (b - ab);
+        ab += GMP_NUMB_BITS - b;
+      }
+    else
+      {
+        x[j] = (sp_t) (acc & mask);
+        acc >>= b;
+        ab -= b;
+      }
+}
+
+/* Sets R to S1*S2 with a number-theoretic transform modulo two primes.
+   Returns 0, or 1 if there are no primes or the inputs are too large. */
+static int
+dwt_ntt_mul (mpz_t R, const mpz_t S1, const mpz_t S2, dwt_t dwt)
+{
+  const struct __dwt_tables *T = dwt->tab;
+  spv_size_t j, log2_len = T->ntt_log2_len, len = (spv_size_t) 1 << log2_len;
+  unsigned int i, b = T->ntt_bits, wb = 0;
+  mp_limb_t mask = (((mp_limb_t) 1) << b) - 1, hi = 0, lo = 0, xh, xl, d;
+  mp_limb_t w = 0;
+  mp_size_t rn;
+  mp_ptr rp;
+  sp_t p1, p2, r1, h;
+  spv_t x, y;
+  spm_t spm;
+
+  if (T->spm[1] == NULL || mpz_sizeinbase (S1, 2) > T->maxbits ||
+      mpz_sizeinbase (S2, 2) > T->maxbits)
+    return 1;
+  if (dwt->x == NULL)
+    {
+      dwt->x = (spv_t) sp_aligned_malloc (3 * len * sizeof (sp_t));
+      if (dwt->x == NULL)
+        return 1;
+    }
+
+  /* the product modulo each prime goes to x + i*len */
+  y = dwt->x + 2 * len;
+  for (i = 0; i < 2; i++)
+    {
+      spm = T->spm[i];
+      x = dwt->x + i * len;
+      dwt_ntt_digits (x, S1, b, len);
+      spv_ntt_gfp_dif (x, log2_len, spm);
+      if (S2 != S1)
+        {
+          dwt_ntt_digits (y, S2, b, len);
+          spv_ntt_gfp_dif (y, log2_len, spm);
+          spv_pwmul (x, x, y, len, spm->sp, spm->mul_c);
+        }
+      else
+        spv_pwmul (x, x, x, len, spm->sp, spm->mul_c);
+      spv_ntt_gfp_dit (x, log2_len, spm);
+      /* spm->sp - (spm->sp - 1) / len is the inverse of len */
+      spv_mul_sp (x, x, spm->sp - (spm->sp - 1) / len, len, spm->sp,
+                  spm->mul_c);
+    }
+
+  /* Each coefficient is r1 + p1 * ((r2 - r1) / p1 mod p2), since it is
+     smaller than p1 * p2. Add it to the carry hi:lo, and write the low b
+     bits of the sum into R. */
+  MPZ_REALLOC (R, (mp_size_t) ((len * b) / GMP_NUMB_BITS + 3));
+  rp = PTR(R);
+  p1 = T->spm[0]->sp;
+  p2 = T->spm[1]->sp;
+  x = dwt->x;
+  for (j = 0, rn = 0; j < len || hi != 0 || lo != 0; j++)
+    {
+      if (j < len)
+        {
+          r1 = x[j];
+          h = sp_mul (sp_sub (x[len + j], (r1 >= p2) ? r1 - p2 : r1, p2),
+                      T->p1inv, p2, T->spm[1]->mul_c);
+          umul_ppmm (xh, xl, (mp_limb_t) p1, (mp_limb_t) h);
+          add_ssaaaa (xh, xl, xh, xl, (mp_limb_t) 0, (mp_limb_t) r1);
+          add_ssaaaa (hi, lo, hi, lo, xh, xl);
+        }
+      d = lo & mask;
+      lo = (lo >> b) | (hi << (GMP_NUMB_BITS - b));
+      hi >>= b;
+      w |= d << wb;
+      wb += b;
+      if (wb >= GMP_NUMB_BITS)
+        {
+          rp[rn++] = w;
+          wb -= GMP_NUMB_BITS;
+          w = d >> (b - wb);
+        }
+    }
+  if (wb != 0)
+    rp[rn++] = w;
+  MPN_NORMALIZE (rp, rn);
+  SIZ(R) = ((SIZ(S1) < 0) != (SIZ(S2) < 0)) ? -rn : rn;
+
+  return 0;
+}
+
+/* Sets R to a number congruent to S1*S2 modulo k*2^n+c, or to S1*S2 for a
+   padded transform or if the round-off error is too large, in which case
+   the product is computed with the NTT. Returns 0, or 1 if the inputs are
+   too large for both, in which case R is undefined. R must not be S1 or
+   S2. */
+int
+dwt_mul (mpz_t R, const mpz_t S1, const mpz_t S2, dwt_t dwt)
+{
+  const struct __dwt_tables *T = dwt->tab;
+  unsigned long j, m = T->m, len = T->len, odd, shift, r;
+  unsigned int b, wb = 0;
+  mp_size_t rn;
+  double *a = dwt->a, *bb = dwt->b, x, y, err = 0.0;
+  const double *ra = T->ra;
+  int64_t carry = 0;
+  uint64_t v;
+  mp_limb_t d, w = 0;
+  mp_ptr rp;
+
+  if (dwt_forward (a, S1, dwt))
+    return dwt_ntt_mul (R, S1, S2, dwt);
+  if (S2 != S1)
+    {
+      if (dwt_forward (bb, S2, dwt))
+        return dwt_ntt_mul (R, S1, S2, dwt);
+    }
+  else
+    bb = a;
+
+  if (T->type == DWT_CYCLIC)
+    dwt_cyclic_mul (a, bb, T);
+  else
+    for (j = 0; j < m; j++)
+      {
+        x = a[j] * bb[j] - a[m + j] * bb[m + j];
+        a[m + j] = a[j] * bb[m + j] + a[m + j] * bb[j];
+        a[j] = x;
+      }
+
+  dwt_fft_dit (a, a + m, T->tw + 2 * m, m);
+
+  if (T->type != DWT_CYCLIC)
+    for (j = 0; j < m; j++)
+      {
+        x = a[j];
+        a[j] = x * ra[j] + a[m + j] * ra[m + j];
+        a[m + j] = a[m + j] * ra[j] - x * ra[m + j];
+      }
+
+  /* round the digits, check the round-off error, propagate the carries
+     and write the digits into R */
+  MPZ_REALLOC (R, (mp_size_t) (((T->type == DWT_PADDED) ?
+                                 len * T->bits : T->n)
+                                / GMP_NUMB_BITS + 2));
+  rp = PTR(R);
+  odd = shift = (T->type == DWT_CYCLIC);
+  for (j = 0, rn = 0; j < len; j++)
+    {
+      b = T->bits + T->big[j];
+      x = a[(j & odd) * m + (j >> shift)] * T->iweight[j];
+      y = (x + DWT_ROUND) - DWT_ROUND;
+      if (fabs (x - y) > err)
+        err = fabs (x - y);
+      /* v + DWT_BIAS is non-negative since |v| < 2^52 */
+      v = (uint64_t) ((int64_t) y + carry) + DWT_BIAS;
+      carry = (int64_t) (v >> b) - (int64_t) (DWT_BIAS >> b);
+      d = (mp_limb_t) v & ((((mp_limb_t) 1) << b) - 1);
+      w |= d << wb;
+      wb += b;
+      if (wb >= GMP_NUMB_BITS)
+        {
+          rp[rn++] = w;
+          wb -= GMP_NUMB_BITS;
+          w = d >> (b - wb);
+        }
+    }
+  if (wb != 0)
+    rp[rn++] = w;
+  if (err > DWT_MAXERR)
+    {
+      outputf (OUTPUT_DEVVERBOSE, "dwt_mul: round-off error %f, using "
+               "the NTT\n", err);
+      return dwt_ntt_mul (R, S1, S2, dwt);
+    }
+  MPN_NORMALIZE (rp, rn);
+  SIZ(R) = rn;
+
+  /* the carry out is worth carry * 2^(len*bits) for DWT_PADDED, and
+     carry * 2^n otherwise, which is -c*carry for k = 1 */
+  if (T->type == DWT_PADDED)
+    dwt_add_int64 (R, carry, len * T->bits, dwt->t);
+  else if (T->k == 1)
+    dwt_add_int64 (R, -T->c * carry, 0, dwt->t);
+  else
+    {
+      dwt_add_int64 (R, carry, T->n, dwt->t);
+      /* R = k*S1*S2 mod k*2^n+c: add the multiple r of k*2^n+c for which
+         R is divisible by k, since k*2^n+c = c mod k */
+      r = mpz_fdiv_ui (R, T->k);
+      r = (unsigned long) (((uint64_t) (T->k - r) * T->cinv) % T->k);
+      mpz_addmul_ui (R, T->M, r);
+      mpz_divexact_ui (R, R, T->k);
+    }
+
+  return 0;
+}
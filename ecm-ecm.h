@@ -70,7 +70,7 @@ typedef struct
 unsigned int nb_digits  (const mpz_t);
 int read_number (mpcandi_t*, FILE*, int);
 int process_newfactor (mpz_t, int, mpcandi_t*, int, int, int, unsigned int*, 
-                       int*, mpz_t, FILE*, int, int);
+                       int*, mpz_t, int, int, int);
 
 /* Various logging levels */
 /* OUTPUT_ALWAYS means print always, regardless of verbose value */
@@ -124,8 +124,75 @@ int  read_resumefile_line (int *, mpz_t, mpz_t, mpcandi_t *,
 int write_resumefile (char *, int, mpz_t, ecm_params params,
 		      mpcandi_t *, mpz_t, mpz_t, 
 		      const char *);
-int write_s_in_file (char *, mpz_t);
-int read_s_from_file (mpz_t, char *, double); 
+int write_s_in_file (char *, mpz_t, double, int);
+int read_s_from_file (mpz_t, char *, double, int);
+
+/* one residue of a resume file, with the values of read_resumefile_line */
+typedef struct
+{
+  int method;
+  mpz_t x, y;
+  mpcandi_t n;
+  mpz_t sigma, A, x0, y0;
+  int Etype, param;
+  double B1done;
+  char program[256], who[256], rtime[256], comment[256];
+} resume_record_t;
+
+/* a resume file being read, in the text or the binary format, and the
+   residues read ahead of the caller */
+typedef struct
+{
+  FILE *fd;                  /* text file, NULL for a binary one */
+  unsigned char *map;        /* binary file, mapped in memory */
+  size_t size;               /* number of bytes of map */
+  size_t pos;                /* offset of the next residue in map */
+  unsigned int nahead;       /* number of residues in ahead */
+  unsigned int alloc;        /* number of allocated entries of ahead */
+  resume_record_t *ahead;    /* residues read ahead */
+} resume_reader_t;
+
+int  resume_reader_open (resume_reader_t *, const char *);
+void resume_reader_close (resume_reader_t *);
+int  resume_reader_next (resume_reader_t *, int *, mpz_t, mpz_t, mpcandi_t *,
+                         mpz_t, mpz_t, mpz_t, mpz_t, int *, int *, double *,
+                         char *, char *, char *, char *);
+resume_record_t *resume_reader_peek (resume_reader_t *, unsigned int);
+int  resume_convert (const char *, const char *);
+
+/* threads.c */
+/* one curve run in a separate thread, with its input and output */
+typedef struct
+{
+  ecm_params params;
+  mpz_t n;               /* the input number */
+  mpz_t x, y, sigma;     /* input values of params->x, y and sigma */
+  double B1, B1done;
+  mpz_t B2min;
+  mpz_t f;               /* the factor found, if any */
+  int result;            /* return value of ecm_factor */
+  int valid;             /* non-zero if the curve was not interrupted */
+  int shared_s;          /* non-zero if params->batch_s is borrowed */
+  mpz_t own_s;           /* the batch_s of params while it is borrowed */
+  FILE *out;             /* buffered output of the curve */
+  FILE *err;             /* buffered error messages of the curve */
+  unsigned int first;    /* first curve of the round with the same n */
+  int stop;              /* set when an earlier curve on n found a factor */
+} curve_job_t;
+
+typedef struct
+{
+  unsigned int nthreads;
+  unsigned int njobs;    /* number of curves of the last round */
+  unsigned int next;     /* next curve to give to the caller */
+  curve_job_t *jobs;
+  resume_reader_t *resume; /* with -resume, the residues to run ahead */
+} curve_pool_t;
+
+void curve_pool_init (curve_pool_t *, unsigned int);
+void curve_pool_clear (curve_pool_t *);
+int  curve_pool_factor (curve_pool_t *, mpz_t, mpz_t, double, ecm_params,
+                        unsigned int, double);
 
 /* main.c */
 int kbnc_z (double *k, unsigned long *b, unsigned long *n, signed long *c,
@@ -50,6 +50,9 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #else
 extern size_t MPZMOD_THRESHOLD;
 extern size_t REDC_THRESHOLD;
+extern size_t KBNC_THRESHOLD;
+extern size_t DWT_THRESHOLD;
+extern size_t BASE2_FFT_THRESHOLD;
 #define TUNE_MULREDC_TABLE {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
 #define TUNE_SQRREDC_TABLE {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
 #define LIST_MUL_TABLE {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
@@ -81,9 +84,46 @@ extern size_t mpn_mul_lo_threshold[];
 #endif
 #endif
 
-#define ECM_STDOUT __ecm_stdout
-#define ECM_STDERR __ecm_stderr
-extern FILE *ECM_STDOUT, *ECM_STDERR;
+/* The state of libecm which is not passed in arguments. During a call of
+   ecm_factor, the context given in params->ctx is the current one of the
+   calling thread; otherwise each thread uses a default context of its own
+   (see ecm_ctx_get in auxlib.c). */
+struct __ecm_ctx_struct
+{
+  int verbose;               /* verbosity level, see set_verbose */
+  FILE *os, *es;             /* output and error streams of outputf */
+  unsigned int Fermat;       /* if non-zero, stage 2 works modulo
+                                2^Fermat+1 (see schoen_strass.c) */
+  mpz_t gt;                  /* temporary of schoen_strass.c */
+  int gt_inited;
+  double *rhotable;          /* Dickman's rho table, see rhoinit */
+  int rho_invh;
+  double rho_h;
+  int rho_tablemax;
+  mpzspm_t mpzspm_cache;     /* see mpzspm_init */
+  char *cachedir;            /* see cachefile_set_dir */
+  spv_t ntt_scratch;         /* scratch space of the four-step NTT */
+  spv_size_t ntt_scratch_size;
+  mpz_t kbnc_n;              /* last input of iskbnc, and its result */
+  int kbnc_inited;
+  double kbnc_threshold;
+  int kbnc_l;
+  unsigned long kbnc_k;
+  long kbnc_c;
+  char *chains_file;         /* the table of Lucas chains mapped by */
+  unsigned char *chains_data; /* chains_init, or NULL */
+  size_t chains_size;
+};
+
+#define ecm_ctx_get __ECM(ctx_get)
+ecm_ctx_t ecm_ctx_get (void);
+#define ecm_ctx_set __ECM(ctx_set)
+ecm_ctx_t ecm_ctx_set (ecm_ctx_t);
+#define ECM_CTX (ecm_ctx_get ())
+
+#define ECM_STDOUT (ECM_CTX->os)
+#define ECM_STDERR (ECM_CTX->es)
+#define ECM_FERMAT (ECM_CTX->Fermat)
 
 /* #define TIMING_CRT */
 
@@ -120,7 +160,8 @@ extern FILE *ECM_STDOUT, *ECM_STDERR;
 /* thresholds */
 #define MPN_MUL_LO_THRESHOLD 32
 
-/* base2mod is used when size(2^n+/-1) <= BASE2_THRESHOLD * size(cofactor) */
+/* base2mod is used when size(2^n+/-1) <= BASE2_THRESHOLD * size(cofactor),
+   and kbncmod when size(k*2^n+c) <= BASE2_THRESHOLD * size(cofactor) */
 #define BASE2_THRESHOLD 1.4
 
 /* default number of probable prime tests */
@@ -129,6 +170,10 @@ extern FILE *ECM_STDOUT, *ECM_STDERR;
 /* threshold for median product */
 #define KS_TMUL_THRESHOLD 8e5
 
+/* With OpenMP, the subtrees of the product tree of F with at least this
+   many leaves are built and evaluated in separate tasks */
+#define POLY_TREE_TASK_THRESHOLD 256
+
 #define ABS(x) ((x) >= 0 ? (x) : -(x))
 
 /* getprime */
@@ -164,8 +209,14 @@ extern FILE *ECM_STDOUT, *ECM_STDERR;
 
 typedef mpz_t mpres_t;
 
+/* a residue of n limbs for a modulus of n limbs, see mpresf_* in mpmod.c */
+typedef mp_limb_t *mpresf_t;
+
 typedef mpz_t* listz_t;
 
+/* a transform plan for products modulo k*2^n+c, see dwt.c */
+typedef struct __dwt_struct *dwt_t;
+
 typedef struct
 {
   mpres_t x;
@@ -244,31 +295,61 @@ typedef struct
 } __polyz_struct;
 typedef __polyz_struct polyz_t[1];
 
+/* Scratch lists for the tasks of the product tree functions, one for each
+   thread, allocated by the thread itself the first time it needs one. The
+   list of thread 0 is given by the caller. */
+typedef struct
+{
+  listz_t *T;
+  unsigned int size;     /* number of entries of each list */
+  unsigned int nthreads;
+} __tree_scratch_struct;
+typedef __tree_scratch_struct tree_scratch_t[1];
+
 typedef struct 
 {
   int repr;           /* ECM_MOD_MPZ: plain modulus, possibly normalized
                          ECM_MOD_BASE2: base 2 number
                          ECM_MOD_MODMULN: MODMULN
-                         ECM_MOD_REDC: REDC representation */
+                         ECM_MOD_REDC: REDC representation
+                         ECM_MOD_KBNC: factor of k*2^n+c
+                         ECM_MOD_DWT: as KBNC, with floating-point FFT */
   int bits;           /* in case of a base 2 number, 2^k[+-]1, bits = [+-]k
+                         in case of a factor of k*2^n+c (KBNC or DWT),
+                         bits = n
                          in case of MODMULN or REDC representation, nr. of 
                          bits b so that 2^b > orig_modulus and 
                          GMP_NUMB_BITS | b */
   int Fermat;         /* If repr = 1 (base 2 number): If modulus is 2^(2^m)+1, 
                          i.e. bits = 2^m, then Fermat = 2^m, 0 otherwise.
                          If repr != 1, undefined */
+  mp_size_t fft_n;    /* For base2, if N divides B^fft_n+1 (fft_n > 0) or
+                         B^-fft_n-1 (fft_n < 0), B = 2^GMP_NUMB_BITS, the
+                         products are done modulo that number with
+                         mpn_mul_fft or mpn_mulmod_bnm1. 0 otherwise */
+  unsigned long kbnc_k; /* For KBNC and DWT, the odd k of k*2^n+c, */
+  long kbnc_c;        /* c, */
+  unsigned int kbnc_kbits; /* and the number of bits of k */
   mp_limb_t *Nprim;   /* For MODMULN */
   mpz_t orig_modulus; /* The original modulus N */
-  mpz_t aux_modulus;  /* Used only for MPZ and REDC:
+  mpz_t aux_modulus;  /* Used only for MPZ, REDC, KBNC and DWT:
 			 - the auxiliary modulus value (i.e. normalized 
                            modulus, or -1/N (mod 2^bits) for REDC,
                          - B^(n + ceil(n/2)) mod N for MPZ,
-  			   where B = 2^GMP_NUMB_BITS */
+  			   where B = 2^GMP_NUMB_BITS,
+                         - a temporary variable for KBNC and DWT */
   mpz_t multiple;     /* The smallest multiple of N that is larger or
 			 equal to 2^bits for REDC/MODMULN */
   mpz_t R2, R3;       /* For MODMULN and REDC, R^2 and R^3 (mod orig_modulus), 
                          where R = 2^bits. */
   mpz_t temp1, temp2; /* Temp values used during multiplication etc. */
+  /* For MODMULN, rp <- s1p * s2p / B^nn and rp <- s1p^2 / B^nn (mod np)
+     for the number nn of limbs of N, chosen once by mpmod_init */
+  void (*mulredc_n) (mp_ptr rp, mp_srcptr s1p, mp_srcptr s2p, mp_srcptr np,
+                     mp_size_t nn, mp_ptr invm, mp_ptr tmp);
+  void (*sqrredc_n) (mp_ptr rp, mp_srcptr s1p, mp_srcptr np, mp_size_t nn,
+                     mp_ptr invm, mp_ptr tmp);
+  dwt_t dwt;          /* For DWT, the transform plan (see dwt.c) */
 } __mpmod_struct;
 typedef __mpmod_struct mpmod_t[1];
 
@@ -286,14 +367,21 @@ void getprime_seek (double);
 
 /* pm1fs2.c */
 #define pm1fs2_memory_use __ECM(pm1fs2_ntt_memory_use)
-size_t  pm1fs2_memory_use (const unsigned long, const mpz_t, const int);
+size_t  pm1fs2_memory_use (const unsigned long, const mpz_t, const int, 
+                           const int);
+#define pm1fs2_disk_use __ECM(pm1fs2_disk_use)
+size_t  pm1fs2_disk_use (const unsigned long, const mpz_t);
 #define pm1fs2_maxlen __ECM(pm1fs2_maxlen)
-unsigned long pm1fs2_maxlen (const size_t, const mpz_t, const int);
+unsigned long pm1fs2_maxlen (const size_t, const size_t, const mpz_t, 
+                             const int);
 #define pp1fs2_memory_use __ECM(pp1fs2_ntt_memory_use)
 size_t  pp1fs2_memory_use (const unsigned long, const mpz_t, const int, 
-                           const int);
+                           const int, const int);
+#define pp1fs2_disk_use __ECM(pp1fs2_disk_use)
+size_t  pp1fs2_disk_use (const unsigned long, const mpz_t);
 #define pp1fs2_maxlen __ECM(pp1fs2_maxlen)
-unsigned long pp1fs2_maxlen (const size_t, const mpz_t, const int, const int);
+unsigned long pp1fs2_maxlen (const size_t, const size_t, const mpz_t, 
+                             const int, const int);
 #define choose_P __ECM(choose_P)
 long    choose_P (const mpz_t, const mpz_t, const unsigned long,
                   const unsigned long, faststage2_param_t *, mpz_t, mpz_t,
@@ -422,6 +510,12 @@ void      PolyFromRoots (listz_t, listz_t, unsigned int, listz_t, mpz_t);
 #define PolyFromRoots_Tree __ECM(PolyFromRoots_Tree)
 int       PolyFromRoots_Tree (listz_t, listz_t, unsigned int, listz_t, int, 
                          mpz_t, listz_t*, FILE*, unsigned int);
+#define tree_scratch_init __ECM(tree_scratch_init)
+void      tree_scratch_init (tree_scratch_t, listz_t, unsigned int);
+#define tree_scratch_get __ECM(tree_scratch_get)
+listz_t   tree_scratch_get (tree_scratch_t);
+#define tree_scratch_clear __ECM(tree_scratch_clear)
+void      tree_scratch_clear (tree_scratch_t);
 
 #define ntt_PolyFromRoots __ECM(ntt_PolyFromRoots)
 void	  ntt_PolyFromRoots (mpzv_t, mpzv_t, spv_size_t, mpzv_t, mpzspm_t);
@@ -485,12 +579,22 @@ unsigned int ks_wrapmul (listz_t, unsigned int, listz_t, unsigned int,
 /* #define MPRESN_NO_ADJUSTMENT */
 #define isbase2 __ECM(isbase2)
 int isbase2 (const mpz_t, const double);
+#define iskbnc __ECM(iskbnc)
+int iskbnc (const mpz_t, unsigned long *, long *, const double);
+#define iskbnc_clear __ECM(iskbnc_clear)
+void iskbnc_clear (void);
 #define mpmod_init __ECM(mpmod_init)
 int mpmod_init (mpmod_t, const mpz_t, int);
 #define mpmod_init_MPZ __ECM(mpmod_init_MPZ)
 void mpmod_init_MPZ (mpmod_t, const mpz_t);
 #define mpmod_init_BASE2 __ECM(mpmod_init_BASE2)
 int mpmod_init_BASE2 (mpmod_t, const int, const mpz_t);
+#define mpmod_init_KBNC __ECM(mpmod_init_KBNC)
+int mpmod_init_KBNC (mpmod_t, const unsigned long, const int, const long,
+                     const mpz_t);
+#define mpmod_init_DWT __ECM(mpmod_init_DWT)
+int mpmod_init_DWT (mpmod_t, const unsigned long, const int, const long,
+                    const mpz_t);
 #define mpmod_init_MODMULN __ECM(mpmod_init_MODMULN)
 void mpmod_init_MODMULN (mpmod_t, const mpz_t);
 #define mpmod_init_REDC __ECM(mpmod_init_REDC)
@@ -579,6 +683,38 @@ void mpresn_add (mpres_t, const mpres_t, const mpres_t, mpmod_t);
 void mpresn_sub (mpres_t, const mpres_t, const mpres_t, mpmod_t);
 #define mpresn_mul_1 __ECM(mpresn_mul_ui)
 void mpresn_mul_1 (mpres_t, const mpres_t, const mp_limb_t, mpmod_t);
+#define mpresf_set_mpres __ECM(mpresf_set_mpres)
+void mpresf_set_mpres (mpresf_t, const mpres_t, mpmod_t);
+#define mpres_set_mpresf __ECM(mpres_set_mpresf)
+void mpres_set_mpresf (mpres_t, const mpresf_t, mpmod_t);
+#define mpresf_mul __ECM(mpresf_mul)
+void mpresf_mul (mpresf_t, const mpresf_t, const mpresf_t, mpmod_t);
+#define mpresf_sqr __ECM(mpresf_sqr)
+void mpresf_sqr (mpresf_t, const mpresf_t, mpmod_t);
+#define mpresf_add __ECM(mpresf_add)
+void mpresf_add (mpresf_t, const mpresf_t, const mpresf_t, mpmod_t);
+#define mpresf_sub __ECM(mpresf_sub)
+void mpresf_sub (mpresf_t, const mpresf_t, const mpresf_t, mpmod_t);
+#define mpresf_set __ECM(mpresf_set)
+void mpresf_set (mpresf_t, const mpresf_t, mpmod_t);
+#define mpresf_swap __ECM(mpresf_swap)
+void mpresf_swap (mpresf_t, mpresf_t, mpmod_t);
+#define mpresf_is_zero __ECM(mpresf_is_zero)
+int  mpresf_is_zero (const mpresf_t, mpmod_t);
+
+/* dwt.c */
+#define dwt_init __ECM(dwt_init)
+dwt_t dwt_init (unsigned long, unsigned long, long);
+#define dwt_init_set __ECM(dwt_init_set)
+dwt_t dwt_init_set (const dwt_t);
+#define dwt_clear __ECM(dwt_clear)
+void dwt_clear (dwt_t);
+#define dwt_length __ECM(dwt_length)
+unsigned long dwt_length (const dwt_t);
+#define dwt_weighted __ECM(dwt_weighted)
+int dwt_weighted (unsigned long, unsigned long, long);
+#define dwt_mul __ECM(dwt_mul)
+int dwt_mul (mpz_t, const mpz_t, const mpz_t, dwt_t);
 
 /* mul_lo.c */
 #define ecm_mul_lo_n __ECM(ecm_mul_lo_n)
@@ -643,6 +779,8 @@ int          outputf (int, const char *, ...);
 void writechkfile (char *, int, double, mpmod_t, mpres_t, mpres_t, mpres_t, mpres_t);
 #define aux_fseek64 __ECM(aux_fseek64)
 int aux_fseek64(FILE *, const int64_t, const int);
+#define ecm_disk_free __ECM(ecm_disk_free)
+size_t ecm_disk_free (const char *);
 #define ecm_tstbit __ECM(ecm_tstbit)
 int ecm_tstbit (mpz_srcptr, ecm_uint);
 
@@ -683,10 +821,135 @@ int  gw_ecm_stage1 (mpz_t, curve *, mpmod_t, double, double *, mpz_t,
 /* batch.c */
 #define compute_s  __ECM(compute_s )
 void compute_s (mpz_t, ecm_uint, int *);
+#define compute_s_extend  __ECM(compute_s_extend)
+void compute_s_extend (mpz_t, ecm_uint, ecm_uint, int *);
+#define batch_s_write  __ECM(batch_s_write)
+int batch_s_write (const char *, mpz_t, double, int);
+#define batch_s_read  __ECM(batch_s_read)
+int batch_s_read (mpz_t, const char *, double, int);
+#define batch_s_update  __ECM(batch_s_update)
+void batch_s_update (mpz_t, double, double *, int);
 #define ecm_stage1_batch  __ECM(ecm_stage1_batch)
 int ecm_stage1_batch (mpz_t, mpres_t, mpres_t, mpmod_t, double, double *, 
                                                                 int,  mpz_t);
 
+/* cachefile.c */
+#define CACHEFILE_HEADER 128 /* size of the header, the data is aligned */
+#define CACHEFILE_KEYS 4     /* number of 64-bit words of the key */
+#define CACHEFILE_BATCH_S 1  /* kinds of data */
+#define CACHEFILE_MPZSPM 2
+#define CACHEFILE_CHAINS 3
+#define cachefile_set_dir __ECM(cachefile_set_dir)
+void cachefile_set_dir (const char *);
+#define cachefile_get_dir __ECM(cachefile_get_dir)
+const char *cachefile_get_dir (void);
+#define cachefile_name __ECM(cachefile_name)
+char *cachefile_name (const char *, ...);
+#define cachefile_checksum __ECM(cachefile_checksum)
+uint64_t cachefile_checksum (const void *, size_t);
+#define cachefile_write __ECM(cachefile_write)
+int cachefile_write (const char *, unsigned int, const uint64_t *,
+                     const void *, size_t);
+#define cachefile_key __ECM(cachefile_key)
+int cachefile_key (const char *, unsigned int, uint64_t *);
+#define cachefile_map __ECM(cachefile_map)
+void *cachefile_map (const char *, unsigned int, const uint64_t *, size_t *);
+#define cachefile_unmap __ECM(cachefile_unmap)
+void cachefile_unmap (void *, size_t);
+
+/* chains.c */
+#define CHAINS_WINDOW 32 /* at most CHAINS_WINDOW-1 primes between those of
+                            a pair */
+typedef struct
+{
+  unsigned char *data, *ptr, *end; /* the table, and the next entry */
+  size_t size;
+  uint64_t p, q, r;                /* the next entry */
+  uint64_t pending[CHAINS_WINDOW]; /* larger primes of the pairs done */
+  int npending;
+} __chains_struct;
+typedef __chains_struct chains_t[1];
+#define chains_r0 __ECM(chains_r0)
+uint64_t chains_r0 (uint64_t);
+#define chains_put __ECM(chains_put)
+int chains_put (unsigned char *, uint64_t);
+#define chains_init __ECM(chains_init)
+int chains_init (chains_t, double);
+#define chains_clear __ECM(chains_clear)
+void chains_clear (chains_t);
+#define chains_clear_cache __ECM(chains_clear_cache)
+void chains_clear_cache (void);
+#define chains_next __ECM(chains_next)
+int chains_next (chains_t, uint64_t, uint64_t, uint64_t *, uint64_t *);
+
+/* stage2bsgs.c */
+#define STAGE2_BSGS_MAX_B2 3e5 /* largest B2 for ecm_stage2_bsgs */
+#define stage2_bsgs_wanted __ECM(stage2_bsgs_wanted)
+int stage2_bsgs_wanted (mpz_t, mpz_t);
+#define ecm_stage2_bsgs __ECM(ecm_stage2_bsgs)
+int ecm_stage2_bsgs (mpz_t *, int *, unsigned int, unsigned int, mpmod_t,
+                     mpz_t, mpz_t, int (*)(void));
+
+/* pipeline.c */
+/* A backend computing stage 1 of curves of param ECM_PARAM_BATCH_32BITS_D
+   for ecm_pipeline: stage1 (data, factors, array_found, n, s, nb_curves,
+   firstsigma) works as ecm_stage1_batch_simd. For ecm_batch_curves,
+   init (backend, &nb_curves, nthreads, with_stage2), if not NULL, is called
+   before stage 1, may change nb_curves and chunk, and returns non-zero on
+   error; report (backend, factors, array_found, nb_curves, firstsigma,
+   time1) prints the outcome of stage 1, which took time1 ms in the
+   pipeline, and returns its time in ms for the expected time to find a
+   factor. */
+typedef struct __stage1_backend_struct stage1_backend_t;
+struct __stage1_backend_struct
+{
+  int (*stage1) (void *, mpz_t *, int *, mpz_t, mpz_t, unsigned int,
+                 unsigned int);
+  void *data;
+  unsigned int chunk; /* number of curves per call of stage1 */
+  int concurrent;     /* non-zero if stage1 may run in several threads */
+  int (*init) (stage1_backend_t *, unsigned int *, unsigned int, int);
+  long (*report) (stage1_backend_t *, mpz_t *, int *, unsigned int,
+                  unsigned int, long);
+  const char *name;   /* prefix of the messages, "GPU: " for instance */
+};
+/* The parameters of stage 2 for ecm_pipeline, as given to stage2 () */
+typedef struct
+{
+  __mpmod_struct *modulus;
+  unsigned long dF, k;
+  root_params_t *root_params;
+  int use_ntt;
+  char *TreeFilename;
+  mpz_ptr B2min, B2;
+  int (*stop_asap) (void);
+} batch_stage2_t;
+#define ecm_pipeline_threads __ECM(ecm_pipeline_threads)
+unsigned int ecm_pipeline_threads (char *);
+#define ecm_pipeline __ECM(ecm_pipeline)
+int ecm_pipeline (mpz_t *, int *, mpz_t, mpz_t, mpz_t, unsigned int,
+                  unsigned int, stage1_backend_t *, batch_stage2_t *,
+                  unsigned int, int, long *, long *);
+#define ecm_batch_curves __ECM(ecm_batch_curves)
+int ecm_batch_curves (mpz_t, mpz_t, int, mpz_t, mpz_t, mpz_t, double *,
+                      double, mpz_t, mpz_t, unsigned long, const int, int, int,
+                      int, int, int, char *, double, int (*)(void), mpz_t,
+                      double *, unsigned int *, stage1_backend_t *);
+
+/* batchsimd.c */
+#define ecm_stage1_batch_simd __ECM(ecm_stage1_batch_simd)
+int ecm_stage1_batch_simd (mpz_t *, int *, mpz_t, mpz_t, unsigned int,
+                           unsigned int);
+#define cpu_batch_ecm __ECM(cpu_batch_ecm)
+int cpu_batch_ecm (mpz_t, mpz_t, int, mpz_t, mpz_t, mpz_t, double *, double,
+                   mpz_t, mpz_t, unsigned long, const int, int, int, int, int,
+                   int, FILE*, FILE*, char *, double, int (*)(void), mpz_t,
+                   double *, unsigned int *);
+#define reducefactors __ECM(reducefactors)
+void reducefactors (mpz_t *, int *, unsigned int);
+#define A_from_sigma __ECM(A_from_sigma)
+void A_from_sigma (mpz_t, unsigned int, mpz_t);
+
 /* parametrizations.c */
 #define get_curve_from_random_parameter __ECM(get_curve_from_random_parameter)
 int get_curve_from_random_parameter (mpz_t, mpres_t, mpres_t, mpz_t, int, 
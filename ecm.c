@@ -116,71 +116,6 @@ montgomery_to_weierstrass (mpz_t f, mpres_t x, mpres_t y, mpres_t A, mpmod_t n)
   return ECM_NO_FACTOR_FOUND;
 }
 
-/* adds Q=(x2:z2) and R=(x1:z1) and puts the result in (x3:z3),
-     using 6 muls (4 muls and 2 squares), and 6 add/sub.
-   One assumes that Q-R=P or R-Q=P where P=(x:z).
-     - n : number to factor
-     - u, v, w : auxiliary variables
-   Modifies: x3, z3, u, v, w.
-   (x3,z3) may be identical to (x2,z2) and to (x,z)
-*/
-void
-add3 (mpres_t x3, mpres_t z3, mpres_t x2, mpres_t z2, mpres_t x1, mpres_t z1, 
-      mpres_t x, mpres_t z, mpmod_t n, mpres_t u, mpres_t v, mpres_t w)
-{
-  mpres_sub (u, x2, z2, n);
-  mpres_add (v, x1, z1, n);      /* u = x2-z2, v = x1+z1 */
-
-  mpres_mul (u, u, v, n);        /* u = (x2-z2)*(x1+z1) */
-
-  mpres_add (w, x2, z2, n);
-  mpres_sub (v, x1, z1, n);      /* w = x2+z2, v = x1-z1 */
-
-  mpres_mul (v, w, v, n);        /* v = (x2+z2)*(x1-z1) */
-
-  mpres_add (w, u, v, n);        /* w = 2*(x1*x2-z1*z2) */
-  mpres_sub (v, u, v, n);        /* v = 2*(x2*z1-x1*z2) */
-
-  mpres_sqr (w, w, n);           /* w = 4*(x1*x2-z1*z2)^2 */
-  mpres_sqr (v, v, n);           /* v = 4*(x2*z1-x1*z2)^2 */
-
-  if (x == x3) /* same variable: in-place variant */
-    {
-      /* x3 <- w * z mod n
-	 z3 <- x * v mod n */
-      mpres_mul (z3, w, z, n);
-      mpres_mul (x3, x, v, n);
-      mpres_swap (x3, z3, n);
-    }
-  else
-    {
-      mpres_mul (x3, w, z, n);   /* x3 = 4*z*(x1*x2-z1*z2)^2 mod n */
-      mpres_mul (z3, x, v, n);   /* z3 = 4*x*(x2*z1-x1*z2)^2 mod n */
-    }
-  /* mul += 6; */
-}
-
-/* computes 2P=(x2:z2) from P=(x1:z1), with 5 muls (3 muls and 2 squares)
-   and 4 add/sub.
-     - n : number to factor
-     - b : (a+2)/4 mod n
-     - t, u, v, w : auxiliary variables
-*/
-void
-duplicate (mpres_t x2, mpres_t z2, mpres_t x1, mpres_t z1, mpmod_t n, 
-           mpres_t b, mpres_t u, mpres_t v, mpres_t w)
-{
-  mpres_add (u, x1, z1, n);
-  mpres_sqr (u, u, n);      /* u = (x1+z1)^2 mod n */
-  mpres_sub (v, x1, z1, n);
-  mpres_sqr (v, v, n);      /* v = (x1-z1)^2 mod n */
-  mpres_mul (x2, u, v, n);  /* x2 = u*v = (x1^2 - z1^2)^2 mod n */
-  mpres_sub (w, u, v, n);   /* w = u-v = 4*x1*z1 */
-  mpres_mul (u, w, b, n);   /* u = w*b = ((A+2)/4*(4*x1*z1)) mod n */
-  mpres_add (u, u, v, n);   /* u = (x1-z1)^2+(A+2)/4*(4*x1*z1) */
-  mpres_mul (z2, w, u, n);  /* z2 = ((4*x1*z1)*((x1-z1)^2+(A+2)/4*(4*x1*z1))) mod n */
-}
-
 /* multiply P=(x:z) by e and puts the result in (x:z). */
 void
 ecm_mul (mpres_t x, mpres_t z, mpz_t e, mpmod_t n, mpres_t b)
@@ -338,168 +273,51 @@ lucas_cost (ecm_uint n, double v)
   return c;
 }
 
-
-/* computes kP from P=(xA:zA) and puts the result in (xA:zA). Assumes k>2. 
-   WARNING! The calls to add3() assume that the two input points are distinct,
-   which is not neccessarily satisfied. The result can be that in rare cases
-   the point at infinity (z==0) results when it shouldn't. A test case is 
-   echo 33554520197234177 | ./ecm -sigma 2046841451 373 1
-   which finds the prime even though it shouldn't (23^2=529 divides order).
-   This is not a problem for ECM since at worst we'll find a factor we 
-   shouldn't have found. For other purposes (i.e. primality proving) this 
-   would have to be fixed first.
-*/
-
-static void
-prac (mpres_t xA, mpres_t zA, ecm_uint k, mpmod_t n, mpres_t b,
-      mpres_t u, mpres_t v, mpres_t w, mpres_t xB, mpres_t zB, mpres_t xC, 
-      mpres_t zC, mpres_t xT, mpres_t zT, mpres_t xT2, mpres_t zT2)
-{
-  ecm_uint d, e, r, i = 0, nv;
-  double c, cmin;
-  __mpz_struct *tmp;
-#define NV 10  
-  /* 1/val[0] = the golden ratio (1+sqrt(5))/2, and 1/val[i] for i>0
-     is the real number whose continued fraction expansion is all 1s
-     except for a 2 in i+1-st place */
-  static double val[NV] =
-    { 0.61803398874989485, 0.72360679774997897, 0.58017872829546410,
-      0.63283980608870629, 0.61242994950949500, 0.62018198080741576,
-      0.61721461653440386, 0.61834711965622806, 0.61791440652881789,
-      0.61807966846989581};
-
-  /* for small n, it makes no sense to try 10 different Lucas chains */
-  nv = mpz_size ((mpz_ptr) n);
-  if (nv > NV)
-    nv = NV;
-
-  if (nv > 1)
-    {
-      /* chooses the best value of v */
-      for (d = 0, cmin = ADD * (double) k; d < nv; d++)
-        {
-          c = lucas_cost (k, val[d]);
-          if (c < cmin)
-            {
-              cmin = c;
-              i = d;
-            }
-        }
-    }
-
-  d = k;
-  r = (ecm_uint) ((double) d * val[i] + 0.5);
-  
-  /* first iteration always begins by Condition 3, then a swap */
-  d = k - r;
-  e = 2 * r - k;
-  mpres_set (xB, xA, n);
-  mpres_set (zB, zA, n); /* B=A */
-  mpres_set (xC, xA, n);
-  mpres_set (zC, zA, n); /* C=A */
-  duplicate (xA, zA, xA, zA, n, b, u, v, w); /* A = 2*A */
-  while (d != e)
-    {
-      if (d < e)
-        {
-          r = d;
-          d = e;
-          e = r;
-          mpres_swap (xA, xB, n);
-          mpres_swap (zA, zB, n);
-        }
-      /* do the first line of Table 4 whose condition qualifies */
-      if (d - e <= e / 4 && ((d + e) % 3) == 0)
-        { /* condition 1 */
-          d = (2 * d - e) / 3;
-          e = (e - d) / 2;
-          add3 (xT, zT, xA, zA, xB, zB, xC, zC, n, u, v, w); /* T = f(A,B,C) */
-          add3 (xT2, zT2, xT, zT, xA, zA, xB, zB, n, u, v, w); /* T2 = f(T,A,B) */
-          add3 (xB, zB, xB, zB, xT, zT, xA, zA, n, u, v, w); /* B = f(B,T,A) */
-          mpres_swap (xA, xT2, n);
-          mpres_swap (zA, zT2, n); /* swap A and T2 */
-        }
-      else if (d - e <= e / 4 && (d - e) % 6 == 0)
-        { /* condition 2 */
-          d = (d - e) / 2;
-          add3 (xB, zB, xA, zA, xB, zB, xC, zC, n, u, v, w); /* B = f(A,B,C) */
-          duplicate (xA, zA, xA, zA, n, b, u, v, w); /* A = 2*A */
-        }
-      else if ((d + 3) / 4 <= e)
-        { /* condition 3 */
-          d -= e;
-          add3 (xT, zT, xB, zB, xA, zA, xC, zC, n, u, v, w); /* T = f(B,A,C) */
-          /* circular permutation (B,T,C) */
-          tmp = xB;
-          xB = xT;
-          xT = xC;
-          xC = tmp;
-          tmp = zB;
-          zB = zT;
-          zT = zC;
-          zC = tmp;
-        }
-      else if ((d + e) % 2 == 0)
-        { /* condition 4 */
-          d = (d - e) / 2;
-          add3 (xB, zB, xB, zB, xA, zA, xC, zC, n, u, v, w); /* B = f(B,A,C) */
-          duplicate (xA, zA, xA, zA, n, b, u, v, w); /* A = 2*A */
-        }
-      /* now d+e is odd */
-      else if (d % 2 == 0)
-        { /* condition 5 */
-          d /= 2;
-          add3 (xC, zC, xC, zC, xA, zA, xB, zB, n, u, v, w); /* C = f(C,A,B) */
-          duplicate (xA, zA, xA, zA, n, b, u, v, w); /* A = 2*A */
-        }
-      /* now d is odd, e is even */
-      else if (d % 3 == 0)
-        { /* condition 6 */
-          d = d / 3 - e;
-          duplicate (xT, zT, xA, zA, n, b, u, v, w); /* T = 2*A */
-          add3 (xT2, zT2, xA, zA, xB, zB, xC, zC, n, u, v, w); /* T2 = f(A,B,C) */
-          add3 (xA, zA, xT, zT, xA, zA, xA, zA, n, u, v, w); /* A = f(T,A,A) */
-          add3 (xT, zT, xT, zT, xT2, zT2, xC, zC, n, u, v, w); /* T = f(T,T2,C) */
-          /* circular permutation (C,B,T) */
-          tmp = xC;
-          xC = xB;
-          xB = xT;
-          xT = tmp;
-          tmp = zC;
-          zC = zB;
-          zB = zT;
-          zT = tmp;
-        }
-      else if ((d + e) % 3 == 0)
-        { /* condition 7 */
-          d = (d - 2 * e) / 3;
-          add3 (xT, zT, xA, zA, xB, zB, xC, zC, n, u, v, w); /* T = f(A,B,C) */
-          add3 (xB, zB, xT, zT, xA, zA, xB, zB, n, u, v, w); /* B = f(T,A,B) */
-          duplicate (xT, zT, xA, zA, n, b, u, v, w);
-          add3 (xA, zA, xA, zA, xT, zT, xA, zA, n, u, v, w); /* A = 3*A */
-        }
-      else if ((d - e) % 3 == 0)
-        { /* condition 8 */
-          d = (d - e) / 3;
-          add3 (xT, zT, xA, zA, xB, zB, xC, zC, n, u, v, w); /* T = f(A,B,C) */
-          add3 (xC, zC, xC, zC, xA, zA, xB, zB, n, u, v, w); /* C = f(A,C,B) */
-          mpres_swap (xB, xT, n);
-          mpres_swap (zB, zT, n); /* swap B and T */
-          duplicate (xT, zT, xA, zA, n, b, u, v, w);
-          add3 (xA, zA, xA, zA, xT, zT, xA, zA, n, u, v, w); /* A = 3*A */
-        }
-      else /* necessarily e is even here */
-        { /* condition 9 */
-          e /= 2;
-          add3 (xC, zC, xC, zC, xB, zB, xA, zA, n, u, v, w); /* C = f(C,B,A) */
-          duplicate (xB, zB, xB, zB, n, b, u, v, w); /* B = 2*B */
-        }
-    }
-  
-  add3 (xA, zA, xA, zA, xB, zB, xC, zC, n, u, v, w);
-
-  ASSERT(d == 1);
-}
+/* add3, duplicate and prac on mpres_t residues */
+#define ML_FN(name) name
+#define ML_EXPORT
+#define ML_RES mpres_t
+#define ML_PTR __mpz_struct *
+#define ML_ADD(r, a, b, n) mpres_add (r, a, b, n)
+#define ML_SUB(r, a, b, n) mpres_sub (r, a, b, n)
+#define ML_MUL(r, a, b, n) mpres_mul (r, a, b, n)
+#define ML_SQR(r, a, n) mpres_sqr (r, a, n)
+#define ML_SET(r, a, n) mpres_set (r, a, n)
+#define ML_SWAP(a, b, n) mpres_swap (a, b, n)
+#include "ecm_mont.h"
+#undef ML_FN
+#undef ML_EXPORT
+#undef ML_RES
+#undef ML_PTR
+#undef ML_ADD
+#undef ML_SUB
+#undef ML_MUL
+#undef ML_SQR
+#undef ML_SET
+#undef ML_SWAP
+
+/* add3f, duplicatef and pracf on fixed-width residues, for ECM_MOD_MODMULN */
+#define ML_FN(name) name ## f
+#define ML_EXPORT static
+#define ML_RES mpresf_t
+#define ML_PTR mp_limb_t *
+#define ML_ADD(r, a, b, n) mpresf_add (r, a, b, n)
+#define ML_SUB(r, a, b, n) mpresf_sub (r, a, b, n)
+#define ML_MUL(r, a, b, n) mpresf_mul (r, a, b, n)
+#define ML_SQR(r, a, n) mpresf_sqr (r, a, n)
+#define ML_SET(r, a, n) mpresf_set (r, a, n)
+#define ML_SWAP(a, b, n) mpresf_swap (a, b, n)
+#include "ecm_mont.h"
+#undef ML_FN
+#undef ML_EXPORT
+#undef ML_RES
+#undef ML_PTR
+#undef ML_ADD
+#undef ML_SUB
+#undef ML_MUL
+#undef ML_SQR
+#undef ML_SET
+#undef ML_SWAP
 
 /* Input: x is initial point
           A is curve parameter in Montgomery's form:
@@ -521,10 +339,14 @@ ecm_stage1 (mpz_t f, mpres_t x, mpres_t A, mpmod_t n, double B1,
             char *chkfilename)
 {
   mpres_t b, z, u, v, w, xB, zB, xC, zC, xT, zT, xT2, zT2;
-  uint64_t p, r, last_chkpnt_p;
-  int ret = ECM_NO_FACTOR_FOUND;
+  mpresf_t F = NULL, xf = NULL, zf = NULL, bf = NULL, t[11];
+  uint64_t p, r, k, l, last_chkpnt_p;
+  int ret = ECM_NO_FACTOR_FOUND, i, use_chains;
   long last_chkpnt_time;
   prime_info_t prime_info;
+  const ecm_uint *block;
+  ecm_uint ib, nb;
+  chains_t chains;
 
   prime_info_init (prime_info);
 
@@ -566,16 +388,78 @@ ecm_stage1 (mpz_t f, mpres_t x, mpres_t A, mpmod_t n, double B1,
         add3 (x, z, x, z, xB, zB, x, z, n, u, v, w);
       }
   
+  /* With MODMULN, the loop over the primes uses fixed-width residues,
+     stored one after the other in F */
+  if (n->repr == ECM_MOD_MODMULN)
+    {
+      mp_size_t nf = mpz_size (n->orig_modulus);
+
+      F = (mpresf_t) malloc (14 * nf * sizeof (mp_limb_t));
+      if (F != NULL)
+        {
+          xf = F;
+          zf = F + nf;
+          bf = F + 2 * nf;
+          for (i = 0; i < 11; i++)
+            t[i] = F + (3 + i) * nf;
+          mpresf_set_mpres (xf, x, n);
+          mpresf_set_mpres (zf, z, n);
+          mpresf_set_mpres (bf, b, n);
+        }
+    }
+
+  /* Precomputed chains (see chains.c) are only used for a stage 1 from
+     scratch, since a pair of primes may straddle B1done */
+  use_chains = *B1done < 5.0 && chains_init (chains, B1) == 0;
+
   last_chkpnt_p = 3;
   p = getprime_mt (prime_info); /* Puts 3 into p. Next call gives 5 */
-  for (p = getprime_mt (prime_info); p <= B1; p = getprime_mt (prime_info))
+  /* the primes from 5 on are read by blocks */
+  for (ib = nb = 0; ; )
     {
-      for (r = p; r <= B1; r *= p)
+      if (ib == nb)
+        {
+          nb = getprimes_mt (prime_info, &block);
+          ib = 0;
+        }
+      p = block[ib++];
+      if (p > B1)
+        break;
+
+      r = p;
+      if (use_chains)
+        switch (chains_next (chains, p, (uint64_t) B1, &k, &l))
+          {
+          case 1: /* p was multiplied in with a smaller prime */
+            r *= p;
+            break;
+          case 2: /* the chain for p or p*q, and for the powers of p if
+                     k = p */
+            do
+              {
+                if (F != NULL)
+                  lucas_chainf (xf, zf, k, l, n, bf, t[0], t[1], t[2], t[3],
+                                t[4], t[5], t[6], t[7], t[8], t[9], t[10]);
+                else
+                  lucas_chain (x, z, k, l, n, b, u, v, w, xB, zB, xC, zC, xT,
+                               zT, xT2, zT2);
+                r *= p;
+              }
+            while (k == p && r <= B1);
+            break;
+          }
+      for ( ; r <= B1; r *= p)
 	if (r > *B1done)
-	  prac (x, z, (ecm_uint) p, n, b, u, v, w, xB, zB, xC, zC, xT,
-		zT, xT2, zT2);
-
-      if (mpres_is_zero (z, n))
+          {
+            if (F != NULL)
+              pracf (xf, zf, (ecm_uint) p, n, bf, t[0], t[1], t[2], t[3],
+                     t[4], t[5], t[6], t[7], t[8], t[9], t[10]);
+            else
+              prac (x, z, (ecm_uint) p, n, b, u, v, w, xB, zB, xC, zC, xT,
+                    zT, xT2, zT2);
+          }
+
+      if (F != NULL ? mpresf_is_zero (zf, n) : mpres_is_zero (z, n))
         {
           outputf (OUTPUT_VERBOSE, "Reached point at infinity, %.0f divides "
                    "group orders\n", p);
@@ -591,12 +475,26 @@ ecm_stage1 (mpz_t f, mpres_t x, mpres_t A, mpmod_t n, double B1,
       if (chkfilename != NULL && p > last_chkpnt_p + 10000 && 
           elltime (last_chkpnt_time, cputime ()) > CHKPNT_PERIOD)
         {
+          if (F != NULL)
+            {
+              mpres_set_mpresf (x, xf, n);
+              mpres_set_mpresf (z, zf, n);
+            }
 	  writechkfile (chkfilename, ECM_ECM, MAX(p, *B1done), n, A, x, NULL, z);
           last_chkpnt_p = p;
           last_chkpnt_time = cputime ();
         }
     }
   
+  if (F != NULL)
+    {
+      mpres_set_mpresf (x, xf, n);
+      mpres_set_mpresf (z, zf, n);
+      free (F);
+    }
+  if (use_chains)
+    chains_clear (chains);
+
   /* If stage 1 finished normally, p is the smallest prime >B1 here.
      In that case, set to B1 */
   if (p > B1)
@@ -718,7 +616,8 @@ ecm_stage1_W (mpz_t f, ell_curve_t E, ell_point_t P, mpmod_t n,
 		    if(status == 0){
 		    }
 		    else if(E->law == ECM_LAW_HOMOGENEOUS){
-			if(E->type == ECM_EC_TYPE_TWISTED_HESSIAN)
+			if(E->type == ECM_EC_TYPE_TWISTED_HESSIAN
+			   || E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
 			    mpres_gcd(f, Q->x, n);
 			else
 			    mpres_gcd(f, Q->z, n);
@@ -801,8 +700,10 @@ ecm_stage1_W (mpz_t f, ell_curve_t E, ell_point_t P, mpmod_t n,
 	    ret = ECM_FACTOR_FOUND_STEP1;
 	}
 	else{
-	    /* for affine case, z = 1 anyway */
-	    if(E->law == ECM_LAW_HOMOGENEOUS){
+	    /* for affine case, z = 1 anyway; the twisted Edwards form is
+	       mapped to the Montgomery form by ecm_stage1_E instead */
+	    if(E->law == ECM_LAW_HOMOGENEOUS
+	       && E->type != ECM_EC_TYPE_TWISTED_EDWARDS){
 		if (!mpres_invert (xB, P->z, n)){ /* Factor found? */
 		    mpres_gcd (f, P->z, n);
 		    gmp_printf("# factor found during normalization: %Zd\n", f);
@@ -830,6 +731,39 @@ ecm_stage1_W (mpz_t f, ell_curve_t E, ell_point_t P, mpmod_t n,
     
     return ret;
 }
+
+/* Stage 1 on the twisted Edwards form of the Montgomery curve
+   g*y^2 = x^3 + A*x^2 + x, where the additions cost 9M instead of 6M for
+   the differential ones, but the width-w NAF of batch_s (when it is not 1)
+   needs much fewer additions than the Montgomery ladder. The input and
+   output are those of ecm_stage1: x is the x-coordinate on the Montgomery
+   curve, which is what stage 2 and the save files use.
+*/
+static int
+ecm_stage1_E (mpz_t f, ell_curve_t E, mpres_t x, mpres_t A, mpmod_t n,
+	      double B1, double *B1done, mpz_t batch_s, mpz_t go,
+	      int (*stop_asap)(void), char *chkfilename)
+{
+  ell_point_t P;
+  int ret;
+
+  E->law = ECM_LAW_HOMOGENEOUS;
+  ell_point_init (P, E, n);
+  montgomery_to_twisted_edwards (E, P, x, A, n);
+  /* checkpoints on the Edwards form could not be resumed */
+  ret = ecm_stage1_W (f, E, P, n, B1, B1done, batch_s, go, stop_asap, NULL);
+  if (ret == ECM_NO_FACTOR_FOUND)
+    {
+      ret = twisted_edwards_to_montgomery (f, x, P->y, P->z, n);
+      if (ret == ECM_NO_FACTOR_FOUND && chkfilename != NULL)
+        {
+          mpres_set_ui (P->z, 1, n);
+          writechkfile (chkfilename, ECM_ECM, *B1done, n, A, x, NULL, P->z);
+        }
+    }
+  ell_point_clear (P, E, n);
+  return ret;
+}
 #endif
 
 /* choose "optimal" S according to step 2 range B2 */
@@ -1176,8 +1110,9 @@ ecm (mpz_t f, mpz_t x, mpz_t y, int param, mpz_t sigma, mpz_t n, mpz_t go,
   /* when dealing with several input numbers, if we had already computed
      batch_s, but the new number uses the base-2 representation, then we
      are forced to use ECM_PARAM_SUYAMA, and we reset batch_s to 1 to avoid
-     the error "-bsaves/-bloads makes sense in batch mode only" below */
-  if (param == ECM_PARAM_SUYAMA)
+     the error "-bsaves/-bloads makes sense in batch mode only" below;
+     stage 1 on the twisted Edwards form uses batch_s with any param */
+  if (param == ECM_PARAM_SUYAMA && zE->type != ECM_EC_TYPE_TWISTED_EDWARDS)
     mpz_set_ui (batch_s, 1);
 
   /* In batch mode, 
@@ -1364,7 +1299,8 @@ ecm (mpz_t f, mpz_t x, mpz_t y, int param, mpz_t sigma, mpz_t n, mpz_t go,
 #endif
               mpres_set_z(P.A, zE->a4, modulus);
 #ifdef HAVE_ADDLAWS
-	      else if(E->type == ECM_EC_TYPE_MONTGOMERY)
+	      else if(E->type == ECM_EC_TYPE_MONTGOMERY
+		      || E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
 		  mpres_set_z(P.A, zE->a2, modulus);
 #endif
               mpres_set_z (P.x, x, modulus);
@@ -1413,15 +1349,13 @@ ecm (mpz_t f, mpz_t x, mpz_t y, int param, mpz_t sigma, mpz_t n, mpz_t go,
         }
     }
 
-  /* Compute s for the batch mode */
-  if (IS_BATCH_MODE(param) && ECM_IS_DEFAULT_B1_DONE(*B1done) &&
+  /* Compute s for the batch mode, or for the twisted Edwards form */
+  if ((IS_BATCH_MODE(param) || E->type == ECM_EC_TYPE_TWISTED_EDWARDS) &&
+      ECM_IS_DEFAULT_B1_DONE(*B1done) &&
       (B1 != *batch_last_B1_used || mpz_cmp_ui (batch_s, 1) <= 0))
     {
-      *batch_last_B1_used = B1;
-
       st = cputime ();
-      /* construct the batch exponent */
-      compute_s (batch_s, B1, NULL);
+      batch_s_update (batch_s, B1, batch_last_B1_used, param);
       outputf (OUTPUT_VERBOSE, "Computing batch product (of %" PRIu64
                                " bits) of primes up to B1=%1.0f took %ldms\n",
                                mpz_sizeinbase (batch_s, 2), B1,
@@ -1445,7 +1379,7 @@ ecm (mpz_t f, mpz_t x, mpz_t y, int param, mpz_t sigma, mpz_t n, mpz_t go,
 
   if (B1 > *B1done || mpz_cmp_ui (go, 1) > 0)
     {
-        if (IS_BATCH_MODE(param))
+        if (IS_BATCH_MODE(param) && E->type != ECM_EC_TYPE_TWISTED_EDWARDS)
         /* FIXME: go, stop_asap and chkfilename are ignored in batch mode */
 	    youpi = ecm_stage1_batch (f, P.x, P.A, modulus, B1, B1done, 
 				      param, batch_s);
@@ -1456,6 +1390,9 @@ ecm (mpz_t f, mpz_t x, mpz_t y, int param, mpz_t sigma, mpz_t n, mpz_t go,
             youpi = ecm_stage1 (f, P.x, P.A, modulus, B1, B1done, go, 
                                 stop_asap, chkfilename);
 #ifdef HAVE_ADDLAWS
+	    else if(E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
+		youpi = ecm_stage1_E (f, E, P.x, P.A, modulus, B1, B1done,
+				      batch_s, go, stop_asap, chkfilename);
 	    else{
 		ell_point_init(PE, E, modulus);
 		mpres_set(PE->x, P.x, modulus);
@@ -1522,9 +1459,10 @@ ecm (mpz_t f, mpz_t x, mpz_t y, int param, mpz_t sigma, mpz_t n, mpz_t go,
   if (stop_asap != NULL && (*stop_asap) ())
     goto end_of_ecm_rhotable;
 
-  /* If using 2^k +/-1 modulus and 'nobase2step2' flag is set,
+  /* If using 2^k +/-1 or k*2^n+c modulus and 'nobase2step2' flag is set,
      set default (-nobase2) modular method and remap P.x, P.y, and P.A */
-  if (modulus->repr == ECM_MOD_BASE2 && nobase2step2)
+  if ((modulus->repr == ECM_MOD_BASE2 || modulus->repr == ECM_MOD_KBNC ||
+       modulus->repr == ECM_MOD_DWT) && nobase2step2)
     {
       mpz_t x_t, y_t, A_t;
 
@@ -1553,7 +1491,8 @@ ecm (mpz_t f, mpz_t x, mpz_t y, int param, mpz_t sigma, mpz_t n, mpz_t go,
     }
 
 #ifdef HAVE_ADDLAWS
-  if (E->type == ECM_EC_TYPE_MONTGOMERY)
+  if (E->type == ECM_EC_TYPE_MONTGOMERY
+      || E->type == ECM_EC_TYPE_TWISTED_EDWARDS)
 #endif
   youpi = montgomery_to_weierstrass (f, P.x, P.y, P.A, modulus);
 #ifdef HAVE_ADDLAWS
@@ -0,0 +1,274 @@
+/* ecm_mont.h - arithmetic on Montgomery curves for stage 1 of ECM: addition,
+   duplication and multiplication by a prime with Lucas chains (PRAC).
+   This file is included by ecm.c once for each residue type, with the
+   following macros defined:
+
+   ML_FN(name)    name of the instance of a function
+   ML_EXPORT      storage class of add3 and duplicate (empty or static)
+   ML_RES         type of a residue argument
+   ML_PTR         type of a pointer to a residue
+   ML_ADD(r, a, b, n), ML_SUB(r, a, b, n), ML_MUL(r, a, b, n),
+   ML_SQR(r, a, n), ML_SET(r, a, n), ML_SWAP(a, b, n)
+                  arithmetic on residues modulo n, where ML_SWAP exchanges
+                  the values of a and b
+
+Copyright 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011,
+2012, 2016, 2026 Paul Zimmermann, Alexander Kruppa, Cyril Bouvier, David
+Cleaver.
+
+This file is part of the ECM Library.
+
+The ECM Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The ECM Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the ECM Library; see the file COPYING.LIB.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* adds Q=(x2:z2) and R=(x1:z1) and puts the result in (x3:z3),
+     using 6 muls (4 muls and 2 squares), and 6 add/sub.
+   One assumes that Q-R=P or R-Q=P where P=(x:z).
+     - n : number to factor
+     - u, v, w : auxiliary variables
+   Modifies: x3, z3, u, v, w.
+   (x3,z3) may be identical to (x2,z2) and to (x,z)
+*/
+ML_EXPORT void
+ML_FN(add3) (ML_RES x3, ML_RES z3, ML_RES x2, ML_RES z2, ML_RES x1,
+             ML_RES z1, ML_RES x, ML_RES z, mpmod_t n, ML_RES u, ML_RES v,
+             ML_RES w)
+{
+  ML_SUB (u, x2, z2, n);
+  ML_ADD (v, x1, z1, n);      /* u = x2-z2, v = x1+z1 */
+
+  ML_MUL (u, u, v, n);        /* u = (x2-z2)*(x1+z1) */
+
+  ML_ADD (w, x2, z2, n);
+  ML_SUB (v, x1, z1, n);      /* w = x2+z2, v = x1-z1 */
+
+  ML_MUL (v, w, v, n);        /* v = (x2+z2)*(x1-z1) */
+
+  ML_ADD (w, u, v, n);        /* w = 2*(x1*x2-z1*z2) */
+  ML_SUB (v, u, v, n);        /* v = 2*(x2*z1-x1*z2) */
+
+  ML_SQR (w, w, n);           /* w = 4*(x1*x2-z1*z2)^2 */
+  ML_SQR (v, v, n);           /* v = 4*(x2*z1-x1*z2)^2 */
+
+  if (x == x3) /* same variable: in-place variant */
+    {
+      /* x3 <- w * z mod n
+	 z3 <- x * v mod n */
+      ML_MUL (z3, w, z, n);
+      ML_MUL (x3, x, v, n);
+      ML_SWAP (x3, z3, n);
+    }
+  else
+    {
+      ML_MUL (x3, w, z, n);   /* x3 = 4*z*(x1*x2-z1*z2)^2 mod n */
+      ML_MUL (z3, x, v, n);   /* z3 = 4*x*(x2*z1-x1*z2)^2 mod n */
+    }
+  /* mul += 6; */
+}
+
+/* computes 2P=(x2:z2) from P=(x1:z1), with 5 muls (3 muls and 2 squares)
+   and 4 add/sub.
+     - n : number to factor
+     - b : (a+2)/4 mod n
+     - t, u, v, w : auxiliary variables
+*/
+ML_EXPORT void
+ML_FN(duplicate) (ML_RES x2, ML_RES z2, ML_RES x1, ML_RES z1, mpmod_t n,
+                  ML_RES b, ML_RES u, ML_RES v, ML_RES w)
+{
+  ML_ADD (u, x1, z1, n);
+  ML_SQR (u, u, n);      /* u = (x1+z1)^2 mod n */
+  ML_SUB (v, x1, z1, n);
+  ML_SQR (v, v, n);      /* v = (x1-z1)^2 mod n */
+  ML_MUL (x2, u, v, n);  /* x2 = u*v = (x1^2 - z1^2)^2 mod n */
+  ML_SUB (w, u, v, n);   /* w = u-v = 4*x1*z1 */
+  ML_MUL (u, w, b, n);   /* u = w*b = ((A+2)/4*(4*x1*z1)) mod n */
+  ML_ADD (u, u, v, n);   /* u = (x1-z1)^2+(A+2)/4*(4*x1*z1) */
+  ML_MUL (z2, w, u, n);  /* z2 = ((4*x1*z1)*((x1-z1)^2+(A+2)/4*(4*x1*z1))) mod n */
+}
+
+/* computes kP from P=(xA:zA) and puts the result in (xA:zA), with the PRAC
+   chain starting from r, where k/2 < r < k and gcd(k, r) = 1. The same
+   warning as for prac applies. */
+static void
+ML_FN(lucas_chain) (ML_RES xA, ML_RES zA, uint64_t k, uint64_t r, mpmod_t n,
+                    ML_RES b, ML_RES u, ML_RES v, ML_RES w, ML_RES xB,
+                    ML_RES zB, ML_RES xC, ML_RES zC, ML_RES xT, ML_RES zT,
+                    ML_RES xT2, ML_RES zT2)
+{
+  uint64_t d, e;
+  ML_PTR tmp;
+
+  /* first iteration always begins by Condition 3, then a swap */
+  d = k - r;
+  e = 2 * r - k;
+  ML_SET (xB, xA, n);
+  ML_SET (zB, zA, n); /* B=A */
+  ML_SET (xC, xA, n);
+  ML_SET (zC, zA, n); /* C=A */
+  ML_FN(duplicate) (xA, zA, xA, zA, n, b, u, v, w); /* A = 2*A */
+  while (d != e)
+    {
+      if (d < e)
+        {
+          r = d;
+          d = e;
+          e = r;
+          ML_SWAP (xA, xB, n);
+          ML_SWAP (zA, zB, n);
+        }
+      /* do the first line of Table 4 whose condition qualifies */
+      if (d - e <= e / 4 && ((d + e) % 3) == 0)
+        { /* condition 1 */
+          d = (2 * d - e) / 3;
+          e = (e - d) / 2;
+          ML_FN(add3) (xT, zT, xA, zA, xB, zB, xC, zC, n, u, v, w); /* T = f(A,B,C) */
+          ML_FN(add3) (xT2, zT2, xT, zT, xA, zA, xB, zB, n, u, v, w); /* T2 = f(T,A,B) */
+          ML_FN(add3) (xB, zB, xB, zB, xT, zT, xA, zA, n, u, v, w); /* B = f(B,T,A) */
+          ML_SWAP (xA, xT2, n);
+          ML_SWAP (zA, zT2, n); /* swap A and T2 */
+        }
+      else if (d - e <= e / 4 && (d - e) % 6 == 0)
+        { /* condition 2 */
+          d = (d - e) / 2;
+          ML_FN(add3) (xB, zB, xA, zA, xB, zB, xC, zC, n, u, v, w); /* B = f(A,B,C) */
+          ML_FN(duplicate) (xA, zA, xA, zA, n, b, u, v, w); /* A = 2*A */
+        }
+      else if ((d + 3) / 4 <= e)
+        { /* condition 3 */
+          d -= e;
+          ML_FN(add3) (xT, zT, xB, zB, xA, zA, xC, zC, n, u, v, w); /* T = f(B,A,C) */
+          /* circular permutation (B,T,C) */
+          tmp = xB;
+          xB = xT;
+          xT = xC;
+          xC = tmp;
+          tmp = zB;
+          zB = zT;
+          zT = zC;
+          zC = tmp;
+        }
+      else if ((d + e) % 2 == 0)
+        { /* condition 4 */
+          d = (d - e) / 2;
+          ML_FN(add3) (xB, zB, xB, zB, xA, zA, xC, zC, n, u, v, w); /* B = f(B,A,C) */
+          ML_FN(duplicate) (xA, zA, xA, zA, n, b, u, v, w); /* A = 2*A */
+        }
+      /* now d+e is odd */
+      else if (d % 2 == 0)
+        { /* condition 5 */
+          d /= 2;
+          ML_FN(add3) (xC, zC, xC, zC, xA, zA, xB, zB, n, u, v, w); /* C = f(C,A,B) */
+          ML_FN(duplicate) (xA, zA, xA, zA, n, b, u, v, w); /* A = 2*A */
+        }
+      /* now d is odd, e is even */
+      else if (d % 3 == 0)
+        { /* condition 6 */
+          d = d / 3 - e;
+          ML_FN(duplicate) (xT, zT, xA, zA, n, b, u, v, w); /* T = 2*A */
+          ML_FN(add3) (xT2, zT2, xA, zA, xB, zB, xC, zC, n, u, v, w); /* T2 = f(A,B,C) */
+          ML_FN(add3) (xA, zA, xT, zT, xA, zA, xA, zA, n, u, v, w); /* A = f(T,A,A) */
+          ML_FN(add3) (xT, zT, xT, zT, xT2, zT2, xC, zC, n, u, v, w); /* T = f(T,T2,C) */
+          /* circular permutation (C,B,T) */
+          tmp = xC;
+          xC = xB;
+          xB = xT;
+          xT = tmp;
+          tmp = zC;
+          zC = zB;
+          zB = zT;
+          zT = tmp;
+        }
+      else if ((d + e) % 3 == 0)
+        { /* condition 7 */
+          d = (d - 2 * e) / 3;
+          ML_FN(add3) (xT, zT, xA, zA, xB, zB, xC, zC, n, u, v, w); /* T = f(A,B,C) */
+          ML_FN(add3) (xB, zB, xT, zT, xA, zA, xB, zB, n, u, v, w); /* B = f(T,A,B) */
+          ML_FN(duplicate) (xT, zT, xA, zA, n, b, u, v, w);
+          ML_FN(add3) (xA, zA, xA, zA, xT, zT, xA, zA, n, u, v, w); /* A = 3*A */
+        }
+      else if ((d - e) % 3 == 0)
+        { /* condition 8 */
+          d = (d - e) / 3;
+          ML_FN(add3) (xT, zT, xA, zA, xB, zB, xC, zC, n, u, v, w); /* T = f(A,B,C) */
+          ML_FN(add3) (xC, zC, xC, zC, xA, zA, xB, zB, n, u, v, w); /* C = f(A,C,B) */
+          ML_SWAP (xB, xT, n);
+          ML_SWAP (zB, zT, n); /* swap B and T */
+          ML_FN(duplicate) (xT, zT, xA, zA, n, b, u, v, w);
+          ML_FN(add3) (xA, zA, xA, zA, xT, zT, xA, zA, n, u, v, w); /* A = 3*A */
+        }
+      else /* necessarily e is even here */
+        { /* condition 9 */
+          e /= 2;
+          ML_FN(add3) (xC, zC, xC, zC, xB, zB, xA, zA, n, u, v, w); /* C = f(C,B,A) */
+          ML_FN(duplicate) (xB, zB, xB, zB, n, b, u, v, w); /* B = 2*B */
+        }
+    }
+  
+  ML_FN(add3) (xA, zA, xA, zA, xB, zB, xC, zC, n, u, v, w);
+
+  ASSERT(d == 1);
+}
+
+/* computes kP from P=(xA:zA) and puts the result in (xA:zA). Assumes k>2. 
+   WARNING! The calls to add3() assume that the two input points are distinct,
+   which is not neccessarily satisfied. The result can be that in rare cases
+   the point at infinity (z==0) results when it shouldn't. A test case is 
+   echo 33554520197234177 | ./ecm -sigma 2046841451 373 1
+   which finds the prime even though it shouldn't (23^2=529 divides order).
+   This is not a problem for ECM since at worst we'll find a factor we 
+   shouldn't have found. For other purposes (i.e. primality proving) this 
+   would have to be fixed first.
+*/
+
+static void
+ML_FN(prac) (ML_RES xA, ML_RES zA, ecm_uint k, mpmod_t n, ML_RES b,
+             ML_RES u, ML_RES v, ML_RES w, ML_RES xB, ML_RES zB, ML_RES xC,
+             ML_RES zC, ML_RES xT, ML_RES zT, ML_RES xT2, ML_RES zT2)
+{
+  ecm_uint d, i = 0, nv;
+  double c, cmin;
+#define NV 10  
+  /* 1/val[0] = the golden ratio (1+sqrt(5))/2, and 1/val[i] for i>0
+     is the real number whose continued fraction expansion is all 1s
+     except for a 2 in i+1-st place */
+  static double val[NV] =
+    { 0.61803398874989485, 0.72360679774997897, 0.58017872829546410,
+      0.63283980608870629, 0.61242994950949500, 0.62018198080741576,
+      0.61721461653440386, 0.61834711965622806, 0.61791440652881789,
+      0.61807966846989581};
+
+  /* for small n, it makes no sense to try 10 different Lucas chains */
+  nv = mpz_size ((mpz_ptr) n);
+  if (nv > NV)
+    nv = NV;
+
+  if (nv > 1)
+    {
+      /* chooses the best value of v */
+      for (d = 0, cmin = ADD * (double) k; d < nv; d++)
+        {
+          c = lucas_cost (k, val[d]);
+          if (c < cmin)
+            {
+              cmin = c;
+              i = d;
+            }
+        }
+    }
+
+  ML_FN(lucas_chain) (xA, zA, k, (ecm_uint) ((double) k * val[i] + 0.5), n,
+                      b, u, v, w, xB, zB, xC, zC, xT, zT, xT2, zT2);
+}
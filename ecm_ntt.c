@@ -30,6 +30,18 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #include <unistd.h> /* for unlink */
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+
+/* The nodes of a level of the product tree are independent, and use
+   disjoint parts of the NTT vectors. When there are at least as many nodes
+   as threads, each thread does whole nodes (with the static schedule, the
+   same coefficients at each level, see init_list2); otherwise the threads
+   share each product (see mpzspv_mul_ntt). */
+#define NTT_TREE_PARALLEL(nodes) \
+  ((nodes) > 1 && (nodes) >= (long) omp_get_max_threads ())
+#endif
+
 #define UNUSED 0
 
 /* memory: 4 * len mpspv coeffs */
@@ -108,8 +120,9 @@ ntt_PolyFromRoots_Tree (mpzv_t r, mpzv_t a, spv_size_t len, mpzv_t t,
     int dolvl, mpzspm_t mpzspm, mpzv_t *Tree, FILE *TreeFile)
 {
   mpzspv_t x;
-  spv_size_t i, m, m_max;
-  mpzv_t src;
+  spv_size_t m, m_max;
+  long i, nodes;
+  mpzv_t src, d;
   mpzv_t *dst = Tree + ceil_log2 (len) - 1;
 
   ASSERT (len == ((spv_size_t)1) << ceil_log2 (len));
@@ -147,10 +160,24 @@ ntt_PolyFromRoots_Tree (mpzv_t r, mpzv_t a, spv_size_t len, mpzv_t t,
           return ECM_ERROR;
         }
 
-      for (i = 0; i < len; i += 2 * m)
-	list_mul (t + i, src + i, m, src + i + m, m, 1, t + len);
-
-      list_mod (*dst, t, len, mpzspm->modulus);
+      /* Fermat = 0 here, so that list_mul does not use its scratch space */
+      d = *dst;
+      nodes = (long) (len / (2 * m));
+#ifdef _OPENMP
+#pragma omp parallel if (NTT_TREE_PARALLEL (nodes))
+#endif
+      {
+        ECM_FERMAT = 0; /* in the context of each thread of the team */
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (i = 0; i < nodes; i++)
+          {
+            list_mul (t + 2 * m * i, src + 2 * m * i, m,
+                      src + 2 * m * i + m, m, 1, t + len);
+            list_mod (d + 2 * m * i, t + 2 * m * i, 2 * m, mpzspm->modulus);
+          }
+      }
       
       src = *dst--;
     }
@@ -164,21 +191,27 @@ ntt_PolyFromRoots_Tree (mpzv_t r, mpzv_t a, spv_size_t len, mpzv_t t,
       if (m == len / 2)
         dst = &r;
       
-      for (i = 0; i < 2 * len; i += 4 * m)
+      if (TreeFile && list_out_raw (TreeFile, src, len) == ECM_ERROR)
+        return ECM_ERROR;
+
+      d = *dst;
+      nodes = (long) (len / (2 * m));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (NTT_TREE_PARALLEL (nodes))
+#endif
+      for (i = 0; i < nodes; i++)
         {
- 	  if (TreeFile &&
-	      list_out_raw (TreeFile, src + i / 2, 2 * m) == ECM_ERROR)
-	    return ECM_ERROR;
-	  
-	  mpzspv_from_mpzv (x, i, src + i / 2, m, mpzspm);
-	  mpzspv_from_mpzv (x, i + 2 * m, src + i / 2 + m, m, mpzspm);
-          mpzspv_mul_ntt (x, i, x, i, m, x, i + 2 * m, m, 2 * m, 1, 2 * m, mpzspm,
+          spv_size_t j = 4 * m * (spv_size_t) i; /* offset in x */
+
+	  mpzspv_from_mpzv (x, j, src + j / 2, m, mpzspm);
+	  mpzspv_from_mpzv (x, j + 2 * m, src + j / 2 + m, m, mpzspm);
+          mpzspv_mul_ntt (x, j, x, j, m, x, j + 2 * m, m, 2 * m, 1, 2 * m, mpzspm,
             NTT_MUL_STEP_FFT1 + NTT_MUL_STEP_FFT2 + NTT_MUL_STEP_MUL + NTT_MUL_STEP_IFFT);
-          mpzspv_to_mpzv (x, i, *dst + i / 2, 2 * m, mpzspm);
+          mpzspv_to_mpzv (x, j, d + j / 2, 2 * m, mpzspm);
 
           /* we only do the mod reduction to reduce the file size a bit */
 	  if (TreeFile)
-	    list_mod (*dst + i / 2, *dst + i / 2, 2 * m, mpzspm->modulus);
+	    list_mod (d + j / 2, d + j / 2, 2 * m, mpzspm->modulus);
 	}
     
       src = *dst--;
@@ -294,6 +327,8 @@ ntt_polyevalT (mpzv_t b, spv_size_t len, mpzv_t *Tree, mpzv_t T,
                    mpzspv_t sp_invF, mpzspm_t mpzspm, char *TreeFilenameStem)
 {
   spv_size_t m, i;
+  long k, nodes;
+  mpzv_t tree;
   FILE *TreeFile = NULL;
   /* assume this "small" malloc will not fail in normal usage */
   char *TreeFilename = NULL;
@@ -344,28 +379,35 @@ ntt_polyevalT (mpzv_t b, spv_size_t len, mpzv_t *Tree, mpzv_t T,
 	  unlink (TreeFilename);
 	}
 
-      for (i = 0; i < len; i += 2 * m)
+      /* the node at offset o uses x[2o..2o+4m-1] and y[o..o+2m-1] */
+      tree = *Tree;
+      nodes = (long) (len / (2 * m));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (NTT_TREE_PARALLEL (nodes))
+#endif
+      for (k = 0; k < nodes; k++)
         {
+          spv_size_t o = 2 * m * (spv_size_t) k, j = 2 * o;
 	  
-	  list_revert (*Tree + i, m);
-          mpzspv_set_sp (x, 0, 1, 1, mpzspm);
-          mpzspv_from_mpzv (x, 1, *Tree + i, m, mpzspm);
+	  list_revert (tree + o, m);
+          mpzspv_set_sp (x, j, 1, 1, mpzspm);
+          mpzspv_from_mpzv (x, j + 1, tree + o, m, mpzspm);
 	  /* x contains reversed monic poly */
-          mpzspv_mul_ntt (x, 0, x, 0, m + 1, y, i, 2 * m, 2 * m, 0, 0, mpzspm, 
+          mpzspv_mul_ntt (x, j, x, j, m + 1, y, o, 2 * m, 2 * m, 0, 0, mpzspm, 
             NTT_MUL_STEP_FFT1 + NTT_MUL_STEP_FFT2 + NTT_MUL_STEP_MUL + NTT_MUL_STEP_IFFT);
           if (m > POLYEVALT_NTT_THRESHOLD)
-	    mpzspv_normalise (x, m, m, mpzspm);
+	    mpzspv_normalise (x, j + m, m, mpzspm);
 	    
-	  list_revert (*Tree + i + m, m);
-	  mpzspv_set_sp (x, 2 * m, 1, 1, mpzspm);
-	  mpzspv_from_mpzv (x, 2 * m + 1, *Tree + i + m, m, mpzspm);
-          mpzspv_mul_ntt(x, 2 * m, x, 2 * m, m + 1, y, i, UNUSED, 2 * m, 0, 0, mpzspm, 
+	  list_revert (tree + o + m, m);
+	  mpzspv_set_sp (x, j + 2 * m, 1, 1, mpzspm);
+	  mpzspv_from_mpzv (x, j + 2 * m + 1, tree + o + m, m, mpzspm);
+          mpzspv_mul_ntt(x, j + 2 * m, x, j + 2 * m, m + 1, y, o, UNUSED, 2 * m, 0, 0, mpzspm, 
             NTT_MUL_STEP_FFT1 + NTT_MUL_STEP_MUL + NTT_MUL_STEP_IFFT);
 	  if (m > POLYEVALT_NTT_THRESHOLD)
-	    mpzspv_normalise (x, 3 * m, m, mpzspm);
+	    mpzspv_normalise (x, j + 3 * m, m, mpzspm);
 	  
-	  mpzspv_set (y, i, x, 3 * m, m, mpzspm);
-	  mpzspv_set (y, i + m, x, m, m, mpzspm);
+	  mpzspv_set (y, o, x, j + 3 * m, m, mpzspm);
+	  mpzspv_set (y, o + m, x, j + m, m, mpzspm);
         }
       
       Tree++;
@@ -0,0 +1,355 @@
+/* ecmchains.c - precomputes the Lucas chains for stage 1 of ECM.
+
+Copyright 2026 Paul Zimmermann, Alexander Kruppa.
+
+This file is part of the ECM Library.
+
+The ECM Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The ECM Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the ECM Library; see the file COPYING.LIB.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* Usage: ecmchains [-d delta] [-w window] dir B1 [B1 ...]
+
+   Writes the cache file dir/chains-B1 for each B1 (see chains.c), which
+   ecm -cachedir dir uses for stage 1 with param 0. For each prime p, the
+   chain starts from the best r among chains_r0(p)+i for |i| <= delta and
+   the 10 values tried by prac, and p is paired with one of the next
+   primes when the chain for the product is cheaper. Larger values of delta
+   and window (at most CHAINS_WINDOW) give slightly shorter chains, at the
+   expense of a longer precomputation. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ecm-impl.h"
+#include "getprime_r.h"
+
+#define ADD 6 /* number of multiplications in an addition */
+#define DUP 5 /* number of multiplications in a duplicate */
+
+static double val[10] =
+  { 0.61803398874989485, 0.72360679774997897, 0.58017872829546410,
+    0.63283980608870629, 0.61242994950949500, 0.62018198080741576,
+    0.61721461653440386, 0.61834711965622806, 0.61791440652881789,
+    0.61807966846989581};
+
+static uint64_t
+gcd64 (uint64_t a, uint64_t b)
+{
+  uint64_t t;
+
+  while (b != 0)
+    {
+      t = a % b;
+      a = b;
+      b = t;
+    }
+  return a;
+}
+
+/* The number of multiplications of the chain for k starting from r, as
+   lucas_chain in ecm_mont.h does it, or a number >= limit if it is at
+   least limit. The numbers of additions and duplicates are added to
+   *adds and *dups if these are not NULL. */
+static unsigned long
+chain_cost (uint64_t k, uint64_t r, unsigned long limit, unsigned long *adds,
+            unsigned long *dups)
+{
+  uint64_t d, e;
+  unsigned long a = 1, u = 1; /* initial duplicate and final addition */
+
+  d = k - r;
+  e = 2 * r - k;
+  while (d != e && ADD * a + DUP * u < limit)
+    {
+      if (d < e)
+        {
+          r = d;
+          d = e;
+          e = r;
+        }
+      if (d - e <= e / 4 && ((d + e) % 3) == 0)
+        { /* condition 1 */
+          d = (2 * d - e) / 3;
+          e = (e - d) / 2;
+          a += 3;
+        }
+      else if (d - e <= e / 4 && (d - e) % 6 == 0)
+        { /* condition 2 */
+          d = (d - e) / 2;
+          a++;
+          u++;
+        }
+      else if ((d + 3) / 4 <= e)
+        { /* condition 3 */
+          d -= e;
+          a++;
+        }
+      else if ((d + e) % 2 == 0)
+        { /* condition 4 */
+          d = (d - e) / 2;
+          a++;
+          u++;
+        }
+      else if (d % 2 == 0)
+        { /* condition 5 */
+          d /= 2;
+          a++;
+          u++;
+        }
+      else if (d % 3 == 0)
+        { /* condition 6 */
+          d = d / 3 - e;
+          a += 3;
+          u++;
+        }
+      else if ((d + e) % 3 == 0)
+        { /* condition 7 */
+          d = (d - 2 * e) / 3;
+          a += 3;
+          u++;
+        }
+      else if ((d - e) % 3 == 0)
+        { /* condition 8 */
+          d = (d - e) / 3;
+          a += 3;
+          u++;
+        }
+      else
+        { /* condition 9 */
+          e /= 2;
+          a++;
+          u++;
+        }
+    }
+  if (adds != NULL)
+    {
+      *adds += a;
+      *dups += u;
+    }
+  return ADD * a + DUP * u;
+}
+
+/* Sets *r to the best start of a chain for k, and returns its cost */
+static unsigned long
+best_chain (uint64_t k, long delta, uint64_t *r)
+{
+  unsigned long c, cmin = ~0UL;
+  uint64_t s, r0 = chains_r0 (k);
+  long i;
+
+  *r = 0;
+  for (i = -delta; i <= delta + 10; i++)
+    {
+      s = (i <= delta) ? r0 + i : (uint64_t) ((double) k * val[i - delta - 1]
+                                              + 0.5);
+      if (2 * s <= k || s >= k || gcd64 (k, s) != 1)
+        continue;
+      c = chain_cost (k, s, cmin, NULL, NULL);
+      if (c < cmin)
+        {
+          cmin = c;
+          *r = s;
+        }
+    }
+  ASSERT_ALWAYS (*r != 0);
+  return cmin;
+}
+
+/* The cost of the chain prac uses for k, for a number of 10 limbs or more */
+static unsigned long
+prac_cost (uint64_t k, unsigned long *adds, unsigned long *dups)
+{
+  unsigned long c, cmin = ~0UL;
+  uint64_t r = 0;
+  int i;
+
+  for (i = 0; i < 10; i++)
+    {
+      c = chain_cost (k, (uint64_t) ((double) k * val[i] + 0.5), cmin, NULL,
+                      NULL);
+      if (c < cmin)
+        {
+          cmin = c;
+          r = (uint64_t) ((double) k * val[i] + 0.5);
+        }
+    }
+  return chain_cost (k, r, ~0UL, adds, dups);
+}
+
+typedef struct
+{
+  uint64_t p, q, r;
+  unsigned long cost;
+} entry_t;
+
+typedef struct
+{
+  unsigned char *data;
+  size_t size, alloc;
+  uint64_t last; /* the prime of the last entry written */
+  unsigned long adds, dups;
+} table_t;
+
+static void
+table_put (table_t *t, entry_t *e)
+{
+  uint64_t k, z, r0;
+
+  if (t->size + 30 > t->alloc)
+    {
+      t->alloc = 2 * t->alloc + 1024;
+      t->data = (unsigned char *) realloc (t->data, t->alloc);
+      ASSERT_ALWAYS (t->data != NULL);
+    }
+  k = (e->q == 0) ? e->p : e->p * e->q;
+  r0 = chains_r0 (k);
+  z = (e->r >= r0) ? 2 * (e->r - r0) : 2 * (r0 - e->r) - 1;
+  t->size += chains_put (t->data + t->size, (e->p - t->last) / 2);
+  t->size += chains_put (t->data + t->size, (e->q == 0) ? 0 : (e->q - e->p) / 2);
+  t->size += chains_put (t->data + t->size, z);
+  t->last = e->p;
+  chain_cost (k, e->r, ~0UL, &t->adds, &t->dups);
+}
+
+static int
+write_chains (const char *dir, double B1, long delta, int window)
+{
+  entry_t queue[CHAINS_WINDOW], e;
+  table_t t;
+  prime_info_t prime_info;
+  uint64_t p, r, key[CACHEFILE_KEYS];
+  unsigned long c, gain, best, prac_adds = 0, prac_dups = 0;
+  int head = 0, len = 0, i, j;
+  char *fn;
+  long st = cputime ();
+
+  memset (&t, 0, sizeof (table_t));
+  t.last = 3;
+  prime_info_init (prime_info);
+  getprime_mt (prime_info); /* 3 */
+  for (p = getprime_mt (prime_info); p <= B1; p = getprime_mt (prime_info))
+    {
+      prac_cost (p, &prac_adds, &prac_dups);
+      e.p = p;
+      e.q = 0;
+      e.cost = best_chain (p, delta, &e.r);
+
+      /* pairs p with the entry of the queue giving the largest gain */
+      for (i = 0, best = 0, j = -1; i < len; i++)
+        {
+          entry_t *f = queue + (head + i) % window;
+
+          if (f->q != 0)
+            continue;
+          c = best_chain (f->p * p, delta, &r);
+          gain = (c < f->cost + e.cost) ? f->cost + e.cost - c : 0;
+          if (gain > best)
+            {
+              best = gain;
+              j = i;
+              e.r = r;
+            }
+        }
+      if (j >= 0)
+        {
+          entry_t *f = queue + (head + j) % window;
+          f->q = p;
+          f->r = e.r;
+          f->cost -= best;
+        }
+      else
+        {
+          if (len == window)
+            {
+              table_put (&t, queue + head);
+              head = (head + 1) % window;
+              len--;
+            }
+          queue[(head + len++) % window] = e;
+        }
+
+      /* the pairs at the start of the queue are complete */
+      while (len > 0 && queue[head].q != 0)
+        {
+          table_put (&t, queue + head);
+          head = (head + 1) % window;
+          len--;
+        }
+    }
+  while (len > 0)
+    {
+      table_put (&t, queue + head);
+      head = (head + 1) % window;
+      len--;
+    }
+  prime_info_clear (prime_info);
+
+  cachefile_set_dir (dir);
+  fn = cachefile_name ("chains-%.0f", B1);
+  memset (key, 0, CACHEFILE_KEYS * sizeof (uint64_t));
+  key[0] = (uint64_t) B1;
+  i = cachefile_write (fn, CACHEFILE_CHAINS, key, t.data, t.size);
+  if (i != 0)
+    fprintf (stderr, "Could not write %s\n", fn);
+  else
+    printf ("Wrote %s (%lu bytes) in %ldms: %lu additions and %lu duplicates,"
+            " prac uses %lu and %lu\n", fn, (unsigned long) t.size,
+            elltime (st, cputime ()), t.adds, t.dups, prac_adds, prac_dups);
+  free (fn);
+  free (t.data);
+  cachefile_set_dir (NULL);
+  return i;
+}
+
+int
+main (int argc, char *argv[])
+{
+  long delta = 32;
+  int window = 8, ret = 0;
+  char *dir;
+  double B1;
+
+  while (argc > 1 && argv[1][0] == '-')
+    {
+      if (argc > 2 && strcmp (argv[1], "-d") == 0)
+        delta = atol (argv[2]);
+      else if (argc > 2 && strcmp (argv[1], "-w") == 0)
+        window = atoi (argv[2]);
+      else
+        break;
+      argc -= 2;
+      argv += 2;
+    }
+  if (argc < 3 || delta < 0 || window < 1 || window > CHAINS_WINDOW)
+    {
+      fprintf (stderr, "Usage: ecmchains [-d delta] [-w window] dir B1 "
+               "[B1 ...]\n");
+      fprintf (stderr, "with 0 <= delta, and 1 <= window <= %d\n",
+               CHAINS_WINDOW);
+      exit (EXIT_FAILURE);
+    }
+  dir = argv[1];
+  for (argc -= 2, argv += 2; argc > 0; argc--, argv++)
+    {
+      B1 = atof (argv[0]);
+      if (B1 < 5.0 || B1 > 4294967295.0)
+        {
+          fprintf (stderr, "Invalid B1: %s\n", argv[0]);
+          exit (EXIT_FAILURE);
+        }
+      ret |= write_chains (dir, B1, delta, window);
+    }
+  return ret;
+}
@@ -87,6 +87,8 @@ main (int argc, char *argv[])
       T[i]->B1 = B1;
       mpz_init (T[i]->f);
       ecm_init (T[i]->q);
+      /* each thread has its own context, see ecm.h */
+      T[i]->q->ctx = ecm_ctx_new ();
     }
 
   printf ("Performing %lu curve(s) with B1=%1.0f\n", nthreads, B1);
@@ -108,6 +110,7 @@ main (int argc, char *argv[])
       mpz_clear (T[i]->n);
       mpz_clear (T[i]->f);
       ecm_clear (T[i]->q);
+      ecm_ctx_free (T[i]->q->ctx);
     }
 
   mpz_clear (n);
@@ -83,6 +83,8 @@ ecm_init (ecm_params q)
   q->gw_b = 0;
   q->gw_n = 0;
   q->gw_c = 0;
+  q->cachedir = NULL;
+  q->ctx = NULL; /* default context of the calling thread */
 }
 
 /* function to be called between two calls of ecm_factor, it the same
@@ -98,6 +100,8 @@ ecm_reset (ecm_params q)
 void
 ecm_clear (ecm_params q)
 {
+  ecm_ctx_t ctx;
+
   mpz_clear (q->x);
   mpz_clear (q->y);
   mpz_clear (q->sigma);
@@ -113,6 +117,60 @@ ecm_clear (ecm_params q)
   mpz_clear (q->E->a6);
   mpz_clear (q->E->sq[0]);
   free (q->E);
+  ctx = ecm_ctx_set (q->ctx);
+  mpzspm_clear_cache ();
+  chains_clear_cache ();
+  ecm_ctx_set (ctx);
+}
+
+/* Return a new context, to be given to ecm_factor in params->ctx, or NULL
+   if there is not enough memory. Its tables and caches are kept from one
+   call to the next, until ecm_ctx_free. A context must not be used by
+   several threads at the same time. */
+ecm_ctx_t
+ecm_ctx_new (void)
+{
+  ecm_ctx_t ctx = (ecm_ctx_t) calloc (1, sizeof (struct __ecm_ctx_struct));
+
+  if (ctx != NULL)
+    {
+      ctx->verbose = OUTPUT_NORMAL;
+      ctx->os = stdout;
+      ctx->es = stderr;
+    }
+  return ctx;
+}
+
+/* Free the tables of ctx, or of the default context of the calling thread
+   if ctx is NULL, which are rebuilt when needed */
+void
+ecm_ctx_clear (ecm_ctx_t ctx)
+{
+  ecm_ctx_t old = ecm_ctx_set (ctx);
+
+  rhoinit (1, 0);
+  F_clear ();
+  iskbnc_clear ();
+  mpzspm_clear_cache ();
+  chains_clear_cache ();
+  sp_aligned_free (ECM_CTX->ntt_scratch);
+  ECM_CTX->ntt_scratch = NULL;
+  ECM_CTX->ntt_scratch_size = 0;
+  ecm_ctx_set ((old == ctx) ? NULL : old);
+}
+
+void
+ecm_ctx_free (ecm_ctx_t ctx)
+{
+  ecm_ctx_t old;
+
+  if (ctx == NULL)
+    return;
+  ecm_ctx_clear (ctx);
+  old = ecm_ctx_set (ctx);
+  cachefile_set_dir (NULL);
+  ecm_ctx_set ((old == ctx) ? NULL : old);
+  free (ctx);
 }
 
 /* returns ECM_FACTOR_FOUND, ECM_NO_FACTOR_FOUND, or ECM_ERROR */
@@ -122,6 +180,7 @@ ecm_factor (mpz_t f, mpz_t n, double B1, ecm_params p0)
   int res; /* return value */
   ecm_params q;
   ecm_params_ptr p;
+  ecm_ctx_t ctx;
 
   if (mpz_cmp_ui (n, 0) <= 0)
     {
@@ -149,35 +208,41 @@ ecm_factor (mpz_t f, mpz_t n, double B1, ecm_params p0)
   else
     p = p0;
 
+  ctx = ecm_ctx_set (p->ctx);
+  cachefile_set_dir (p->cachedir);
+
   if (p->method == ECM_ECM)
     {
 #ifdef WITH_GPU
-      if (p->gpu == 0)
-        {
-#endif
-            res = ecm (f, p->x, p->y, p->param, p->sigma, n, p->go,
-		       &(p->B1done),
-                       B1, p->B2min, p->B2, p->k, p->S, p->verbose,
-                       p->repr, p->nobase2step2, p->use_ntt, 
-		       p->sigma_is_A, p->E,
-                       p->os, p->es, p->chkfilename, p->TreeFilename, p->maxmem,
-                       p->stage1time, p->rng, p->stop_asap, p->batch_s,
-                       &(p->batch_last_B1_used), p->gw_k, p->gw_b, p->gw_n,
-                       p->gw_c);
-#ifdef WITH_GPU
-        }
+      if (p->gpu != 0)
+        res = gpu_ecm (f, p->x, p->param, p->sigma, n, p->go,
+                       &(p->B1done), B1, p->B2min, p->B2, p->k,
+                       p->S, p->verbose, p->repr, p->nobase2step2, 
+                       p->use_ntt, p->sigma_is_A, p->os, p->es,
+                       p->chkfilename, p->TreeFilename, p->maxmem,
+                       p->stop_asap, p->batch_s, &(p->batch_last_B1_used),
+                       p->gpu_device, &(p->gpu_device_init),
+                       &(p->gpu_number_of_curves));
       else
-        {
-          res = gpu_ecm (f, p->x, p->param, p->sigma, n, p->go,
-                         &(p->B1done), B1, p->B2min, p->B2, p->k,
-                         p->S, p->verbose, p->repr, p->nobase2step2, 
-                         p->use_ntt, p->sigma_is_A, p->os, p->es,
-                         p->chkfilename, p->TreeFilename, p->maxmem,
-                         p->stop_asap, p->batch_s, &(p->batch_last_B1_used),
-                         p->gpu_device, &(p->gpu_device_init),
-                         &(p->gpu_number_of_curves));
-        }
 #endif
+      if (p->gpu_number_of_curves > 0) /* several curves at once on CPU */
+        res = cpu_batch_ecm (f, p->x, p->param, p->sigma, n, p->go,
+                             &(p->B1done), B1, p->B2min, p->B2, p->k,
+                             p->S, p->verbose, p->repr, p->nobase2step2,
+                             p->use_ntt, p->sigma_is_A, p->os, p->es,
+                             p->TreeFilename, p->maxmem, p->stop_asap,
+                             p->batch_s, &(p->batch_last_B1_used),
+                             &(p->gpu_number_of_curves));
+      else
+        res = ecm (f, p->x, p->y, p->param, p->sigma, n, p->go,
+                   &(p->B1done),
+                   B1, p->B2min, p->B2, p->k, p->S, p->verbose,
+                   p->repr, p->nobase2step2, p->use_ntt, 
+                   p->sigma_is_A, p->E,
+                   p->os, p->es, p->chkfilename, p->TreeFilename, p->maxmem,
+                   p->stage1time, p->rng, p->stop_asap, p->batch_s,
+                   &(p->batch_last_B1_used), p->gw_k, p->gw_b, p->gw_n,
+                   p->gw_c);
     }
   else if (p->method == ECM_PM1)
     res = pm1 (f, p->x, n, p->go, &(p->B1done), B1, p->B2min, p->B2,
@@ -195,6 +260,7 @@ ecm_factor (mpz_t f, mpz_t n, double B1, ecm_params p0)
       res = ECM_ERROR;
     }
 
+  ecm_ctx_set (ctx);
   if (p0 == NULL)
     ecm_clear (q);
 
@@ -6,6 +6,18 @@
 #define REDC_THRESHOLD 294
 #endif
 
+#ifndef KBNC_THRESHOLD
+#define KBNC_THRESHOLD 32
+#endif
+
+#ifndef DWT_THRESHOLD
+#define DWT_THRESHOLD 512
+#endif
+
+#ifndef BASE2_FFT_THRESHOLD
+#define BASE2_FFT_THRESHOLD 512
+#endif
+
 #ifndef MPN_MUL_LO_THRESHOLD_TABLE
 #define MPN_MUL_LO_THRESHOLD_TABLE {0, 0, 0, 0, 0, 0, 0, 1, 7, 8, 1, 1, 8, 1, 1, 10, 1, 1, 1, 1, 1, 1, 1, 16, 1, 1, 16, 16, 1, 1, 16, 1}
 #endif
@@ -18,6 +30,10 @@
 #define NTT_GFP_TWIDDLE_DIT_BREAKOVER 11
 #endif
 
+#ifndef NTT_GFP_FOURSTEP_THRESHOLD
+#define NTT_GFP_FOURSTEP_THRESHOLD 20
+#endif
+
 #ifndef MUL_NTT_THRESHOLD
 #define MUL_NTT_THRESHOLD 1024
 #endif
@@ -38,6 +54,10 @@
 #define MPZSPV_NORMALISE_STRIDE 512
 #endif
 
+#ifndef MPZSPV_TO_MPZV_TREE_THRESHOLD
+#define MPZSPV_TO_MPZV_TREE_THRESHOLD 1024
+#endif
+
 #ifndef TUNE_MULREDC_TABLE
 #define TUNE_MULREDC_TABLE {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
 #endif
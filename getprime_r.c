@@ -34,6 +34,243 @@
 #define ASSERT(x)
 #endif
 
+/* The sieve is segmented and keeps one bit for each integer coprime to
+   30: byte b of a segment starting at base (a multiple of 30) corresponds to
+   base + 30*b + wheel_res[k] for bits k = 0, ..., 7.
+
+   The multiples p*m of a sieving prime p >= 7 that remain to be crossed off
+   are those with m coprime to 30, and for each residue of m mod 30 they are
+   one byte in every p, at a fixed bit. The position of the next one is kept
+   as 8 * (byte offset from the segment start) + bit. */
+
+static const unsigned char wheel_res[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+
+/* wheel_bit[r] is the bit for residue r mod 30, for r coprime to 30 */
+static const unsigned char wheel_bit[30] =
+  {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 3, 0,
+   0, 0, 4, 0, 5, 0, 0, 0, 6, 0, 0, 0, 0, 0, 7};
+
+/* The iterator starts with small segments, so that a loop up to a small
+   bound stays cheap, and doubles them up to GETPRIME_SEGMENT bytes, which
+   should fit in the L1 cache. */
+#define GETPRIME_SEGMENT 32768
+#define GETPRIME_MIN_SEGMENT 64
+
+/* floor(sqrt(n)) */
+static ecm_uint
+isqrt (ecm_uint n)
+{
+  ecm_uint r = 0, b;
+
+  for (b = (ecm_uint) 1 << (4 * sizeof (ecm_uint) - 1); b != 0; b >>= 1)
+    if ((r + b) <= n / (r + b))
+      r += b;
+  return r;
+}
+
+/* set next[8*j..8*j+7] for the sieving primes primes[j], 0 <= j < nprimes,
+   and a segment starting at base */
+static void
+sieve_start (ecm_uint *next, const ecm_uint *primes, ecm_uint nprimes,
+             ecm_uint base)
+{
+  ecm_uint j, k, p, m0, m, n;
+
+  for (j = 0; j < nprimes; j++)
+    {
+      p = primes[j];
+      /* smallest m >= p with p*m >= base */
+      m0 = base / p + (base % p != 0);
+      if (m0 < p)
+        m0 = p;
+      for (k = 0; k < 8; k++)
+        {
+          m = m0 + (wheel_res[k] + 30 - m0 % 30) % 30;
+          n = p * m;
+          next[8 * j + k] = 8 * ((n - base) / 30) + wheel_bit[n % 30];
+        }
+    }
+}
+
+/* sieve the segment of nbytes bytes at sieve, and advance next[] to the
+   following segment */
+static void
+sieve_segment (unsigned char *sieve, ecm_uint nbytes, const ecm_uint *primes,
+               ecm_uint nprimes, ecm_uint *next)
+{
+  ecm_uint j, k, o, p;
+  unsigned char mask;
+
+  memset (sieve, 0xff, nbytes);
+  for (j = 0; j < nprimes; j++)
+    {
+      p = primes[j];
+      for (k = 0; k < 8; k++)
+        {
+          o = next[8 * j + k];
+          mask = (unsigned char) ~(1 << (o & 7));
+          for (o >>= 3; o < nbytes; o += p)
+            sieve[o] &= mask;
+          next[8 * j + k] = ((o - nbytes) << 3) | (next[8 * j + k] & 7);
+        }
+    }
+}
+
+/* index of the least significant bit of x != 0 */
+#if defined(__GNUC__)
+#define lowest_bit(x) __builtin_ctz (x)
+#else
+static int
+lowest_bit (unsigned int x)
+{
+  int k;
+
+  for (k = 0; (x & 1) == 0; x >>= 1, k++);
+  return k;
+}
+#endif
+
+/* write to r the primes lo <= q < hi of the segment of nbytes bytes at base,
+   and return their number; at most 8*nbytes are written */
+static ecm_uint
+sieve_extract (ecm_uint *r, const unsigned char *sieve, ecm_uint nbytes,
+               ecm_uint base, ecm_uint lo, ecm_uint hi)
+{
+  ecm_uint b, n = 0, m = 0;
+  unsigned int bits;
+
+  for (b = 0; b < nbytes; b++, base += 30)
+    for (bits = sieve[b]; bits != 0; bits &= bits - 1)
+      r[n++] = base + wheel_res[lowest_bit (bits)];
+
+  /* only the ends of the segment can be out of range */
+  while (n > 0 && r[n - 1] >= hi)
+    n--;
+  while (m < n && r[m] < lo)
+    m++;
+  if (m > 0)
+    memmove (r, r + m, (n - m) * sizeof (ecm_uint));
+  return n - m;
+}
+
+/* Returns the primes 7 <= q < hi in a newly allocated array, using the
+   sieving primes primes[0..nprimes-1], which must contain all primes
+   7 <= p with p^2 < hi. The number of primes is put in *n. Returns NULL
+   if the memory allocation fails. */
+static ecm_uint *
+sieve_range (ecm_uint lo, ecm_uint hi, const ecm_uint *primes,
+             ecm_uint nprimes, ecm_uint *n)
+{
+  ecm_uint base, nbytes, alloc, *r, *next, *t;
+  unsigned char *sieve;
+
+  *n = 0;
+  if (lo < 7)
+    lo = 7;
+  if (lo >= hi)
+    return (ecm_uint *) malloc (sizeof (ecm_uint));
+
+  base = lo - lo % 30;
+  nbytes = (hi - base - 1) / 30 + 1;
+  if (nbytes > GETPRIME_SEGMENT)
+    nbytes = GETPRIME_SEGMENT;
+  alloc = 8 * nbytes;
+  r = (ecm_uint *) malloc (alloc * sizeof (ecm_uint));
+  next = (ecm_uint *) malloc ((8 * nprimes + 1) * sizeof (ecm_uint));
+  sieve = (unsigned char *) malloc (nbytes);
+  if (r == NULL || next == NULL || sieve == NULL)
+    goto error;
+
+  sieve_start (next, primes, nprimes, base);
+  for ( ; base < hi; base += 30 * nbytes)
+    {
+      if (*n + 8 * nbytes > alloc)
+        {
+          alloc = 2 * alloc + 8 * nbytes;
+          t = (ecm_uint *) realloc (r, alloc * sizeof (ecm_uint));
+          if (t == NULL)
+            goto error;
+          r = t;
+        }
+      sieve_segment (sieve, nbytes, primes, nprimes, next);
+      *n += sieve_extract (r + *n, sieve, nbytes, base, lo, hi);
+    }
+
+  free (sieve);
+  free (next);
+  return r;
+
+ error:
+  free (sieve);
+  free (next);
+  free (r);
+  *n = 0;
+  return NULL;
+}
+
+/* Returns the primes lo <= p < hi in increasing order in a newly allocated
+   array, and puts their number in *n. Returns NULL if the memory allocation
+   fails. */
+ecm_uint *
+getprimes_range (ecm_uint lo, ecm_uint hi, ecm_uint *n)
+{
+  ecm_uint *primes = NULL, nprimes = 0, *r, *t, *s, ns;
+
+  *n = 0;
+  r = (ecm_uint *) malloc (3 * sizeof (ecm_uint));
+  if (r == NULL)
+    return NULL;
+  if (lo <= 2 && 2 < hi)
+    r[(*n)++] = 2;
+  if (lo <= 3 && 3 < hi)
+    r[(*n)++] = 3;
+  if (lo <= 5 && 5 < hi)
+    r[(*n)++] = 5;
+  if (lo < 7)
+    lo = 7;
+  if (lo >= hi)
+    return r;
+
+  /* the sieving primes 7 <= p <= sqrt(hi - 1) */
+  if (isqrt (hi - 1) >= 7)
+    {
+      primes = getprimes_range (7, isqrt (hi - 1) + 1, &nprimes);
+      if (primes == NULL)
+        {
+          free (r);
+          return NULL;
+        }
+    }
+
+  s = sieve_range (lo, hi, primes, nprimes, &ns);
+  free (primes);
+  if (s == NULL)
+    {
+      free (r);
+      *n = 0;
+      return NULL;
+    }
+  if (*n == 0)
+    {
+      free (r);
+      *n = ns;
+      return s;
+    }
+
+  t = (ecm_uint *) realloc (r, (*n + ns) * sizeof (ecm_uint));
+  if (t == NULL)
+    {
+      free (s);
+      free (r);
+      *n = 0;
+      return NULL;
+    }
+  memcpy (t + *n, s, ns * sizeof (ecm_uint));
+  free (s);
+  *n += ns;
+  return t;
+}
+
 /* This function returns successive odd primes, starting with 3.
    To perform a loop over all primes <= B1, do the following
    (compile this file with -DMAIN to count primes):
@@ -55,9 +292,13 @@ prime_info_init (prime_info_t i)
   i->current = -1;
   i->primes = NULL;
   i->nprimes = 0;
+  i->nactive = 0;
+  i->bound = 7;
   i->sieve = NULL;
-  i->len = 0;
+  i->sieve_len = 0;
   i->moduli = NULL;
+  i->block = NULL;
+  i->len = 0;
 }
 
 void
@@ -66,133 +307,119 @@ prime_info_clear (prime_info_t i)
   free (i->primes);
   free (i->sieve);
   free (i->moduli);
+  free (i->block);
+}
+
+/* sieve the next segment into i->block */
+static void
+getprime_sieve (prime_info_t i)
+{
+  ecm_uint end, b, k, *t;
+
+  do
+    {
+      /* first enlarge sieving table if small */
+      if (i->sieve_len < GETPRIME_SEGMENT)
+        {
+          i->sieve_len = (i->sieve_len == 0) ? GETPRIME_MIN_SEGMENT
+                                             : 2 * i->sieve_len;
+          free (i->sieve);
+          free (i->block);
+          i->sieve = (unsigned char *) malloc (i->sieve_len);
+          /* 3 and 5 are added to the first block */
+          i->block = (ecm_uint *) malloc ((8 * i->sieve_len + 2)
+                                          * sizeof (ecm_uint));
+          /* assume those "small" malloc's will not fail in normal usage */
+          ASSERT(i->sieve != NULL && i->block != NULL);
+        }
+
+      /* now enlarge the sieving primes table if too small: it needs the
+         primes up to sqrt(end - 1), and we take them up to twice that */
+      end = i->offset + 30 * i->sieve_len;
+      b = isqrt (end - 1) + 1;
+      if (b > i->bound)
+        {
+          b = 2 * b;
+          t = getprimes_range (i->bound, b, &k);
+          ASSERT(t != NULL);
+          i->primes = (ecm_uint *) realloc (i->primes, (i->nprimes + k)
+                                            * sizeof (ecm_uint));
+          i->moduli = (ecm_uint *) realloc (i->moduli, 8 * (i->nprimes + k)
+                                            * sizeof (ecm_uint));
+          ASSERT(i->primes != NULL && i->moduli != NULL);
+          memcpy (i->primes + i->nprimes, t, k * sizeof (ecm_uint));
+          free (t);
+          i->nprimes += k;
+          i->bound = b;
+        }
+
+      /* only the primes with p^2 < end take part in the sieving */
+      for (k = i->nactive; k < i->nprimes
+             && i->primes[k] <= (end - 1) / i->primes[k]; k++)
+        sieve_start (i->moduli + 8 * k, i->primes + k, 1, i->offset);
+      i->nactive = k;
+
+      /* now sieve for new primes */
+      sieve_segment (i->sieve, i->sieve_len, i->primes, i->nactive,
+                     i->moduli);
+      k = 0;
+      if (i->offset == 0)
+        {
+          i->block[k++] = 3;
+          i->block[k++] = 5;
+        }
+      k += sieve_extract (i->block + k, i->sieve, i->sieve_len, i->offset,
+                          7, end);
+      i->offset = end;
+    }
+  while (k == 0);
+
+  i->len = k;
+  i->current = 0;
 }
 
 /* this function is thread-safe */
 ecm_uint
 getprime_mt (prime_info_t i)
 {
-  if (i->len)
-    {
-      unsigned char *ptr = i->sieve + i->current;
-      while (!*++ptr);
-      i->current = ptr - i->sieve;
-    }
-  else
-    i->current = 0;
+  if (++i->current < i->len) /* most calls will end here */
+    return i->block[i->current];
 
-  if (i->current < i->len) /* most calls will end here */
-    return i->offset + 2 * i->current;
+  getprime_sieve (i);
+  return i->block[0];
+}
 
-  /* otherwise we have to sieve */
-  i->offset += 2 * i->len;
+/* Puts in *p a pointer to the primes getprime_mt would return in its next
+   calls, and returns their number, which is positive. They remain valid
+   until the next call to getprime_mt or getprimes_mt. */
+ecm_uint
+getprimes_mt (prime_info_t i, const ecm_uint **p)
+{
+  ecm_uint n;
 
-  /* first enlarge sieving table if too small */
-  if ((ecm_uint) i->len * i->len < i->offset)
+  if (i->current + 1 >= i->len)
     {
-      free (i->sieve);
-      i->len *= 2;
-      i->sieve = (unsigned char *) malloc ((i->len + 1 )
-                                           * sizeof (unsigned char));
-      /* assume this "small" malloc will not fail in normal usage */
-      ASSERT(i->sieve != NULL);
-      i->sieve[i->len] = 1; /* End mark */
+      getprime_sieve (i);
+      i->current = -1;
     }
-
-  /* now enlarge small prime table if too small */
-  if ((i->nprimes == 0) ||
-      ((ecm_uint) i->primes[i->nprimes - 1] * (ecm_uint)
-       i->primes[i->nprimes - 1] < i->offset + i->len))
-      {
-	if (i->nprimes == 0) /* initialization */
-	  {
-	    i->nprimes = 1;
-	    i->primes = (ecm_uint*) malloc (i->nprimes
-                                                * sizeof(ecm_uint));
-	    /* assume this "small" malloc will not fail in normal usage */
-	    ASSERT(i->primes != NULL);
-	    i->moduli = (ecm_uint*) malloc (i->nprimes
-                                                * sizeof(ecm_uint));
-	    /* assume this "small" malloc will not fail in normal usage */
-	    ASSERT(i->moduli != NULL);
-	    i->len = 1;
-	    i->sieve = (unsigned char *) malloc((i->len + 1) *
-                                       sizeof(unsigned char)); /* len=1 here */
-	    /* assume this "small" malloc will not fail in normal usage */
-	    ASSERT(i->sieve != NULL);
-	    i->sieve[i->len] = 1; /* End mark */
-	    i->offset = 5;
-	    i->sieve[0] = 1; /* corresponding to 5 */
-	    i->primes[0] = 3;
-	    i->moduli[0] = 1; /* next odd multiple of 3 is 7, i.e. next to 5 */
-	    i->current = -1;
-	    return 3;
-	  }
-	else
-	  {
-	    ecm_uint k, p, j, ok;
-
-	    k = i->nprimes;
-	    i->nprimes *= 2;
-	    i->primes = (ecm_uint*) realloc (i->primes, i->nprimes *
-                                                 sizeof(ecm_uint));
-	    i->moduli = (ecm_uint*) realloc (i->moduli, i->nprimes *
-                                                 sizeof(ecm_uint));
-	    /* assume those "small" realloc's will not fail in normal usage */
-	    ASSERT(i->primes != NULL && i->moduli != NULL);
-	    for (p = i->primes[k-1]; k < i->nprimes; k++)
-	      {
-		/* find next (odd) prime > p */
-		do
-		  {
-		    for (p += 2, ok = 1, j = 0; (ok != 0) && (j < k); j++)
-		      ok = p % i->primes[j];
-		  }
-		while (ok == 0);
-		i->primes[k] = p;
-		/* moduli[k] is the smallest m such that
-                   offset + 2*m = 0 mod p, i.e., moduli[k] = -offset/2 mod p */
-		j = i->offset % p;
-		j = (j == 0) ? j : p - j; /* -offset mod p */
-		if ((j % 2) != 0)
-		  j += p; /* ensure j is even */
-		i->moduli[k] = j / 2;
-	      }
-	  }
-      }
-
-  /* now sieve for new primes */
-  {
-    ecm_int k;
-    ecm_uint j, p;
-    
-    memset (i->sieve, 1, sizeof(unsigned char) * (i->len + 1));
-    for (j = 0; j < i->nprimes; j++)
-      {
-	p = i->primes[j];
-	for (k = i->moduli[j]; k < i->len; k += p)
-	  i->sieve[k] = 0;
-	i->moduli[j] = k - i->len; /* for next sieving array */
-      }
-  }
-
-  {
-    unsigned char *ptr = i->sieve - 1;
-    while (!*++ptr);
-    i->current = ptr - i->sieve;
-  }
-
-  ASSERT(i->current < i->len); /* otherwise we found a prime gap >= sqrt(x)
-                                  around x */
-  return i->offset + 2 * i->current;
+  *p = i->block + i->current + 1;
+  n = i->len - i->current - 1;
+  i->current = i->len - 1;
+  return n;
 }
 
 #ifdef MAIN
+/* Counts the primes <= B with getprime_mt, getprimes_mt and getprimes_range
+   (the latter on two halves, so that lo is not a multiple of 30), and
+   prints their number if the three counts agree. This is run by
+   "make check", see test.getprime. */
 int
 main (int argc, char *argv[])
 {
   unsigned long p, B;
-  unsigned long pi = 0;
+  unsigned long pi, pi_block;
+  ecm_uint k, n0, n1, *r0, *r1;
+  const ecm_uint *block;
   prime_info_t i;
 
   if (argc != 2)
@@ -202,14 +429,39 @@ main (int argc, char *argv[])
     }
 
   B = strtoul (argv[1], NULL, 0);
-  
-  prime_info_init (i);
 
+  prime_info_init (i);
   for (pi = 0, p = 2; p <= B; p = getprime_mt (i), pi++);
-  printf ("pi(%lu)=%lu\n", B, pi);
-
   prime_info_clear (i); /* free the tables */
 
+  prime_info_init (i);
+  for (pi_block = (B >= 2), p = 0; p <= B; )
+    {
+      k = getprimes_mt (i, &block);
+      while (k-- > 0 && (p = *block++) <= B)
+        pi_block++;
+    }
+  prime_info_clear (i);
+
+  r0 = getprimes_range (0, (ecm_uint) B / 2, &n0);
+  r1 = getprimes_range ((ecm_uint) B / 2, (ecm_uint) B + 1, &n1);
+  if (r0 == NULL || r1 == NULL)
+    {
+      fprintf (stderr, "Cannot allocate memory\n");
+      exit (EXIT_FAILURE);
+    }
+  free (r0);
+  free (r1);
+
+  if (pi_block != pi || (unsigned long) (n0 + n1) != pi)
+    {
+      fprintf (stderr, "Error, pi(%lu) is %lu with getprime_mt, %lu with "
+               "getprimes_mt and %lu with getprimes_range\n", B, pi,
+               pi_block, (unsigned long) (n0 + n1));
+      exit (EXIT_FAILURE);
+    }
+  printf ("pi(%lu)=%lu\n", B, pi);
+
   return 0;
 }
 #endif
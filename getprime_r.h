@@ -4,13 +4,17 @@
 #include "ecm_int.h"
 
 struct prime_info_s {
-  ecm_uint offset;  /* offset for current primes */
-  ecm_int current;          /* index of previous prime */
-  ecm_uint *primes;  /* small primes up to sqrt(p) */
+  ecm_uint offset;  /* start of the next segment, a multiple of 30 */
+  ecm_int current;          /* index of previous prime in block[] */
+  ecm_uint *primes;  /* sieving primes 7 <= p < bound */
   ecm_uint nprimes; /* length of primes[] */
-  unsigned char *sieve;  /* sieving table */
-  ecm_int len;              /* length of sieving table */
-  ecm_uint *moduli;  /* offset for small primes */
+  ecm_uint nactive; /* primes[0..nactive-1] are used for the sieving */
+  ecm_uint bound;
+  unsigned char *sieve;  /* sieving table, one bit per integer coprime to 30 */
+  ecm_uint sieve_len;       /* length of sieving table in bytes */
+  ecm_uint *moduli;  /* next multiples of the sieving primes, 8 per prime */
+  ecm_uint *block;   /* primes of the last segment */
+  ecm_int len;              /* length of block[] */
 };
 typedef struct prime_info_s prime_info_t[1];
 
@@ -18,10 +22,15 @@ typedef struct prime_info_s prime_info_t[1];
 extern "C" {
 #endif
 
-/* The getprime_mt function returns successive odd primes, starting with 3. */
+/* The getprime_mt function returns successive odd primes, starting with 3,
+   getprimes_mt the following ones by blocks. */
 void prime_info_init (prime_info_t);
 void prime_info_clear (prime_info_t);
 ecm_uint getprime_mt (prime_info_t);
+ecm_uint getprimes_mt (prime_info_t, const ecm_uint **);
+
+/* The primes lo <= p < hi, in a newly allocated array */
+ecm_uint *getprimes_range (ecm_uint, ecm_uint, ecm_uint *);
 
 #ifdef __cplusplus
 }
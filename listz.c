@@ -23,14 +23,20 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #include <stdlib.h>
 #include "ecm-impl.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* With OpenMP, the minimal length of a list for which init_list2 allocates
+   the integers in several threads */
+#define INIT_LIST_OPENMP_THRESHOLD 16384
+
 #ifdef DEBUG
 #define ASSERTD(x) assert(x)
 #else
 #define ASSERTD(x)
 #endif
 
-extern unsigned int Fermat;
-
 /* returns a bound on the auxiliary memory needed by list_mult_n */
 int
 list_mul_mem (unsigned int len)
@@ -54,17 +60,23 @@ init_list (unsigned int n)
 }
 
 /* creates a list of n integers, return NULL if error. Allocates each
-   mpz_t to the size of N bits */
+   mpz_t to the size of N bits. For long lists, each thread allocates (and
+   so gets on its NUMA node) a contiguous part, the one it gets from the
+   static schedule of the loops over the nodes of a level of the product
+   tree (see ecm_ntt.c). */
 listz_t
 init_list2 (unsigned int n, unsigned int N)
 {
   listz_t p;
-  unsigned int i;
+  long i;
 
   p = (mpz_t*) malloc (n * sizeof (mpz_t));
   if (p == NULL)
     return NULL;
-  for (i = 0; i < n; i++)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (n >= INIT_LIST_OPENMP_THRESHOLD)
+#endif
+  for (i = 0; i < (long) n; i++)
     mpz_init2 (p[i], N);
   return p;
 }
@@ -274,19 +286,19 @@ list_mul (listz_t a, listz_t b, unsigned int k,
   po2 = (po2 == 1);
 
 #ifdef DEBUG
-  if (Fermat && !(po2 && l == k))
+  if (ECM_FERMAT && !(po2 && l == k))
     fprintf (ECM_STDOUT, "list_mul: Fermat number, but poly lengths %d and %d\n", k, l);
 #endif
 
-  if (po2 && Fermat)
+  if (po2 && ECM_FERMAT)
     {
       if (monic && l == k)
         {
-          F_mul (a, b, c, l, MONIC, Fermat, t);
+          F_mul (a, b, c, l, MONIC, ECM_FERMAT, t);
           monic = 0;
         }
       else
-        F_mul (a, b, c, l, DEFAULT, Fermat, t);
+        F_mul (a, b, c, l, DEFAULT, ECM_FERMAT, t);
     }
   else
     list_mult_n (a, b, c, l); /* set a[0]...a[2l-2] */
@@ -335,8 +347,8 @@ list_mulmod (listz_t a2, listz_t a, listz_t b, listz_t c, unsigned int k,
   
   ASSERTD(list_check(b,k,n));
   ASSERTD(list_check(c,k,n));
-  if (i == 1 && Fermat)
-    F_mul (a, b, c, k, DEFAULT, Fermat, t);
+  if (i == 1 && ECM_FERMAT)
+    F_mul (a, b, c, k, DEFAULT, ECM_FERMAT, t);
   else
     list_mult_n (a, b, c, k); /* set a[0]...a[2l-2] */
 
@@ -372,6 +384,88 @@ PolyFromRoots (listz_t G, listz_t a, unsigned int k, listz_t T, mpz_t n)
   list_mod (G, T, k, n);
 }
 
+/* Sets s up for nthreads threads, with T the list of thread 0 */
+void
+tree_scratch_init (tree_scratch_t s, listz_t T, unsigned int size)
+{
+  unsigned int i;
+
+#ifdef _OPENMP
+  s->nthreads = omp_get_max_threads ();
+#else
+  s->nthreads = 1;
+#endif
+  s->size = size;
+  s->T = (listz_t *) malloc (s->nthreads * sizeof (listz_t));
+  ASSERT_ALWAYS (s->T != NULL);
+  s->T[0] = T;
+  for (i = 1; i < s->nthreads; i++)
+    s->T[i] = NULL;
+}
+
+/* Returns the scratch list of the calling thread */
+listz_t
+tree_scratch_get (tree_scratch_t s)
+{
+  unsigned int i = 0;
+
+#ifdef _OPENMP
+  i = omp_get_thread_num ();
+#endif
+  ASSERT (i < s->nthreads);
+  if (s->T[i] == NULL)
+    {
+      s->T[i] = init_list (s->size);
+      ASSERT_ALWAYS (s->T[i] != NULL);
+    }
+  return s->T[i];
+}
+
+/* Frees the lists allocated by the threads (not the one of thread 0) */
+void
+tree_scratch_clear (tree_scratch_t s)
+{
+  unsigned int i;
+
+  for (i = 1; i < s->nthreads; i++)
+    clear_list (s->T[i], s->size);
+  free (s->T);
+}
+
+#ifdef _OPENMP
+/* Same as PolyFromRoots_Tree with dolvl = -1 and TreeFile = NULL, but
+   builds the two subtrees of each node in separate tasks, each with the
+   scratch list of the thread that runs it */
+static void
+PolyFromRoots_Tree_task (listz_t G, listz_t a, unsigned int k, mpz_t n,
+                         listz_t *Tree, unsigned int sh, tree_scratch_t s)
+{
+  unsigned int l, m;
+  listz_t H1, T;
+
+  if (k < POLY_TREE_TASK_THRESHOLD)
+    {
+      PolyFromRoots_Tree (G, a, k, tree_scratch_get (s), -1, n, Tree, NULL,
+                          sh);
+      return;
+    }
+
+  m = k / 2;
+  l = k - m;
+  H1 = Tree[0] + sh;
+#pragma omp task
+  PolyFromRoots_Tree_task (H1, a, l, n, Tree + 1, sh, s);
+#pragma omp task
+  PolyFromRoots_Tree_task (H1 + l, a + l, m, n, Tree + 1, sh + l, s);
+#pragma omp taskwait
+  /* the scratch list is not used across the taskwait, where this thread
+     may run other tasks */
+  T = tree_scratch_get (s);
+  list_mul (T, H1, l, H1 + l, m, 1, T + k);
+  list_mod (G, T, k, n);
+}
+#endif
+
 /* puts in G[0]..G[k-1] the coefficients from (x+a[0])...(x+a[k-1])
    Warning: doesn't fill the coefficient 1 of G[k], which is implicit.
    Needs k + list_mul_mem(k/2) cells in T.
@@ -387,6 +481,10 @@ PolyFromRoots (listz_t G, listz_t a, unsigned int k, listz_t T, mpz_t n)
 
    Either Tree <> NULL and TreeFile == NULL, and we write the tree to memory,
    or Tree == NULL and TreeFile <> NULL, and we write the tree to disk.
+
+   With OpenMP, when the whole tree is written to memory, the two subtrees
+   of each node are built in separate tasks down to POLY_TREE_TASK_THRESHOLD
+   leaves.
 */
 int
 PolyFromRoots_Tree (listz_t G, listz_t a, unsigned int k, listz_t T, 
@@ -398,6 +496,27 @@ PolyFromRoots_Tree (listz_t G, listz_t a, unsigned int k, listz_t T,
 
   ASSERT (k >= 1);
 
+#ifdef _OPENMP
+  if (dolvl < 0 && Tree != NULL && k >= 2 * POLY_TREE_TASK_THRESHOLD
+      && !omp_in_parallel () && omp_get_max_threads () > 1)
+    {
+      tree_scratch_t s;
+      unsigned int Fermat = ECM_FERMAT;
+
+      m = k / 2;
+      l = k - m;
+      tree_scratch_init (s, T, l + list_mul_mem (l));
+#pragma omp parallel num_threads(s->nthreads)
+      {
+        ECM_FERMAT = Fermat; /* in the context of each thread of the team */
+#pragma omp master
+        PolyFromRoots_Tree_task (G, a, k, n, Tree, sh, s);
+      }
+      tree_scratch_clear (s);
+      return 0;
+    }
+#endif
+
   if (k == 1)
     {
       /* we consider x + a[0], which mean we consider negated roots */
@@ -466,7 +585,7 @@ PolyInvert (listz_t q, listz_t b, unsigned int K, listz_t t, mpz_t n)
       l = K - k;
 
       for (po2 = K; (po2 & 1) == 0; po2 >>= 1);
-      po2 = (po2 == 1 && Fermat != 0);
+      po2 = (po2 == 1 && ECM_FERMAT != 0);
 
       /* first determine l most-significant coeffs of Q */
       PolyInvert (q + k, b + k, l, t, n); /* Q1 = {q+k, l} */
@@ -484,7 +603,7 @@ PolyInvert (listz_t q, listz_t b, unsigned int K, listz_t t, mpz_t n)
         {
           list_revert (q + k, l);
           /* This expects the leading monomials explicitly in q[2k-1] and b[k+l-1] */
-          F_mul_trans (t, q + k, b, K / 2, K, Fermat, t + k);
+          F_mul_trans (t, q + k, b, K / 2, K, ECM_FERMAT, t + k);
           list_revert (q + k, l);
           list_neg (t, t, k, n);
         }
@@ -504,7 +623,7 @@ PolyInvert (listz_t q, listz_t b, unsigned int K, listz_t t, mpz_t n)
 
       ASSERTD(list_check(t,k,n) && list_check(q+l,k,n));
       if (po2)
-        F_mul (t + k, t, q + l, k, DEFAULT, Fermat, t + 3 * k);
+        F_mul (t + k, t, q + l, k, DEFAULT, ECM_FERMAT, t + 3 * k);
       else
         list_mult_n (t + k, t, q + l, k);
       list_mod (q, t + 2 * k - 1, k, n);
@@ -537,18 +656,18 @@ PrerevertDivision (listz_t a, listz_t b, listz_t invb,
   /* Q <- high(high(A) * INVB) with a short product */
   for (po2 = K; (po2 & 1) == 0; po2 >>= 1);
   po2 = (po2 == 1);
-  if (Fermat && po2)
+  if (ECM_FERMAT && po2)
     {
       mpz_set_ui (a[2 * K - 1], 0);
-      if (K <= 4 * Fermat)
+      if (K <= 4 * ECM_FERMAT)
         {
-          F_mul (t, a + K, invb, K, DEFAULT, Fermat, t + 2 * K);
+          F_mul (t, a + K, invb, K, DEFAULT, ECM_FERMAT, t + 2 * K);
           /* Put Q in T, as we still need high(A) later on */
           list_mod (t, t + K - 2, K, n);
         }
       else
         {
-          F_mul (t, a + K, invb, K, DEFAULT, Fermat, t + 2 * K);
+          F_mul (t, a + K, invb, K, DEFAULT, ECM_FERMAT, t + 2 * K);
           list_mod (a + K, t + K - 2, K, n);
         }
     }
@@ -570,19 +689,19 @@ PrerevertDivision (listz_t a, listz_t b, listz_t invb,
 
   /* T <- low(Q * B) with a short product */
   mpz_set_ui (a[2 * K - 1], 0);
-  if (Fermat && po2)
+  if (ECM_FERMAT && po2)
     {
-      if (K <= 4 * Fermat)
+      if (K <= 4 * ECM_FERMAT)
         {
           /* Multiply without zero padding, result is (mod x^K - 1) */
-          F_mul (t + K, t, b, K, NOPAD, Fermat, t + 2 * K);
+          F_mul (t + K, t, b, K, NOPAD, ECM_FERMAT, t + 2 * K);
           /* Take the leading monomial x^K of B into account */
           list_add (t, t + K, t, K);
           /* Subtract high(A) */
           list_sub(t, t, a + K, K);
         }
       else
-        F_mul (t, a + K, b, K, DEFAULT, Fermat, t + 2 * K);
+        F_mul (t, a + K, b, K, DEFAULT, ECM_FERMAT, t + 2 * K);
     }
   else /* non-Fermat case */
     {
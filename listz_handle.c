@@ -2,20 +2,59 @@
 #include "config.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #ifdef HAVE_FCNTL_H
 #include <fcntl.h>
 #endif
 #ifdef _OPENMP
 #include <omp.h>
 #endif
+#include "listz_handle.h"
 #if defined(HAVE_AIO_READ) && defined(WANT_AIO)
 /* For EAGAIN etc. */
 #include <errno.h>
+/* For close() */
+#include <unistd.h>
 #endif
-#include "listz_handle.h"
 
 /* #define TRACE_ITER yes */
 
+/* Open filename for the disk storage of F, whose words and len are set.
+   Frees F and returns NULL if something goes wrong. */
+
+static listz_handle_t 
+listz_handle_open (listz_handle_t F, const char *filename)
+{
+  F->storage = 1; /* Disk storage */
+  F->filename = (char *) malloc ((strlen (filename) + 1) * sizeof(char));
+  if (F->filename == NULL)
+    {
+      free (F);
+      return NULL;
+    }
+  strcpy (F->filename, filename);
+  F->data.file = fopen (F->filename, "rb+");
+  if (F->data.file == NULL)
+    F->data.file = fopen (F->filename, "wb+");
+  if (F->data.file == NULL)
+    {
+      free (F->filename);
+      free (F);
+      return NULL;
+    }
+#ifdef HAVE_FALLOCATE
+  fallocate (fileno(F->data.file), 0, (off_t) 0, 
+             F->words * sizeof(file_word_t) * F->len);
+#endif
+#if defined(HAVE_SETVBUF) && defined(HAVE_AIO_READ)
+  /* Set to unbuffered mode as we use aio_*() functions for reading
+     in the background */
+  setvbuf (F->data.file, NULL, _IONBF, 0);
+#endif
+
+  return F;
+}
+
 /* Init a listz_handle_t to store up to len residues (modulo m). 
    If filename != NULL, uses disk storage, otherwise memory.
    Returns NULL if something goes wrong (i.e., if a memory allocation
@@ -51,39 +90,35 @@ listz_handle_init (const char *filename, const uint64_t len, const mpz_t m)
           free (F);
           F = NULL;
         }
-    } else {
-      F->storage = 1; /* Disk storage */
-      F->filename = (char *) malloc ((strlen (filename) + 1) * sizeof(char));
-      if (F->filename == NULL)
-        {
-          free (F);
-          return NULL;
-        }
-      strcpy (F->filename, filename);
-      F->data.file = fopen (F->filename, "rb+");
-      if (F->data.file == NULL)
-        F->data.file = fopen (F->filename, "wb+");
-      if (F->data.file == NULL)
-        {
-          free (F->filename);
-          free (F);
-          return NULL;
-        }
-#ifdef HAVE_FALLOCATE
-      fallocate (fileno(F->data.file), 0, (off_t) 0, 
-                 F->words * sizeof(file_word_t) * len);
-#endif
-#if defined(HAVE_SETVBUF) && defined(HAVE_AIO_READ)
-      /* Set to unbuffered mode as we use aio_*() functions for reading
-         in the background */
-      setvbuf (F->data.file, NULL, _IONBF, 0);
-#endif
     }
+  else
+    F = listz_handle_open (F, filename);
 
   return F;
 }
 
 
+/* Init a listz_handle_t that stores len entries of words file_word_t's 
+   each in filename. The entries are accessed with listz_handle_read_raw(),
+   listz_handle_write_raw() and listz_iterator_read_raw() rather than as 
+   residues. Returns NULL if something goes wrong. */
+
+listz_handle_t 
+listz_handle_init_raw (const char *filename, const uint64_t len, 
+                       const size_t words)
+{
+  listz_handle_t F;
+
+  F = malloc (sizeof (_listz_handle_t));
+  if (F == NULL)
+    return NULL;
+  F->words = words;
+  F->len = len;
+
+  return listz_handle_open (F, filename);
+}
+
+
 listz_handle_t 
 listz_handle_from_listz (const listz_t l, const uint64_t len, const mpz_t m)
 {
@@ -159,6 +194,48 @@ listz_handle_seek_entry (listz_handle_t F, const uint64_t index)
 }
 
 
+/* Read nbytes bytes, starting offset bytes into the index-th entry, 
+   of a handle stored on disk into buf */
+
+void 
+listz_handle_read_raw (listz_handle_t F, const uint64_t index, 
+                       const size_t offset, void *buf, const size_t nbytes)
+{
+  size_t r = 0;
+
+  ASSERT (offset + nbytes <= F->words * sizeof(file_word_t));
+#ifdef _OPENMP
+#pragma omp critical 
+#endif
+  {
+    if (listz_handle_seek_entry (F, index) == 0 && 
+        aux_fseek64 (F->data.file, (int64_t) offset, SEEK_CUR) == 0)
+      r = fread (buf, 1, nbytes, F->data.file);
+  }
+  ASSERT_ALWAYS (r == nbytes);
+}
+
+
+void 
+listz_handle_write_raw (listz_handle_t F, const uint64_t index, 
+                        const size_t offset, const void *buf, 
+                        const size_t nbytes)
+{
+  size_t r = 0;
+
+  ASSERT (offset + nbytes <= F->words * sizeof(file_word_t));
+#ifdef _OPENMP
+#pragma omp critical 
+#endif
+  {
+    if (listz_handle_seek_entry (F, index) == 0 && 
+        aux_fseek64 (F->data.file, (int64_t) offset, SEEK_CUR) == 0)
+      r = fwrite (buf, 1, nbytes, F->data.file);
+  }
+  ASSERT_ALWAYS (r == nbytes);
+}
+
+
 /* Output a polynomial of degree len-1, or a monic polynomial of degree len.
    In either case, len is the number of coefficients read from "l".
    If symmetric == 1, then the polynomial is printed as a reciprocal Laurent
@@ -220,15 +297,20 @@ listz_handle_output_poly (const listz_handle_t l, const uint64_t len,
 /* Iterator functions for sequential access to elements of a
    list_handle_t. */
 
+/* Read the buffer at iter->next. With aio_*(), the read goes to the 
+   inactive buffer and is only started, listz_iterator_switchbuf() waits
+   for it to finish. */
+
 static void 
-listz_iterator_fetch (listz_iterator_t *iter, const uint64_t offset)
+listz_iterator_fetch (listz_iterator_t *iter)
 {
+  const size_t ressize = iter->handle->words * sizeof(file_word_t);
+
   ASSERT (iter->handle->storage == 1);
-  iter->offset = offset;
 #if defined(HAVE_AIO_READ) && defined(WANT_AIO)
-  iter->cb.aio_offset = (off_t) offset * iter->handle->words * sizeof(file_word_t);
-  iter->cb.aio_buf = iter->buf[iter->active_buffer];
-  iter->cb.aio_nbytes = iter->bufsize * iter->handle->words * sizeof(file_word_t);
+  iter->cb.aio_offset = (off_t) iter->next * ressize;
+  iter->cb.aio_buf = iter->buf[iter->active_buffer ^ 1];
+  iter->cb.aio_nbytes = iter->bufsize * ressize;
   {
     int r = aio_read (&iter->cb);
     if (r != 0)
@@ -237,15 +319,26 @@ listz_iterator_fetch (listz_iterator_t *iter, const uint64_t offset)
         abort ();
       }
   }
+  iter->pending = 1;
 #else /* ifdef HAVE_AIO_READ */
+  iter->offset = iter->next;
+  iter->next += iter->stride;
 #ifdef _OPENMP
 #pragma omp critical 
 #endif
   {
     listz_handle_seek_entry (iter->handle, iter->offset);
-    iter->valid = fread (iter->buf, iter->handle->words * sizeof(file_word_t), 
-                         iter->bufsize, iter->handle->data.file);
+    iter->valid = fread (iter->buf, ressize, iter->bufsize, 
+                         iter->handle->data.file);
   }
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+  /* Let the system read the next buffer in the background while we 
+     process this one */
+  if (iter->next < iter->handle->len)
+    posix_fadvise (fileno (iter->handle->data.file), 
+                   (off_t) iter->next * ressize, 
+                   (off_t) iter->bufsize * ressize, POSIX_FADV_WILLNEED);
+#endif
 #endif /* ifdef HAVE_AIO_READ else */
 }
 
@@ -260,7 +353,7 @@ listz_iterator_suspend (struct aiocb * const cb)
   do {
     const struct aiocb * aiocb_list[1] = {cb};
     r = aio_suspend (aiocb_list, 1, NULL);
-  } while (r == EAGAIN || r == EINTR);
+  } while (r != 0 && (errno == EAGAIN || errno == EINTR));
   if (r != 0)
     {
       fprintf (stderr, "%s(): aio_suspend() returned error, errno = %d\n",
@@ -280,6 +373,8 @@ listz_iterator_suspend (struct aiocb * const cb)
 #endif  
 
 
+/* Write the residues of the active buffer to the file at iter->offset */
+
 static void 
 listz_iterator_flush (listz_iterator_t *iter)
 {
@@ -290,22 +385,27 @@ listz_iterator_flush (listz_iterator_t *iter)
 
 #if defined(HAVE_AIO_READ) && defined(WANT_AIO)
   {
+    /* iter->cb may be busy with reading the next buffer */
+    struct aiocb cb;
     size_t nbytes, written;
     int r;
 
-    iter->cb.aio_offset = 
+    memset (&cb, 0, sizeof(struct aiocb));
+    cb.aio_fildes = iter->fd;
+    cb.aio_sigevent.sigev_notify = SIGEV_NONE;
+    cb.aio_offset = 
         (off_t) iter->offset * iter->handle->words * sizeof(file_word_t);
-    iter->cb.aio_buf = iter->buf[iter->active_buffer];
+    cb.aio_buf = iter->buf[iter->active_buffer];
     nbytes = iter->writeptr * iter->handle->words * sizeof(file_word_t);
-    iter->cb.aio_nbytes = nbytes;
-    r = aio_write (&iter->cb);
+    cb.aio_nbytes = nbytes;
+    r = aio_write (&cb);
     if (r != 0)
       {
         fprintf (stderr, "%s(): aio_write() returned error, errno = %d\n", 
                  __func__, errno);
         abort ();
       }
-    written = listz_iterator_suspend (&iter->cb);
+    written = listz_iterator_suspend (&cb);
     ASSERT_ALWAYS (written == nbytes);
   }
 #else
@@ -324,9 +424,14 @@ listz_iterator_flush (listz_iterator_t *iter)
 }
 
 
+/* Init an iterator that starts at residue firstres and buffers nr_buffered
+   residues at a time. The buffers that follow start stride residues 
+   apart, so with stride > nr_buffered, the iterator skips the residues in
+   between. */
+
 listz_iterator_t *  
-listz_iterator_init2 (listz_handle_t h, const uint64_t firstres, 
-                      const size_t nr_buffered)
+listz_iterator_init_stride (listz_handle_t h, const uint64_t firstres, 
+                            const size_t nr_buffered, const uint64_t stride)
 {
   listz_iterator_t *iter;
   
@@ -339,7 +444,9 @@ listz_iterator_init2 (listz_handle_t h, const uint64_t firstres,
     iter->readptr = iter->writeptr = (size_t) firstres;
   else
     {
-      iter->offset = firstres;
+      ASSERT_ALWAYS (stride >= nr_buffered);
+      iter->offset = iter->next = firstres;
+      iter->stride = stride;
       iter->readptr = iter->writeptr = iter->valid = 0;
       iter->bufsize = nr_buffered;
 #if defined(HAVE_AIO_READ) && defined(WANT_AIO)
@@ -347,26 +454,22 @@ listz_iterator_init2 (listz_handle_t h, const uint64_t firstres,
                              sizeof(file_word_t));
       iter->buf[1] = malloc (iter->bufsize * iter->handle->words * 
                              sizeof(file_word_t));
-      if (iter->buf[0] == NULL || iter->buf[1] == NULL) 
+      /* Each iterator has its own file descriptor, so that the offsets
+         of its requests don't interfere with other accesses to the file */
+      iter->fd = open (h->filename, O_RDWR);
+      if (iter->buf[0] == NULL || iter->buf[1] == NULL || iter->fd < 0) 
         {
+          if (iter->fd >= 0)
+            close (iter->fd);
           free (iter->buf[0]);
           free (iter->buf[1]);
           free (iter);
           return NULL;
         }
-#ifdef _OPENMP
-#pragma omp critical 
-#endif
-      {
-        /* Prevent other access to the file which would lead to data 
-           corruption */
-        iter->hidden_file = h->data.file;
-        h->data.file = NULL;
-      }
-      ASSERT_ALWAYS (iter->hidden_file != NULL);
       iter->active_buffer = 0;
+      iter->pending = 0;
       memset (&iter->cb, 0, sizeof(struct aiocb));
-      iter->cb.aio_fildes = fileno (iter->hidden_file);
+      iter->cb.aio_fildes = iter->fd;
       iter->cb.aio_reqprio = 0;
       iter->cb.aio_sigevent.sigev_notify = SIGEV_NONE;
 #else
@@ -384,6 +487,14 @@ listz_iterator_init2 (listz_handle_t h, const uint64_t firstres,
 }
 
 
+listz_iterator_t *  
+listz_iterator_init2 (listz_handle_t h, const uint64_t firstres, 
+                      const size_t nr_buffered)
+{
+  return listz_iterator_init_stride (h, firstres, nr_buffered, nr_buffered);
+}
+
+
 listz_iterator_t *  
 listz_iterator_init (listz_handle_t h, const uint64_t firstres)
 {
@@ -398,14 +509,12 @@ listz_iterator_clear (listz_iterator_t *iter)
   if (iter->handle->storage == 1)
     {
 #if defined(HAVE_AIO_READ) && defined(WANT_AIO)
-      if (iter->valid > 0)
-        {
-          listz_iterator_suspend (&iter->cb);
-        }
+      if (iter->pending)
+        listz_iterator_suspend (&iter->cb);
 #endif
       listz_iterator_flush (iter);
 #if defined(HAVE_AIO_READ) && defined(WANT_AIO)
-      iter->handle->data.file = iter->hidden_file;
+      close (iter->fd);
       free (iter->buf[0]);
       free (iter->buf[1]);
 #else
@@ -416,34 +525,31 @@ listz_iterator_clear (listz_iterator_t *iter)
 }
 
 
-/* Outside of listz_iterator_newbuf() we have:
-   If iter->valid == 0, then there is no outstanding read request
-   If iter->valid != 0, then there is an outstanding read request for the 
-     non-active buffer
+/* Outside of listz_iterator_switchbuf() we have:
+   The active buffer holds iter->valid residues read from iter->offset
+   If iter->pending != 0, then there is an outstanding read request for 
+     the non-active buffer, which starts at iter->next
    There is no outstanding write request
-   If there is an outstanding read request, then iter->offset is the start 
-     position in the file (in units of residues) of that read request
 */
 
 static inline void 
 listz_iterator_switchbuf (listz_iterator_t *iter)
 {
+  listz_iterator_flush (iter);
 #if defined(HAVE_AIO_READ) && defined(WANT_AIO)
-  if (iter->valid == 0)
-    {
-      /* We never read data before. We have to fetch data for the 
-         current buffer and wait for it to finish, then issue a fetch 
-         for the next buffer */
-      listz_iterator_fetch (iter, iter->offset);
-      iter->active_buffer ^= 1;
-    }
+  if (!iter->pending)
+    listz_iterator_fetch (iter);
   iter->valid = listz_iterator_suspend (&iter->cb) 
       / sizeof(file_word_t) / iter->handle->words;
-#endif
-  listz_iterator_flush (iter);
-  listz_iterator_fetch (iter, iter->offset + iter->valid);
-#if defined(HAVE_AIO_READ) && defined(WANT_AIO)
+  iter->pending = 0;
   iter->active_buffer ^= 1;
+  iter->offset = iter->next;
+  iter->next += iter->stride;
+  /* Read the next buffer while the caller processes this one */
+  if (iter->next < iter->handle->len)
+    listz_iterator_fetch (iter);
+#else
+  listz_iterator_fetch (iter);
 #endif
   iter->readptr = 0;
   ASSERT_ALWAYS (iter->valid > 0);
@@ -520,7 +626,7 @@ listz_iterator_write (listz_iterator_t *iter, const mpz_t r)
                   iter->writeptr, iter->active_buffer);
 #endif
           listz_iterator_flush (iter);
-          iter->offset += iter->bufsize;
+          iter->offset += iter->stride;
         }
       ASSERT_ALWAYS (mpz_sgn (r) >= 0);
       /* TODO: we may want to allow residues that are not fully reduced 
@@ -536,6 +642,28 @@ listz_iterator_write (listz_iterator_t *iter, const mpz_t r)
   iter->writeptr++;
 }
 
+/* Returns a pointer to the handle->words file_word_t's of the next entry
+   of a handle stored on disk, which stays valid until the next call. This
+   is for handles made with listz_handle_init_raw(). */
+
+file_word_t *
+listz_iterator_read_raw (listz_iterator_t *iter)
+{
+  file_word_t *r;
+
+  ASSERT (iter->handle->storage == 1);
+  ASSERT (iter->writeptr == 0);
+  if (iter->readptr == iter->valid)
+    listz_iterator_switchbuf (iter);
+#if defined(HAVE_AIO_READ) && defined(WANT_AIO)
+  r = &iter->buf[iter->active_buffer][iter->readptr * iter->handle->words];
+#else
+  r = &iter->buf[iter->readptr * iter->handle->words];
+#endif
+  iter->readptr++;
+  return r;
+}
+
 /* Functions that can be used as callbacks to listz_iterator_read() and 
    listz_iterator_write() in mpzspv_fromto_mpzv(). Note that calling, e.g., 
    listz_iterator_read() by de-referencing a pointer of type mpz_producerfunc_t
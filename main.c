@@ -29,6 +29,9 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #endif
 #include "ecm-impl.h"
 #include "ecm-ecm.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "config.h"
 
@@ -101,6 +104,8 @@ usage (void)
     printf ("  -A A         use A as a curve coefficient [ecm, see README]\n");
     printf ("  -torsion T   to generate a curve with torsion group T "
 	                                                "[ecm, see README]\n");
+    printf ("  -edwards     perform stage 1 on the twisted Edwards form "
+                                                "[ecm, see README]\n");
     printf ("  -k n         perform >= n steps in stage 2\n");
     printf ("  -power n     use x^n for Brent-Suyama's extension\n");
     printf ("  -dickson n   use n-th Dickson's polynomial for Brent-Suyama's extension\n");
@@ -113,7 +118,9 @@ usage (void)
     printf ("  -mpzmod      use GMP's mpz_mod for modular reduction\n");
     printf ("  -modmuln     use Montgomery's MODMULN for modular reduction\n");
     printf ("  -redc        use Montgomery's REDC for modular reduction\n");
-    printf ("  -nobase2     disable special base-2 code\n");
+    printf ("  -kbnc        use special division for factors of k*2^n+c\n");
+    printf ("  -dwt         same with floating-point FFT multiplication\n");
+    printf ("  -nobase2     disable special base-2 and k*2^n+c code\n");
     printf ("  -nobase2s2   disable special base-2 code in ecm stage 2 only\n");
     printf ("  -base2 n     force base 2 mode with 2^n+1 (n>0) or 2^|n|-1 (n<0)\n");
     printf ("  -ntt         enable NTT convolution routines in stage 2\n");
@@ -121,6 +128,8 @@ usage (void)
     printf ("  -save file   save residues at end of stage 1 to file\n");
     printf ("  -savea file  like -save, appends to existing files\n");
     printf ("  -resume file resume residues from file, reads from stdin if file is \"-\"\n");
+    printf ("  -resumeconv f g convert resume file f from text to binary or from\n"
+            "               binary to text, write it to g, and exit\n");
     printf ("  -chkpnt file save periodic checkpoints during stage 1 to file (for -param 0)\n");
     printf ("  -primetest   perform a primality test on input\n");
     printf ("  -treefile f  [ECM only] store stage 2 data in files f.0, ... \n");
@@ -136,6 +145,11 @@ usage (void)
 
     printf ("  -bsaves file With -param 1-3, save stage 1 exponent in file.\n");
     printf ("  -bloads file With -param 1-3, load stage 1 exponent from file.\n");
+    printf ("  -cachedir d  keep stage 1 exponents and stage 2 NTT data in directory d\n");
+    printf ("  -cpucurves n With -param 3, compute stage 1 of n curves at once "
+                                                          "on the CPU\n");
+    printf ("  -t n         run n curves at once in separate threads (with -gpu or\n"
+            "               -cpucurves, overlap stage 1 and 2 in n threads)\n");
 #ifdef WITH_GPU
     printf ("  -gpu         Use CGBN for computations stage 1.\n");
     printf ("  -gpudevice n Use device n to execute GPU code (by default, "
@@ -237,6 +251,24 @@ print_config ()
   printf ("REDC_THRESHOLD undefined\n");
 #endif
 
+#ifdef KBNC_THRESHOLD
+  printf ("KBNC_THRESHOLD = %d\n", KBNC_THRESHOLD);
+#else
+  printf ("KBNC_THRESHOLD undefined\n");
+#endif
+
+#ifdef DWT_THRESHOLD
+  printf ("DWT_THRESHOLD = %d\n", DWT_THRESHOLD);
+#else
+  printf ("DWT_THRESHOLD undefined\n");
+#endif
+
+#ifdef BASE2_FFT_THRESHOLD
+  printf ("BASE2_FFT_THRESHOLD = %d\n", BASE2_FFT_THRESHOLD);
+#else
+  printf ("BASE2_FFT_THRESHOLD undefined\n");
+#endif
+
 #ifdef MUL_NTT_THRESHOLD
   printf ("MUL_NTT_THRESHOLD = %d\n", MUL_NTT_THRESHOLD);
 #else
@@ -368,6 +400,7 @@ main (int argc, char *argv[])
                            /*   1=sigma from command line */
   int repr = ECM_MOD_DEFAULT; /* automatic choice */
   int nobase2step2 = 0; /* flag to turn off base 2 arithmetic in ecm stage 2 */
+  int edwards = 0; /* stage 1 on the twisted Edwards form */
   unsigned long k = ECM_DEFAULT_K; /* default number of blocks in stage 2 */
   int S = ECM_DEFAULT_S;
              /* Degree for Brent-Suyama extension requested by user.
@@ -375,12 +408,14 @@ main (int argc, char *argv[])
                 negative: use degree |S| Dickson poly,
                 default (0): automatic choice. */
   char *savefilename = NULL, *resumefilename = NULL, *infilename = NULL;
-  char *TreeFilename = NULL, *chkfilename = NULL;
+  char *TreeFilename = NULL, *chkfilename = NULL, *cachedir = NULL;
 #ifdef HAVE_TORSION
   char *torsion = NULL;
 #endif
   char rtime[256] = "", who[256] = "", comment[256] = "", program[256] = "";
-  FILE *resumefile = NULL, *infile = NULL;
+  FILE *infile = NULL;
+  resume_reader_t resume, *resumefile = NULL;
+  char *convertfilename[2] = {NULL, NULL}; /* -resumeconv files */
   mpz_t resume_lastN, resume_lastfac; /* When resuming residues from a file,
         store the last number processed and the factors found for this it */
   int resume_wasPrp = 0; /* 1 if resume_lastN/resume_lastfac is a PRP */
@@ -406,6 +441,9 @@ main (int argc, char *argv[])
                       /* chooses)                                             */
   unsigned int gpucurves = 0; /* How many curves do we want for GPU code */ 
                               /* (by default CUDA chooses)               */
+  unsigned int cpucurves = 0; /* How many curves at once in CPU batch mode */
+  unsigned int nthreads = 1;  /* How many curves at once in threads (-t) */
+  curve_pool_t pool;
 
   /* check ecm is linked with a compatible library */
   if (mp_bits_per_limb != GMP_NUMB_BITS)
@@ -481,6 +519,18 @@ main (int argc, char *argv[])
 	  argv++;
 	  argc--;
         }
+      else if (strcmp (argv[1], "-kbnc") == 0)
+        {
+          repr = ECM_MOD_KBNC;
+	  argv++;
+	  argc--;
+        }
+      else if (strcmp (argv[1], "-dwt") == 0)
+        {
+          repr = ECM_MOD_DWT;
+	  argv++;
+	  argc--;
+        }
       else if (strcmp (argv[1], "-nobase2") == 0)
         {
           repr = ECM_MOD_NOBASE2;
@@ -529,6 +579,12 @@ main (int argc, char *argv[])
           argv += 2;
           argc -= 2;
         }
+      else if ((argc > 2) && (strcmp (argv[1], "-cachedir") == 0))
+        {
+          cachedir = argv[2];
+          argv += 2;
+          argc -= 2;
+        }
       else if (strcmp (argv[1], "-h") == 0 || strcmp (argv[1], "--help") == 0)
         {
           usage ();
@@ -648,6 +704,12 @@ main (int argc, char *argv[])
 	  argc -= 2;
         }
 #endif
+      else if (strcmp (argv[1], "-edwards") == 0)
+        {
+          edwards = 1;
+	  argv++;
+	  argc--;
+        }
       else if ((argc > 2) && (strcmp (argv[1], "-power")) == 0)
         {
           S = abs (atoi (argv[2]));
@@ -696,6 +758,13 @@ main (int argc, char *argv[])
 	  argv += 2;
 	  argc -= 2;
 	}
+      else if ((argc > 3) && (strcmp (argv[1], "-resumeconv") == 0))
+	{
+	  convertfilename[0] = argv[2];
+	  convertfilename[1] = argv[3];
+	  argv += 3;
+	  argc -= 3;
+	}
       else if ((argc > 2) && (strcmp (argv[1], "-chkpnt") == 0))
 	{
 	  chkfilename = argv[2];
@@ -783,6 +852,23 @@ main (int argc, char *argv[])
 	  argv += 2;
 	  argc -= 2;
 	}
+      else if ((argc > 2) && (strcmp (argv[1], "-cpucurves") == 0))
+        {
+          cpucurves = atoi (argv[2]);
+          argv += 2;
+          argc -= 2;
+        }
+      else if ((argc > 2) && (strcmp (argv[1], "-t") == 0))
+        {
+          if (atoi (argv[2]) <= 0)
+            {
+              fprintf (stderr, "Error, the -t parameter should be positive\n");
+              exit (EXIT_FAILURE);
+            }
+          nthreads = atoi (argv[2]);
+          argv += 2;
+          argc -= 2;
+        }
 #ifdef WITH_GPU
       else if (strcmp (argv[1], "-gpu") == 0 || strcmp (argv[1], "-cgbn") == 0)
         {
@@ -817,6 +903,21 @@ main (int argc, char *argv[])
       exit (EXIT_FAILURE);
     }
 
+  /* -resumeconv only converts a file, and needs no bounds */
+  if (convertfilename[0] != NULL)
+    {
+      if (access (convertfilename[1], F_OK) == 0)
+        {
+          fprintf (stderr, "File %s already exists, will not overwrite\n",
+                   convertfilename[1]);
+          exit (EXIT_FAILURE);
+        }
+      init_expr ();
+      if (resume_convert (convertfilename[0], convertfilename[1]) != 0)
+        returncode = EXIT_FAILURE;
+      goto free_all;
+    }
+
   if (argc < 2)
     {
       fprintf (stderr, "Invalid arguments. See %s --help.\n", argv0[0]);
@@ -1028,13 +1129,42 @@ main (int argc, char *argv[])
   params->nobase2step2 = nobase2step2;
   params->chkfilename = chkfilename;
   params->TreeFilename = TreeFilename;
+  params->cachedir = cachedir;
   params->maxmem = maxmem;
   params->stage1time = stage1time;
   params->gpu = use_gpu;   /* If WITH_GPU is not defined it will always be 0 */
   params->gpu_device = gpudevice; /* If WITH_GPU is not defined or    */
                                   /* use_gpu = 0, it has no meaning   */
-  params->gpu_number_of_curves = gpucurves; /* If WITH_GPU is not defined or */
-                                            /* use_gpu = 0, it has no meaning*/
+  /* number of curves computed at once, either on the GPU or on the CPU */
+  params->gpu_number_of_curves = use_gpu ? gpucurves : cpucurves;
+  if (cpucurves > 0 && (use_gpu || method != ECM_ECM))
+    {
+      fprintf (stderr, "Error, -cpucurves makes sense with ECM on CPU only\n");
+      exit (EXIT_FAILURE);
+    }
+  if (nthreads > 1)
+    {
+#ifndef _OPENMP
+      fprintf (stderr, "Error, -t requires GMP-ECM to be configured with "
+               "--enable-openmp\n");
+      exit (EXIT_FAILURE);
+#endif
+      if (chkfilename != NULL || TreeFilename != NULL)
+        {
+          fprintf (stderr, "Error, -t not allowed with -chkpnt or -treefile\n");
+          exit (EXIT_FAILURE);
+        }
+      /* with several curves at once, the threads run stage 2 while stage 1
+         of the next curves goes on (see pipeline.c) */
+      if (use_gpu || cpucurves > 0)
+        {
+#ifdef _OPENMP
+          omp_set_num_threads (nthreads);
+#endif
+          nthreads = 1;
+        }
+    }
+  curve_pool_init (&pool, nthreads);
 
   /* Open resume file for reading, if resuming is requested */
   if (resumefilename != NULL)
@@ -1045,17 +1175,21 @@ main (int argc, char *argv[])
           fprintf (stderr, "Error, -resume not allowed with -gpu\n");
           exit (EXIT_FAILURE);
         }
-      if (strcmp (resumefilename, "-") == 0)
-        resumefile = stdin;
-      else
-        resumefile = fopen (resumefilename, "r");
-      
-      if (resumefile == NULL)
+      if (cpucurves > 0)
+        {
+          fprintf (stderr, "Error, -resume not allowed with -cpucurves\n");
+          exit (EXIT_FAILURE);
+        }
+      /* the file can be in the text or the binary format */
+      if (resume_reader_open (&resume, resumefilename) != 0)
         {
           fprintf (stderr, "Could not open file %s for reading\n", 
                    resumefilename);
           exit (EXIT_FAILURE);
         }
+      resumefile = &resume;
+      /* with -t, the next residues are run ahead in the other threads */
+      pool.resume = resumefile;
       mpz_init (resume_lastN);
       mpz_init (resume_lastfac);
       mpz_set_ui (resume_lastfac, 1);
@@ -1150,10 +1284,10 @@ main (int argc, char *argv[])
                        "Error, option -c and -resume are incompatible\n");
               exit (EXIT_FAILURE);
             }
-          if (!read_resumefile_line (&method, x, y, &n, sigma, A, 
-				     orig_x0, orig_y0, &(params->E->type), 
-				     &(params->param), &(params->B1done), 
-				     program, who, rtime, comment, resumefile))
+          if (!resume_reader_next (resumefile, &method, x, y, &n, sigma, A, 
+				   orig_x0, orig_y0, &(params->E->type), 
+				   &(params->param), &(params->B1done), 
+				   program, who, rtime, comment))
             break;
 
 	  if (params->E->type == ECM_EC_TYPE_WEIERSTRASS
@@ -1375,7 +1509,7 @@ main (int argc, char *argv[])
               exit (EXIT_FAILURE);
             }
           params->batch_last_B1_used = B1;
-          if (read_s_from_file (params->batch_s, loadfile_s, B1))
+          if (read_s_from_file (params->batch_s, loadfile_s, B1, param))
             {
               fprintf (stderr, "Error while reading s from file\n");
               exit (EXIT_FAILURE);
@@ -1443,6 +1577,9 @@ main (int argc, char *argv[])
 	    }
 #endif
 	}
+      /* any Montgomery curve, from sigma, A or -torsion, has this form */
+      if (edwards && params->E->type == ECM_EC_TYPE_MONTGOMERY)
+        params->E->type = ECM_EC_TYPE_TWISTED_EDWARDS;
       mpz_set (params->sigma, (params->sigma_is_A) ? A : sigma);
       mpz_set (params->go, go.Candi.n); /* may change if contains N */
       mpz_set (params->B2min, B2min); /* may change with -c */
@@ -1499,7 +1636,19 @@ main (int argc, char *argv[])
       /* now call the ecm library */
       if (result == ECM_NO_FACTOR_FOUND)
         /* if torsion was used, some factor may have been found... */
-        result = ecm_factor (f, n.n, B1, params);
+        {
+          /* the pool runs the next curves in advance, with -resume those
+             of the next residues of the file (see threads.c) */
+          unsigned int ncurves = (resumefile == NULL) ? cnt : 1;
+#ifdef HAVE_TORSION
+          if (torsion != NULL)
+            ncurves = 1;
+#endif
+          result = (nthreads > 1)
+            ? curve_pool_factor (&pool, f, n.n, B1, params, ncurves,
+                                 autoincrementB1)
+            : ecm_factor (f, n.n, B1, params);
+        }
 
       if (result == ECM_ERROR)
         {
@@ -1508,7 +1657,7 @@ main (int argc, char *argv[])
           exit (EXIT_FAILURE);
         }
       
-      if (!params->gpu)
+      if (params->gpu_number_of_curves == 0)
           cnt --; /* one more curve performed */
       else
         {
@@ -1518,8 +1667,8 @@ main (int argc, char *argv[])
               cnt -= params->gpu_number_of_curves; 
         }
 
-      /* When GPU is used we need to have the value of N before it is 
-        divided by potential factor in f */
+      /* When several curves are computed at once we need to have the value
+         of N before it is divided by potential factor in f */
       mpz_init_set (tmp_n, n.n);
 
       if (result != ECM_NO_FACTOR_FOUND)
@@ -1529,16 +1678,18 @@ main (int argc, char *argv[])
           mpz_init (tmp_factor);
           do 
             {
-              if (params->gpu)
-                  /* gpu returns multiple factors as f = f0 + f1*n + ... + fk*n^k */
+              if (params->gpu_number_of_curves > 0)
+                  /* multiple factors are returned as f = f0 + f1*n + ... + fk*n^k */
                   mpz_fdiv_qr (f, tmp_factor, f, tmp_n);
               else
                   mpz_set (tmp_factor, f);
 
               returncode = process_newfactor (tmp_factor, result, &n, method,
-                                 returncode, params->gpu, &cnt, &resume_wasPrp,
-                                 resume_lastfac, resumefile, verbose, deep);
-            } while (params->gpu && mpz_cmp_ui (f, 0) != 0 
+                                 returncode, params->gpu_number_of_curves > 0,
+                                 &cnt, &resume_wasPrp,
+                                 resume_lastfac, resumefile != NULL,
+                                 verbose, deep);
+            } while (params->gpu_number_of_curves > 0 && mpz_cmp_ui (f, 0) != 0 
                                  && returncode != ECM_INPUT_NUMBER_FOUND);
           mpz_clear (tmp_factor);
         }
@@ -1568,7 +1719,8 @@ main (int argc, char *argv[])
       /* Save the batch exponent s if requested */
       if (savefile_s != NULL)
         {
-          int ret = write_s_in_file (savefile_s, params->batch_s);
+          int ret = write_s_in_file (savefile_s, params->batch_s,
+                                     params->batch_last_B1_used, param);
           if (verbose >= OUTPUT_VERBOSE && ret > 0)
               printf ("Saved batch product (of %u bytes) in %s\n", ret, 
                       savefile_s);
@@ -1587,12 +1739,13 @@ main (int argc, char *argv[])
     } /* end of main loop */
 
   free_all1:
+  curve_pool_clear (&pool);
   if (infilename) /* infile might be stdin, don't fclose that! */
     fclose (infile);
 
   if (resumefile)
     {
-      fclose (resumefile);
+      resume_reader_close (resumefile);
       mpz_clear (resume_lastN);
       mpz_clear (resume_lastfac);
     }
@@ -36,8 +36,6 @@ Proc. of ISSAC'03, Philadelphia, 2003.
 #define MIN(a,b) (((a) < (b)) ? (a) : (b))
 #endif
 
-extern unsigned int Fermat;
-
 static void list_add_wrapper (listz_t, listz_t, listz_t, unsigned int,
                               unsigned int);
 static void list_sub_wrapper (listz_t, listz_t, listz_t, unsigned int,
@@ -734,14 +732,14 @@ TMulGen (listz_t b, unsigned int n, listz_t a, unsigned int m,
 {
   ASSERT (n <= l);
     
-  if (Fermat)
+  if (ECM_FERMAT)
     {
       unsigned int i;
       for (i = l + 1; i > 1 && (i&1) == 0; i >>= 1);
       ASSERT(i == 1);
       ASSERT(n + 1 == (l + 1) / 2);
       ASSERT(m == l - n || m + 1 == l - n);
-      return F_mul_trans (b, a, c, m + 1, l + 1, Fermat, tmp);
+      return F_mul_trans (b, a, c, m + 1, l + 1, ECM_FERMAT, tmp);
     }
   
   if ((double) n * (double) mpz_sizeinbase (modulus, 2) >= KS_TMUL_THRESHOLD)
@@ -758,7 +756,7 @@ TMulGen (listz_t b, unsigned int n, listz_t a, unsigned int m,
 unsigned int
 TMulGen_space (unsigned int n, unsigned int m, unsigned int l)
 {
-    if (Fermat)
+    if (ECM_FERMAT)
       return 2 * (l + 1);
     else
       return TToomCookMul_space (n, m, l);
@@ -30,8 +30,6 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
   #include "mulredc.h"
 #endif
 
-FILE *ECM_STDOUT, *ECM_STDERR; /* define them here since needed in tune.c */
-
 /* define WANT_ASSERT to check normalization of residues */
 /* #define WANT_ASSERT 1 */
 /* #define DEBUG */
@@ -48,6 +46,7 @@ static void ecm_redc_basecase (mpz_ptr, mpz_ptr, mpmod_t) ATTRIBUTE_HOT;
 static void ecm_mulredc_basecase (mpres_t, const mpres_t, const mpres_t, 
                                   mpmod_t) ATTRIBUTE_HOT;
 static void base2mod (mpres_t, const mpres_t, mpres_t, mpmod_t) ATTRIBUTE_HOT;
+static void kbncmod (mpres_t, const mpres_t, mpres_t, mpmod_t) ATTRIBUTE_HOT;
 static void REDC (mpres_t, const mpres_t, mpz_t, mpmod_t);
 
 /* returns +/-l if n is a factor of N = 2^l +/- 1 with N <= n^threshold, 
@@ -107,6 +106,160 @@ isbase2 (const mpz_t n, const double threshold)
   return res;
 }
 
+/* Largest k and |c| accepted by iskbnc. The bound on c is the one used by
+   kbnc_z in Fgw.c. */
+#define KBNC_MAX_K 4294967295UL
+#define KBNC_MAX_C 8388607UL
+
+/* returns l and sets k (odd) and c, with 0 < |c| <= KBNC_MAX_C, if n is a
+   factor of N = k*2^l + c with k <= KBNC_MAX_K and N <= n^threshold,
+   0 otherwise.
+   For each l, k*2^l = -c mod n with k and |c| small means that r/n, where
+   r = 2^l mod n, is close to a fraction with denominator k, thus k is one
+   of the cofactors t[i] of r in the extended Euclidean algorithm on n and
+   r, for which the remainder a[i] = t[i]*r mod n is small. As in Lehmer's
+   algorithm, we run it on the KBNC_BITS most significant bits of n and r
+   only, which gives the same quotients as long as the remainders are large
+   compared to the cofactors, and check a candidate k exactly.
+*/
+#define KBNC_BITS (3 * GMP_NUMB_BITS)
+static int
+iskbnc_search (const mpz_t n, unsigned long *k, long *c,
+               const double threshold)
+{
+  unsigned long lo, l, lmax, u0, u1, q, sh;
+  int res = 0;
+  mpz_t r, a0, a1, t;
+
+  if (mpz_cmp_ui (n, KBNC_MAX_C) <= 0 || mpz_even_p (n))
+    return 0;
+
+  mpz_init (r);
+  mpz_init (a0);
+  mpz_init (a1);
+  mpz_init (t);
+  lo = mpz_sizeinbase (n, 2) - 1; /* 2^lo <= n < 2^(lo+1) */
+  sh = (lo >= KBNC_BITS) ? lo + 1 - KBNC_BITS : 0;
+  /* k*2^l + c >= n needs l >= lo - 31 since k < 2^32 */
+  l = (lo > 32) ? lo - 31 : 1;
+  lmax = (unsigned long) (threshold * (double) lo);
+  mpz_set_ui (r, 1UL);
+  mpz_mul_2exp (r, r, l);
+  mpz_mod (r, r, n);
+  for (; l <= lmax && res == 0; l++)
+    {
+      /* here r = 2^l mod n */
+      mpz_tdiv_q_2exp (a0, n, sh);
+      mpz_tdiv_q_2exp (a1, r, sh);
+      u0 = 0;
+      u1 = 1;
+      while (1)
+        {
+          /* a1 is about u1*r mod n, up to sign and an error of u1 + 1 */
+          if (mpz_sizeinbase (a1, 2) <= 34)
+            {
+              mpz_mul_ui (t, r, u1);
+              mpz_tdiv_r (t, t, n);
+              if (mpz_sgn (t) == 0) /* n divides k, c would be 0 */
+                break;
+              if (mpz_cmp_ui (t, KBNC_MAX_C) <= 0)
+                {
+                  /* u1*2^l - t = 0 mod n */
+                  *k = u1;
+                  *c = - (long) mpz_get_ui (t);
+                  res = l;
+                  break;
+                }
+              mpz_sub (t, n, t);
+              if (mpz_cmp_ui (t, KBNC_MAX_C) <= 0)
+                {
+                  /* u1*2^l + t = 0 mod n */
+                  *k = u1;
+                  *c = (long) mpz_get_ui (t);
+                  res = l;
+                  break;
+                }
+            }
+          if (mpz_sgn (a1) == 0)
+            break;
+          mpz_tdiv_qr (t, a0, a0, a1);
+          if (mpz_cmp_ui (t, (KBNC_MAX_K - u0) / u1) > 0)
+            break;
+          q = mpz_get_ui (t);
+          u0 += q * u1;
+          mpz_swap (a0, a1);
+          q = u0;
+          u0 = u1;
+          u1 = q;
+        }
+
+      mpz_mul_2exp (r, r, 1);
+      if (mpz_cmp (r, n) >= 0)
+        mpz_sub (r, r, n);
+    }
+  mpz_clear (r);
+  mpz_clear (a0);
+  mpz_clear (a1);
+  mpz_clear (t);
+
+  if (res == 0)
+    return 0;
+
+  /* k*2^l with k even is also (k/2)*2^(l+1) */
+  for (; (*k & 1) == 0; *k >>= 1)
+    res++;
+
+  /* 2^l + c with |c| = 1 is a base-2 number, left to isbase2 */
+  if (res < 32 || (*k == 1 && (*c == 1 || *c == -1)))
+    res = 0;
+
+  for (q = *k, l = res; q > 1; q >>= 1)
+    l++; /* now 2^l <= k*2^res < 2^(l+1) */
+  if ((double) l > threshold * (double) lo)
+    res = 0;
+
+  return res;
+}
+
+/* Same as iskbnc_search, which runs up to about 0.4*log2(n) extended
+   Euclidean algorithms, but remembers the last n of the context: the
+   default mpmod_init calls it for all the numbers of KBNC_THRESHOLD limbs
+   or more, thus for each curve, and the curve pool for each job. */
+int
+iskbnc (const mpz_t n, unsigned long *k, long *c, const double threshold)
+{
+  ecm_ctx_t ctx = ECM_CTX;
+
+  if (!ctx->kbnc_inited)
+    {
+      mpz_init (ctx->kbnc_n);
+      ctx->kbnc_inited = 1;
+    }
+  else if (ctx->kbnc_threshold == threshold && mpz_cmp (ctx->kbnc_n, n) == 0)
+    goto done;
+  mpz_set (ctx->kbnc_n, n);
+  ctx->kbnc_threshold = threshold;
+  ctx->kbnc_l = iskbnc_search (n, &ctx->kbnc_k, &ctx->kbnc_c, threshold);
+
+ done:
+  if (ctx->kbnc_l != 0)
+    {
+      *k = ctx->kbnc_k;
+      *c = ctx->kbnc_c;
+    }
+  return ctx->kbnc_l;
+}
+
+void
+iskbnc_clear (void)
+{
+  ecm_ctx_t ctx = ECM_CTX;
+
+  if (ctx->kbnc_inited)
+    mpz_clear (ctx->kbnc_n);
+  ctx->kbnc_inited = 0;
+}
+
 /* Do base-2 reduction. R must not equal S or t. */
 static void
 base2mod (mpres_t R, const mpres_t S, mpres_t t, mpmod_t modulus)
@@ -133,8 +286,71 @@ base2mod (mpres_t R, const mpres_t S, mpres_t t, mpmod_t modulus)
     }
 }
 
-/* Modular reduction modulo the Fermat number 2^m+1. 
-   n = m / GMP_NUMB_BITS. Result is < 2^m+1.
+/* One folding step of kbncmod: with R = hi and t = lo, where the number to
+   reduce is S = hi*2^n + lo, and hi = q*k + s, sets
+   R <- s*2^n + lo - c*q, which is congruent to S modulo k*2^n+c. */
+static inline void
+kbncmod_fold (mpres_t R, mpres_t t, mpmod_t modulus)
+{
+  unsigned long s;
+  int sgn = mpz_sgn (R);
+
+  if (modulus->kbnc_k > 1)
+    {
+      s = mpz_tdiv_q_ui (R, R, modulus->kbnc_k);
+      if (s != 0)
+        {
+          /* s has the sign of hi, i.e., of S, as lo */
+          mpz_set_ui (modulus->aux_modulus, s);
+          mpz_mul_2exp (modulus->aux_modulus, modulus->aux_modulus,
+                        modulus->bits);
+          if (sgn < 0)
+            mpz_sub (t, t, modulus->aux_modulus);
+          else
+            mpz_add (t, t, modulus->aux_modulus);
+        }
+    }
+  mpz_mul_si (R, R, -modulus->kbnc_c);
+  mpz_add (R, R, t);
+}
+
+/* Do reduction modulo a factor of k*2^n+c, with n = modulus->bits. The
+   result has at most n + log2(k) + 1 bits, and might be negative, as for
+   base2mod. R must not equal S or t. */
+static void
+kbncmod (mpres_t R, const mpres_t S, mpres_t t, mpmod_t modulus)
+{
+  unsigned long n = modulus->bits, maxbits = n + modulus->kbnc_kbits;
+
+  ASSERT (R != S && R != t);
+  mpz_tdiv_q_2exp (R, S, n);
+  mpz_tdiv_r_2exp (t, S, n);
+  kbncmod_fold (R, t, modulus);
+
+  /* each step divides |R| by about 2^n/|c| as long as it is large, and
+     then gives |R| < k*2^n + 4|c| < 2^maxbits since n >= 32 */
+  while (mpz_sizeinbase (R, 2) > maxbits)
+    {
+      mpz_tdiv_r_2exp (t, R, n);
+      mpz_tdiv_q_2exp (R, R, n);
+      kbncmod_fold (R, t, modulus);
+    }
+}
+
+/* R <- S1 * S2 modulo a factor of k*2^n+c, with the floating-point FFT
+   of dwt.c, or its NTT if the round-off error is too large, or with
+   mpz_mul if the inputs are too large for both.
+   R may be S1 or S2, but not modulus->temp1. */
+static inline void
+dwtmod_mul (mpres_t R, const mpres_t S1, const mpres_t S2, mpmod_t modulus)
+{
+  if (dwt_mul (modulus->temp1, S1, S2, modulus->dwt) != 0)
+    mpz_mul (modulus->temp1, S1, S2);
+  kbncmod (R, modulus->temp1, modulus->temp1, modulus);
+}
+
+/* Modular reduction modulo B^n+1, where B = 2^GMP_NUMB_BITS, for example
+   the Fermat number 2^m+1 with n = m / GMP_NUMB_BITS. Result is < B^n+1.
    FIXME: this does not work with nails.
    Only copies the data to R if reduction is needed and returns 1 in that 
    case. If the value in S is reduced already, nothing is done and 0 is 
@@ -170,6 +386,164 @@ base2mod_2 (mpres_t R, const mpres_t S, mp_size_t n, mpz_t modulus)
   return 0;
 }
 
+/* Modular reduction modulo B^n-1, where B = 2^GMP_NUMB_BITS, as base2mod_2
+   does modulo B^n+1: if S has more than n limbs, sets R to a number of at
+   most n limbs congruent to S, and returns 1. Otherwise returns 0. */
+static int
+base2mod_3 (mpres_t R, const mpres_t S, mp_size_t n, mpz_t modulus)
+{
+  mp_size_t s;
+
+  s = ABSIZ(S);
+  if (s > n)
+    {
+      if (s <= 2 * n)
+        {
+          mp_srcptr sp = PTR(S);
+          mp_ptr rp;
+          mp_limb_t cy;
+
+          MPZ_REALLOC (R, n);
+          rp = PTR(R);
+
+          /* the sum is at most 2B^n-2, so the carry wraps around once */
+          cy = mpn_add (rp, sp, n, sp + n, s - n);
+          cy = mpn_add_1 (rp, rp, n, cy);
+          ASSERT (cy == 0);
+          s = n;
+          MPN_NORMALIZE(rp, s);
+          SIZ(R) = (SIZ(S) > 0) ? (int) s : (int) -s;
+        }
+      else /* should happen rarely */
+        mpz_mod (R, S, modulus);
+
+      return 1;
+    }
+
+  return 0;
+}
+
+/* The parameter k of mpn_mul_fft for a product modulo B^n+1: the best one
+   for n, lowered until 2^k divides n, as mpn_mulmod_bnm1 does */
+static int
+base2_fft_k (mp_size_t n, int sqr)
+{
+  int k = mpn_fft_best_k (n, sqr);
+
+  while (k > 0 && (n & ((1L << k) - 1)) != 0)
+    k--;
+  return k;
+}
+
+/* mpn_mul_fft is slower than mpz_mul with fewer than 2^BASE2_FFT_MIN_K
+   pieces */
+#define BASE2_FFT_MIN_K 3
+
+/* Returns n > 0 if the products modulo a factor of 2^|base2|+/-1 are best
+   done modulo B^n+1 with mpn_mul_fft, -n if modulo B^n-1 with
+   mpn_mulmod_bnm1, and 0 otherwise, i.e., with mpz_mul and base2mod.
+   This needs GMP_NUMB_BITS | base2, since 2^|base2|+/-1 divides B^n+/-1
+   only for the multiples n*GMP_NUMB_BITS of |base2| with an odd quotient
+   (resp. any quotient), and the multiples larger than |base2| itself
+   would cost more than the full product. */
+static mp_size_t
+base2_fft_n (int base2)
+{
+  mp_size_t n = abs (base2) / GMP_NUMB_BITS;
+  int k;
+
+  if (abs (base2) % GMP_NUMB_BITS != 0)
+    return 0;
+  /* mpn_mulmod_bnm1 uses mpn_mul and a fold for small n, so it is never
+     slower than mpz_mul and base2mod */
+  if (base2 < 0)
+    return -n;
+  if ((size_t) n < BASE2_FFT_THRESHOLD)
+    return 0;
+  k = base2_fft_k (n, 0);
+  if (k < BASE2_FFT_MIN_K || mpn_fft_next_size (n, k) != n)
+    return 0;
+  return n;
+}
+
+/* R <- S1 * S2 modulo B^n+1 if n = modulus->fft_n > 0, or modulo B^|n|-1
+   if n < 0, which is a multiple of N. The result has at most |n|+1 limbs
+   and is not reduced further modulo N.
+   R may be S1 or S2, but not modulus->temp1 or modulus->temp2. */
+static void
+base2mod_fft_mul (mpres_t R, const mpres_t S1, const mpres_t S2,
+                  mpmod_t modulus)
+{
+  mp_size_t n = ABS(modulus->fft_n);
+  mp_srcptr s1p = PTR(S1), s2p = PTR(S2);
+  mp_size_t s1s = SIZ(S1), s2s = SIZ(S2);
+  int (*fold) (mpres_t, const mpres_t, mp_size_t, mpz_t);
+
+  fold = (modulus->fft_n > 0) ? base2mod_2 : base2mod_3;
+  if (fold (modulus->temp1, S1, n, modulus->orig_modulus))
+    {
+      s1p = PTR(modulus->temp1);
+      s1s = SIZ(modulus->temp1);
+    }
+  if (S1 == S2)
+    {
+      s2p = s1p;
+      s2s = s1s;
+    }
+  else if (fold (modulus->temp2, S2, n, modulus->orig_modulus))
+    {
+      s2p = PTR(modulus->temp2);
+      s2s = SIZ(modulus->temp2);
+    }
+
+  if (modulus->fft_n > 0)
+    {
+      MPZ_REALLOC (R, n + 1);
+      /* mpn_mul_fft() computes the product modulo B^n + 1, where 
+         B = 2^(machine word size in bits). So the result can be = B^n, 
+         in that case R is set to zero and 1 is returned as carry-out.
+         In all other cases 0 is returned. Hence the complete result is 
+         R + cy * B^n, where cy is the value returned by mpn_mul_fft(). */
+      PTR(R)[n] = mpn_mul_fft (PTR(R), n, s1p, ABS(s1s), s2p, ABS(s2s),
+                               base2_fft_k (n, S1 == S2));
+      n ++;
+    }
+  else
+    {
+      /* mpn_mulmod_bnm1 does not allow overlap, and needs 2n+4 limbs of
+         scratch space: the product goes to aux_modulus, then to R */
+      mp_ptr tp = PTR(modulus->aux_modulus);
+      mp_size_t an = ABS(s1s), bn = ABS(s2s);
+
+      if (an < bn)
+        {
+          mp_srcptr tmp = s1p;
+          s1p = s2p;
+          s2p = tmp;
+          an = bn;
+          bn = ABS(s1s);
+        }
+      if (bn == 0)
+        n = 0;
+      else if (an + bn <= n / 2)
+        {
+          /* mpn_mulmod_bnm1 needs an + bn > n/2, and the product is
+             below B^n anyway */
+          mpn_mul (tp, s1p, an, s2p, bn);
+          n = an + bn;
+        }
+      else
+        {
+          mpn_mulmod_bnm1 (tp, n, s1p, an, s2p, bn, tp + n);
+          n = MIN (n, an + bn);
+        }
+      MPZ_REALLOC (R, n);
+      MPN_COPY (PTR(R), tp, n);
+    }
+  MPN_NORMALIZE(PTR(R), n);
+  SIZ(R) = ((s1s ^ s2s) >= 0) ? (int) n : (int) -n;
+}
+
 /* subquadratic REDC, at mpn level.
    {orig,n} is the original modulus.
    Requires xn = 2n or 2n-1 and ABSIZ(orig_modulus)=n.
@@ -567,121 +941,213 @@ mulredc_1 (mp_ptr z, const mp_limb_t x, mp_srcptr y, mp_srcptr m,
 static int tune_mulredc_table[] = TUNE_MULREDC_TABLE;
 static int tune_sqrredc_table[] = TUNE_SQRREDC_TABLE;
 
-static void 
-ecm_mulredc_basecase_n (mp_ptr rp, mp_srcptr s1p, mp_srcptr s2p, 
-                        mp_srcptr np, mp_size_t nn, mp_ptr invm, mp_ptr tmp)
+/* The products with Montgomery reduction rp <- s1p * s2p / B^nn mod np and
+   rp <- s1p^2 / B^nn mod np, one for each mode of the tuning tables (see
+   mpmod.h). The result has nn limbs and is less than B^nn, but not
+   necessarily less than np. mpmod_init_MODMULN chooses one of them for the
+   size of the modulus, so that the multiplications do not look up the
+   tables each time. */
+
+#ifdef USE_ASM_REDC
+static void
+mulredc_asm (mp_ptr rp, mp_srcptr s1p, mp_srcptr s2p, mp_srcptr np,
+             mp_size_t nn, mp_ptr invm, ATTRIBUTE_UNUSED mp_ptr tmp)
+{
+  mulredc (rp, s1p, s2p, np, nn, invm[0]);
+}
+
+static void
+sqrredc_asm (mp_ptr rp, mp_srcptr s1p, mp_srcptr np, mp_size_t nn,
+             mp_ptr invm, ATTRIBUTE_UNUSED mp_ptr tmp)
+{
+  mulredc (rp, s1p, s1p, np, nn, invm[0]);
+}
+#endif
+
+#ifdef HAVE_MULREDC_ADX
+/* the MULX/ADX kernels from x86_64/mulredc_adx.c, for nn <= MULREDC_ADX_MAX */
+static void
+mulredc_adx (mp_ptr rp, mp_srcptr s1p, mp_srcptr s2p, mp_srcptr np,
+             mp_size_t nn, mp_ptr invm, ATTRIBUTE_UNUSED mp_ptr tmp)
+{
+  if (mulredc_adx_table[nn] (rp, s1p, s2p, np, invm[0]) != 0)
+    mpn_sub_n (rp, rp, np, nn); /* a borrow should always occur here */
+}
+
+static void
+sqrredc_adx (mp_ptr rp, mp_srcptr s1p, mp_srcptr np, mp_size_t nn,
+             mp_ptr invm, ATTRIBUTE_UNUSED mp_ptr tmp)
+{
+  if (sqrredc_adx_table[nn] (rp, s1p, np, invm[0]) != 0)
+    mpn_sub_n (rp, rp, np, nn); /* a borrow should always occur here */
+}
+#endif
+
+#ifdef HAVE___GMPN_REDC_1
+static void
+mul_redc1 (mp_ptr rp, mp_srcptr s1p, mp_srcptr s2p, mp_srcptr np,
+           mp_size_t nn, mp_ptr invm, mp_ptr tmp)
+{
+  mpn_mul_n (tmp, s1p, s2p, nn);
+  REDC1(rp, tmp, np, nn, invm[0]);
+}
+
+static void
+sqr_redc1 (mp_ptr rp, mp_srcptr s1p, mp_srcptr np, mp_size_t nn,
+           mp_ptr invm, mp_ptr tmp)
+{
+  mpn_sqr (tmp, s1p, nn);
+  REDC1(rp, tmp, np, nn, invm[0]);
+}
+#endif
+
+#ifdef HAVE___GMPN_REDC_2
+static void
+mul_redc2 (mp_ptr rp, mp_srcptr s1p, mp_srcptr s2p, mp_srcptr np,
+           mp_size_t nn, mp_ptr invm, mp_ptr tmp)
+{
+  mpn_mul_n (tmp, s1p, s2p, nn);
+  REDC2(rp, tmp, np, nn, invm);
+}
+
+static void
+sqr_redc2 (mp_ptr rp, mp_srcptr s1p, mp_srcptr np, mp_size_t nn,
+           mp_ptr invm, mp_ptr tmp)
+{
+  mpn_sqr (tmp, s1p, nn);
+  REDC2(rp, tmp, np, nn, invm);
+}
+#endif
+
+/* plain C quadratic reduction of {tmp, 2nn} */
+static void
+redc_c (mp_ptr rp, mp_ptr tmp, mp_srcptr np, mp_size_t nn, mp_ptr invm)
 {
   mp_limb_t cy;
   mp_size_t j;
 
-  if (nn <= MULREDC_ASSEMBLY_MAX)
+  for (j = 0; j < nn; j++, tmp++)
+    tmp[0] = mpn_addmul_1 (tmp, np, nn, tmp[0] * invm[0]);
+  cy = mpn_add_n (rp, tmp - nn, tmp, nn);
+  if (cy != 0)
+    mpn_sub_n (rp, rp, np, nn); /* a borrow should always occur here */
+}
+
+static void
+mul_redc_c (mp_ptr rp, mp_srcptr s1p, mp_srcptr s2p, mp_srcptr np,
+            mp_size_t nn, mp_ptr invm, mp_ptr tmp)
+{
+  mpn_mul_n (tmp, s1p, s2p, nn);
+  redc_c (rp, tmp, np, nn, invm);
+}
+
+static void
+sqr_redc_c (mp_ptr rp, mp_srcptr s1p, mp_srcptr np, mp_size_t nn,
+            mp_ptr invm, mp_ptr tmp)
+{
+  mpn_sqr (tmp, s1p, nn);
+  redc_c (rp, tmp, np, nn, invm);
+}
+
+/* for nn > MULREDC_ASSEMBLY_MAX */
+static void
+mul_redc_n (mp_ptr rp, mp_srcptr s1p, mp_srcptr s2p, mp_srcptr np,
+            mp_size_t nn, mp_ptr invm, mp_ptr tmp)
+{
+  mpn_mul_n (tmp, s1p, s2p, nn);
+  ecm_redc_n (rp, tmp, 2 * nn, np, invm, nn);
+}
+
+static void
+sqr_redc_n (mp_ptr rp, mp_srcptr s1p, mp_srcptr np, mp_size_t nn,
+            mp_ptr invm, mp_ptr tmp)
+{
+  mpn_sqr (tmp, s1p, nn);
+  ecm_redc_n (rp, tmp, 2 * nn, np, invm, nn);
+}
+
+/* Sets modulus->mulredc_n and modulus->sqrredc_n for a modulus of nn limbs,
+   from the tuning tables. A mode that is not available falls back to the
+   next one. If the cpu has BMI2 and ADX, the MULX/ADX kernels are faster
+   than all the modes of the tables (which were tuned without them), and
+   are used up to MULREDC_ADX_MAX limbs. */
+static void
+mpmod_set_redc (mpmod_t modulus, mp_size_t nn)
+{
+#ifdef HAVE_MULREDC_ADX
+  if (nn <= MULREDC_ADX_MAX && mulredc_adx_available ())
     {
-      switch (tune_mulredc_table[nn])
-        {
-        case MPMOD_MULREDC: /* use quadratic assembly mulredc */
+      modulus->mulredc_n = mulredc_adx;
+      modulus->sqrredc_n = sqrredc_adx;
+      return;
+    }
+#endif
+
+  if (nn > MULREDC_ASSEMBLY_MAX)
+    {
+      modulus->mulredc_n = mul_redc_n;
+      modulus->sqrredc_n = sqr_redc_n;
+      return;
+    }
+
+  switch (tune_mulredc_table[nn])
+    {
+    case MPMOD_MULREDC: /* use quadratic assembly mulredc */
 #ifdef USE_ASM_REDC
-          mulredc (rp, s1p, s2p, np, nn, invm[0]);
-          break;
+      modulus->mulredc_n = mulredc_asm;
+      break;
 #endif /* otherwise go through to the next available mode */
-        case MPMOD_MUL_REDC1: /* mpn_mul_n + __gmpn_redc_1 */
+    case MPMOD_MUL_REDC1: /* mpn_mul_n + __gmpn_redc_1 */
 #ifdef HAVE___GMPN_REDC_1
-          mpn_mul_n (tmp, s1p, s2p, nn);
-          REDC1(rp, tmp, np, nn, invm[0]);
-          break;
+      modulus->mulredc_n = mul_redc1;
+      break;
 #endif /* otherwise go through to the next available mode */
-        case MPMOD_MUL_REDC2: /* mpn_mul_n + __gmpn_redc_2 */
+    case MPMOD_MUL_REDC2: /* mpn_mul_n + __gmpn_redc_2 */
 #ifdef HAVE___GMPN_REDC_2
-          mpn_mul_n (tmp, s1p, s2p, nn);
-          REDC2(rp, tmp, np, nn, invm);
-          break;
-#endif /* otherwise go through to the next available mode */
-        case MPMOD_MUL_REDCN: /* mpn_mul_n + __gmpn_redc_n */
-        /* disable redc_n for now, since it uses the opposite
-           precomputed inverse wrt redc_1 and redc_2 */
-#ifdef HAVE___GMPN_REDC_Nxxx
-          mpn_mul_n (tmp, s1p, s2p, nn);
-          __gmpn_redc_n (rp, tmp, np, nn, invm);
-          break;
+      modulus->mulredc_n = mul_redc2;
+      break;
 #endif /* otherwise go through to the next available mode */
-        case MPMOD_MUL_REDC_C: /* plain C quadratic reduction */
-          mpn_mul_n (tmp, s1p, s2p, nn);
-          for (j = 0; j < nn; j++, tmp++)
-            tmp[0] = mpn_addmul_1 (tmp, np, nn, tmp[0] * invm[0]);
-          cy = mpn_add_n (rp, tmp - nn, tmp, nn);
-          if (cy != 0)
-            mpn_sub_n (rp, rp, np, nn); /* a borrow should always occur here */
-          break;
-        default:
-          {
-            outputf (OUTPUT_ERROR, "Invalid mulredc mode: %d\n",
-                     tune_mulredc_table[nn]);
-            exit (EXIT_FAILURE);
-          }
-        }
-    }
-  else /* nn > MULREDC_ASSEMBLY_MAX */
-    {
-      mpn_mul_n (tmp, s1p, s2p, nn);
-      ecm_redc_n (rp, tmp, 2 * nn, np, invm, nn);
+    case MPMOD_MUL_REDCN: /* mpn_mul_n + __gmpn_redc_n */
+      /* disabled for now, since __gmpn_redc_n uses the opposite
+         precomputed inverse wrt redc_1 and redc_2 */
+    case MPMOD_MUL_REDC_C: /* plain C quadratic reduction */
+      modulus->mulredc_n = mul_redc_c;
+      break;
+    default:
+      {
+        outputf (OUTPUT_ERROR, "Invalid mulredc mode: %d\n",
+                 tune_mulredc_table[nn]);
+        exit (EXIT_FAILURE);
+      }
     }
-}
 
-static void 
-ecm_sqrredc_basecase_n (mp_ptr rp, mp_srcptr s1p,
-                        mp_srcptr np, mp_size_t nn, mp_ptr invm, mp_ptr tmp)
-{
-  mp_limb_t cy;
-  mp_size_t j;
-
-  if (nn <= MULREDC_ASSEMBLY_MAX)
+  switch (tune_sqrredc_table[nn])
     {
-      switch (tune_sqrredc_table[nn])
-        {
-        case MPMOD_MULREDC: /* use quadratic assembly mulredc */
+    case MPMOD_MULREDC: /* use quadratic assembly mulredc */
 #ifdef USE_ASM_REDC
-          mulredc (rp, s1p, s1p, np, nn, invm[0]);
-          break;
+      modulus->sqrredc_n = sqrredc_asm;
+      break;
 #endif /* otherwise go through to the next available mode */
-        case MPMOD_MUL_REDC1: /* mpn_sqr + __gmpn_redc_1 */
+    case MPMOD_MUL_REDC1: /* mpn_sqr + __gmpn_redc_1 */
 #ifdef HAVE___GMPN_REDC_1
-          mpn_sqr (tmp, s1p, nn);
-          REDC1(rp, tmp, np, nn, invm[0]);
-          break;
+      modulus->sqrredc_n = sqr_redc1;
+      break;
 #endif /* otherwise go through to the next available mode */
-        case MPMOD_MUL_REDC2: /* mpn_sqr + __gmpn_redc_2 */
+    case MPMOD_MUL_REDC2: /* mpn_sqr + __gmpn_redc_2 */
 #ifdef HAVE___GMPN_REDC_2
-          mpn_sqr (tmp, s1p, nn);
-          REDC2(rp, tmp, np, nn, invm);
-          break;
-#endif /* otherwise go through to the next available mode */
-        case MPMOD_MUL_REDCN: /* mpn_sqr + __gmpn_redc_n */
-        /* disable redc_n for now, since it uses the opposite
-           precomputed inverse wrt redc_1 and redc_2 */
-#ifdef HAVE___GMPN_REDC_Nxxx
-          mpn_sqr (tmp, s1p, nn);
-          __gmpn_redc_n (rp, tmp, np, nn, invm);
-          break;
+      modulus->sqrredc_n = sqr_redc2;
+      break;
 #endif /* otherwise go through to the next available mode */
-        case MPMOD_MUL_REDC_C: /* plain C quadratic reduction */
-          mpn_sqr (tmp, s1p, nn);
-          for (j = 0; j < nn; j++, tmp++)
-            tmp[0] = mpn_addmul_1 (tmp, np, nn, tmp[0] * invm[0]);
-          cy = mpn_add_n (rp, tmp - nn, tmp, nn);
-          if (cy != 0)
-            mpn_sub_n (rp, rp, np, nn); /* a borrow should always occur here */
-          break;
-        default:
-          {
-            outputf (OUTPUT_ERROR, "Invalid sqrredc mode: %d\n",
-                     tune_sqrredc_table[nn]);
-            exit (EXIT_FAILURE);
-          }
-        }
-    }
-  else /* nn > MULREDC_ASSEMBLY_MAX */
-    {
-      mpn_sqr (tmp, s1p, nn);
-      ecm_redc_n (rp, tmp, 2 * nn, np, invm, nn);
+    case MPMOD_MUL_REDCN: /* mpn_sqr + __gmpn_redc_n, disabled as above */
+    case MPMOD_MUL_REDC_C: /* plain C quadratic reduction */
+      modulus->sqrredc_n = sqr_redc_c;
+      break;
+    default:
+      {
+        outputf (OUTPUT_ERROR, "Invalid sqrredc mode: %d\n",
+                 tune_sqrredc_table[nn]);
+        exit (EXIT_FAILURE);
+      }
     }
 }
 
@@ -708,8 +1174,8 @@ ecm_mulredc_basecase (mpres_t R, const mpres_t S1, const mpres_t S2,
   for (j = ABSIZ(S2); j < nn; j++) 
     s2p[j] = 0;
 
-  ecm_mulredc_basecase_n (rp, s1p, s2p, PTR(modulus->orig_modulus), nn,
-                          modulus->Nprim, PTR(modulus->temp1));
+  modulus->mulredc_n (rp, s1p, s2p, PTR(modulus->orig_modulus), nn,
+                      modulus->Nprim, PTR(modulus->temp1));
 
   MPN_NORMALIZE (rp, nn);
   SIZ(R) = (SIZ(S1)*SIZ(S2)) < 0 ? (int) -nn : (int) nn;
@@ -734,23 +1200,31 @@ ecm_sqrredc_basecase (mpres_t R, const mpres_t S1, mpmod_t modulus)
   for (j = ABSIZ(S1); j < nn; j++)
     s1p[j] = 0;
 
-  ecm_sqrredc_basecase_n (rp, s1p, PTR(modulus->orig_modulus), nn,
-                          modulus->Nprim, PTR(modulus->temp1));
+  modulus->sqrredc_n (rp, s1p, PTR(modulus->orig_modulus), nn,
+                      modulus->Nprim, PTR(modulus->temp1));
 
   MPN_NORMALIZE (rp, nn);
   SIZ(R) = (int) nn;
 }
 
 /* If the user asked for a particular representation, always use it.
-   If repr = ECM_MOD_DEFAULT, use the thresholds.
-   Don't use base2 if repr = ECM_MOD_NOBASE2.
+   If repr = ECM_MOD_DEFAULT, use the thresholds: a factor of 2^n+/-1 uses
+   base2, and from KBNC_THRESHOLD limbs on, a factor of k*2^n+c with small
+   k and c uses KBNC. From DWT_THRESHOLD limbs on, a factor of 2^n+/-1
+   uses DWT instead of base2, except when base2 multiplies modulo
+   B^(n/GMP_NUMB_BITS)+/-1 with GMP's FFT (see base2_fft_n), and a factor
+   of k*2^n+c uses DWT instead of KBNC if the transform is weighted, but
+   not if it is zero-padded, since that is not faster than mpz_mul.
+   Don't use base2, KBNC nor DWT if repr = ECM_MOD_NOBASE2.
    If a value is <= -16 or >= 16, it is a base2 exponent.
    Return a non-zero value if an error occurred.
 */
 int
 mpmod_init (mpmod_t modulus, const mpz_t N, int repr)
 {
-  int base2 = 0, r = 0;
+  int base2 = 0, kbnc_n = 0, r = 0;
+  unsigned long kbnc_k = 0;
+  long kbnc_c = 0;
   mp_size_t n = mpz_size (N);
 
   switch (repr)
@@ -759,8 +1233,21 @@ mpmod_init (mpmod_t modulus, const mpz_t N, int repr)
       if ((base2 = isbase2 (N, BASE2_THRESHOLD)))
 	{
 	  repr = ECM_MOD_BASE2;
+          /* the numbers for which base2 multiplies modulo B^n+/-1 with
+             GMP's FFT keep it, the Fermat numbers also for stage 2 */
+          if (mpz_size (N) >= DWT_THRESHOLD && base2_fft_n (base2) == 0)
+            repr = ECM_MOD_DWT;
 	  break;
 	}
+      if (mpz_size (N) >= KBNC_THRESHOLD &&
+          (kbnc_n = iskbnc (N, &kbnc_k, &kbnc_c, BASE2_THRESHOLD)))
+        {
+          repr = ECM_MOD_KBNC;
+          if (mpz_size (N) >= DWT_THRESHOLD &&
+              dwt_weighted (kbnc_k, kbnc_n, kbnc_c))
+            repr = ECM_MOD_DWT;
+          break;
+        }
       /* else go through */
 #if defined( __GNUC__ ) && __GNUC__ >= 7 && !defined(__ICC)
       __attribute__ ((fallthrough));
@@ -772,10 +1259,27 @@ mpmod_init (mpmod_t modulus, const mpz_t N, int repr)
         repr = ECM_MOD_MPZ;
       else
 	repr = ECM_MOD_REDC;
+      break;
+    case ECM_MOD_KBNC:
+      if ((kbnc_n = iskbnc (N, &kbnc_k, &kbnc_c, BASE2_THRESHOLD)) == 0)
+        {
+          outputf (OUTPUT_ERROR, "mpmod_init: n is not a factor of a "
+                   "number k*2^n+c with small k and c\n");
+          return ECM_ERROR;
+        }
+      break;
+    case ECM_MOD_DWT:
+      if ((base2 = isbase2 (N, BASE2_THRESHOLD)) == 0 &&
+          (kbnc_n = iskbnc (N, &kbnc_k, &kbnc_c, BASE2_THRESHOLD)) == 0)
+        {
+          outputf (OUTPUT_ERROR, "mpmod_init: n is not a factor of a "
+                   "number k*2^n+c with small k and c\n");
+          return ECM_ERROR;
+        }
     }
 
-  /* now repr is {ECM_MOD_BASE2, ECM_MOD_MODMULN, ECM_MOD_MPZ, ECM_MOD_REDC},
-     or |repr| >= 16. */
+  /* now repr is {ECM_MOD_BASE2, ECM_MOD_MODMULN, ECM_MOD_MPZ, ECM_MOD_REDC,
+     ECM_MOD_KBNC, ECM_MOD_DWT}, or |repr| >= 16. */
 
   switch (repr)
     {
@@ -784,6 +1288,11 @@ mpmod_init (mpmod_t modulus, const mpz_t N, int repr)
       mpmod_init_MPZ (modulus, N);
       break;
     case ECM_MOD_MODMULN:
+#ifdef HAVE_MULREDC_ADX
+      if (n <= MULREDC_ADX_MAX && mulredc_adx_available ())
+        outputf (OUTPUT_VERBOSE, "Using MODMULN [mulredc:adx, sqrredc:adx]\n");
+      else
+#endif
       outputf (OUTPUT_VERBOSE, "Using MODMULN [mulredc:%d, sqrredc:%d]\n",
                (n <= MULREDC_ASSEMBLY_MAX) ? tune_mulredc_table[n] : 4,
                (n <= MULREDC_ASSEMBLY_MAX) ? tune_sqrredc_table[n] : 4);
@@ -793,6 +1302,15 @@ mpmod_init (mpmod_t modulus, const mpz_t N, int repr)
       outputf (OUTPUT_VERBOSE, "Using REDC\n");
       mpmod_init_REDC (modulus, N);
       break;
+    case ECM_MOD_KBNC:
+      r = mpmod_init_KBNC (modulus, kbnc_k, kbnc_n, kbnc_c, N);
+      break;
+    case ECM_MOD_DWT:
+      if (base2 != 0)
+        r = mpmod_init_DWT (modulus, 1, abs (base2), (base2 < 0) ? -1 : 1, N);
+      else
+        r = mpmod_init_DWT (modulus, kbnc_k, kbnc_n, kbnc_c, N);
+      break;
     default: /* base2 case: either repr=ECM_MOD_BASE2, and base2 was
 		determined above, or |repr| >= 16, and we want base2 = repr */
       if (repr != ECM_MOD_BASE2)
@@ -879,10 +1397,97 @@ mpmod_init_BASE2 (mpmod_t modulus, const int base2, const mpz_t N)
           modulus->Fermat = base2;
         }
     }
+
+  modulus->fft_n = base2_fft_n (base2);
+  if (modulus->fft_n > 0)
+    outputf (OUTPUT_DEVVERBOSE, "Using mpn_mul_fft modulo 2^%d+1\n",
+             abs (base2));
+  else if (modulus->fft_n < 0)
+    {
+      outputf (OUTPUT_DEVVERBOSE, "Using mpn_mulmod_bnm1 modulo 2^%d-1\n",
+               abs (base2));
+      /* the result and scratch space of base2mod_fft_mul */
+      mpz_init2 (modulus->aux_modulus,
+                 (3 * -modulus->fft_n + 4) * GMP_NUMB_BITS);
+    }
   
   return 0;
 }
 
+int
+mpmod_init_KBNC (mpmod_t modulus, const unsigned long k, const int n,
+                 const long c, const mpz_t N)
+{
+  int Nbits;
+  unsigned long i;
+
+  outputf (OUTPUT_VERBOSE,
+           "Using special division for factor of %lu*2^%d%+ld\n", k, n, c);
+  mpz_init_set (modulus->orig_modulus, N);
+  modulus->repr = ECM_MOD_KBNC;
+  modulus->bits = n;
+  modulus->Fermat = 0;
+  modulus->kbnc_k = k;
+  modulus->kbnc_c = c;
+  for (i = k, modulus->kbnc_kbits = 0; i != 0; i >>= 1)
+    modulus->kbnc_kbits ++;
+
+  Nbits = n + modulus->kbnc_kbits; /* residues have at most Nbits bits */
+
+  mpz_init2 (modulus->temp1, 2UL * Nbits + GMP_NUMB_BITS);
+  mpz_init2 (modulus->temp2, Nbits);
+  mpz_init2 (modulus->aux_modulus, Nbits);
+
+  mpz_set_ui (modulus->temp1, k);
+  mpz_mul_2exp (modulus->temp1, modulus->temp1, n);
+  if (c < 0)
+    mpz_sub_ui (modulus->temp1, modulus->temp1, (unsigned long) -c);
+  else
+    mpz_add_ui (modulus->temp1, modulus->temp1, (unsigned long) c);
+  if (k == 0 || n <= 0 || !mpz_divisible_p (modulus->temp1, N))
+    {
+       outputf (OUTPUT_ERROR, "mpmod_init_KBNC: n does not divide "
+                "%lu*2^%d%+ld\n", k, n, c);
+       mpz_clear (modulus->aux_modulus);
+       mpz_clear (modulus->temp2);
+       mpz_clear (modulus->temp1);
+       mpz_clear (modulus->orig_modulus);
+       return ECM_ERROR;
+    }
+
+  return 0;
+}
+
+/* As mpmod_init_KBNC, but the products are done with the floating-point
+   FFT of dwt.c. Here k = 1 and c = +/-1 are allowed. The copies made by
+   mpmod_init_set share the tables of the transform, so that they must be
+   cleared before modulus. */
+int
+mpmod_init_DWT (mpmod_t modulus, const unsigned long k, const int n,
+                const long c, const mpz_t N)
+{
+  dwt_t dwt;
+
+  dwt = (n > 0) ? dwt_init (k, n, c) : NULL;
+  if (dwt == NULL)
+    {
+      outputf (OUTPUT_ERROR, "mpmod_init_DWT: cannot use a floating-point "
+               "FFT for %lu*2^%d%+ld\n", k, n, c);
+      return ECM_ERROR;
+    }
+  if (mpmod_init_KBNC (modulus, k, n, c, N) != 0)
+    {
+      dwt_clear (dwt);
+      return ECM_ERROR;
+    }
+  outputf (OUTPUT_VERBOSE, "Using floating-point FFT of length %lu\n",
+           dwt_length (dwt));
+  modulus->repr = ECM_MOD_DWT;
+  modulus->dwt = dwt;
+
+  return 0;
+}
+
 /* initialize the following fields:
    orig_modulus - the original modulus
    bits         - # of bits of N, rounded up to a multiple of GMP_NUMB_BITS
@@ -937,6 +1542,8 @@ mpmod_init_MODMULN (mpmod_t modulus, const mpz_t N)
   /* ensure Nprim has all its n limbs correctly set, for ecm_redc_n */
   MPN_ZERO(modulus->Nprim, mpz_size (N));
   mpn_copyi (modulus->Nprim, PTR(modulus->temp2), ABSIZ(modulus->temp2));
+
+  mpmod_set_redc (modulus, mpz_size (N));
 }
 
 void 
@@ -1000,8 +1607,12 @@ mpmod_clear (mpmod_t modulus)
   mpz_clear (modulus->orig_modulus);
   mpz_clear (modulus->temp1);
   mpz_clear (modulus->temp2);
-  if (modulus->repr == ECM_MOD_REDC || modulus->repr == ECM_MOD_MPZ)
+  if (modulus->repr == ECM_MOD_REDC || modulus->repr == ECM_MOD_MPZ ||
+      modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT ||
+      (modulus->repr == ECM_MOD_BASE2 && modulus->fft_n < 0))
     mpz_clear (modulus->aux_modulus);
+  if (modulus->repr == ECM_MOD_DWT)
+    dwt_clear (modulus->dwt);
   if (modulus->repr == ECM_MOD_MODMULN || modulus->repr == ECM_MOD_REDC)
     {
       mpz_clear (modulus->R2);
@@ -1024,7 +1635,24 @@ mpmod_init_set (mpmod_t r, const mpmod_t modulus)
   r->repr = modulus->repr;
   r->bits = modulus->bits;
   r->Fermat = modulus->Fermat;
+  r->fft_n = modulus->fft_n;
   mpz_init_set (r->orig_modulus, modulus->orig_modulus);
+  if (modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT)
+    {
+      r->kbnc_k = modulus->kbnc_k;
+      r->kbnc_c = modulus->kbnc_c;
+      r->kbnc_kbits = modulus->kbnc_kbits;
+      /* only used as a temporary variable by kbncmod */
+      mpz_init2 (r->aux_modulus, Nbits + r->kbnc_kbits);
+    }
+  if (modulus->repr == ECM_MOD_BASE2 && modulus->fft_n < 0)
+    mpz_init2 (r->aux_modulus, (3 * -modulus->fft_n + 4) * GMP_NUMB_BITS);
+  if (modulus->repr == ECM_MOD_DWT)
+    {
+      /* each thread needs its own signals, the tables are shared */
+      r->dwt = dwt_init_set (modulus->dwt);
+      ASSERT_ALWAYS (r->dwt != NULL);
+    }
   mpz_init2 (r->temp1, 2 * Nbits + GMP_NUMB_BITS);
   mpz_init2 (r->temp2, Nbits + GMP_NUMB_BITS);
   if (modulus->repr == ECM_MOD_MODMULN || modulus->repr == ECM_MOD_REDC)
@@ -1049,6 +1677,8 @@ mpmod_init_set (mpmod_t r, const mpmod_t modulus)
     {
       r->Nprim = (mp_limb_t*) malloc (n * sizeof (mp_limb_t));
       mpn_copyi (r->Nprim, modulus->Nprim, n);
+      r->mulredc_n = modulus->mulredc_n;
+      r->sqrredc_n = modulus->sqrredc_n;
     }
 }
 
@@ -1071,7 +1701,8 @@ mpres_realloc (mpres_t R, const mpmod_t modulus)
 
 /* a <- b^2 mod (modulus).
    a and b might be equal, but cannot be modulus->temp1.
-   Assumes repr = ECM_MOD_BASE2 or ECM_MOD_MODMULN or ECM_MOD_REDC */
+   Assumes repr = ECM_MOD_BASE2, ECM_MOD_KBNC, ECM_MOD_DWT, ECM_MOD_MODMULN
+   or ECM_MOD_REDC */
 static inline void
 mpres_pow_sqr (mpres_t a, const mpres_t b, mpmod_t modulus)
 {
@@ -1081,6 +1712,13 @@ mpres_pow_sqr (mpres_t a, const mpres_t b, mpmod_t modulus)
       mpz_mul (modulus->temp1, b, b);
       base2mod (a, modulus->temp1, modulus->temp1, modulus);
     }
+  else if (modulus->repr == ECM_MOD_KBNC)
+    {
+      mpz_mul (modulus->temp1, b, b);
+      kbncmod (a, modulus->temp1, modulus->temp1, modulus);
+    }
+  else if (modulus->repr == ECM_MOD_DWT)
+    dwtmod_mul (a, b, b, modulus);
   else if (modulus->repr == ECM_MOD_MODMULN)
     ecm_sqrredc_basecase (a, b, modulus);
   else
@@ -1093,7 +1731,8 @@ mpres_pow_sqr (mpres_t a, const mpres_t b, mpmod_t modulus)
 
 /* a <- b*c mod (modulus)
    a, b, c must not equal modulus->temp1.
-   Assumes repr = ECM_MOD_BASE2 or ECM_MOD_MODMULN or ECM_MOD_REDC */
+   Assumes repr = ECM_MOD_BASE2, ECM_MOD_KBNC, ECM_MOD_DWT, ECM_MOD_MODMULN
+   or ECM_MOD_REDC */
 static inline void
 mpres_pow_mul (mpres_t a, const mpres_t b, const mpres_t c, mpmod_t modulus)
 {
@@ -1103,6 +1742,13 @@ mpres_pow_mul (mpres_t a, const mpres_t b, const mpres_t c, mpmod_t modulus)
       mpz_mul (modulus->temp1, b, c);
       base2mod (a, modulus->temp1, modulus->temp1, modulus);
     }
+  else if (modulus->repr == ECM_MOD_KBNC)
+    {
+      mpz_mul (modulus->temp1, b, c);
+      kbncmod (a, modulus->temp1, modulus->temp1, modulus);
+    }
+  else if (modulus->repr == ECM_MOD_DWT)
+    dwtmod_mul (a, b, c, modulus);
   else if (modulus->repr == ECM_MOD_MODMULN)
     ecm_mulredc_basecase (a, b, c, modulus);
   else
@@ -1127,7 +1773,8 @@ mpres_pow (mpres_t R, const mpres_t BASE, const mpz_t EXP, mpmod_t modulus)
 
   if (modulus->repr == ECM_MOD_MPZ)
     mpz_powm (R, BASE, EXP, modulus->orig_modulus);
-  else if (modulus->repr == ECM_MOD_BASE2 || modulus->repr == ECM_MOD_MODMULN ||
+  else if (modulus->repr == ECM_MOD_BASE2 || modulus->repr == ECM_MOD_KBNC ||
+           modulus->repr == ECM_MOD_DWT || modulus->repr == ECM_MOD_MODMULN ||
            modulus->repr == ECM_MOD_REDC)
     {
       size_t expidx;
@@ -1260,7 +1907,8 @@ mpres_ui_pow (mpres_t R, const unsigned long BASE, const mpres_t EXP,
       mpz_set_ui (modulus->temp1, BASE);
       mpz_powm (R, modulus->temp1, EXP, modulus->orig_modulus);
     }
-  else if (modulus->repr == ECM_MOD_BASE2 || modulus->repr == ECM_MOD_MODMULN ||
+  else if (modulus->repr == ECM_MOD_BASE2 || modulus->repr == ECM_MOD_KBNC ||
+           modulus->repr == ECM_MOD_DWT || modulus->repr == ECM_MOD_MODMULN ||
            modulus->repr == ECM_MOD_REDC)
     {
       size_t expidx;
@@ -1405,48 +2053,9 @@ mpres_mul (mpres_t R, const mpres_t S1, const mpres_t S2, mpmod_t modulus)
   mpz_mod (test_result1, test_result1, modulus->orig_modulus);
 #endif
 
-  if (UNLIKELY(modulus->repr == ECM_MOD_BASE2 && modulus->Fermat >= 32768))
+  if (UNLIKELY(modulus->repr == ECM_MOD_BASE2 && modulus->fft_n != 0))
     {
-      mp_size_t n = modulus->Fermat / GMP_NUMB_BITS;
-      unsigned long k;
-      mp_srcptr s1p, s2p;
-      mp_size_t s1s, s2s;
-      
-      MPZ_REALLOC (R, n + 1);
-      s1p = PTR(S1);
-      s1s = SIZ(S1);
-      s2p = PTR(S2);
-      s2s = SIZ(S2);
-      
-      k = mpn_fft_best_k (n, S1 == S2);
-      ASSERT(mpn_fft_next_size (n, k) == n);
-
-      if (base2mod_2 (modulus->temp1, S1, n, modulus->orig_modulus))
-        {
-          s1p = PTR(modulus->temp1);
-          s1s = SIZ(modulus->temp1);
-        }
-      if (S1 == S2)
-        {
-          s2p = s1p;
-          s2s = s1s;
-        }
-      else if (base2mod_2 (modulus->temp2, S2, n, modulus->orig_modulus))
-        {
-          s2p = PTR(modulus->temp2);
-          s2s = SIZ(modulus->temp2);
-        }
-
-      /* mpn_mul_fft() computes the product modulo B^n + 1, where 
-         B = 2^(machine word size in bits). So the result can be = B^n, 
-         in that case R is set to zero and 1 is returned as carry-out.
-         In all other cases 0 is returned. Hence the complete result is 
-         R + cy * B^n, where cy is the value returned by mpn_mul_fft(). */
-      PTR(R)[n] = mpn_mul_fft (PTR(R), n, s1p, ABS(s1s), s2p, ABS(s2s), k);
-      n ++;
-      MPN_NORMALIZE(PTR(R), n);
-      SIZ(R) = ((s1s ^ s2s) >= 0) ? (int) n : (int) -n;
-
+      base2mod_fft_mul (R, S1, S2, modulus);
       return;
     }
 
@@ -1456,6 +2065,13 @@ mpres_mul (mpres_t R, const mpres_t S1, const mpres_t S2, mpmod_t modulus)
       mpz_mul (modulus->temp1, S1, S2);
       base2mod (R, modulus->temp1, modulus->temp1, modulus);
       break;
+    case ECM_MOD_KBNC:
+      mpz_mul (modulus->temp1, S1, S2);
+      kbncmod (R, modulus->temp1, modulus->temp1, modulus);
+      break;
+    case ECM_MOD_DWT:
+      dwtmod_mul (R, S1, S2, modulus);
+      break;
     case ECM_MOD_MODMULN:
       MPZ_REALLOC (R, modulus->bits / GMP_NUMB_BITS);
       ecm_mulredc_basecase (R, S1, S2, modulus);
@@ -1507,9 +2123,9 @@ mpres_sqr (mpres_t R, const mpres_t S1, mpmod_t modulus)
   mpz_mod (test_result1, test_result1, modulus->orig_modulus);
 #endif
 
-  if (UNLIKELY(modulus->repr == ECM_MOD_BASE2 && modulus->Fermat >= 32768))
+  if (UNLIKELY(modulus->repr == ECM_MOD_BASE2 && modulus->fft_n != 0))
     {
-      mpres_mul (R, S1, S1, modulus);
+      base2mod_fft_mul (R, S1, S1, modulus);
       return;
     }
 
@@ -1519,6 +2135,13 @@ mpres_sqr (mpres_t R, const mpres_t S1, mpmod_t modulus)
       mpz_mul (modulus->temp1, S1, S1);
       base2mod (R, modulus->temp1, modulus->temp1, modulus);
       break;
+    case ECM_MOD_KBNC:
+      mpz_mul (modulus->temp1, S1, S1);
+      kbncmod (R, modulus->temp1, modulus->temp1, modulus);
+      break;
+    case ECM_MOD_DWT:
+      dwtmod_mul (R, S1, S1, modulus);
+      break;
     case ECM_MOD_MODMULN:
       MPZ_REALLOC (R, modulus->bits / GMP_NUMB_BITS);
       ecm_sqrredc_basecase (R, S1, modulus);
@@ -1585,44 +2208,10 @@ mpres_mul_z_to_z (mpz_t R, const mpres_t S1, const mpz_t S2, mpmod_t modulus)
 {
   ASSERT_NORMALIZED (S1);
 
-  if (modulus->repr == ECM_MOD_BASE2 && modulus->Fermat >= 32768)
+  if (modulus->repr == ECM_MOD_BASE2 && modulus->fft_n != 0)
     {
-      mp_size_t n = modulus->Fermat / GMP_NUMB_BITS;
-      unsigned long k;
-      mp_srcptr s1p = PTR(S1), s2p = PTR(S2);
-      mp_size_t s1s = SIZ(S1), s2s = SIZ(S2);
-
-      MPZ_REALLOC (R, n + 1);
-      k = mpn_fft_best_k (n, S1 == S2);
-      ASSERT(mpn_fft_next_size (n, k) == n);
-
-      if (base2mod_2 (modulus->temp1, S1, n, modulus->orig_modulus))
-        {
-          s1p = PTR(modulus->temp1);
-          s1s = SIZ(modulus->temp1);
-        }
-      if (S1 == S2)
-        {
-          s2p = s1p;
-          s2s = s1s;
-        }
-      else if (base2mod_2 (modulus->temp2, S2, n, modulus->orig_modulus))
-        {
-          s2p = PTR(modulus->temp2);
-          s2s = SIZ(modulus->temp2);
-        }
-
-      /* mpn_mul_fft() computes the product modulo B^n + 1, where 
-         B = 2^(machine word size in bits). So the result can be = B^n, 
-         in that case R is set to zero and 1 is returned as carry-out.
-         In all other cases 0 is returned. Hence the complete result is 
-         R + cy * B^n, where cy is the value returned by mpn_mul_fft(). */
-      PTR(R)[n] = mpn_mul_fft (PTR(R), n, s1p, ABS(s1s), s2p, ABS(s2s), k);
-      n ++;
-      MPN_NORMALIZE(PTR(R), n);
-      SIZ(R) = ((s1s ^ s2s) >= 0) ? (int) n : (int) -n;
+      base2mod_fft_mul (R, S1, S2, modulus);
       mpz_mod (R, R, modulus->orig_modulus);
-
       return;
     }
 
@@ -1639,6 +2228,18 @@ mpres_mul_z_to_z (mpz_t R, const mpres_t S1, const mpz_t S2, mpmod_t modulus)
       base2mod (R, modulus->temp1, modulus->temp1, modulus);
       mpz_mod (R, R, modulus->orig_modulus);
       break;
+    case ECM_MOD_KBNC:
+    case ECM_MOD_DWT: /* S2 may be larger than the transform length */
+      if (mpz_sizeinbase (S2, 2) > modulus->bits + modulus->kbnc_kbits)
+	{
+	  kbncmod (modulus->temp2, S2, modulus->temp1, modulus);
+	  mpz_mul (modulus->temp1, S1, modulus->temp2);
+	}
+      else
+	mpz_mul (modulus->temp1, S1, S2);
+      kbncmod (R, modulus->temp1, modulus->temp1, modulus);
+      mpz_mod (R, R, modulus->orig_modulus);
+      break;
     case ECM_MOD_MODMULN:
       if (mpz_cmp (S2, modulus->orig_modulus) >= 0)
 	{
@@ -1775,7 +2376,8 @@ mpres_add_ui (mpres_t R, const mpres_t S, const unsigned long n,
               mpmod_t modulus)
 {
   ASSERT_NORMALIZED (S);
-  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2)
+  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2 ||
+      modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT)
     {
       mpz_add_ui (R, S, n);
       if (mpz_cmp (R, modulus->orig_modulus) > 0)
@@ -1819,7 +2421,8 @@ mpres_sub_ui (mpres_t R, const mpres_t S, const unsigned long n,
               mpmod_t modulus)
 {
   ASSERT_NORMALIZED (S);
-  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2)
+  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2 ||
+      modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT)
     {
       mpz_sub_ui (R, S, n);
       if (mpz_sgn (R) < 0)
@@ -1845,7 +2448,8 @@ mpres_ui_sub (mpres_t R, const unsigned long n ,const mpres_t S,
               mpmod_t modulus)
 {
   ASSERT_NORMALIZED (S);
-  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2)
+  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2 ||
+      modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT)
     {
       mpz_ui_sub (R, n, S);
       if (mpz_sgn (R) < 0)
@@ -1884,7 +2488,8 @@ mpres_sub (mpres_t R, const mpres_t S1, const mpres_t S2, mpmod_t modulus)
 void 
 mpres_set_z (mpres_t R, const mpz_t S, mpmod_t modulus)
 {
-  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2)
+  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2 ||
+      modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT)
     mpz_mod (R, S, modulus->orig_modulus);
   else if (modulus->repr == ECM_MOD_MODMULN)
     {
@@ -1905,7 +2510,8 @@ void
 mpres_get_z (mpz_t R, const mpres_t S, mpmod_t modulus)
 {
   ASSERT_NORMALIZED (S);
-  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2)
+  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2 ||
+      modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT)
     {
       mpz_mod (R, S, modulus->orig_modulus);
     }
@@ -1938,7 +2544,8 @@ mpres_get_z (mpz_t R, const mpres_t S, mpmod_t modulus)
 void 
 mpres_set_ui (mpres_t R, const unsigned long n, mpmod_t modulus)
 {
-  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2)
+  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2 ||
+      modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT)
     {
       mpz_set_ui (R, n);
       mpz_mod (R, R, modulus->orig_modulus);
@@ -1956,7 +2563,8 @@ mpres_set_ui (mpres_t R, const unsigned long n, mpmod_t modulus)
 void 
 mpres_set_si (mpres_t R, const long n, mpmod_t modulus)
 {
-  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2)
+  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2 ||
+      modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT)
     {
       mpz_set_si (R, n);
       mpz_mod (R, R, modulus->orig_modulus);
@@ -1996,7 +2604,8 @@ mpres_invert (mpres_t R, const mpres_t S, mpmod_t modulus)
   if (mpz_invert (modulus->temp2, S, modulus->orig_modulus) == 0)
     return 0;
   
-  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2)
+  if (modulus->repr == ECM_MOD_MPZ || modulus->repr == ECM_MOD_BASE2 ||
+      modulus->repr == ECM_MOD_KBNC || modulus->repr == ECM_MOD_DWT)
     {
       mpz_set (R, modulus->temp2);
       ASSERT_NORMALIZED (R);
@@ -2263,8 +2872,8 @@ mpresn_sqr (mpres_t R, const mpres_t S1, mpmod_t modulus)
 
   ASSERT (SIZ(S1) == n || -SIZ(S1) == n);
 
-  ecm_sqrredc_basecase_n (PTR(R), PTR(S1), PTR(modulus->orig_modulus),
-                          n, modulus->Nprim, PTR(modulus->temp1));
+  modulus->sqrredc_n (PTR(R), PTR(S1), PTR(modulus->orig_modulus),
+                      n, modulus->Nprim, PTR(modulus->temp1));
 
   SIZ(R) = n;
 }
@@ -2278,8 +2887,8 @@ mpresn_mul (mpres_t R, const mpres_t S1, const mpres_t S2, mpmod_t modulus)
   ASSERT (SIZ(S1) == n || -SIZ(S1) == n);
   ASSERT (SIZ(S2) == n || -SIZ(S2) == n);
 
-  ecm_mulredc_basecase_n (PTR(R), PTR(S1), PTR(S2), PTR(modulus->orig_modulus),
-                          n, modulus->Nprim, PTR(modulus->temp1));
+  modulus->mulredc_n (PTR(R), PTR(S1), PTR(S2), PTR(modulus->orig_modulus),
+                      n, modulus->Nprim, PTR(modulus->temp1));
 
   SIZ(R) = SIZ(S1) == SIZ(S2) ? n : -n;
 }
@@ -2472,3 +3081,121 @@ mpresn_addsub (mpres_t R, mpres_t T,
       SIZ(T) = SIZ(S1);
     }
 }
+
+/******************************************************************/
+/* mpresf: fixed-width residues for ECM_MOD_MODMULN, based on mpn */
+/******************************************************************/
+
+/* A fixed-width residue (mpresf_t) is an array of n limbs, where n is the
+   number of limbs of N, holding a value in [0, N) in the same Montgomery
+   form as the mpres_t of ECM_MOD_MODMULN. There is no size or sign: the
+   caller allocates the limbs, usually one block for all the residues of a
+   loop, so that the functions below never reallocate, and the products go
+   directly to the functions chosen by mpmod_init. */
+
+/* r <- S, where S is a residue of the MODMULN modulus */
+void
+mpresf_set_mpres (mpresf_t r, const mpres_t S, mpmod_t modulus)
+{
+  mp_size_t n = ABSIZ(modulus->orig_modulus), sn;
+
+  mpz_mod (modulus->temp2, S, modulus->orig_modulus);
+  sn = ABSIZ(modulus->temp2);
+  mpn_copyi (r, PTR(modulus->temp2), sn);
+  MPN_ZERO (r + sn, n - sn);
+}
+
+/* R <- s */
+void
+mpres_set_mpresf (mpres_t R, const mpresf_t s, mpmod_t modulus)
+{
+  mp_size_t n = ABSIZ(modulus->orig_modulus);
+
+  if (ALLOC(R) < n)
+    _mpz_realloc (R, n);
+  mpn_copyi (PTR(R), s, n);
+  MPN_NORMALIZE (PTR(R), n);
+  SIZ(R) = (int) n;
+}
+
+/* r <- s1 * s2 mod N, r may be s1 or s2 */
+void
+mpresf_mul (mpresf_t r, const mpresf_t s1, const mpresf_t s2,
+            mpmod_t modulus)
+{
+  mp_size_t n = ABSIZ(modulus->orig_modulus);
+  mp_srcptr np = PTR(modulus->orig_modulus);
+
+  modulus->mulredc_n (r, s1, s2, np, n, modulus->Nprim, PTR(modulus->temp1));
+  /* since s1, s2 < N, the result of REDC is less than 2N */
+  if (mpn_cmp (r, np, n) >= 0)
+    mpn_sub_n (r, r, np, n);
+}
+
+/* r <- s^2 mod N, r may be s */
+void
+mpresf_sqr (mpresf_t r, const mpresf_t s, mpmod_t modulus)
+{
+  mp_size_t n = ABSIZ(modulus->orig_modulus);
+  mp_srcptr np = PTR(modulus->orig_modulus);
+
+  modulus->sqrredc_n (r, s, np, n, modulus->Nprim, PTR(modulus->temp1));
+  if (mpn_cmp (r, np, n) >= 0)
+    mpn_sub_n (r, r, np, n);
+}
+
+/* r <- s1 + s2 mod N */
+void
+mpresf_add (mpresf_t r, const mpresf_t s1, const mpresf_t s2,
+            mpmod_t modulus)
+{
+  mp_size_t n = ABSIZ(modulus->orig_modulus);
+  mp_srcptr np = PTR(modulus->orig_modulus);
+
+  if (mpn_add_n (r, s1, s2, n) != 0 || mpn_cmp (r, np, n) >= 0)
+    mpn_sub_n (r, r, np, n);
+}
+
+/* r <- s1 - s2 mod N */
+void
+mpresf_sub (mpresf_t r, const mpresf_t s1, const mpresf_t s2,
+            mpmod_t modulus)
+{
+  mp_size_t n = ABSIZ(modulus->orig_modulus);
+
+  if (mpn_sub_n (r, s1, s2, n) != 0)
+    mpn_add_n (r, r, PTR(modulus->orig_modulus), n);
+}
+
+void
+mpresf_set (mpresf_t r, const mpresf_t s, mpmod_t modulus)
+{
+  if (r != s)
+    mpn_copyi (r, s, ABSIZ(modulus->orig_modulus));
+}
+
+/* exchanges the values of r and s */
+void
+mpresf_swap (mpresf_t r, mpresf_t s, mpmod_t modulus)
+{
+  mp_size_t i, n = ABSIZ(modulus->orig_modulus);
+  mp_limb_t t;
+
+  for (i = 0; i < n; i++)
+    {
+      t = r[i];
+      r[i] = s[i];
+      s[i] = t;
+    }
+}
+
+int
+mpresf_is_zero (const mpresf_t s, mpmod_t modulus)
+{
+  mp_size_t i, n = ABSIZ(modulus->orig_modulus);
+
+  for (i = 0; i < n; i++)
+    if (s[i] != 0)
+      return 0;
+  return 1;
+}
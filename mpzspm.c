@@ -21,6 +21,7 @@ MA 02110-1301, USA. */
 
 #include <stdio.h> /* for printf */
 #include <stdlib.h>
+#include <string.h> /* for memcpy */
 #include "sp.h"
 #include "ecm-impl.h"
 
@@ -77,6 +78,15 @@ static unsigned long sp_max_modulus_bits[32] =
 ;
 #endif
 
+/* The last mpzspm_t structure created. Since ECM and P-1 stage 2 need the
+   same one for each curve on a given number, mpzspm_clear keeps it, and
+   mpzspm_init returns it again for the same modulus and transform length.
+   It is freed when another one is created, or by mpzspm_clear_cache.
+   Each context has its own, see ecm_ctx_get. */
+#define mpzspm_cache (ECM_CTX->mpzspm_cache)
+
+static void mpzspm_free (mpzspm_t);
+
 #define CHECK(cond,msg,label)       \
   if (cond)                         \
     {                               \
@@ -117,6 +127,8 @@ mpzspm_max_len (mpz_t modulus)
    If n = 5, T[0]: 1, 1, 1, 1, 1
              T[1]: 2, 2, 1
              T[2]: 4, 1
+   The tree is used by mpzspm_init, by mpzspv_from_mpzv if d > I0_THRESHOLD,
+   and by mpzspv_to_mpzv if n >= MPZSPV_TO_MPZV_TREE_THRESHOLD.
 */
 static void
 mpzspm_product_tree_init (mpzspm_t mpzspm)
@@ -126,11 +138,6 @@ mpzspm_product_tree_init (mpzspm_t mpzspm)
   mpzv_t *T;
 
   for (i = n, d = 0; i > 1; i = (i + 1) / 2, d ++);
-  if (d <= I0_THRESHOLD)
-    {
-      mpzspm->T = NULL;
-      return;
-    }
   T = (mpzv_t*) malloc ((d + 1) * sizeof (mpzv_t));
   T[0] = (mpzv_t) malloc (n * sizeof (mpz_t));
   for (j = 0; j < n; j++)
@@ -156,6 +163,379 @@ mpzspm_product_tree_init (mpzspm_t mpzspm)
   mpzspm->d = d;
 }
 
+/* Set crt1[i] = (P / p_i) mod modulus and crt3[i] = (P / p_i)^{-1} mod p_i,
+   where P = p_0 * ... * p_{n-1}, going down the product tree T: for a node v,
+   we compute c_v = (P / T_v) mod modulus and r_v = (P / T_v) mod T_v, and
+   for its children a and b:
+   c_a = c_v * T_b mod modulus, r_a = (r_v mod T_a) * (T_b mod T_a) mod T_a.
+   This takes O(M(n) log(n)) instead of O(n^2) for the naive method. */
+static void
+mpzspm_crt_tree (mpzspm_t mpzspm)
+{
+  unsigned int i, j, n, m, *len;
+  unsigned int d = mpzspm->d;
+  mpzv_t *T = mpzspm->T;
+  mpz_t *C, *R, ca, ra, t;
+  mpz_t *modulus = &(mpzspm->modulus);
+  sp_t a, p;
+
+  len = (unsigned int *) malloc ((d + 1) * sizeof (unsigned int));
+  for (i = 0, n = mpzspm->sp_num; i <= d; i++, n = (n + 1) / 2)
+    len[i] = n;
+
+  C = (mpz_t *) malloc (len[0] * sizeof (mpz_t));
+  R = (mpz_t *) malloc (len[0] * sizeof (mpz_t));
+  for (j = 0; j < len[0]; j++)
+    {
+      mpz_init (C[j]);
+      mpz_init (R[j]);
+    }
+  mpz_init (ca);
+  mpz_init (ra);
+  mpz_init (t);
+
+  mpz_set_ui (C[0], 1);
+  mpz_set_ui (R[0], 1);
+  for (i = d; i-- > 0;)
+    {
+      /* goes down from depth i+1 to i. Node j of depth i+1 has children
+         2j and 2j+1, thus we go from right to left to avoid overwriting
+         entries not yet used. */
+      m = len[i + 1];
+      for (j = m; j-- > 0;)
+        {
+          if (2 * j + 1 < len[i])
+            {
+              mpz_mul (ca, C[j], T[i][2*j+1]);
+              mpz_mod (ca, ca, *modulus);
+              mpz_mod (t, T[i][2*j+1], T[i][2*j]);
+              mpz_mod (ra, R[j], T[i][2*j]);
+              mpz_mul (ra, ra, t);
+              mpz_mod (ra, ra, T[i][2*j]);
+
+              mpz_mul (C[2*j+1], C[j], T[i][2*j]);
+              mpz_mod (C[2*j+1], C[2*j+1], *modulus);
+              mpz_mod (t, T[i][2*j], T[i][2*j+1]);
+              mpz_mod (R[2*j+1], R[j], T[i][2*j+1]);
+              mpz_mul (R[2*j+1], R[2*j+1], t);
+              mpz_mod (R[2*j+1], R[2*j+1], T[i][2*j+1]);
+
+              mpz_swap (C[2*j], ca);
+              mpz_swap (R[2*j], ra);
+            }
+          else /* single child, with the same value */
+            {
+              mpz_swap (C[2*j], C[j]);
+              mpz_swap (R[2*j], R[j]);
+            }
+        }
+    }
+
+  for (j = 0; j < len[0]; j++)
+    {
+      p = mpzspm->spm[j]->sp;
+      mpz_init_set (mpzspm->crt1[j], C[j]);
+      a = mpz_get_sp (R[j]);
+      mpzspm->crt3[j] = sp_inv (a, p, mpzspm->spm[j]->mul_c);
+      mpz_clear (C[j]);
+      mpz_clear (R[j]);
+    }
+
+  mpz_clear (ca);
+  mpz_clear (ra);
+  mpz_clear (t);
+  free (C);
+  free (R);
+  free (len);
+}
+
+/* A mpzspm_t structure can be saved in a cache file (see cachefile.c), for
+   the next runs on the same modulus with the same transform length. The
+   data is a sequence of arrays: the modulus, sp_num, then for each prime
+   its constants and the tables of the forward and inverse transforms, then
+   crt3, crt4 and crt5, and the mpz_t's of crt1, crt2 and T. An mpz_t is
+   stored as its number of limbs followed by the limbs. The sp_t arrays
+   are aligned on 64 bytes, so that they are used in place when the file
+   is mapped. */
+
+/* Stores the n bytes at data at offset *pos of buf, aligned on align
+   bytes, and updates *pos. Only updates *pos if buf is NULL. */
+static void
+cache_put (char *buf, size_t *pos, const void *data, size_t n, size_t align)
+{
+  size_t off = (*pos + align - 1) & ~(align - 1);
+
+  if (buf != NULL)
+    memcpy (buf + off, data, n);
+  *pos = off + n;
+}
+
+static void
+cache_put_mpz (char *buf, size_t *pos, mpz_t z)
+{
+  uint64_t n = mpz_size (z);
+
+  cache_put (buf, pos, &n, sizeof (uint64_t), 8);
+  cache_put (buf, pos, PTR(z), n * sizeof (mp_limb_t), 8);
+}
+
+static void
+cache_put_nttdata (char *buf, size_t *pos, sp_nttdata_t data,
+                   spv_size_t log2_len)
+{
+  uint64_t n = data->twiddle_size;
+
+  cache_put (buf, pos, data->ntt_roots, (log2_len + 1) * sizeof (sp_t), 64);
+  cache_put (buf, pos, &n, sizeof (uint64_t), 8);
+  cache_put (buf, pos, data->twiddle, n * sizeof (sp_t), 64);
+  cache_put (buf, pos, data->twiddle_shoup, n * sizeof (sp_t), 64);
+}
+
+/* Returns a pointer to the n bytes at offset *pos of buf, aligned on align
+   bytes, and updates *pos, or NULL if they go beyond size */
+static const void *
+cache_get (const char *buf, size_t size, size_t *pos, size_t n, size_t align)
+{
+  size_t off = (*pos + align - 1) & ~(align - 1);
+
+  if (off > size || n > size - off)
+    return NULL;
+  *pos = off + n;
+  return buf + off;
+}
+
+/* Initializes z to the mpz_t at *pos of buf, or only checks that there is
+   one if z is NULL. Returns 0 on success, 1 on error. */
+static int
+cache_get_mpz (mpz_ptr z, const char *buf, size_t size, size_t *pos)
+{
+  const uint64_t *n;
+  const mp_limb_t *d;
+
+  n = (const uint64_t *) cache_get (buf, size, pos, sizeof (uint64_t), 8);
+  if (n == NULL || *n > size)
+    return 1;
+  d = (const mp_limb_t *) cache_get (buf, size, pos,
+                                     *n * sizeof (mp_limb_t), 8);
+  if (d == NULL || (*n > 0 && d[*n - 1] == 0))
+    return 1;
+  if (z != NULL)
+    {
+      mpz_init2 (z, *n * GMP_NUMB_BITS);
+      memcpy (PTR(z), d, *n * sizeof (mp_limb_t));
+      SIZ(z) = *n;
+    }
+  return 0;
+}
+
+static int
+cache_get_nttdata (sp_nttdata_t data, const char *buf, size_t size,
+                   size_t *pos, spv_size_t log2_len)
+{
+  const uint64_t *n;
+
+  data->ntt_roots = (spv_t) cache_get (buf, size, pos,
+                                       (log2_len + 1) * sizeof (sp_t), 64);
+  n = (const uint64_t *) cache_get (buf, size, pos, sizeof (uint64_t), 8);
+  if (data->ntt_roots == NULL || n == NULL || *n > size)
+    return 1;
+  data->twiddle_size = *n;
+  data->twiddle = (spv_t) cache_get (buf, size, pos, *n * sizeof (sp_t), 64);
+  data->twiddle_shoup = (spv_t) cache_get (buf, size, pos,
+                                           *n * sizeof (sp_t), 64);
+  return data->twiddle == NULL || data->twiddle_shoup == NULL;
+}
+
+/* Stores mpzspm in buf, if not NULL, and returns the size of the data */
+static size_t
+mpzspm_cache_put (mpzspm_t mpzspm, char *buf)
+{
+  spv_size_t log2_len = ceil_log_2 (mpzspm->max_ntt_size);
+  unsigned int i, j, n = mpzspm->sp_num;
+  uint64_t sp_num = n;
+  size_t pos = 0;
+
+  cache_put_mpz (buf, &pos, mpzspm->modulus);
+  cache_put (buf, &pos, &sp_num, sizeof (uint64_t), 8);
+  for (i = 0; i < n; i++)
+    {
+      spm_t spm = mpzspm->spm[i];
+      sp_t c[6];
+
+      c[0] = spm->sp;
+      c[1] = spm->mul_c;
+      c[2] = spm->invm;
+      c[3] = spm->Bpow;
+      c[4] = spm->prim_root;
+      c[5] = spm->inv_prim_root;
+      cache_put (buf, &pos, c, sizeof (c), 8);
+      cache_put_nttdata (buf, &pos, spm->nttdata, log2_len);
+      cache_put_nttdata (buf, &pos, spm->inttdata, log2_len);
+    }
+  cache_put (buf, &pos, mpzspm->crt3, n * sizeof (sp_t), 64);
+  for (i = 0; i < n; i++)
+    cache_put (buf, &pos, mpzspm->crt4[i], n * sizeof (sp_t), 64);
+  cache_put (buf, &pos, mpzspm->crt5, n * sizeof (sp_t), 64);
+  for (i = 0; i < n; i++)
+    cache_put_mpz (buf, &pos, mpzspm->crt1[i]);
+  for (i = 0; i < n + 2; i++)
+    cache_put_mpz (buf, &pos, mpzspm->crt2[i]);
+  for (i = 0; i <= mpzspm->d; i++, n = (n + 1) / 2)
+    for (j = 0; j < n; j++)
+      cache_put_mpz (buf, &pos, mpzspm->T[i][j]);
+  return pos;
+}
+
+/* Returns the mpzspm_t structure stored in buf, of size bytes, for
+   transform length max_len and the given modulus, or NULL if buf does not
+   hold one. The sp_t arrays point into buf, the mpz_t's are copied. */
+static mpzspm_t
+mpzspm_cache_get (const char *buf, size_t size, spv_size_t max_len,
+                  mpz_t modulus)
+{
+  spv_size_t log2_len = ceil_log_2 (max_len);
+  const uint64_t *sp_num;
+  mpzspm_t mpzspm;
+  unsigned int i, j, n, d;
+  size_t pos = 0, pos_mpz;
+  mpz_t z;
+
+  if (cache_get_mpz (z, buf, size, &pos) != 0)
+    return NULL;
+  i = mpz_cmp (z, modulus);
+  mpz_clear (z);
+  if (i != 0)
+    return NULL;
+  sp_num = (const uint64_t *) cache_get (buf, size, &pos,
+                                         sizeof (uint64_t), 8);
+  if (sp_num == NULL || *sp_num == 0 || *sp_num > size)
+    return NULL;
+  n = *sp_num;
+  for (i = n, d = 0; i > 1; i = (i + 1) / 2, d ++);
+
+  mpzspm = (mpzspm_t) malloc (sizeof (__mpzspm_struct));
+  if (mpzspm == NULL)
+    return NULL;
+  mpzspm->sp_num = n;
+  mpzspm->max_ntt_size = max_len;
+  mpzspm->d = d;
+  mpzspm->spm = (spm_t *) calloc (n, sizeof (spm_t));
+  mpzspm->crt1 = (mpzv_t) malloc (n * sizeof (mpz_t));
+  mpzspm->crt2 = (mpzv_t) malloc ((n + 2) * sizeof (mpz_t));
+  mpzspm->crt4 = (spv_t *) malloc (n * sizeof (spv_t));
+  mpzspm->T = (mpzv_t *) calloc (d + 1, sizeof (mpzv_t));
+  CHECK(mpzspm->spm == NULL || mpzspm->crt1 == NULL || mpzspm->crt2 == NULL
+        || mpzspm->crt4 == NULL || mpzspm->T == NULL,
+        "Out of memory in mpzspm_init()\n", error);
+
+  for (i = 0; i < n; i++)
+    {
+      const sp_t *c;
+      spm_t spm;
+
+      spm = mpzspm->spm[i] = (spm_t) calloc (1, sizeof (__spm_struct));
+      if (spm == NULL)
+        goto error;
+      spm->scratch = (spv_t) sp_aligned_malloc (MAX_NTT_BLOCK_SIZE *
+                                                sizeof (sp_t));
+      c = (const sp_t *) cache_get (buf, size, &pos, 6 * sizeof (sp_t), 8);
+      if (spm->scratch == NULL || c == NULL
+          || cache_get_nttdata (spm->nttdata, buf, size, &pos, log2_len)
+          || cache_get_nttdata (spm->inttdata, buf, size, &pos, log2_len))
+        goto error;
+      spm->sp = c[0];
+      spm->mul_c = c[1];
+      spm->invm = c[2];
+      spm->Bpow = c[3];
+      spm->prim_root = c[4];
+      spm->inv_prim_root = c[5];
+      if (spv_ntt_gfp_fourstep_init (spm, log2_len))
+        goto error;
+    }
+  mpzspm->crt3 = (spv_t) cache_get (buf, size, &pos, n * sizeof (sp_t), 64);
+  for (i = 0; i < n; i++)
+    {
+      mpzspm->crt4[i] = (spv_t) cache_get (buf, size, &pos,
+                                           n * sizeof (sp_t), 64);
+      if (mpzspm->crt4[i] == NULL)
+        goto error;
+    }
+  mpzspm->crt5 = (spv_t) cache_get (buf, size, &pos, n * sizeof (sp_t), 64);
+  if (mpzspm->crt3 == NULL || mpzspm->crt5 == NULL)
+    goto error;
+
+  /* check the mpz_t's before reading them, so that no mpz_clear is needed
+     on error */
+  pos_mpz = pos;
+  for (i = 0; i < 2 * n + 2; i++)
+    if (cache_get_mpz (NULL, buf, size, &pos) != 0)
+      goto error;
+  for (i = 0; i <= d; i++, n = (n + 1) / 2)
+    {
+      mpzspm->T[i] = (mpzv_t) malloc (n * sizeof (mpz_t));
+      if (mpzspm->T[i] == NULL)
+        goto error;
+      for (j = 0; j < n; j++)
+        if (cache_get_mpz (NULL, buf, size, &pos) != 0)
+          goto error;
+    }
+  if (pos != size)
+    goto error;
+
+  pos = pos_mpz;
+  n = mpzspm->sp_num;
+  for (i = 0; i < n; i++)
+    cache_get_mpz (mpzspm->crt1[i], buf, size, &pos);
+  for (i = 0; i < n + 2; i++)
+    cache_get_mpz (mpzspm->crt2[i], buf, size, &pos);
+  for (i = 0; i <= d; i++, n = (n + 1) / 2)
+    for (j = 0; j < n; j++)
+      cache_get_mpz (mpzspm->T[i][j], buf, size, &pos);
+  mpz_init_set (mpzspm->modulus, modulus);
+
+  mpzspm->map = (void *) buf;
+  mpzspm->map_size = size;
+  return mpzspm;
+
+ error:
+  if (mpzspm->T != NULL)
+    for (i = 0; i <= d; i++)
+      free (mpzspm->T[i]);
+  if (mpzspm->spm != NULL)
+    for (i = 0; i < mpzspm->sp_num; i++)
+      if (mpzspm->spm[i] != NULL)
+        {
+          spv_ntt_gfp_fourstep_clear (mpzspm->spm[i]);
+          sp_aligned_free (mpzspm->spm[i]->scratch);
+          free (mpzspm->spm[i]);
+        }
+  free (mpzspm->T);
+  free (mpzspm->crt4);
+  free (mpzspm->crt2);
+  free (mpzspm->crt1);
+  free (mpzspm->spm);
+  free (mpzspm);
+  return NULL;
+}
+
+/* The name and key of the cache file for max_len and modulus, or NULL if
+   there is no cache directory */
+static char *
+mpzspm_cache_name (uint64_t *key, spv_size_t max_len, mpz_t modulus)
+{
+  memset (key, 0, CACHEFILE_KEYS * sizeof (uint64_t));
+  key[0] = max_len;
+  key[1] = cachefile_checksum (PTR(modulus),
+                               mpz_size (modulus) * sizeof (mp_limb_t));
+  key[2] = mpz_size (modulus) | (uint64_t) SP_NUMB_BITS << 32
+    | (uint64_t) sizeof (sp_t) << 48;
+  key[3] = NTT_GFP_TWIDDLE_DIF_BREAKOVER
+    | (uint64_t) NTT_GFP_TWIDDLE_DIT_BREAKOVER << 32;
+  return cachefile_name ("ntt-%08lx%08lx-%lu", (unsigned long) (key[1] >> 32),
+                         (unsigned long) (key[1] & 0xffffffffUL),
+                         (unsigned long) max_len);
+}
+
 /* This function initializes a mpzspm_t structure which contains the number
    of small primes, the small primes with associated primitive roots and 
    precomputed data for the CRT to allow convolution products of length up 
@@ -165,17 +545,55 @@ mpzspm_product_tree_init (mpzspm_t mpzspm)
 mpzspm_t
 mpzspm_init (spv_size_t max_len, mpz_t modulus)
 {
-  unsigned int ub, i, j;
+  unsigned int ub, i;
   mpz_t P, S, T, mp, mt; /* mp is p as mpz_t, mt is a temp mpz_t */
-  sp_t p, a;
+  sp_t p;
   mpzspm_t mpzspm;
+  int enough;
   long st;
+  uint64_t key[CACHEFILE_KEYS];
+  char *fn;
+  void *map;
+  size_t size;
+
+  if (mpzspm_cache != NULL && mpzspm_cache->max_ntt_size == max_len
+      && mpz_cmp (mpzspm_cache->modulus, modulus) == 0)
+    {
+      mpzspm_cache->refs ++;
+      return mpzspm_cache;
+    }
 
   st = cputime ();
 
+  /* read it from the cache directory if it is there */
+  fn = mpzspm_cache_name (key, max_len, modulus);
+  if (fn != NULL)
+    {
+      map = cachefile_map (fn, CACHEFILE_MPZSPM, key, &size);
+      mpzspm = NULL;
+      if (map != NULL)
+        {
+          mpzspm = mpzspm_cache_get ((const char *) map, size, max_len,
+                                     modulus);
+          if (mpzspm == NULL)
+            cachefile_unmap (map, size);
+        }
+      if (mpzspm != NULL)
+        {
+          outputf (OUTPUT_DEVVERBOSE, "mpzspm_init: reading %s took %lums\n",
+                   fn, cputime () - st);
+          free (fn);
+          goto done;
+        }
+    }
+
   mpzspm = (mpzspm_t) malloc (sizeof (__mpzspm_struct));
   if (mpzspm == NULL)
-    return NULL;
+    {
+      free (fn);
+      return NULL;
+    }
+  mpzspm->map = NULL;
   
   /* Upper bound for the number of primes we need.
    * Let minp, maxp denote the min, max permissible prime,
@@ -241,15 +659,23 @@ mpzspm_init (spv_size_t max_len, mpz_t modulus)
       mpz_add (S, S, mp);
 
       /* we want P > 4 * max_len * (modulus * S)^2. The S^2 term is due to 
-         theorem 3.1 in Bernstein and Sorenson's paper */
-      mpz_mul (T, S, modulus);
-      mpz_mul (T, T, T);
-      mpz_mul_ui (T, T, max_len);
-      mpz_mul_2exp (T, T, 2UL);
+         theorem 3.1 in Bernstein and Sorenson's paper.
+         Since the right-hand side is at least 2^(2*(s+m)-2) where S and
+         modulus have s and m bits, we compute it only when P is larger. */
+      enough = 0;
+      if (mpz_sizeinbase (P, 2) > 2 * (mpz_sizeinbase (S, 2)
+                                       + mpz_sizeinbase (modulus, 2)) - 2)
+        {
+          mpz_mul (T, S, modulus);
+          mpz_mul (T, T, T);
+          mpz_mul_ui (T, T, max_len);
+          mpz_mul_2exp (T, T, 2UL);
+          enough = mpz_cmp (P, T) > 0;
+        }
       
       p -= (sp_t) max_len;
     }
-  while (mpz_cmp (P, T) <= 0);
+  while (!enough);
 
   /* we add the test_verbose() call to avoid calls to cputime() even if
      nothing is printed */
@@ -278,46 +704,36 @@ mpzspm_init (spv_size_t max_len, mpz_t modulus)
       CHECK(mpzspm->crt4[i] == NULL, "Out of memory in mpzspm_init()\n",
             error_clear_crt);
     }
-  
+
+  /* the product tree is also used for the precomputations below */
+  mpzspm_product_tree_init (mpzspm);
+
+  /* crt1[i] = (P / p) mod modulus, crt3[i] = (P / p)^{-1} mod p */
+  mpzspm_crt_tree (mpzspm);
+
+  /* crt4[i][j] = ((P / p[j]) mod modulus) mod p[i], i.e., crt4 is the RNS
+     representation of the vector crt1 */
+  mpzspv_from_mpzv (mpzspm->crt4, 0, mpzspm->crt1, mpzspm->sp_num, mpzspm);
+
+  /* crt5[i] = (-P mod modulus) mod p */
+  mpz_mod (T, P, modulus);
+  mpz_sub (T, modulus, T);
   for (i = 0; i < mpzspm->sp_num; i++)
     {
-      p = mpzspm->spm[i]->sp;
-      mpz_set_sp (mp, p);
-      
-      /* crt3[i] = (P / p)^{-1} mod p */
-      mpz_fdiv_q (T, P, mp);
-      mpz_fdiv_r (mt, T, mp);
-      a = mpz_get_sp (mt);
-      mpzspm->crt3[i] = sp_inv (a, p, mpzspm->spm[i]->mul_c);
-     
-      /* crt1[i] = (P / p) mod modulus */
-      mpz_init (mpzspm->crt1[i]);
-      mpz_mod (mpzspm->crt1[i], T, modulus);
-
-      /* crt4[i][j] = ((P / p[i]) mod modulus) mod p[j] */
-      for (j = 0; j < mpzspm->sp_num; j++)
-        {
-          mpz_set_sp (mp, mpzspm->spm[j]->sp);
-          mpz_fdiv_r (mt, mpzspm->crt1[i], mp);
-          mpzspm->crt4[j][i] = mpz_get_sp (mt);
-        }
-      
-      /* crt5[i] = (-P mod modulus) mod p */
-      mpz_mod (T, P, modulus);
-      mpz_sub (T, modulus, T);
-      mpz_set_sp (mp, p);
+      mpz_set_sp (mp, mpzspm->spm[i]->sp);
       mpz_fdiv_r (mt, T, mp);
       mpzspm->crt5[i] = mpz_get_sp (mt);
     }
-  
-  mpz_set_ui (T, 0);
 
   /* set crt2[i] = -i*P mod modulus */
+  mpz_sub (T, modulus, T); /* P mod modulus */
+  mpz_set_ui (mt, 0);
   for (i = 0; i < mpzspm->sp_num + 2; i++)
     {
-      mpz_mod (T, T, modulus);
-      mpz_init_set (mpzspm->crt2[i], T);
-      mpz_sub (T, T, P);
+      mpz_init_set (mpzspm->crt2[i], mt);
+      mpz_sub (mt, mt, T);
+      if (mpz_sgn (mt) < 0)
+        mpz_add (mt, mt, modulus);
     }
   
   mpz_clear (mp);
@@ -326,11 +742,32 @@ mpzspm_init (spv_size_t max_len, mpz_t modulus)
   mpz_clear (S);
   mpz_clear (T);
 
-  mpzspm_product_tree_init (mpzspm);
-
   if (test_verbose (OUTPUT_DEVVERBOSE))
     outputf (OUTPUT_DEVVERBOSE, "mpzspm_init took %lums\n", cputime() - st);
 
+  if (fn != NULL)
+    {
+      char *buf;
+
+      size = mpzspm_cache_put (mpzspm, NULL);
+      buf = (char *) calloc (size, 1); /* the padding is zero */
+      if (buf != NULL)
+        mpzspm_cache_put (mpzspm, buf);
+      if (buf == NULL
+          || cachefile_write (fn, CACHEFILE_MPZSPM, key, buf, size) != 0)
+        outputf (OUTPUT_ERROR, "Could not write %s\n", fn);
+      free (buf);
+      free (fn);
+    }
+
+ done:
+  mpzspm->refs = 1;
+  if (mpzspm_cache == NULL || mpzspm_cache->refs == 0)
+    {
+      mpzspm_clear_cache ();
+      mpzspm_cache = mpzspm;
+    }
+
   return mpzspm;
   
   /* Error cases: free memory we allocated so far */
@@ -349,6 +786,7 @@ mpzspm_init (spv_size_t max_len, mpz_t modulus)
 
   error_clear_mpzspm:
   free (mpzspm);
+  free (fn);
 
   return NULL;
 }
@@ -362,9 +800,6 @@ mpzspm_product_tree_clear (mpzspm_t mpzspm)
   unsigned int d = mpzspm->d;
   mpzv_t *T = mpzspm->T;
 
-  if (T == NULL) /* use the slow method */
-    return;
-
   for (i = 0; i <= d; i++)
     {
       for (j = 0; j < n; j++)
@@ -375,7 +810,28 @@ mpzspm_product_tree_clear (mpzspm_t mpzspm)
   free (T);
 }
 
-void mpzspm_clear (mpzspm_t mpzspm)
+/* release mpzspm, which is freed unless it is the cached one */
+void
+mpzspm_clear (mpzspm_t mpzspm)
+{
+  ASSERT (mpzspm->refs > 0);
+  if (--mpzspm->refs == 0 && mpzspm != mpzspm_cache)
+    mpzspm_free (mpzspm);
+}
+
+/* free the cached mpzspm_t structure, if it is not used */
+void
+mpzspm_clear_cache (void)
+{
+  if (mpzspm_cache != NULL && mpzspm_cache->refs == 0)
+    {
+      mpzspm_free (mpzspm_cache);
+      mpzspm_cache = NULL;
+    }
+}
+
+static void
+mpzspm_free (mpzspm_t mpzspm)
 {
   unsigned int i;
 
@@ -384,8 +840,18 @@ void mpzspm_clear (mpzspm_t mpzspm)
   for (i = 0; i < mpzspm->sp_num; i++)
     {
       mpz_clear (mpzspm->crt1[i]);
-      free (mpzspm->crt4[i]);
-      spm_clear (mpzspm->spm[i]);
+      if (mpzspm->map == NULL)
+        {
+          free (mpzspm->crt4[i]);
+          spm_clear (mpzspm->spm[i]);
+        }
+      else /* the four-step tables and the scratch space are not in the
+              cache file */
+        {
+          spv_ntt_gfp_fourstep_clear (mpzspm->spm[i]);
+          sp_aligned_free (mpzspm->spm[i]->scratch);
+          free (mpzspm->spm[i]);
+        }
     }
 
   for (i = 0; i < mpzspm->sp_num + 2; i++)
@@ -393,9 +859,14 @@ void mpzspm_clear (mpzspm_t mpzspm)
   
   free (mpzspm->crt1);
   free (mpzspm->crt2);
-  free (mpzspm->crt3);
   free (mpzspm->crt4);
-  free (mpzspm->crt5);
+  if (mpzspm->map == NULL)
+    {
+      free (mpzspm->crt3);
+      free (mpzspm->crt5);
+    }
+  else
+    cachefile_unmap (mpzspm->map, mpzspm->map_size);
   
   mpz_clear (mpzspm->modulus);
   free (mpzspm->spm);
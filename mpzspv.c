@@ -24,6 +24,14 @@ MA 02110-1301, USA. */
 #include <string.h> /* for memset */
 #include "ecm-impl.h"
 #include "sp.h"
+#include "listz_handle.h"
+
+/* With OpenMP, the minimal number of residues (coefficients times small
+   primes) for which mpzspv_mul_ntt and mpzspv_normalise use several
+   threads. The normalisation costs O(sp_num) per residue, hence the lower
+   threshold. */
+#define MPZSPV_MUL_NTT_OPENMP_THRESHOLD 32768
+#define MPZSPV_NORMALISE_OPENMP_THRESHOLD 4096
 
 mpzspv_t
 mpzspv_init (spv_size_t len, mpzspm_t mpzspm)
@@ -358,7 +366,7 @@ mpzspv_from_mpzv (mpzspv_t x, const spv_size_t offset, const mpzv_t mpzv,
       else
         {
 	  ASSERT(mpz_sgn (mpzv[i]) > 0); /* We can't handle negative values */
-          if (mpzspm->T == NULL)
+          if (mpzspm->d <= I0_THRESHOLD)
             mpzspv_from_mpzv_slow (x, i + offset, mpzv[i], mpzspm);
           else
             mpzspv_from_mpzv_fast (x, i + offset, mpzv[i], mpzspm);
@@ -374,6 +382,99 @@ mpzspv_from_mpzv (mpzspv_t x, const spv_size_t offset, const mpzv_t mpzv,
 #endif
 }
 
+/* Same as mpzspv_to_mpzv below, but instead of accumulating the t_i P/p_i
+ * modulo the modulus, we compute S = \sum_i t_i P/p_i exactly with the
+ * product tree T (see mpzspm.c): a node of depth i with children a and b
+ * gets S_a * T[i-1][b] + S_b * T[i-1][a]. At depth g, where the nodes
+ * cover 2^g moduli, S is computed directly as \sum_i t_i T[g][j]/p_i.
+ * Then u = S - P floor(1/2 + \alpha) = S mod modulus + crt2[floor(...)].
+ *
+ * time: O(len * M(sp_num) log(sp_num))
+ * memory: 2 * sp_num mpz_t's, sp_num floats */
+static void
+mpzspv_to_mpzv_tree (mpzspv_t x, spv_size_t offset, mpzv_t mpzv,
+                     spv_size_t len, mpzspm_t mpzspm)
+{
+  const unsigned int sp_num = mpzspm->sp_num;
+  const unsigned int g = MIN (MPZSPV_TO_MPZV_LEAF_DEPTH, mpzspm->d);
+  unsigned int i, j, n, oldn;
+  spv_size_t k;
+  mpzv_t *T = mpzspm->T;
+  spm_t *spm = mpzspm->spm;
+  float *prime_recip, f;
+  mpz_t *U, *C, mt;
+  sp_t t;
+
+  U = (mpz_t *) malloc (sp_num * sizeof (mpz_t));
+  C = (mpz_t *) malloc (sp_num * sizeof (mpz_t));
+  prime_recip = (float *) malloc (sp_num * sizeof (float));
+  if (U == NULL || C == NULL || prime_recip == NULL)
+    {
+      fprintf (stderr, "Cannot allocate memory in mpzspv_to_mpzv_tree\n");
+      exit (1);
+    }
+  for (i = 0; i < sp_num; i++)
+    {
+      mpz_init (U[i]);
+      /* C[i] = T[g][j] / p_i where the node j of depth g contains p_i */
+      mpz_init (C[i]);
+      mpz_divexact (C[i], T[g][i >> g], T[0][i]);
+      prime_recip[i] = 1.0f / (float) spm[i]->sp;
+    }
+  mpz_init (mt);
+
+  for (k = 0; k < len; k++)
+    {
+      f = 0.5;
+      for (j = 0; j << g < sp_num; j++)
+        mpz_set_ui (U[j], 0);
+      for (i = 0; i < sp_num; i++)
+        {
+          t = sp_mul (x[i][k + offset], mpzspm->crt3[i], spm[i]->sp,
+                      spm[i]->mul_c);
+          if (sizeof (sp_t) > sizeof (unsigned long))
+            {
+              mpz_set_sp (mt, t);
+              mpz_addmul (U[i >> g], C[i], mt);
+            }
+          else
+            mpz_addmul_ui (U[i >> g], C[i], t);
+          /* same error analysis as in mpzspv_to_mpzv */
+          f += (float) t * prime_recip[i];
+        }
+
+      /* go up the tree: the new U[j] overwrites an entry which was already
+         used, since 2j >= j */
+      for (i = g + 1, n = (sp_num + (1 << g) - 1) >> g; i <= mpzspm->d; i++)
+        {
+          oldn = n;
+          n = (n + 1) / 2;
+          for (j = 0; j < n; j++)
+            if (2 * j + 1 < oldn)
+              {
+                mpz_mul (mt, U[2*j], T[i-1][2*j+1]);
+                mpz_mul (U[j], U[2*j+1], T[i-1][2*j]);
+                mpz_add (U[j], U[j], mt);
+              }
+            else /* oldn is odd */
+              mpz_swap (U[j], U[2*j]);
+        }
+
+      mpz_mod (mpzv[k], U[0], mpzspm->modulus);
+      mpz_add (mpzv[k], mpzv[k], mpzspm->crt2[(unsigned int) f]);
+    }
+
+  mpz_clear (mt);
+  for (i = 0; i < sp_num; i++)
+    {
+      mpz_clear (U[i]);
+      mpz_clear (C[i]);
+    }
+  free (U);
+  free (C);
+  free (prime_recip);
+}
+
 /* Convert the len residues x[][offset..offset+len-1] from "spv" (RNS) format
  * to mpz_t format.
  * See: Daniel J. Bernstein and Jonathan P. Sorenson,
@@ -387,7 +488,10 @@ mpzspv_from_mpzv (mpzspv_t x, const spv_size_t offset, const mpzv_t mpzv,
  * \alpha = \sum_i t_i/p_i
  *
  * time: O(len * sp_num^2) where sp_num is proportional to the modulus size
- * memory: MPZSPV_NORMALISE_STRIDE floats */
+ * memory: MPZSPV_NORMALISE_STRIDE floats
+ *
+ * For sp_num >= MPZSPV_TO_MPZV_TREE_THRESHOLD, we use instead the
+ * subquadratic mpzspv_to_mpzv_tree. */
 void
 mpzspv_to_mpzv (mpzspv_t x, spv_size_t offset, mpzv_t mpzv,
     spv_size_t len, mpzspm_t mpzspm)
@@ -412,6 +516,15 @@ mpzspv_to_mpzv (mpzspv_t x, spv_size_t offset, mpzv_t mpzv,
 #ifdef TIMING_CRT
   mpzspv_to_mpzv_time -= cputime ();
 #endif
+  if (mpzspm->sp_num >= MPZSPV_TO_MPZV_TREE_THRESHOLD)
+    {
+      mpzspv_to_mpzv_tree (x, offset, mpzv, len, mpzspm);
+      free (f);
+#ifdef TIMING_CRT
+      mpzspv_to_mpzv_time += cputime ();
+#endif
+      return;
+    }
   mpz_init (mt);
   for (l = 0; l < len; l += MPZSPV_NORMALISE_STRIDE)
     {
@@ -503,6 +616,7 @@ mpzspv_pwmul (mpzspv_t r, spv_size_t r_offset, mpzspv_t x, spv_size_t x_offset,
  * memory: MPZSPV_NORMALISE_STRIDE mpzspv coeffs
  *         6 * MPZSPV_NORMALISE_STRIDE sp's
  *         MPZSPV_NORMALISE_STRIDE floats
+ *         (per thread with OpenMP)
  * For a subquadratic version: look at Section 23 of
  * http://cr.yp.to/papers.html#multapps
 */
@@ -510,20 +624,33 @@ void
 mpzspv_normalise (mpzspv_t x, spv_size_t offset, spv_size_t len,
     mpzspm_t mpzspm)
 {
-  unsigned int i, j, sp_num = mpzspm->sp_num;
-  spv_size_t k, l;
-  sp_t v;
-  spv_t s, d, w;
+  const unsigned int sp_num = mpzspm->sp_num;
+  const long nr_strides = (long) ((len + MPZSPV_NORMALISE_STRIDE - 1)
+                                  / MPZSPV_NORMALISE_STRIDE);
   spm_t *spm = mpzspm->spm;
-  float prime_recip;
-  float *f;
-  mpzspv_t t;
+  long m;
 
 #ifdef TIMING_CRT
   mpzspv_normalise_time -= cputime ();
 #endif
   ASSERT (mpzspv_verify (x, offset, len, mpzspm));
 
+  /* The strides are independent: each one reads and writes only its own
+     coefficients of x, so they are distributed among the threads, each
+     with its own temporary storage. */
+#if defined(_OPENMP)
+#pragma omp parallel private(m) \
+  if (len * sp_num > MPZSPV_NORMALISE_OPENMP_THRESHOLD)
+#endif
+  {
+  unsigned int i, j;
+  spv_size_t k, l;
+  sp_t v;
+  spv_t s, d, w;
+  float prime_recip;
+  float *f;
+  mpzspv_t t;
+
   f = (float *) malloc (MPZSPV_NORMALISE_STRIDE * sizeof (float));
   s = (spv_t) malloc (3 * MPZSPV_NORMALISE_STRIDE * sizeof (sp_t));
   d = (spv_t) malloc (3 * MPZSPV_NORMALISE_STRIDE * sizeof (sp_t));
@@ -536,9 +663,15 @@ mpzspv_normalise (mpzspv_t x, spv_size_t offset, spv_size_t len,
   
   memset (s, 0, 3 * MPZSPV_NORMALISE_STRIDE * sizeof (sp_t));
 
-  for (l = 0; l < len; l += MPZSPV_NORMALISE_STRIDE)
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+  for (m = 0; m < nr_strides; m++)
     {
-      spv_size_t stride = MIN (MPZSPV_NORMALISE_STRIDE, len - l);
+      spv_size_t stride;
+
+      l = (spv_size_t) m * MPZSPV_NORMALISE_STRIDE;
+      stride = MIN (MPZSPV_NORMALISE_STRIDE, len - l);
       
       /* FIXME: use B&S Theorem 2.2 */
       for (k = 0; k < stride; k++)
@@ -604,6 +737,7 @@ mpzspv_normalise (mpzspv_t x, spv_size_t offset, spv_size_t len,
   free (s);
   free (d);
   free (f);
+  }
 #ifdef TIMING_CRT
   mpzspv_normalise_time += cputime ();
 #endif
@@ -713,14 +847,15 @@ mpzspv_mul_ntt (mpzspv_t r, const spv_size_t offsetr,
   
   log2_ntt_size = ceil_log_2 (ntt_size);
 
-  /* Need parallelization at higher level (e.g., handling a branch of the 
-     product tree in one thread) to make this worthwhile for ECM */
-#define MPZSPV_MUL_NTT_OPENMP 0
-
-#if defined(_OPENMP) && MPZSPV_MUL_NTT_OPENMP
-#pragma omp parallel if (ntt_size > 16384)
+  /* The small primes are independent: each thread does the forward
+     transforms, the product and the inverse transform for its primes.
+     Small products are not worth starting the threads for. */
+#if defined(_OPENMP)
+#pragma omp parallel \
+  if (mpzspm->sp_num > 1 \
+      && ntt_size * mpzspm->sp_num > MPZSPV_MUL_NTT_OPENMP_THRESHOLD)
   {
-#pragma omp for
+#pragma omp for schedule(static, 1)
 #endif
   for (i = 0; i < (int) mpzspm->sp_num; i++)
     {
@@ -778,11 +913,73 @@ mpzspv_mul_ntt (mpzspv_t r, const spv_size_t offsetr,
               1, spm->sp);
       }
     }
-#if defined(_OPENMP) && MPZSPV_MUL_NTT_OPENMP
+#if defined(_OPENMP)
   }
 #endif
 }
 
+/* Computes a DCT-I of the length dctlen for one prime. Input is the spvlen 
+   coefficients in spv. tmp is temp space and must have space for 
+   2*dctlen-2 sp_t's. dct == spv is ok. */
+
+void
+spv_to_dct1 (spv_t dct, const spv_t spv, const spv_size_t spvlen, 
+             const spv_size_t dctlen, spv_t tmp, const spm_t spm)
+{
+  const spv_size_t l = 2 * (dctlen - 1); /* Length for the DFT */
+  const spv_size_t log2_l = ceil_log_2 (l);
+  spv_size_t i;
+      
+  /* Make a symmetric copy of spv in tmp. I.e. with spv = [3, 2, 1], 
+     spvlen = 3, dctlen = 5 (hence l = 8), we want 
+     tmp = [3, 2, 1, 0, 0, 0, 1, 2] */
+  spv_set (tmp, spv, spvlen);
+  spv_rev (tmp + l - spvlen + 1, spv + 1, spvlen - 1);
+  /* Now we have [3, 2, 1, ?, ?, ?, 1, 2]. Fill the ?'s with zeros. */
+  spv_set_sp (tmp + spvlen, (sp_t) 0, l - 2 * spvlen + 1);
+
+  spv_ntt_gfp_dif (tmp, log2_l, spm);
+
+  /* The forward transform is scrambled. We want elements [0 ... l/2]
+     of the unscrabled data, that is all the coefficients with the most 
+     significant bit in the index (in log2(l) word size) unset, plus the 
+     element at index l/2. By scrambling, these map to the elements with 
+     even index, plus the element at index 1. 
+     The elements with scrambled index 2*i are stored in h[i], the
+     element with scrambled index 1 is stored in h[params->l].
+
+     The scrambled indices i in [2^k, 2^(k+1)[ hold the frequencies that
+     are the odd multiples (2*r+1)*l/2^(k+1), where r is i - 2^k with its 
+     k bits reversed. The opposite frequency is 
+     (2*(2^k-1-r)+1)*l/2^(k+1), whose r has the k bits of the former one
+     complemented, thus it is at scrambled index 2^k + (2^k-1-(i-2^k)) =
+     3*2^k-1-i. As the data is symmetric, both have the same coefficient.
+     Below and in spv_mul_by_dct(), m = 3*2^k-1 for the block of i: it
+     becomes 2*m+1 when i reaches 2^(k+1), which is when i + i/2 > m. */
+  
+#ifdef WANT_ASSERT
+  /* Test that the coefficients are symmetric (if they were unscrambled)
+     and that our algorithm for finding identical coefficients in the 
+     scrambled data works */
+  {
+    spv_size_t m = 5;
+    for (i = 2; i < l; i += 2L)
+      {
+        if (i + i / 2L > m)
+            m = 2L * m + 1L;
+
+        ASSERT (tmp[i] == tmp[m - i]);
+      }
+  }
+#endif
+
+  /* Copy coefficients to dct buffer */
+  for (i = 0; i < l / 2; i++)
+    dct[i] = tmp[i * 2];
+  dct[l / 2] = tmp[1];
+}
+
+
 /* Computes a DCT-I of the length dctlen. Input is the spvlen coefficients
    in spv. tmp is temp space and must have space for 2*dctlen-2 sp_t's */
 
@@ -791,8 +988,6 @@ mpzspv_to_dct1 (mpzspv_t dct, const mpzspv_t spv, const spv_size_t spvlen,
                 const spv_size_t dctlen, mpzspv_t tmp, 
 		const mpzspm_t mpzspm)
 {
-  const spv_size_t l = 2 * (dctlen - 1); /* Length for the DFT */
-  const spv_size_t log2_l = ceil_log_2 (l);
   int j;
 
 #ifdef _OPENMP
@@ -801,70 +996,58 @@ mpzspv_to_dct1 (mpzspv_t dct, const mpzspv_t spv, const spv_size_t spvlen,
 #pragma omp for
 #endif
   for (j = 0; j < (int) mpzspm->sp_num; j++)
-    {
-      const spm_t spm = mpzspm->spm[j];
-      spv_size_t i;
-      
-      /* Make a symmetric copy of spv in tmp. I.e. with spv = [3, 2, 1], 
-         spvlen = 3, dctlen = 5 (hence l = 8), we want 
-         tmp = [3, 2, 1, 0, 0, 0, 1, 2] */
-      spv_set (tmp[j], spv[j], spvlen);
-      spv_rev (tmp[j] + l - spvlen + 1, spv[j] + 1, spvlen - 1);
-      /* Now we have [3, 2, 1, ?, ?, ?, 1, 2]. Fill the ?'s with zeros. */
-      spv_set_sp (tmp[j] + spvlen, (sp_t) 0, l - 2 * spvlen + 1);
-
-#if 0
-      printf ("mpzspv_to_dct1: tmp[%d] = [", j);
-      for (i = 0; i < l; i++)
-          printf ("%lu, ", tmp[j][i]);
-      printf ("]\n");
-#endif
-      
-      spv_ntt_gfp_dif (tmp[j], log2_l, spm);
-
-#if 0
-      printf ("mpzspv_to_dct1: tmp[%d] = [", j);
-      for (i = 0; i < l; i++)
-          printf ("%lu, ", tmp[j][i]);
-      printf ("]\n");
+    spv_to_dct1 (dct[j], spv[j], spvlen, dctlen, tmp[j], mpzspm->spm[j]);
+#ifdef _OPENMP
+  }
 #endif
+}
 
-      /* The forward transform is scrambled. We want elements [0 ... l/2]
-         of the unscrabled data, that is all the coefficients with the most 
-         significant bit in the index (in log2(l) word size) unset, plus the 
-         element at index l/2. By scrambling, these map to the elements with 
-         even index, plus the element at index 1. 
-         The elements with scrambled index 2*i are stored in h[i], the
-         element with scrambled index 1 is stored in h[params->l] */
-  
-#ifdef WANT_ASSERT
-      /* Test that the coefficients are symmetric (if they were unscrambled)
-         and that our algorithm for finding identical coefficients in the 
-         scrambled data works */
-      {
-        spv_size_t m = 5;
-        for (i = 2; i < l; i += 2L)
-          {
-            /* This works, but why? */
-            if (i + i / 2L > m)
-                m = 2L * m + 1L;
 
-            ASSERT (tmp[j][i] == tmp[j][m - i]);
-#if 0
-            printf ("mpzspv_to_dct1: DFT[%lu] == DFT[%lu]\n", i, m - i);
-#endif
-          }
-      }
-#endif
+/* Multiply the polynomial in "dft" by the RLP in "dct" for one prime, 
+   see mpzspv_mul_by_dct(). dct may be NULL if steps does not include 
+   NTT_MUL_STEP_MUL. */
 
-      /* Copy coefficients to dct buffer */
-      for (i = 0; i < l / 2; i++)
-        dct[j][i] = tmp[j][i * 2];
-      dct[j][l / 2] = tmp[j][1];
+void
+spv_mul_by_dct (spv_t spv, const spv_t dct, const spv_size_t len, 
+                const spm_t spm, const int steps)
+{
+  spv_size_t log2_len = ceil_log_2 (len);
+  unsigned long i, m;
+	
+  /* Forward DFT of dft[j] */
+  if ((steps & NTT_MUL_STEP_FFT1) != 0)
+    spv_ntt_gfp_dif (spv, log2_len, spm);
+	
+  /* Point-wise product */
+  if ((steps & NTT_MUL_STEP_MUL) != 0)
+    {
+      m = 5UL;
+	    
+      spv[0] = sp_mul (spv[0], dct[0], spm->sp, spm->mul_c);
+      spv[1] = sp_mul (spv[1], dct[len / 2UL], spm->sp, spm->mul_c);
+	    
+      /* spv[m - i] has the frequency opposite to that of spv[i], see 
+         spv_to_dct1() */
+      for (i = 2UL; i < len; i += 2UL)
+        {
+          if (i + i / 2UL > m)
+            m = 2UL * m + 1;
+		
+          spv[i] = sp_mul (spv[i], dct[i / 2UL], spm->sp, spm->mul_c);
+          spv[m - i] = sp_mul (spv[m - i], dct[i / 2UL], spm->sp, 
+                               spm->mul_c);
+        }
+    }
+	
+  /* Inverse transform of dft[j] */
+  if ((steps & NTT_MUL_STEP_IFFT) != 0)
+    {
+      spv_ntt_gfp_dit (spv, log2_len, spm);
+	    
+      /* Divide by transform length. FIXME: scale the DCT of h instead */
+      spv_mul_sp (spv, spv, spm->sp - (spm->sp - 1) / len, len, 
+                  spm->sp, spm->mul_c);
     }
-#ifdef _OPENMP
-  }
-#endif
 }
 
 
@@ -884,7 +1067,6 @@ mpzspv_mul_by_dct (mpzspv_t dft, const mpzspv_t dct, const spv_size_t len,
 		   const mpzspm_t mpzspm, const int steps)
 {
   int j;
-  spv_size_t log2_len = ceil_log_2 (len);
   
 #ifdef _OPENMP
 #pragma omp parallel private(j)
@@ -892,45 +1074,8 @@ mpzspv_mul_by_dct (mpzspv_t dft, const mpzspv_t dct, const spv_size_t len,
 #pragma omp for
 #endif
     for (j = 0; j < (int) (mpzspm->sp_num); j++)
-      {
-	const spm_t spm = mpzspm->spm[j];
-	const spv_t spv = dft[j];
-	unsigned long i, m;
-	
-	/* Forward DFT of dft[j] */
-	if ((steps & NTT_MUL_STEP_FFT1) != 0)
-	  spv_ntt_gfp_dif (spv, log2_len, spm);
-	
-	/* Point-wise product */
-	if ((steps & NTT_MUL_STEP_MUL) != 0)
-	  {
-	    m = 5UL;
-	    
-	    spv[0] = sp_mul (spv[0], dct[j][0], spm->sp, spm->mul_c);
-	    spv[1] = sp_mul (spv[1], dct[j][len / 2UL], spm->sp, spm->mul_c);
-	    
-	    for (i = 2UL; i < len; i += 2UL)
-	      {
-		/* This works, but why? */
-		if (i + i / 2UL > m)
-		  m = 2UL * m + 1;
-		
-		spv[i] = sp_mul (spv[i], dct[j][i / 2UL], spm->sp, spm->mul_c);
-		spv[m - i] = sp_mul (spv[m - i], dct[j][i / 2UL], spm->sp, 
-				     spm->mul_c);
-	      }
-	  }
-	
-	/* Inverse transform of dft[j] */
-	if ((steps & NTT_MUL_STEP_IFFT) != 0)
-	  {
-	    spv_ntt_gfp_dit (spv, log2_len, spm);
-	    
-	    /* Divide by transform length. FIXME: scale the DCT of h instead */
-	    spv_mul_sp (spv, spv, spm->sp - (spm->sp - 1) / len, len, 
-			spm->sp, spm->mul_c);
-	  }
-      }
+      spv_mul_by_dct (dft[j], (dct == NULL) ? NULL : dct[j], len, 
+                      mpzspm->spm[j], steps);
 #ifdef _OPENMP
   }
 #endif
@@ -1118,3 +1263,119 @@ mpzspv_sqr_reciprocal (mpzspv_t dft, const spv_size_t n,
     }
 #endif
 }
+
+
+/* Out-of-core storage for NTT vectors. The file holds len residues for each 
+   of the sp_num primes of mpzspm, the residues of one prime in an entry of
+   a listz_handle_t, so that the transforms can load one prime at a time. 
+   Accesses to the file are serialised, but threads that work on different
+   primes overlap their reads and writes with the computation of the 
+   others, and mpzspv_file_iterator_read() reads the next prime in the 
+   background. Returns NULL if something goes wrong. */
+
+mpzspv_file_t
+mpzspv_file_init (const char *filename, const spv_size_t len, 
+                  mpzspm_t mpzspm)
+{
+  mpzspv_file_t f;
+
+  f = (mpzspv_file_t) malloc (sizeof (__mpzspv_file_struct));
+  if (f == NULL)
+    return NULL;
+
+  f->len = len;
+  f->mpzspm = mpzspm;
+  f->handle = listz_handle_init_raw (filename, mpzspm->sp_num, 
+                                     (len * sizeof (sp_t) 
+                                      + sizeof (file_word_t) - 1) 
+                                     / sizeof (file_word_t));
+  if (f->handle == NULL)
+    {
+      free (f);
+      return NULL;
+    }
+
+  return f;
+}
+
+void
+mpzspv_file_clear (mpzspv_file_t f)
+{
+  listz_handle_clear (f->handle);
+  free (f);
+}
+
+/* Read entries [offset, offset + len[ of the j-th prime into x */
+
+void
+mpzspv_file_read_spv (mpzspv_file_t f, const unsigned int j, 
+                      const spv_size_t offset, spv_t x, const spv_size_t len)
+{
+  ASSERT (j < f->mpzspm->sp_num);
+  ASSERT (offset + len <= f->len);
+  listz_handle_read_raw (f->handle, j, offset * sizeof (sp_t), x, 
+                         len * sizeof (sp_t));
+}
+
+void
+mpzspv_file_write_spv (mpzspv_file_t f, const unsigned int j, 
+                       const spv_size_t offset, const spv_t x, 
+                       const spv_size_t len)
+{
+  ASSERT (j < f->mpzspm->sp_num);
+  ASSERT (offset + len <= f->len);
+  listz_handle_write_raw (f->handle, j, offset * sizeof (sp_t), x, 
+                          len * sizeof (sp_t));
+}
+
+/* Read entries [offset, offset + len[ of every prime into x[j][0 ... len-1] */
+
+void
+mpzspv_file_read (mpzspv_file_t f, const spv_size_t offset, mpzspv_t x, 
+                  const spv_size_t len)
+{
+  unsigned int j;
+
+  for (j = 0; j < f->mpzspm->sp_num; j++)
+    mpzspv_file_read_spv (f, j, offset, x[j], len);
+}
+
+void
+mpzspv_file_write (mpzspv_file_t f, const spv_size_t offset, 
+                   const mpzspv_t x, const spv_size_t len)
+{
+  unsigned int j;
+
+  for (j = 0; j < f->mpzspm->sp_num; j++)
+    mpzspv_file_write_spv (f, j, offset, x[j], len);
+}
+
+/* An iterator over the primes j, j + step, j + 2*step, ... of f. Each 
+   mpzspv_file_iterator_read() returns the residues of the next of these 
+   primes, and starts reading the one after in the background. */
+
+mpzspv_file_iterator_t
+mpzspv_file_iterator_init (mpzspv_file_t f, const unsigned int j, 
+                           const unsigned int step)
+{
+  mpzspv_file_iterator_t iter;
+
+  iter = listz_iterator_init_stride (f->handle, j, 1, step);
+  ASSERT_ALWAYS (iter != NULL);
+  return iter;
+}
+
+/* The f->len residues of the next prime. They stay valid until the next 
+   call only. */
+
+spv_t
+mpzspv_file_iterator_read (mpzspv_file_iterator_t iter)
+{
+  return (spv_t) listz_iterator_read_raw (iter);
+}
+
+void
+mpzspv_file_iterator_clear (mpzspv_file_iterator_t iter)
+{
+  listz_iterator_clear (iter);
+}
@@ -1034,90 +1034,6 @@ pt_many_print(ell_curve_t *tE, ell_point_t *tP, int nE, mpmod_t n)
     }
 }
 
-/* Computes inv[i] = 1/x[i] using only one inversion, a la Montgomery.
-   If takeit[i] != 1, do not compute 1/x[i] (it is probably 0, or irrelevant).
-   We should have inv != x.
-   x[nx] is a buffer.
-   When a factor is found, the i s.t. x[i] is not invertible are looked for
-   and the corresponding values of takeit put to 2.
-*/
-int
-compute_all_inverses(mpz_t f, mpres_t *inv, mpres_t *x, int nx, mpmod_t n, char *takeit)
-{
-    int i;
-
-#if 0
-    /* plain version, to debug the architecture */
-    for(i = 0; i < nx; i++){
-	if(takeit[i] != 1)
-	    continue;
-	if(!mpres_invert(inv[i], x[i], n)){
-	    mpres_gcd(inv[0], x[i], n); // FIXME!!
-#if DEBUG_ADD_LAWS >= 1
-	    gmp_printf ("Factor[%d]: %Zd\n", i, inv[0]);
-#endif
-	    return 0;
-	}
-    }
-#else
-    /* Montgomery's trick */
-    for(i = 0; i < nx; i++){
-	if(takeit[i] != 1){
-	    if(i == 0)
-		mpres_set_ui(inv[i], 1, n);
-	    else
-		mpres_set(inv[i], inv[i-1], n);
-	}
-	else{
-	    if(i == 0)
-		mpres_set(inv[i], x[i], n);
-	    else
-		mpres_mul(inv[i], inv[i-1], x[i], n);
-	}
-    }
-    /* invert */
-    if(!mpres_invert(x[nx], inv[nx-1], n)){
-	mpres_gcd(f, inv[nx-1], n);
-#if DEBUG_ADD_LAWS >= 1
-	gmp_printf ("Factor[%d]: %Zd\n", i, f);
-#endif
-	/* identifying the x[i]'s */
-	for(i = 0; i < nx; i++){
-	    mpres_gcd(f, x[i], n);
-	    if(mpz_cmp_ui(f, 1) != 0){
-#if DEBUG_ADD_LAWS >= 0
-		gmp_printf ("# x[%d] not invertible: %Zd\n", i, f);
-#endif
-		/* ONE DAY: if x[nx] != inv[0], we have another factor! */
-		takeit[i] = 2;
-	    }
-	}
-	return 0;
-    }
-    /* get inverses back */
-    /* say inv = 1/(x1*x2*x3) */
-    for(i = nx-1; i > 0; i--)
-	if(takeit[i] == 1){
-	    mpres_mul(inv[i], x[nx], inv[i-1], n); /* 1/x3 = inv * (x1*x2) */
-	    mpres_mul(x[nx], x[nx], x[i], n); /* inv = 1/(x1*x2) */
-	}
-    mpres_set(inv[0], x[nx], n);
-#endif
-#if DEBUG_ADD_LAWS >= 1
-    /*    printf("# checking inverses\n"); */
-    mpres_t tmp;
-    mpres_init(tmp, n);
-    for(i = 0; i < nx; i++){
-	mpres_mul(tmp, inv[i], x[i], n);
-	mpres_get_z(tmp, tmp, n);
-	if(mpz_cmp_ui(tmp, 1) != 0)
-	    printf("ERROR in compute_all_inverses[%d]\n", i);
-    }
-    mpres_clear(tmp, n);
-#endif
-    return 1;
-}
-
 /* NOTE: we can have tR = tP or tQ.
    In case a factor is found, it is put in num[nE].
  */
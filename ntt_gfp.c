@@ -21,6 +21,270 @@ MA 02110-1301, USA. */
 #include "sp.h"
 #include "ecm-impl.h"
 
+/*------------------ BUTTERFLIES WITH SHOUP'S MULTIPLICATION ---------------*/
+
+/* The butterflies of the table-based transforms multiply by precomputed
+   twiddle factors w[i], so they use sp_mul_shoup with the precomputed
+   wp[i] = sp_mul_shoup_pre (w[i], p). All results are reduced in [0, p). */
+
+typedef void (*bfly_shoup_func_t) (spv_t, spv_t, const spv_t, const spv_t,
+                                   spv_size_t, sp_t);
+typedef void (*bfly4_shoup_func_t) (spv_t, spv_t, spv_t, spv_t, const spv_t,
+                                    const spv_t, spv_size_t, sp_t);
+
+static void
+bfly_dif_shoup_generic (spv_t x0, spv_t x1, const spv_t w, const spv_t wp,
+                        spv_size_t len, sp_t p)
+{
+  spv_size_t i;
+
+  for (i = 0; i < len; i++)
+    {
+      sp_t t0 = x0[i];
+      sp_t t1 = x1[i];
+      x0[i] = sp_add (t0, t1, p);
+      x1[i] = sp_mul_shoup (sp_sub (t0, t1, p), w[i], wp[i], p);
+    }
+}
+
+static void
+bfly_dit_shoup_generic (spv_t x0, spv_t x1, const spv_t w, const spv_t wp,
+                        spv_size_t len, sp_t p)
+{
+  spv_size_t i;
+
+  for (i = 0; i < len; i++)
+    {
+      sp_t t0 = x0[i];
+      sp_t t1 = sp_mul_shoup (x1[i], w[i], wp[i], p);
+      x0[i] = sp_add (t0, t1, p);
+      x1[i] = sp_sub (t0, t1, p);
+    }
+}
+
+static void
+bfly4_dif_shoup_generic (spv_t x0, spv_t x1, spv_t x2, spv_t x3,
+                         const spv_t w, const spv_t wp, spv_size_t len, sp_t p)
+{
+  const spv_t w2 = w + 2 * len, w2p = wp + 2 * len;
+  spv_size_t i;
+
+  for (i = 0; i < len; i++)
+    {
+      sp_t a = x0[i], b = x1[i], c = x2[i], d = x3[i], t;
+
+      t = sp_add (a, c, p);
+      c = sp_mul_shoup (sp_sub (a, c, p), w[i], wp[i], p);
+      a = t;
+      t = sp_add (b, d, p);
+      d = sp_mul_shoup (sp_sub (b, d, p), w[len + i], wp[len + i], p);
+      b = t;
+      x0[i] = sp_add (a, b, p);
+      x1[i] = sp_mul_shoup (sp_sub (a, b, p), w2[i], w2p[i], p);
+      x2[i] = sp_add (c, d, p);
+      x3[i] = sp_mul_shoup (sp_sub (c, d, p), w2[i], w2p[i], p);
+    }
+}
+
+static void
+bfly4_dit_shoup_generic (spv_t x0, spv_t x1, spv_t x2, spv_t x3,
+                         const spv_t w, const spv_t wp, spv_size_t len, sp_t p)
+{
+  const spv_t w2 = w + 2 * len, w2p = wp + 2 * len;
+  spv_size_t i;
+
+  for (i = 0; i < len; i++)
+    {
+      sp_t a = x0[i], b, c = x2[i], d, t;
+
+      t = sp_mul_shoup (x1[i], w2[i], w2p[i], p);
+      b = sp_sub (a, t, p);
+      a = sp_add (a, t, p);
+      t = sp_mul_shoup (x3[i], w2[i], w2p[i], p);
+      d = sp_sub (c, t, p);
+      c = sp_add (c, t, p);
+      t = sp_mul_shoup (c, w[i], wp[i], p);
+      x0[i] = sp_add (a, t, p);
+      x2[i] = sp_sub (a, t, p);
+      t = sp_mul_shoup (d, w[len + i], wp[len + i], p);
+      x1[i] = sp_add (b, t, p);
+      x3[i] = sp_sub (b, t, p);
+    }
+}
+
+static void
+spv_mul_shoup_generic (spv_t r, const spv_t x, const spv_t w, const spv_t wp,
+                       spv_size_t len, sp_t p)
+{
+  spv_size_t i;
+
+  for (i = 0; i < len; i++)
+    r[i] = sp_mul_shoup (x[i], w[i], wp[i], p);
+}
+
+/* The vector versions need 2p < 2^63 for the signed comparison of AVX2 */
+#if defined(HAVE_X86_TARGET_ATTRIBUTE) && SP_TYPE_BITS == 64 && \
+    SP_NUMB_BITS <= 62
+#define NTT_GFP_SIMD 1
+#include <immintrin.h>
+
+#define NTT_AVX2 __attribute__ ((target ("avx2")))
+#define NTT_AVX512 __attribute__ ((target ("avx512f,avx512dq")))
+
+/* low 64 bits of the products x * y */
+NTT_AVX2 static inline __m256i
+mullo_avx2 (__m256i x, __m256i y)
+{
+  __m256i mid = _mm256_add_epi64 (
+                  _mm256_mul_epu32 (_mm256_srli_epi64 (x, 32), y),
+                  _mm256_mul_epu32 (x, _mm256_srli_epi64 (y, 32)));
+  return _mm256_add_epi64 (_mm256_mul_epu32 (x, y),
+                           _mm256_slli_epi64 (mid, 32));
+}
+
+/* x - p if x >= p, else x, for 0 <= x < 2p < 2^63 */
+NTT_AVX2 static inline __m256i
+red_avx2 (__m256i x, __m256i p)
+{
+  __m256d t = _mm256_castsi256_pd (_mm256_sub_epi64 (x, p));
+  return _mm256_castpd_si256 (
+           _mm256_blendv_pd (t, _mm256_castsi256_pd (x), t));
+}
+
+/* AVX2, 4 words per vector */
+#define NS_FN(name) name ## _avx2
+#define NS_ATTR NTT_AVX2
+#define NS_VEC __m256i
+#define NS_VL 4
+#define NS_LOAD(p) _mm256_loadu_si256 ((const __m256i *) (p))
+#define NS_STORE(p, x) _mm256_storeu_si256 ((__m256i *) (p), x)
+#define NS_SET1(x) _mm256_set1_epi64x ((long long) (x))
+#define NS_ADD(x, y) _mm256_add_epi64 (x, y)
+#define NS_SUB(x, y) _mm256_sub_epi64 (x, y)
+#define NS_SRLI(x, k) _mm256_srli_epi64 (x, k)
+#define NS_AND(x, y) _mm256_and_si256 (x, y)
+#define NS_MUL32(x, y) _mm256_mul_epu32 (x, y)
+#define NS_MULLO(x, y) mullo_avx2 (x, y)
+#define NS_RED(x, p) red_avx2 (x, p)
+#include "ntt_gfp_simd.h"
+#undef NS_FN
+#undef NS_ATTR
+#undef NS_VEC
+#undef NS_VL
+#undef NS_LOAD
+#undef NS_STORE
+#undef NS_SET1
+#undef NS_ADD
+#undef NS_SUB
+#undef NS_SRLI
+#undef NS_AND
+#undef NS_MUL32
+#undef NS_MULLO
+#undef NS_RED
+
+/* AVX-512, 8 words per vector */
+#define NS_FN(name) name ## _avx512
+#define NS_ATTR NTT_AVX512
+#define NS_VEC __m512i
+#define NS_VL 8
+#define NS_LOAD(p) _mm512_loadu_si512 ((const void *) (p))
+#define NS_STORE(p, x) _mm512_storeu_si512 ((void *) (p), x)
+#define NS_SET1(x) _mm512_set1_epi64 ((long long) (x))
+#define NS_ADD(x, y) _mm512_add_epi64 (x, y)
+#define NS_SUB(x, y) _mm512_sub_epi64 (x, y)
+#define NS_SRLI(x, k) _mm512_srli_epi64 (x, k)
+#define NS_AND(x, y) _mm512_and_si512 (x, y)
+#define NS_MUL32(x, y) _mm512_mul_epu32 (x, y)
+#define NS_MULLO(x, y) _mm512_mullo_epi64 (x, y)
+#define NS_RED(x, p) _mm512_min_epu64 (x, _mm512_sub_epi64 (x, p))
+#include "ntt_gfp_simd.h"
+#undef NS_FN
+#undef NS_ATTR
+#undef NS_VEC
+#undef NS_VL
+#undef NS_LOAD
+#undef NS_STORE
+#undef NS_SET1
+#undef NS_ADD
+#undef NS_SUB
+#undef NS_SRLI
+#undef NS_AND
+#undef NS_MUL32
+#undef NS_MULLO
+#undef NS_RED
+#endif /* NTT_GFP_SIMD */
+
+/* The butterflies used by the transforms, see spv_ntt_gfp_select() */
+static bfly_shoup_func_t bfly_dif_shoup = bfly_dif_shoup_generic;
+static bfly_shoup_func_t bfly_dit_shoup = bfly_dit_shoup_generic;
+static bfly4_shoup_func_t bfly4_dif_shoup = bfly4_dif_shoup_generic;
+static bfly4_shoup_func_t bfly4_dit_shoup = bfly4_dit_shoup_generic;
+static bfly_shoup_func_t spv_mul_shoup = spv_mul_shoup_generic;
+
+#ifdef NTT_GFP_SIMD
+/* Choose the butterflies for the instruction sets of this cpu, once, 
+   before main() and before any thread can use them */
+__attribute__ ((constructor)) static void
+spv_ntt_gfp_select (void)
+{
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx512f") &&
+      __builtin_cpu_supports ("avx512dq"))
+    {
+      bfly_dif_shoup = bfly_dif_shoup_avx512;
+      bfly_dit_shoup = bfly_dit_shoup_avx512;
+      bfly4_dif_shoup = bfly4_dif_shoup_avx512;
+      bfly4_dit_shoup = bfly4_dit_shoup_avx512;
+      spv_mul_shoup = spv_mul_shoup_avx512;
+    }
+  else if (__builtin_cpu_supports ("avx2"))
+    {
+      bfly_dif_shoup = bfly_dif_shoup_avx2;
+      bfly_dit_shoup = bfly_dit_shoup_avx2;
+      bfly4_dif_shoup = bfly4_dif_shoup_avx2;
+      bfly4_dit_shoup = bfly4_dit_shoup_avx2;
+      spv_mul_shoup = spv_mul_shoup_avx2;
+    }
+}
+#endif
+
+/* The SSE2 assembly butterflies below are faster than the portable
+   Shoup butterflies for 32-bit primes, they ignore wp */
+#if ((defined(__GNUC__) || defined(__ICL)) && \
+  	defined(__i386__) && defined(HAVE_SSE2)) || \
+    (defined( _MSC_VER ) && defined( SSE2))
+#define BFLY_DIF_TABLE(x0, x1, w, wp, len, p, d) bfly_dif (x0, x1, w, len, p, d)
+#define BFLY_DIT_TABLE(x0, x1, w, wp, len, p, d) bfly_dit (x0, x1, w, len, p, d)
+#define BFLY4_DIF_TABLE(x0, x1, x2, x3, w, wp, len, p, d) \
+  do { bfly_dif (x0, x2, w, 2 * (len), p, d);              \
+       bfly_dif (x0, x1, (w) + 2 * (len), len, p, d);      \
+       bfly_dif (x2, x3, (w) + 2 * (len), len, p, d); } while (0)
+#define BFLY4_DIT_TABLE(x0, x1, x2, x3, w, wp, len, p, d) \
+  do { bfly_dit (x0, x1, (w) + 2 * (len), len, p, d);      \
+       bfly_dit (x2, x3, (w) + 2 * (len), len, p, d);      \
+       bfly_dit (x0, x2, w, 2 * (len), p, d); } while (0)
+#else
+#define BFLY_DIF_TABLE(x0, x1, w, wp, len, p, d) \
+  bfly_dif_shoup (x0, x1, w, wp, len, p)
+#define BFLY_DIT_TABLE(x0, x1, w, wp, len, p, d) \
+  bfly_dit_shoup (x0, x1, w, wp, len, p)
+#define BFLY4_DIF_TABLE(x0, x1, x2, x3, w, wp, len, p, d) \
+  bfly4_dif_shoup (x0, x1, x2, x3, w, wp, len, p)
+#define BFLY4_DIT_TABLE(x0, x1, x2, x3, w, wp, len, p, d) \
+  bfly4_dit_shoup (x0, x1, x2, x3, w, wp, len, p)
+#endif
+
+/* The four-step transform (see below) does at most NTT_GFP_FOURSTEP_MAX_LOG2
+   levels at once, on blocks of NTT_GFP_FOURSTEP_COLS columns. Its tables
+   for 2^k rows take NTT_GFP_FOURSTEP_TABLE(k) words, and its scratch space
+   NTT_GFP_FOURSTEP_SCRATCH(k) words */
+#define NTT_GFP_FOURSTEP_COLS 8
+#define NTT_GFP_FOURSTEP_MAX_LOG2 10
+#define NTT_GFP_FOURSTEP_TABLE(k) ((2 * NTT_GFP_FOURSTEP_COLS) << (k))
+#define NTT_GFP_FOURSTEP_SCRATCH(k) ((NTT_GFP_FOURSTEP_COLS + 3) << (k))
+
+static void spv_ntt_gfp_fourstep (spv_t, spv_size_t, spv_size_t, spm_t, int);
+
 /*--------------------------- FORWARD NTT --------------------------------*/
 static void bfly_dif(spv_t x0, spv_t x1, spv_t w,
 			spv_size_t len, sp_t p, sp_t d)
@@ -213,11 +477,10 @@ static void bfly_dif(spv_t x0, spv_t x1, spv_t w,
 }
 
 static void
-spv_ntt_dif_core (spv_t x, spv_t w, 
+spv_ntt_dif_core (spv_t x, spv_t w, spv_t wp,
 		  spv_size_t log2_len, sp_t p, sp_t d)
 {
-  spv_size_t len;
-  spv_t x0, x1;
+  spv_size_t len, i;
 	
   /* handle small transforms immediately */
   switch (log2_len) {
@@ -244,7 +507,7 @@ spv_ntt_dif_core (spv_t x, spv_t w,
       t7 = sp_sub (t1, t3, p);
       x[0] = sp_add (t4, t5, p);
       x[1] = sp_sub (t4, t5, p);
-      t7 = sp_mul (t7, w[1], p, d);
+      t7 = sp_mul_shoup (t7, w[1], wp[1], p);
       x[2] = sp_add (t6, t7, p);
       x[3] = sp_sub (t6, t7, p);
       return;
@@ -265,19 +528,19 @@ spv_ntt_dif_core (spv_t x, spv_t w,
       t12 = sp_sub (t0, t4, p);
       t9 = sp_add (t1, t5, p);
       t13 = sp_sub (t1, t5, p);
-      t13 = sp_mul (t13, w[1], p, d);
+      t13 = sp_mul_shoup (t13, w[1], wp[1], p);
       t10 = sp_add (t2, t6, p);
       t14 = sp_sub (t2, t6, p);
-      t14 = sp_mul (t14, w[2], p, d);
+      t14 = sp_mul_shoup (t14, w[2], wp[2], p);
       t11 = sp_add (t3, t7, p);
       t15 = sp_sub (t3, t7, p);
-      t15 = sp_mul (t15, w[3], p, d);
+      t15 = sp_mul_shoup (t15, w[3], wp[3], p);
 
       t0 = sp_add (t8, t10, p);
       t2 = sp_sub (t8, t10, p);
       t1 = sp_add (t9, t11, p);
       t3 = sp_sub (t9, t11, p);
-      t3 = sp_mul (t3, w[2], p, d);
+      t3 = sp_mul_shoup (t3, w[2], wp[2], p);
       x[0] = sp_add (t0, t1, p);
       x[1] = sp_sub (t0, t1, p);
       x[2] = sp_add (t2, t3, p);
@@ -287,7 +550,7 @@ spv_ntt_dif_core (spv_t x, spv_t w,
       t2 = sp_sub (t12, t14, p);
       t1 = sp_add (t13, t15, p);
       t3 = sp_sub (t13, t15, p);
-      t3 = sp_mul (t3, w[2], p, d);
+      t3 = sp_mul_shoup (t3, w[2], wp[2], p);
       x[4] = sp_add (t0, t1, p);
       x[5] = sp_sub (t0, t1, p);
       x[6] = sp_add (t2, t3, p);
@@ -296,12 +559,24 @@ spv_ntt_dif_core (spv_t x, spv_t w,
     }
   }
 
-  len = 1 << (log2_len - 1);
-  x0 = x;
-  x1 = x + len;
-  bfly_dif (x0, x1, w, len, p, d);
-  spv_ntt_dif_core (x0, w + len, log2_len - 1, p, d);
-  spv_ntt_dif_core (x1, w + len, log2_len - 1, p, d);
+  if (log2_len == 4)
+    {
+      /* too short for two levels at once in vectors of 8 words */
+      BFLY_DIF_TABLE (x, x + 8, w, wp, 8, p, d);
+      spv_ntt_dif_core (x, w + 8, wp + 8, 3, p, d);
+      spv_ntt_dif_core (x + 8, w + 8, wp + 8, 3, p, d);
+      return;
+    }
+
+  /* two levels at once, then the four transforms of a quarter of the
+     length, whose twiddle factors follow those for the full and half
+     lengths */
+  len = 1 << (log2_len - 2);
+  BFLY4_DIF_TABLE (x, x + len, x + 2 * len, x + 3 * len, w, wp, len, p, d);
+  w += 3 * len;
+  wp += 3 * len;
+  for (i = 0; i < 4; i++)
+    spv_ntt_dif_core (x + i * len, w, wp, log2_len - 2, p, d);
 }
 
 void
@@ -312,9 +587,9 @@ spv_ntt_gfp_dif (spv_t x, spv_size_t log2_len, spm_t data)
 
   if (log2_len <= NTT_GFP_TWIDDLE_DIF_BREAKOVER)
     { 
-      spv_t w = data->nttdata->twiddle + 
-	        data->nttdata->twiddle_size - (1 << log2_len);
-      spv_ntt_dif_core (x, w, log2_len, p, d);
+      spv_size_t k = data->nttdata->twiddle_size - (1 << log2_len);
+      spv_ntt_dif_core (x, data->nttdata->twiddle + k,
+                        data->nttdata->twiddle_shoup + k, log2_len, p, d);
     }
   else
     {
@@ -324,6 +599,18 @@ spv_ntt_gfp_dif (spv_t x, spv_size_t log2_len, spm_t data)
       spv_t x0 = x;
       spv_t x1 = x + len;
       spv_t roots = data->nttdata->ntt_roots;
+      spv_size_t k = MIN (log2_len - NTT_GFP_TWIDDLE_DIF_BREAKOVER,
+                          NTT_GFP_FOURSTEP_MAX_LOG2);
+
+      if (data->nttdata->fourstep[log2_len] != NULL)
+        {
+          spv_size_t i;
+
+          spv_ntt_gfp_fourstep (x, log2_len, k, data, 0);
+          for (i = 0; i < ((spv_size_t) 1 << k); i++)
+            spv_ntt_gfp_dif (x + (i << (log2_len - k)), log2_len - k, data);
+          return;
+        }
 
         {
           spv_size_t i;
@@ -540,11 +827,10 @@ static inline void bfly_dit(spv_t x0, spv_t x1, spv_t w,
 }
 
 static void
-spv_ntt_dit_core (spv_t x, spv_t w, 
+spv_ntt_dit_core (spv_t x, spv_t w, spv_t wp,
 		  spv_size_t log2_len, sp_t p, sp_t d)
 {
-  spv_size_t len;
-  spv_t x0, x1;
+  spv_size_t len, i;
 	
   /* handle small transforms immediately */
   switch (log2_len) {
@@ -571,7 +857,7 @@ spv_ntt_dit_core (spv_t x, spv_t w,
       t7 = sp_sub (t2, t3, p);
       x[0] = sp_add (t4, t6, p);
       x[2] = sp_sub (t4, t6, p);
-      t7 = sp_mul (t7, w[1], p, d);
+      t7 = sp_mul_shoup (t7, w[1], wp[1], p);
       x[1] = sp_add (t5, t7, p);
       x[3] = sp_sub (t5, t7, p);
       return;
@@ -594,7 +880,7 @@ spv_ntt_dit_core (spv_t x, spv_t w,
       t11 = sp_sub(t2, t3, p);
       t0 = sp_add(t8, t10, p);
       t2 = sp_sub(t8, t10, p);
-      t11 = sp_mul (t11, w[2], p, d);
+      t11 = sp_mul_shoup (t11, w[2], wp[2], p);
       t1 = sp_add(t9, t11, p);
       t3 = sp_sub(t9, t11, p);
 
@@ -604,31 +890,38 @@ spv_ntt_dit_core (spv_t x, spv_t w,
       t11 = sp_sub(t6, t7, p);
       t4 = sp_add(t8, t10, p);
       t6 = sp_sub(t8, t10, p);
-      t11 = sp_mul (t11, w[2], p, d);
+      t11 = sp_mul_shoup (t11, w[2], wp[2], p);
       t5 = sp_add(t9, t11, p);
       t7 = sp_sub(t9, t11, p);
 
       x[0] = sp_add(t0, t4, p);
       x[4] = sp_sub(t0, t4, p);
-      t5 = sp_mul (t5, w[1], p, d);
+      t5 = sp_mul_shoup (t5, w[1], wp[1], p);
       x[1] = sp_add(t1, t5, p);
       x[5] = sp_sub(t1, t5, p);
-      t6 = sp_mul (t6, w[2], p, d);
+      t6 = sp_mul_shoup (t6, w[2], wp[2], p);
       x[2] = sp_add(t2, t6, p);
       x[6] = sp_sub(t2, t6, p);
-      t7 = sp_mul (t7, w[3], p, d);
+      t7 = sp_mul_shoup (t7, w[3], wp[3], p);
       x[3] = sp_add(t3, t7, p);
       x[7] = sp_sub(t3, t7, p);
       return;
     }
   }
 
-  len = 1 << (log2_len - 1);
-  x0 = x;
-  x1 = x + len;
-  spv_ntt_dit_core (x0, w + len, log2_len - 1, p, d);
-  spv_ntt_dit_core (x1, w + len, log2_len - 1, p, d);
-  bfly_dit (x0, x1, w, len, p, d);
+  if (log2_len == 4)
+    {
+      spv_ntt_dit_core (x, w + 8, wp + 8, 3, p, d);
+      spv_ntt_dit_core (x + 8, w + 8, wp + 8, 3, p, d);
+      BFLY_DIT_TABLE (x, x + 8, w, wp, 8, p, d);
+      return;
+    }
+
+  len = 1 << (log2_len - 2);
+  for (i = 0; i < 4; i++)
+    spv_ntt_dit_core (x + i * len, w + 3 * len, wp + 3 * len, log2_len - 2,
+                      p, d);
+  BFLY4_DIT_TABLE (x, x + len, x + 2 * len, x + 3 * len, w, wp, len, p, d);
 }
 
 void
@@ -639,9 +932,9 @@ spv_ntt_gfp_dit (spv_t x, spv_size_t log2_len, spm_t data)
 
   if (log2_len <= NTT_GFP_TWIDDLE_DIT_BREAKOVER)
     {
-      spv_t w = data->inttdata->twiddle + 
-	        data->inttdata->twiddle_size - (1 << log2_len);
-      spv_ntt_dit_core (x, w, log2_len, p, d);
+      spv_size_t k = data->inttdata->twiddle_size - (1 << log2_len);
+      spv_ntt_dit_core (x, data->inttdata->twiddle + k,
+                        data->inttdata->twiddle_shoup + k, log2_len, p, d);
     }
   else
     {
@@ -649,6 +942,18 @@ spv_ntt_gfp_dit (spv_t x, spv_size_t log2_len, spm_t data)
       spv_t x0 = x;
       spv_t x1 = x + len;
       spv_t roots = data->inttdata->ntt_roots;
+      spv_size_t k = MIN (log2_len - NTT_GFP_TWIDDLE_DIT_BREAKOVER,
+                          NTT_GFP_FOURSTEP_MAX_LOG2);
+
+      if (data->inttdata->fourstep[log2_len] != NULL)
+        {
+          spv_size_t i;
+
+          for (i = 0; i < ((spv_size_t) 1 << k); i++)
+            spv_ntt_gfp_dit (x + (i << (log2_len - k)), log2_len - k, data);
+          spv_ntt_gfp_fourstep (x, log2_len, k, data, 1);
+          return;
+        }
 
       spv_ntt_gfp_dit (x0, log2_len - 1, data);
       spv_ntt_gfp_dit (x1, log2_len - 1, data);
@@ -675,3 +980,206 @@ spv_ntt_gfp_dit (spv_t x, spv_size_t log2_len, spm_t data)
 	}
     }
 }
+
+/*--------------------------- FOUR-STEP NTT ------------------------------*/
+
+/* For a length N = 2^log2_len that does not fit in the cache, the top k
+   levels of the forward transform, with R = 2^k and C = N/R, amount to a
+   length R transform of each column x[i + j*C], 0 <= j < R, followed by the
+   multiplication of its output s by w_N^(i*bitrev(s)), where bitrev(s)
+   reverses the k bits of s. The inverse transform multiplies first, then
+   transforms. Doing this on blocks of NTT_GFP_FOURSTEP_COLS columns, copied
+   to contiguous memory to avoid the cache conflicts of the stride C, makes
+   one pass over x instead of k. The sub-transforms of length C are left to
+   the caller.
+
+   The powers of w_N only depend on the prime and on N: they are computed
+   once by spv_ntt_gfp_fourstep_init, in nttdata->fourstep[log2_len]. Only
+   the scratch space is per thread, in its context. */
+
+/* Return the number k of levels the four-step transform of length
+   2^log2_len should do, or 0 if it should not be used */
+static spv_size_t
+spv_ntt_gfp_fourstep_levels (spv_size_t log2_len, spv_size_t breakover,
+                             sp_nttdata_t nttdata)
+{
+  spv_size_t k;
+
+  if (log2_len <= breakover || log2_len < NTT_GFP_FOURSTEP_THRESHOLD)
+    return 0;
+  k = MIN (log2_len - breakover, NTT_GFP_FOURSTEP_MAX_LOG2);
+  if (((spv_size_t) 1 << (log2_len - k)) < NTT_GFP_FOURSTEP_COLS ||
+      ((spv_size_t) 1 << k) > nttdata->twiddle_size)
+    return 0;
+  return k;
+}
+
+/* Compute in tab the tables of the four-step transform of length
+   2^log2_len with 2^k rows and g = nttdata->ntt_roots[log2_len]:
+   q[(b-1)*R + s] = g^(b*bitrev(s)) for 0 < b < B, e[s] = g^(B*bitrev(s)),
+   followed by their sp_mul_shoup_pre in qp and ep */
+static void
+spv_ntt_gfp_fourstep_table (spv_t tab, spv_size_t log2_len, spv_size_t k,
+                            sp_nttdata_t nttdata, sp_t p, sp_t d)
+{
+  const spv_size_t R = (spv_size_t) 1 << k;
+  const spv_size_t B = NTT_GFP_FOURSTEP_COLS;
+  spv_t q = tab, qp = q + (B - 1) * R, e = qp + (B - 1) * R, ep = e + R;
+  sp_t g = nttdata->ntt_roots[log2_len], r0, minv;
+  spv_size_t b, s, j, rev;
+
+  sp_mul_shoup_init (&r0, &minv, p);
+
+  /* the powers g^j are temporarily in e */
+  for (e[0] = 1, j = 1; j < R; j++)
+    e[j] = sp_mul (e[j - 1], g, p, d);
+  for (s = 0; s < R; s++)
+    {
+      for (rev = 0, j = 0; j < k; j++)
+        rev |= ((s >> j) & 1) << (k - 1 - j);
+      q[s] = e[rev];
+    }
+  for (b = 1; b < B - 1; b++)
+    for (s = 0; s < R; s++)
+      q[b * R + s] = sp_mul (q[(b - 1) * R + s], q[s], p, d);
+  for (s = 0; s < R; s++)
+    {
+      e[s] = sp_mul (q[(B - 2) * R + s], q[s], p, d);
+      ep[s] = sp_mul_shoup_pre (e[s], r0, minv, p, d);
+    }
+  for (s = 0; s < (B - 1) * R; s++)
+    qp[s] = sp_mul_shoup_pre (q[s], r0, minv, p, d);
+}
+
+static int
+spv_ntt_gfp_fourstep_init_data (sp_nttdata_t nttdata, spv_size_t log2_len,
+                                spv_size_t breakover, sp_t p, sp_t d)
+{
+  spv_size_t i, k;
+
+  for (i = 0; i < NTT_GFP_MAX_LOG2_LEN; i++)
+    {
+      k = (i <= log2_len)
+        ? spv_ntt_gfp_fourstep_levels (i, breakover, nttdata) : 0;
+      sp_aligned_free (nttdata->fourstep[i]);
+      nttdata->fourstep[i] = NULL;
+      if (k == 0)
+        continue;
+      nttdata->fourstep[i] = (spv_t) sp_aligned_malloc
+        (NTT_GFP_FOURSTEP_TABLE(k) * sizeof (sp_t));
+      if (nttdata->fourstep[i] == NULL)
+        return 1;
+      spv_ntt_gfp_fourstep_table (nttdata->fourstep[i], i, k, nttdata, p, d);
+    }
+  return 0;
+}
+
+/* Build the four-step tables of data for the transforms of length up to
+   2^log2_len which use it with the current thresholds, and free the other
+   ones. The tables of data must be NULL or valid on input.
+   Returns 0 on success, 1 if out of memory. */
+int
+spv_ntt_gfp_fourstep_init (spm_t data, spv_size_t log2_len)
+{
+  ASSERT_ALWAYS (log2_len < NTT_GFP_MAX_LOG2_LEN);
+  return spv_ntt_gfp_fourstep_init_data (data->nttdata, log2_len,
+                                         NTT_GFP_TWIDDLE_DIF_BREAKOVER,
+                                         data->sp, data->mul_c)
+    || spv_ntt_gfp_fourstep_init_data (data->inttdata, log2_len,
+                                       NTT_GFP_TWIDDLE_DIT_BREAKOVER,
+                                       data->sp, data->mul_c);
+}
+
+void
+spv_ntt_gfp_fourstep_clear (spm_t data)
+{
+  spv_size_t i;
+
+  for (i = 0; i < NTT_GFP_MAX_LOG2_LEN; i++)
+    {
+      sp_aligned_free (data->nttdata->fourstep[i]);
+      sp_aligned_free (data->inttdata->fourstep[i]);
+      data->nttdata->fourstep[i] = data->inttdata->fourstep[i] = NULL;
+    }
+}
+
+/* The scratch space of the calling thread for the four-step transform,
+   of at least n words, kept in its context */
+static spv_t
+spv_ntt_gfp_fourstep_scratch (spv_size_t n)
+{
+  ecm_ctx_t ctx = ECM_CTX;
+
+  if (ctx->ntt_scratch_size < n)
+    {
+      sp_aligned_free (ctx->ntt_scratch);
+      ctx->ntt_scratch = (spv_t) sp_aligned_malloc (n * sizeof (sp_t));
+      if (ctx->ntt_scratch == NULL)
+        {
+          fprintf (stderr, "Cannot allocate memory in "
+                   "spv_ntt_gfp_fourstep_scratch\n");
+          exit (1);
+        }
+      ctx->ntt_scratch_size = n;
+    }
+  return ctx->ntt_scratch;
+}
+
+static void
+spv_ntt_gfp_fourstep (spv_t x, spv_size_t log2_len, spv_size_t k,
+                      spm_t data, int inverse)
+{
+  const spv_size_t R = (spv_size_t) 1 << k, C = (spv_size_t) 1 << (log2_len - k);
+  const spv_size_t B = NTT_GFP_FOURSTEP_COLS;
+  __sp_nttdata *nttdata = inverse ? data->inttdata : data->nttdata;
+  spv_t w = nttdata->twiddle + nttdata->twiddle_size - R;
+  spv_t wp = nttdata->twiddle_shoup + nttdata->twiddle_size - R;
+  spv_t q = nttdata->fourstep[log2_len], qp = q + (B - 1) * R;
+  spv_t e = qp + (B - 1) * R, ep = e + R;
+  spv_t col = spv_ntt_gfp_fourstep_scratch (NTT_GFP_FOURSTEP_SCRATCH(k));
+  spv_t t = col + B * R, tp = t + R, u = tp + R;
+  sp_t p = data->sp, d = data->mul_c;
+  sp_t r0, minv;
+  spv_size_t i, b, s;
+
+  sp_mul_shoup_init (&r0, &minv, p);
+
+  /* t[s] = g^(i*bitrev(s)) for the first column i of the block, and
+     u[s] = t[s] * 2^SP_TYPE_BITS mod p gives tp[s], see sp_mul_shoup_pre */
+  for (s = 0; s < R; s++)
+    {
+      t[s] = 1;
+      u[s] = r0;
+      tp[s] = ((sp_t) 0 - r0) * minv;
+    }
+
+  for (i = 0; i < C; i += B)
+    {
+      for (s = 0; s < R; s++)
+        for (b = 0; b < B; b++)
+          col[b * R + s] = x[i + b + s * C];
+
+      for (b = 0; b < B; b++)
+        {
+          spv_t y = col + b * R;
+
+          if (!inverse)
+            spv_ntt_dif_core (y, w, wp, k, p, d);
+          if (b != 0)
+            spv_mul_shoup (y, y, q + (b - 1) * R, qp + (b - 1) * R, R, p);
+          if (i != 0)
+            spv_mul_shoup (y, y, t, tp, R, p);
+          if (inverse)
+            spv_ntt_dit_core (y, w, wp, k, p, d);
+        }
+
+      for (s = 0; s < R; s++)
+        for (b = 0; b < B; b++)
+          x[i + b + s * C] = col[b * R + s];
+
+      spv_mul_shoup (t, t, e, ep, R, p);
+      spv_mul_shoup (u, u, e, ep, R, p);
+      for (s = 0; s < R; s++)
+        tp[s] = ((sp_t) 0 - u[s]) * minv;
+    }
+}
@@ -0,0 +1,225 @@
+/* ntt_gfp_simd.h - NTT butterflies with Shoup's multiplication, on vectors
+   of 64-bit words. This file is included by ntt_gfp.c once for
+   each instruction set, with the following macros defined:
+
+   NS_FN(name)    name of the instance of a function
+   NS_ATTR        attributes of the functions (target instruction set)
+   NS_VEC         vector type, NS_VL 64-bit words
+   NS_LOAD(p), NS_STORE(p, x), NS_SET1(x)
+   NS_ADD(x, y), NS_SUB(x, y), NS_SRLI(x, k), NS_AND(x, y)
+   NS_MUL32(x, y) product of the low 32 bits of each word
+   NS_MULLO(x, y) low 64 bits of the products
+   NS_RED(x, p)   x - p if x >= p, else x, for 0 <= x < 2p < 2^63
+
+Copyright 2026 Paul Zimmermann, Alexander Kruppa.
+
+The SP Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The SP Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the SP Library; see the file COPYING.LIB.  If not, write to
+the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+MA 02110-1301, USA. */
+
+/* high 64 bits of the products x * y, with four 32x32 products */
+NS_ATTR static inline NS_VEC
+NS_FN(mulhi) (NS_VEC x, NS_VEC y)
+{
+  const NS_VEC mask = NS_SET1 (0xffffffffUL);
+  NS_VEC xh = NS_SRLI (x, 32), yh = NS_SRLI (y, 32);
+  NS_VEC ll = NS_MUL32 (x, y), lh = NS_MUL32 (x, yh);
+  NS_VEC hl = NS_MUL32 (xh, y), hh = NS_MUL32 (xh, yh);
+  NS_VEC mid;
+
+  mid = NS_ADD (NS_SRLI (ll, 32), NS_ADD (NS_AND (lh, mask),
+                                          NS_AND (hl, mask)));
+  hh = NS_ADD (hh, NS_ADD (NS_SRLI (lh, 32), NS_SRLI (hl, 32)));
+  return NS_ADD (hh, NS_SRLI (mid, 32));
+}
+
+/* x * w mod p in [0, 2p), where wp = sp_mul_shoup_pre (w, p) */
+NS_ATTR static inline NS_VEC
+NS_FN(mul_shoup) (NS_VEC x, NS_VEC w, NS_VEC wp, NS_VEC p)
+{
+  NS_VEC q = NS_FN(mulhi) (x, wp);
+  return NS_SUB (NS_MULLO (x, w), NS_MULLO (q, p));
+}
+
+NS_ATTR static void
+NS_FN(bfly_dif_shoup) (spv_t x0, spv_t x1, const spv_t w, const spv_t wp,
+                       spv_size_t len, sp_t p)
+{
+  const NS_VEC vp = NS_SET1 (p);
+  spv_size_t i;
+
+  for (i = 0; i + NS_VL <= len; i += NS_VL)
+    {
+      NS_VEC a = NS_LOAD (x0 + i), b = NS_LOAD (x1 + i), t;
+
+      NS_STORE (x0 + i, NS_RED (NS_ADD (a, b), vp));
+      t = NS_ADD (NS_SUB (a, b), vp); /* in [1, 2p) */
+      t = NS_FN(mul_shoup) (t, NS_LOAD (w + i), NS_LOAD (wp + i), vp);
+      NS_STORE (x1 + i, NS_RED (t, vp));
+    }
+  for ( ; i < len; i++)
+    {
+      sp_t t0 = x0[i], t1 = x1[i];
+      x0[i] = sp_add (t0, t1, p);
+      x1[i] = sp_mul_shoup (sp_sub (t0, t1, p), w[i], wp[i], p);
+    }
+}
+
+NS_ATTR static void
+NS_FN(bfly_dit_shoup) (spv_t x0, spv_t x1, const spv_t w, const spv_t wp,
+                       spv_size_t len, sp_t p)
+{
+  const NS_VEC vp = NS_SET1 (p);
+  spv_size_t i;
+
+  for (i = 0; i + NS_VL <= len; i += NS_VL)
+    {
+      NS_VEC a = NS_LOAD (x0 + i), t;
+
+      t = NS_FN(mul_shoup) (NS_LOAD (x1 + i), NS_LOAD (w + i),
+                            NS_LOAD (wp + i), vp);
+      t = NS_RED (t, vp);
+      NS_STORE (x0 + i, NS_RED (NS_ADD (a, t), vp));
+      NS_STORE (x1 + i, NS_RED (NS_ADD (NS_SUB (a, t), vp), vp));
+    }
+  for ( ; i < len; i++)
+    {
+      sp_t t0 = x0[i], t1;
+      t1 = sp_mul_shoup (x1[i], w[i], wp[i], p);
+      x0[i] = sp_add (t0, t1, p);
+      x1[i] = sp_sub (t0, t1, p);
+    }
+}
+
+/* two levels of the forward transform at once, on x0[i], x1[i], x2[i],
+   x3[i] for 0 <= i < len, where w is the table for length 4*len and
+   w + 2*len the table for length 2*len */
+NS_ATTR static void
+NS_FN(bfly4_dif_shoup) (spv_t x0, spv_t x1, spv_t x2, spv_t x3,
+                        const spv_t w, const spv_t wp, spv_size_t len, sp_t p)
+{
+  const NS_VEC vp = NS_SET1 (p);
+  const spv_t w2 = w + 2 * len, w2p = wp + 2 * len;
+  spv_size_t i;
+
+  for (i = 0; i + NS_VL <= len; i += NS_VL)
+    {
+      NS_VEC a = NS_LOAD (x0 + i), b = NS_LOAD (x1 + i);
+      NS_VEC c = NS_LOAD (x2 + i), d = NS_LOAD (x3 + i);
+      NS_VEC v2 = NS_LOAD (w2 + i), v2p = NS_LOAD (w2p + i), t;
+
+      t = NS_RED (NS_ADD (a, c), vp);
+      c = NS_FN(mul_shoup) (NS_ADD (NS_SUB (a, c), vp), NS_LOAD (w + i),
+                            NS_LOAD (wp + i), vp);
+      c = NS_RED (c, vp);
+      a = t;
+      t = NS_RED (NS_ADD (b, d), vp);
+      d = NS_FN(mul_shoup) (NS_ADD (NS_SUB (b, d), vp), NS_LOAD (w + len + i),
+                            NS_LOAD (wp + len + i), vp);
+      d = NS_RED (d, vp);
+      b = t;
+
+      NS_STORE (x0 + i, NS_RED (NS_ADD (a, b), vp));
+      t = NS_FN(mul_shoup) (NS_ADD (NS_SUB (a, b), vp), v2, v2p, vp);
+      NS_STORE (x1 + i, NS_RED (t, vp));
+      NS_STORE (x2 + i, NS_RED (NS_ADD (c, d), vp));
+      t = NS_FN(mul_shoup) (NS_ADD (NS_SUB (c, d), vp), v2, v2p, vp);
+      NS_STORE (x3 + i, NS_RED (t, vp));
+    }
+  for ( ; i < len; i++)
+    {
+      sp_t a = x0[i], b = x1[i], c = x2[i], d = x3[i], t;
+
+      t = sp_add (a, c, p);
+      c = sp_mul_shoup (sp_sub (a, c, p), w[i], wp[i], p);
+      a = t;
+      t = sp_add (b, d, p);
+      d = sp_mul_shoup (sp_sub (b, d, p), w[len + i], wp[len + i], p);
+      b = t;
+      x0[i] = sp_add (a, b, p);
+      x1[i] = sp_mul_shoup (sp_sub (a, b, p), w2[i], w2p[i], p);
+      x2[i] = sp_add (c, d, p);
+      x3[i] = sp_mul_shoup (sp_sub (c, d, p), w2[i], w2p[i], p);
+    }
+}
+
+/* two levels of the inverse transform at once, as in spv_ntt_dit_core */
+NS_ATTR static void
+NS_FN(bfly4_dit_shoup) (spv_t x0, spv_t x1, spv_t x2, spv_t x3,
+                        const spv_t w, const spv_t wp, spv_size_t len, sp_t p)
+{
+  const NS_VEC vp = NS_SET1 (p);
+  const spv_t w2 = w + 2 * len, w2p = wp + 2 * len;
+  spv_size_t i;
+
+  for (i = 0; i + NS_VL <= len; i += NS_VL)
+    {
+      NS_VEC a = NS_LOAD (x0 + i), b, c = NS_LOAD (x2 + i), d;
+      NS_VEC v2 = NS_LOAD (w2 + i), v2p = NS_LOAD (w2p + i), t;
+
+      t = NS_FN(mul_shoup) (NS_LOAD (x1 + i), v2, v2p, vp);
+      t = NS_RED (t, vp);
+      b = NS_RED (NS_ADD (NS_SUB (a, t), vp), vp);
+      a = NS_RED (NS_ADD (a, t), vp);
+      t = NS_FN(mul_shoup) (NS_LOAD (x3 + i), v2, v2p, vp);
+      t = NS_RED (t, vp);
+      d = NS_RED (NS_ADD (NS_SUB (c, t), vp), vp);
+      c = NS_RED (NS_ADD (c, t), vp);
+
+      t = NS_FN(mul_shoup) (c, NS_LOAD (w + i), NS_LOAD (wp + i), vp);
+      t = NS_RED (t, vp);
+      NS_STORE (x0 + i, NS_RED (NS_ADD (a, t), vp));
+      NS_STORE (x2 + i, NS_RED (NS_ADD (NS_SUB (a, t), vp), vp));
+      t = NS_FN(mul_shoup) (d, NS_LOAD (w + len + i), NS_LOAD (wp + len + i),
+                            vp);
+      t = NS_RED (t, vp);
+      NS_STORE (x1 + i, NS_RED (NS_ADD (b, t), vp));
+      NS_STORE (x3 + i, NS_RED (NS_ADD (NS_SUB (b, t), vp), vp));
+    }
+  for ( ; i < len; i++)
+    {
+      sp_t a = x0[i], b, c = x2[i], d, t;
+
+      t = sp_mul_shoup (x1[i], w2[i], w2p[i], p);
+      b = sp_sub (a, t, p);
+      a = sp_add (a, t, p);
+      t = sp_mul_shoup (x3[i], w2[i], w2p[i], p);
+      d = sp_sub (c, t, p);
+      c = sp_add (c, t, p);
+      t = sp_mul_shoup (c, w[i], wp[i], p);
+      x0[i] = sp_add (a, t, p);
+      x2[i] = sp_sub (a, t, p);
+      t = sp_mul_shoup (d, w[len + i], wp[len + i], p);
+      x1[i] = sp_add (b, t, p);
+      x3[i] = sp_sub (b, t, p);
+    }
+}
+
+/* r[i] = x[i] * w[i] mod p, where wp[i] = sp_mul_shoup_pre (w[i], ...) */
+NS_ATTR static void
+NS_FN(spv_mul_shoup) (spv_t r, const spv_t x, const spv_t w, const spv_t wp,
+                      spv_size_t len, sp_t p)
+{
+  const NS_VEC vp = NS_SET1 (p);
+  spv_size_t i;
+
+  for (i = 0; i + NS_VL <= len; i += NS_VL)
+    {
+      NS_VEC t = NS_FN(mul_shoup) (NS_LOAD (x + i), NS_LOAD (w + i),
+                                   NS_LOAD (wp + i), vp);
+      NS_STORE (r + i, NS_RED (t, vp));
+    }
+  for ( ; i < len; i++)
+    r[i] = sp_mul_shoup (x[i], w[i], wp[i], p);
+}
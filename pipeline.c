@@ -0,0 +1,658 @@
+/* pipeline.c - overlaps stage 1 of many curves at once with their stage 2.
+
+Copyright 2026 Paul Zimmermann, Alexander Kruppa.
+
+This file is part of the ECM Library.
+
+The ECM Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The ECM Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the ECM Library; see the file COPYING.LIB.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* gpu_ecm and cpu_batch_ecm (with ecm_batch_curves below) compute stage 1
+   of many curves at once with a stage1_backend_t (the GPU, or the
+   vectorized code of batchsimd.c), then stage 2 of each curve on the CPU.
+   Here the curves are cut into chunks of backend->chunk curves: as soon as
+   stage 1 of a chunk is done, stage 2 of its curves becomes an OpenMP task,
+   which the other threads of the team run while stage 1 of the next chunks
+   goes on. At most PIPELINE_DEPTH chunks per thread are in the queue, so
+   that the stage 1 backend does not run too far ahead: when the queue is
+   full, the thread running the backend helps with stage 2 until the queue
+   is empty. When the backend can run in several threads at once
+   (backend->concurrent), a task computes both stages of its chunk.
+
+   Stage 2 of a chunk is skipped when stage 1 found a factor with one of its
+   curves, as cpu_batch_ecm and gpu_ecm did for the whole batch, thus the
+   factors found do not depend on the number of threads. Without OpenMP, or
+   with one thread, the chunks are done one after the other. */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ecm-gmp.h"
+#include "ecm-impl.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* number of chunks per thread waiting for or in stage 2 */
+#define PIPELINE_DEPTH 2
+
+#define TWO32 4294967296 /* 2^32 */
+
+typedef struct
+{
+  mpz_t *factors;
+  int *array_found;
+  mpz_ptr x, n, s;
+  size_t n_bits;
+  unsigned int firstsigma;
+  stage1_backend_t *backend;
+  batch_stage2_t *stage2;
+  int verbose, verbose2; /* verbosity of stage 1, and of stage 2 */
+  FILE *os, *es;
+  const char *cachedir;
+  mp_ptr xp;             /* the limbs of x, written by the chunks */
+  int ret1;              /* result of stage 1 over all chunks */
+  long time1, time2;     /* elapsed time of each stage, over all chunks */
+  unsigned int inflight; /* number of chunks started, and not done */
+} pipeline_t;
+
+/* The tasks may run in any thread of the team, which gets the output
+   streams, the verbosity and the cache directory of the caller */
+static void
+pipeline_thread_init (pipeline_t *pl, int verbose)
+{
+  const char *dir = cachefile_get_dir ();
+
+  ECM_STDOUT = pl->os;
+  ECM_STDERR = pl->es;
+  set_verbose (verbose);
+  if (pl->cachedir == NULL ? dir != NULL
+      : (dir == NULL || strcmp (dir, pl->cachedir) != 0))
+    cachefile_set_dir (pl->cachedir);
+}
+
+/* Stage 1 of the curves c0 <= i < c1, whose residues are saved in x */
+static void
+pipeline_stage1 (pipeline_t *pl, unsigned int c0, unsigned int c1)
+{
+  long st = realtime ();
+  unsigned int i, b;
+  size_t off, w, l0, len, k, fn;
+  mp_ptr buf;
+  mp_srcptr fp;
+  int ret;
+
+  ret = pl->backend->stage1 (pl->backend->data, pl->factors + c0,
+                             pl->array_found + c0, pl->n, pl->s, c1 - c0,
+                             pl->firstsigma + c0);
+  st = elltime (st, realtime ());
+
+  /* x = x0 + x1 * 2^bits + ... + xk * 2^(bits*k): the residues of the
+     chunk are shifted into the limbs l0 to l0+len-1 of buf, which are
+     copied into x, except the first and the last ones, which may have
+     bits of the neighbouring chunks, and are or'ed in under the lock */
+  l0 = (pl->n_bits * c0) / GMP_NUMB_BITS;
+  len = (pl->n_bits * c1 - 1) / GMP_NUMB_BITS + 1 - l0;
+  buf = (mp_ptr) calloc (len + 1, sizeof (mp_limb_t));
+  ASSERT_ALWAYS (buf != NULL);
+  for (i = c0; i < c1; i++)
+    {
+      ASSERT (mpz_sgn (pl->factors[i]) >= 0);
+      ASSERT (mpz_sizeinbase (pl->factors[i], 2) <= pl->n_bits);
+      off = pl->n_bits * i - l0 * GMP_NUMB_BITS;
+      w = off / GMP_NUMB_BITS;
+      b = off % GMP_NUMB_BITS;
+      fp = PTR(pl->factors[i]);
+      fn = mpz_size (pl->factors[i]);
+      for (k = 0; k < fn; k++)
+        {
+          buf[w + k] |= fp[k] << b;
+          if (b != 0)
+            buf[w + k + 1] |= fp[k] >> (GMP_NUMB_BITS - b);
+        }
+    }
+  for (k = 1; k + 1 < len; k++)
+    pl->xp[l0 + k] = buf[k];
+
+#ifdef _OPENMP
+#pragma omp critical (pipeline)
+#endif
+  {
+    pl->time1 += st;
+    if (ret == ECM_ERROR || pl->ret1 == ECM_NO_FACTOR_FOUND)
+      pl->ret1 = ret;
+    pl->xp[l0] |= buf[0];
+    if (len > 1)
+      pl->xp[l0 + len - 1] |= buf[len - 1];
+  }
+  free (buf);
+}
+
+/* Stage 2 of the curves c0 <= i < c1, with a modulus of its own */
+static void
+pipeline_stage2 (pipeline_t *pl, unsigned int c0, unsigned int c1)
+{
+  batch_stage2_t *S = pl->stage2;
+  mpz_t *factors = pl->factors;
+  int *array_found = pl->array_found;
+  mpmod_t modulus;
+  root_params_t root_params;
+  curve P;
+  mpz_t A;
+  unsigned int i;
+  int youpi = ECM_ERROR;
+  long st = realtime ();
+
+  for (i = c0; i < c1; i++)
+    if (array_found[i] != ECM_NO_FACTOR_FOUND)
+      return;
+
+  mpmod_init_set (modulus, S->modulus);
+  /* with a small B2, the baby-step giant-step stage 2 processes all
+     curves at once, otherwise (or if it runs out of memory) one curve
+     after the other */
+  if (stage2_bsgs_wanted (S->B2min, S->B2))
+    youpi = ecm_stage2_bsgs (factors + c0, array_found + c0, c1 - c0,
+                             pl->firstsigma + c0, modulus, S->B2min, S->B2,
+                             S->stop_asap);
+  if (youpi == ECM_ERROR)
+    {
+      mpres_init (P.x, modulus);
+      mpres_init (P.y, modulus);
+      mpres_init (P.A, modulus);
+      mpz_init (A);
+      P.disc = 0; /* For stage2 this needs to be 0, in order not to use CM
+                     stuff */
+      root_params = *S->root_params;
+      mpz_init_set (root_params.i0, S->root_params->i0);
+
+      for (i = c0; i < c1; i++)
+        {
+          if (test_verbose (OUTPUT_RESVERBOSE))
+            outputf (OUTPUT_RESVERBOSE, "x=%Zd\n", factors[i]);
+
+          if (S->stop_asap != NULL && (*S->stop_asap) ())
+            break;
+
+          mpres_set_z (P.x, factors[i], modulus);
+          mpres_set_ui (P.y, 1, modulus);
+          A_from_sigma (A, i + pl->firstsigma, modulus->orig_modulus);
+          mpres_set_z (P.A, A, modulus);
+
+          youpi = montgomery_to_weierstrass (factors[i], P.x, P.y, P.A,
+                                             modulus);
+          if (youpi == ECM_NO_FACTOR_FOUND && test_verbose (OUTPUT_RESVERBOSE))
+            {
+              mpres_get_z (A, P.x, modulus);
+              outputf (OUTPUT_RESVERBOSE, "After switch to Weierstrass form, "
+                       "P=(%Zd", A);
+              mpres_get_z (A, P.y, modulus);
+              outputf (OUTPUT_RESVERBOSE, ", %Zd)\n", A);
+              mpres_get_z (A, P.A, modulus);
+              outputf (OUTPUT_RESVERBOSE, "on curve Y^2 = X^3 + %Zd * X + b\n",
+                       A);
+            }
+          if (youpi == ECM_NO_FACTOR_FOUND)
+            youpi = stage2 (factors[i], &P, modulus, S->dF, S->k,
+                            &root_params, S->use_ntt, S->TreeFilename, i + 1,
+                            S->stop_asap);
+          if (youpi != ECM_NO_FACTOR_FOUND)
+            array_found[i] = youpi;
+        }
+
+      mpz_clear (root_params.i0);
+      mpz_clear (A);
+      mpres_clear (P.A, modulus);
+      mpres_clear (P.y, modulus);
+      mpres_clear (P.x, modulus);
+    }
+  mpmod_clear (modulus);
+
+  st = elltime (st, realtime ());
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  pl->time2 += st;
+}
+
+/* The task for the curves c0 <= i < c1: both stages if with_stage1 is
+   non-zero, otherwise only stage 2 */
+static void
+pipeline_task (pipeline_t *pl, unsigned int c0, unsigned int c1,
+               int with_stage1)
+{
+  if (with_stage1)
+    {
+      pipeline_thread_init (pl, pl->verbose);
+      pipeline_stage1 (pl, c0, c1);
+    }
+  if (pl->stage2 != NULL)
+    {
+      pipeline_thread_init (pl, pl->verbose2);
+      pipeline_stage2 (pl, c0, c1);
+    }
+  set_verbose (pl->verbose);
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  pl->inflight--;
+}
+
+/* Returns the number of threads ecm_pipeline should use */
+unsigned int
+ecm_pipeline_threads (char *TreeFilename)
+{
+  /* the product tree files of stage 2 are per curve, but large */
+  if (TreeFilename != NULL)
+    return 1;
+#ifdef _OPENMP
+  return omp_get_max_threads ();
+#else
+  return 1;
+#endif
+}
+
+/* Computes stage 1 with backend, then stage 2 if stage2 is not NULL, of
+   the nb_curves curves with sigma = firstsigma + i, in nthreads threads,
+   with the verbosity level of the caller. The input number is n, and the
+   stage 1 exponent s. On output, factors[i]
+   and array_found[i] are as for ecm_stage1_batch_simd, except that
+   array_found[i] = ECM_FACTOR_FOUND_STEP2 if stage 2 of curve i found the
+   factor factors[i], and x contains the stage 1 residues (see gpu_ecm).
+   The elapsed times of stage 1 and stage 2, summed over the chunks, are
+   put in *time1 and *time2.
+   Returns ECM_ERROR if stage 1 failed, ECM_FACTOR_FOUND_STEP1 if stage 1
+   found a factor, ECM_FACTOR_FOUND_STEP2 if only stage 2 did, and
+   ECM_NO_FACTOR_FOUND otherwise. */
+int
+ecm_pipeline (mpz_t *factors, int *array_found, mpz_t x, mpz_t n, mpz_t s,
+              unsigned int nb_curves, unsigned int firstsigma,
+              stage1_backend_t *backend, batch_stage2_t *stage2,
+              unsigned int nthreads, int verbose, long *time1, long *time2)
+{
+  pipeline_t pl[1];
+  unsigned int c, chunk, bound;
+  mp_size_t xn;
+  int ret;
+
+  pl->factors = factors;
+  pl->array_found = array_found;
+  pl->x = x;
+  pl->n = n;
+  pl->s = s;
+  pl->n_bits = mpz_sizeinbase (n, 2);
+  pl->firstsigma = firstsigma;
+  pl->backend = backend;
+  pl->stage2 = stage2;
+  pl->verbose = verbose;
+  if (nthreads == 0)
+    nthreads = 1;
+  /* stage 2 of each curve is one level less verbose, and two levels when
+     the lines of several threads would be mixed */
+  pl->verbose2 = verbose - ((nthreads > 1) ? 2 : 1);
+  if (pl->verbose2 < 0)
+    pl->verbose2 = (verbose < 0) ? verbose : 0;
+  pl->os = ECM_STDOUT;
+  pl->es = ECM_STDERR;
+  pl->cachedir = cachefile_get_dir ();
+  pl->ret1 = ECM_NO_FACTOR_FOUND;
+  pl->time1 = pl->time2 = 0;
+  pl->inflight = 0;
+
+  xn = (nb_curves * pl->n_bits - 1) / GMP_NUMB_BITS + 1;
+  mpz_set_ui (x, 0);
+  mpz_realloc2 (x, xn * GMP_NUMB_BITS);
+  pl->xp = PTR(x);
+  MPN_ZERO (pl->xp, xn);
+
+  chunk = (backend->chunk == 0) ? nb_curves : backend->chunk;
+  bound = PIPELINE_DEPTH * nthreads;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if (nthreads > 1)
+#endif
+  {
+#ifdef _OPENMP
+#pragma omp single
+#endif
+    for (c = 0; c < nb_curves; c += chunk)
+      {
+        unsigned int c1 = (nb_curves - c > chunk) ? c + chunk : nb_curves;
+        unsigned int k;
+
+        /* when the queue is full, this thread helps with the chunks in it
+           until they are done (taskyield, which would only wait for a free
+           place, does nothing in some OpenMP implementations) */
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+        k = pl->inflight;
+        if (k >= bound)
+          {
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+          }
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+        ret = pl->ret1;
+        if (ret == ECM_ERROR
+            || (stage2 != NULL && stage2->stop_asap != NULL
+                && (*stage2->stop_asap) ()))
+          break;
+
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        pl->inflight++;
+        if (backend->concurrent)
+          {
+#ifdef _OPENMP
+#pragma omp task firstprivate (c, c1)
+#endif
+            pipeline_task (pl, c, c1, 1);
+          }
+        else
+          {
+            pipeline_stage1 (pl, c, c1);
+#ifdef _OPENMP
+#pragma omp task firstprivate (c, c1)
+#endif
+            pipeline_task (pl, c, c1, 0);
+          }
+      }
+#ifdef _OPENMP
+    /* the tasks are done at the barrier of single: the other threads free
+       the NTT tables of stage 2 in their default context, which outlives
+       this call */
+    if (omp_get_thread_num () != 0)
+      ecm_ctx_clear (NULL);
+#endif
+  }
+
+  MPN_NORMALIZE (pl->xp, xn);
+  SIZ(x) = xn;
+
+  *time1 = pl->time1;
+  *time2 = pl->time2;
+  ret = pl->ret1;
+  if (ret == ECM_NO_FACTOR_FOUND)
+    for (c = 0; c < nb_curves; c++)
+      if (array_found[c] == ECM_FACTOR_FOUND_STEP2)
+        ret = ECM_FACTOR_FOUND_STEP2;
+  return ret;
+}
+
+/* The common part of gpu_ecm and cpu_batch_ecm, which check that their
+   backend can handle n, and set the output streams and the verbosity.
+   Computes stage 1 of *nb_curves curves of param ECM_PARAM_BATCH_32BITS_D
+   with sigma = firstsigma, ..., firstsigma + *nb_curves - 1 with backend,
+   and their stage 2 on the CPU with ecm_pipeline. The other parameters are
+   those of ecm (). On output, x contains the stage 1 residues as
+   x = x0 + x1 * 2^bits + ... and f the factors found as f = f0 + f1*n + ...
+   where bits is the number of bits of n: this way, several factors can be
+   returned without breaking the library interface, as gcd(f,n)=gcd(f0,n). */
+int
+ecm_batch_curves (mpz_t f, mpz_t x, int param, mpz_t firstsigma, mpz_t n,
+                  mpz_t go, double *B1done, double B1, mpz_t B2min_parm,
+                  mpz_t B2_parm, unsigned long k, const int S, int verbose,
+                  int repr, int nobase2step2, int use_ntt, int sigma_is_A,
+                  char *TreeFilename, double maxmem, int (*stop_asap)(void),
+                  mpz_t batch_s, double *batch_last_B1_used,
+                  unsigned int *nb_curves, stage1_backend_t *backend)
+{
+  const char *name = backend->name;
+  unsigned int i, nthreads, firstsigma_ui;
+  int youpi = ECM_NO_FACTOR_FOUND;
+  long st, st1, st2;
+  mpz_t *factors = NULL; /* Contains either a factor of n either end-of-stage-1
+                         residue (depending of the value of array_found */
+  int *array_found = NULL;
+  /* Only for stage 2 */
+  int base2 = 0;  /* If n is of form 2^n[+-]1, set base to [+-]n */
+  int Fermat = 0; /* If base2 > 0 is a power of 2, set Fermat to base2 */
+  int po2 = 0;    /* Whether we should use power-of-2 poly degree */
+  mpmod_t modulus;
+  mpz_t B2min, B2; /* Local B2, B2min to avoid changing caller's values */
+  unsigned long dF;
+  root_params_t root_params;
+  batch_stage2_t stage2_params;
+
+  ASSERT((-1 <= sigma_is_A) && (sigma_is_A <= 1));
+
+  /* Only param = ECM_PARAM_BATCH_32BITS_D is accepted */
+  if (param == ECM_PARAM_DEFAULT)
+    param = ECM_PARAM_BATCH_32BITS_D;
+
+  if (param != ECM_PARAM_BATCH_32BITS_D)
+    {
+      outputf (OUTPUT_ERROR, "%sError, only param = ECM_PARAM_BATCH_32BITS_D "
+               "is accepted with several curves at once.\n", name);
+      return ECM_ERROR;
+    }
+
+  /* Current code works only for sigma_is_A = 0 */
+  if (sigma_is_A != 0)
+    {
+      outputf (OUTPUT_ERROR, "%sError, cannot give A with several curves "
+               "at once.\n", name);
+      return ECM_ERROR;
+    }
+
+  if (go != NULL && mpz_cmp_ui (go, 1) > 0)
+    {
+      outputf (OUTPUT_ERROR, "%sError, option -go is not allowed with several "
+               "curves at once.\n", name);
+      return ECM_ERROR;
+    }
+
+  /* Cannot resume since each curve has its own residue */
+  if (!ECM_IS_DEFAULT_B1_DONE(*B1done) && *B1done < B1)
+    {
+      outputf (OUTPUT_ERROR, "%sError, cannot resume with several curves "
+               "at once.\n", name);
+      return ECM_ERROR;
+    }
+
+  /* The stage 1 arithmetic is the one of the backend, repr is only used for
+     stage 2 */
+  if (mpmod_init (modulus, n, repr) != 0)
+    return ECM_ERROR;
+
+  /* See what kind of number we have as that may influence optimal parameter
+     selection. Test for base 2 number. Note: this was already done by
+     mpmod_init. */
+  if (modulus->repr == ECM_MOD_BASE2)
+    base2 = modulus->bits;
+
+  /* For a Fermat number (base2 a positive power of 2) */
+  for (Fermat = base2; Fermat > 0 && (Fermat & 1) == 0; Fermat >>= 1);
+  if (Fermat == 1)
+    {
+      Fermat = base2;
+      po2 = 1;
+    }
+  else
+    Fermat = 0;
+
+  mpz_init (B2);
+  mpz_init (B2min);
+
+  /* stage 2 runs in several threads at once (see ecm_pipeline), thus each
+     one gets a part of maxmem */
+  nthreads = ecm_pipeline_threads (TreeFilename);
+  youpi = set_stage_2_params (B2, B2_parm, B2min, B2min_parm, &root_params,
+                              B1, &k, S, use_ntt, &po2, &dF, TreeFilename,
+                              maxmem / (double) nthreads, Fermat, modulus);
+  if (youpi == ECM_ERROR)
+    goto end_ecm_batch_curves;
+
+  /* the backend may choose the number of curves, and its chunks */
+  if (backend->init != NULL
+      && backend->init (backend, nb_curves, nthreads,
+                        mpz_cmp (B2, B2min) >= 0) != 0)
+    {
+      youpi = ECM_ERROR;
+      goto end_ecm_batch_curves;
+    }
+
+  if (mpz_sgn (firstsigma) == 0)
+    {
+      /* generate random value in [2, 2^32 - nb_curves - 1] */
+      mpz_set_ui (firstsigma, (get_random_ul () %
+                               (TWO32 - 2 - *nb_curves)) + 2);
+    }
+  else if (mpz_cmp_ui (firstsigma, 2) < 0 ||
+           mpz_cmp_ui (firstsigma, TWO32 - *nb_curves) >= 0)
+    {
+      outputf (OUTPUT_ERROR, "%sError, sigma should be in [2,%lu]\n", name,
+               TWO32 - *nb_curves - 1);
+      youpi = ECM_ERROR;
+      goto end_ecm_batch_curves;
+    }
+  firstsigma_ui = mpz_get_ui (firstsigma);
+
+  factors = (mpz_t *) malloc (*nb_curves * sizeof (mpz_t));
+  ASSERT_ALWAYS (factors != NULL);
+  array_found = (int *) malloc (*nb_curves * sizeof (int));
+  ASSERT_ALWAYS (array_found != NULL);
+  for (i = 0; i < *nb_curves; i++)
+    {
+      mpz_init (factors[i]);
+      array_found[i] = ECM_NO_FACTOR_FOUND;
+    }
+
+  print_B1_B2_poly (OUTPUT_NORMAL, ECM_ECM, B1, *B1done,  B2min_parm, B2min,
+                    B2, S, firstsigma, sigma_is_A, ECM_EC_TYPE_MONTGOMERY,
+                    go, param, *nb_curves);
+  outputf (OUTPUT_VERBOSE, "dF=%lu, k=%lu, d=%lu, d2=%lu, i0=%Zd\n",
+           dF, k, root_params.d1, root_params.d2, root_params.i0);
+
+  if (test_verbose (OUTPUT_VERBOSE))
+    {
+      if (mpz_cmp_d (B2min, B1) != 0)
+        {
+          outputf (OUTPUT_VERBOSE,
+            "Can't compute success probabilities for B1 <> B2min\n");
+        }
+      else
+        {
+          rhoinit (256, 10);
+          print_expcurves (B1, B2, dF, k, root_params.S, param);
+        }
+    }
+
+  /* Compute s */
+  if (B1 != *batch_last_B1_used || mpz_cmp_ui (batch_s, 1) <= 0)
+    {
+      st = cputime ();
+      batch_s_update (batch_s, B1, batch_last_B1_used, param);
+      outputf (OUTPUT_VERBOSE, "Computing batch product (of %" PRIu64
+                               " bits) of primes up to B1=%1.0f took %ldms\n",
+                               mpz_sizeinbase (batch_s, 2), B1, cputime () - st);
+    }
+
+  /* If using 2^k +/-1 or k*2^n+c modulus and 'nobase2step2' flag is set,
+     set default (-nobase2) modular method for stage 2, as in ecm () */
+  if ((modulus->repr == ECM_MOD_BASE2 || modulus->repr == ECM_MOD_KBNC ||
+       modulus->repr == ECM_MOD_DWT) && nobase2step2)
+    {
+      mpmod_clear (modulus);
+
+      repr = ECM_MOD_NOBASE2;
+      mpmod_init (modulus, n, repr); /* cannot fail for ECM_MOD_NOBASE2 */
+    }
+
+  stage2_params.modulus = modulus;
+  stage2_params.dF = dF;
+  stage2_params.k = k;
+  stage2_params.root_params = &root_params;
+  stage2_params.use_ntt = use_ntt;
+  stage2_params.TreeFilename = TreeFilename;
+  stage2_params.B2min = B2min;
+  stage2_params.B2 = B2;
+  stage2_params.stop_asap = stop_asap;
+
+  st = realtime ();
+  youpi = ecm_pipeline (factors, array_found, x, n, batch_s, *nb_curves,
+                        firstsigma_ui, backend, (mpz_cmp (B2, B2min) < 0)
+                        ? NULL : &stage2_params, nthreads, verbose, &st1,
+                        &st2);
+  if (youpi == ECM_ERROR)
+    goto end_ecm_batch_curves;
+  st = elltime (st, realtime ());
+
+  /* the backend prints the time of stage 1, and gives the one to count
+     for the expected time to find a factor */
+  st1 = backend->report (backend, factors, array_found, *nb_curves,
+                         firstsigma_ui, st1);
+
+  *B1done = B1;
+
+  if (mpz_cmp (B2, B2min) >= 0)
+    {
+      for (i = 0; i < *nb_curves; i++)
+        if (array_found[i] != ECM_NO_FACTOR_FOUND
+            && array_found[i] != ECM_FACTOR_FOUND_STEP1)
+          outputf (OUTPUT_NORMAL, "%sFactor %Zd found in Step 2 with"
+                   " curve %u (-sigma 3:%u)\n", name, factors[i], i,
+                   i + firstsigma_ui);
+      outputf (OUTPUT_NORMAL, "Computing %u Step 2 took %ldms\n", *nb_curves,
+               st2);
+      if (st2 > 0)
+        outputf (OUTPUT_VERBOSE, "Throughput: %.3f Step 2 per second ",
+                 1000.0 * (double) (*nb_curves) / (double) st2);
+      outputf (OUTPUT_VERBOSE, "(on average %.2fms per Step 2)\n",
+               (double) st2 / (double) (*nb_curves));
+      st1 += st2;
+    }
+  if (nthreads > 1)
+    outputf (OUTPUT_VERBOSE, "Both steps in %u threads took %ldms elapsed\n",
+             nthreads, st);
+
+  if (test_verbose (OUTPUT_VERBOSE) && mpz_cmp_d (B2min, B1) == 0
+      && youpi == ECM_NO_FACTOR_FOUND
+      && (stop_asap == NULL || !(*stop_asap)()))
+    print_exptime (B1, B2, dF, k, root_params.S, st1 / (long) *nb_curves,
+                   param);
+
+  reducefactors (factors, array_found, *nb_curves);
+
+  /* f = f0 + f1*n + .. + fk*n^k, where f0, ..., fk are the factors found
+     in stage 1 or 2, in the order in which they were found */
+  mpz_set_ui (f, 0);
+  for (i = 0; i < *nb_curves; i++)
+    if (array_found[*nb_curves-1-i] != ECM_NO_FACTOR_FOUND)
+      {
+        mpz_mul (f, f, n);
+        mpz_add (f, f, factors[*nb_curves-1-i]);
+      }
+
+end_ecm_batch_curves:
+  if (test_verbose (OUTPUT_VERBOSE) && mpz_cmp_d (B2min, B1) == 0)
+    rhoinit (1, 0); /* Free memory of rhotable */
+  mpz_clear (root_params.i0);
+  mpz_clear (B2);
+  mpz_clear (B2min);
+  if (factors != NULL)
+    for (i = 0; i < *nb_curves; i++)
+      mpz_clear (factors[i]);
+  free (array_found);
+  free (factors);
+  mpmod_clear (modulus);
+
+  return youpi;
+}
@@ -158,6 +158,8 @@ pm1_stage1 (mpz_t f, mpres_t a, mpmod_t n, double B1, double *B1done,
   long last_chkpnt_time;
   const double B0 = sqrt (B1);
   prime_info_t prime_info;
+  const ecm_uint *block;
+  ecm_uint b, nb;
 
   mpz_init (g);
   mpz_init (d);
@@ -270,8 +272,8 @@ pm1_stage1 (mpz_t f, mpres_t a, mpmod_t n, double B1, double *B1done,
     p = (double) getprime_mt (prime_info);
 
   /* then remaining primes > max(sqrt(B1), cascade_limit) and taken 
-     with exponent 1 */
-  for (; p <= B1; p = (double) getprime_mt (prime_info))
+     with exponent 1, which are read by blocks */
+  for (b = nb = 0; p <= B1; p = (double) block[b++])
   {
     mpz_mul_d (g, g, p, d);
     if (mpz_sizeinbase (g, 2) >= max_size)
@@ -293,6 +295,11 @@ pm1_stage1 (mpz_t f, mpres_t a, mpmod_t n, double B1, double *B1done,
             last_chkpnt_time = cputime ();
           }
       }
+    if (b == nb)
+      {
+        nb = getprimes_mt (prime_info, &block);
+        b = 0;
+      }
   }
 
   mpres_pow (a, a, g, n);
@@ -436,13 +443,18 @@ pm1 (mpz_t f, mpz_t p, mpz_t N, mpz_t go, double *B1done, double B1,
       if (use_ntt)
 	{
 	  unsigned long t;
+	  size_t disk = 0;
 	  /* See what transform length the NTT can handle (due to limited 
-	     primes and limited memory) */
+	     primes and limited memory). With a -treefile, the NTT vectors
+	     are stored on disk, which also limits the length. */
 	  t = mpzspm_max_len (N);
 	  lmax_NTT = MIN (lmax, t);
-	  if (maxmem != 0.)
+	  if (TreeFilename != NULL)
+	    disk = MAX (ecm_disk_free (TreeFilename), 1);
+	  if (maxmem != 0. || disk != 0)
 	    {
-	      t = pm1fs2_maxlen (double_to_size (maxmem), N, use_ntt);
+	      t = pm1fs2_maxlen ((maxmem != 0.) ? double_to_size (maxmem) : 
+				 SIZE_MAX, disk, N, use_ntt);
 	      lmax_NTT = MIN (lmax_NTT, t);
 	    }
 	  outputf (OUTPUT_DEVVERBOSE, "NTT can handle lmax <= %lu\n", lmax_NTT);
@@ -461,7 +473,7 @@ pm1 (mpz_t f, mpz_t p, mpz_t N, mpz_t go, double *B1done, double B1,
       if (maxmem != 0.)
 	{
 	  unsigned long t;
-	  t = pm1fs2_maxlen (double_to_size (maxmem), N, 0);
+	  t = pm1fs2_maxlen (double_to_size (maxmem), 0, N, 0);
 	  lmax_noNTT = MIN (lmax_noNTT, t);
 	  outputf (OUTPUT_DEVVERBOSE, "non-NTT can handle lmax <= %lu\n", 
 		   lmax_noNTT);
@@ -526,9 +538,14 @@ pm1 (mpz_t f, mpz_t p, mpz_t N, mpz_t go, double *B1done, double B1,
       mpz_clear (effB2_nontt);
       
       outputf (OUTPUT_VERBOSE, "Using lmax = %lu with%s NTT which takes "
-               "about %luMB of memory\n", params.l, 
+               "about %luMB of memory", params.l, 
                (use_ntt) ? "" : "out", 
-               pm1fs2_memory_use (params.l, N, use_ntt) / 1048576);
+               pm1fs2_memory_use (params.l, N, use_ntt, 
+                                  TreeFilename != NULL) / 1048576);
+      if (use_ntt && TreeFilename != NULL)
+        outputf (OUTPUT_VERBOSE, " and %luMB of disk", 
+                 pm1fs2_disk_use (params.l, N) / 1048576);
+      outputf (OUTPUT_VERBOSE, "\n");
     }
   
   /* Print B1, B2, polynomial and x0 */
@@ -30,6 +30,7 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #include <limits.h>
 #include "ecm-impl.h"
 #include "sp.h"
+#include "listz_handle.h"
 #include <math.h>
 #ifdef HAVE_ALLOCA_H
 #include <alloca.h>
@@ -43,7 +44,7 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 
 /* TODO:
    - move functions into their proper files (i.e. NTT functions etc.)
-   - later: allow storing NTT vectors on disk
+   - allow storing NTT vectors on disk for P+1, too
 */
 
 /* Define TEST_ZERO_RESULT to test if any result of the multipoint
@@ -51,6 +52,15 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
    happening might indicate a problem in the evalutaion code */
 #define TEST_ZERO_RESULT
 
+/* Number of coefficients per prime that are converted and read or written 
+   at a time when NTT vectors are stored on disk */
+#define NTT_FILE_BLOCK 4096
+
+/* Each thread of ntt_gcd_thread() takes a gcd of its partial product 
+   after about this many residues, so that a factor stops the stage 2 
+   early. A gcd costs much less than this many modular multiplications. */
+#define NTT_GCD_CHECKPOINT 65536
+
 const int pari = 0;
 
 const unsigned long Pvalues[] = {
@@ -161,8 +171,157 @@ const unsigned long phiPfactors[] = {2UL, 3UL, 5UL, 7UL, 11UL, 13UL,
 #ifndef _OPENMP
 static int omp_get_num_threads () {return 1;}
 static int omp_get_thread_num () {return 0;}
+static int omp_get_max_threads () {return 1;}
 #endif
 
+/* Coefficients that are written to a mpzspv_file_t one at a time are 
+   collected in NTT-ready format in buf, and written out every 
+   NTT_FILE_BLOCK coefficients. With file == NULL, nothing is written. */
+typedef struct {
+  mpzspv_file_t file;
+  mpzspv_t buf;
+  spv_size_t offset; /* Position in file of buf[][0] */
+  spv_size_t fill;
+} ntt_file_writer_t;
+
+/* The loops of the fast stage 2 run in OpenMP parallel regions. The 
+   OpenMP run-time keeps its threads alive from one region to the next, 
+   and a fs2_pool_t does the same for their state: each thread gets a 
+   private copy of the modulus and temporaries once per stage 2, and 
+   remembers the starting values of its part of the g_i sequence so that 
+   the next multi-point evaluation can reuse them. */
+typedef struct {
+  mpmod_t modulus;   /* Private copy of the modulus */
+  mpz_t t;
+  mpres_t r[3];
+  listz_t R;         /* Rlen entries for ntt_gcd_thread(), or NULL */
+  unsigned long Rlen;
+  mpzspv_t block;    /* NTT_FILE_BLOCK residues for ntt_gcd_thread(), 
+                        or NULL */
+  spv_t spv[2];      /* spv_len residues each for the NTT vectors on disk */
+  spv_size_t spv_len;
+  /* The part of the g_i sequence of this thread, and the values for it 
+     that do not depend on k_2, see pm1_sequence_g_thread(). g_len == 0 
+     if they are not set. */
+  unsigned long g_offset, g_len;
+  mpres_t g_r[3];
+  mpres_t prod;      /* Partial product of ntt_gcd_thread() */
+} fs2_worker_t;
+
+typedef struct {
+  int nr;              /* Number of workers */
+  fs2_worker_t *w;     /* Worker i is used by thread number i */
+  mpzspm_t ntt_context; /* NTT context for the workers' vectors, or NULL */
+  /* Set by the first checkpoint of ntt_gcd_thread() that finds a factor: 
+     the factor, the partial product of the partial_len residues it was 
+     taken of, and the residues [found_start, found_end[ since the 
+     previous checkpoint of that thread */
+  int found;
+  mpz_t factor;
+  mpres_t partial;
+  unsigned long partial_len, found_start, found_end;
+} fs2_pool_t;
+
+static fs2_pool_t *
+fs2_pool_init (mpmod_t modulus, const mpzspm_t ntt_context)
+{
+  fs2_pool_t *pool;
+  int i;
+
+  pool = (fs2_pool_t *) malloc (sizeof (fs2_pool_t));
+  ASSERT_ALWAYS (pool != NULL);
+  pool->nr = omp_get_max_threads ();
+  pool->w = (fs2_worker_t *) malloc (pool->nr * sizeof (fs2_worker_t));
+  ASSERT_ALWAYS (pool->w != NULL);
+  pool->ntt_context = ntt_context;
+  pool->found = 0;
+  mpz_init (pool->factor);
+  mpres_init (pool->partial, modulus);
+
+  for (i = 0; i < pool->nr; i++)
+    {
+      fs2_worker_t *w = pool->w + i;
+      int k;
+
+      mpmod_init_set (w->modulus, modulus);
+      mpz_init (w->t);
+      for (k = 0; k < 3; k++)
+	{
+	  mpres_init (w->r[k], w->modulus);
+	  mpres_init (w->g_r[k], w->modulus);
+	}
+      mpres_init (w->prod, w->modulus);
+      w->R = NULL;
+      w->Rlen = 0;
+      w->block = NULL;
+      w->spv[0] = w->spv[1] = NULL;
+      w->spv_len = 0;
+      w->g_offset = w->g_len = 0;
+    }
+
+  return pool;
+}
+
+static void
+fs2_pool_clear (fs2_pool_t *pool, mpmod_t modulus)
+{
+  int i;
+
+  for (i = 0; i < pool->nr; i++)
+    {
+      fs2_worker_t *w = pool->w + i;
+      int k;
+
+      if (w->R != NULL)
+	clear_list (w->R, w->Rlen);
+      if (w->block != NULL)
+	mpzspv_clear (w->block, pool->ntt_context);
+      sp_aligned_free (w->spv[0]);
+      sp_aligned_free (w->spv[1]);
+      for (k = 0; k < 3; k++)
+	{
+	  mpres_clear (w->r[k], w->modulus);
+	  mpres_clear (w->g_r[k], w->modulus);
+	}
+      mpres_clear (w->prod, w->modulus);
+      mpz_clear (w->t);
+      mpmod_clear (w->modulus);
+    }
+  mpz_clear (pool->factor);
+  mpres_clear (pool->partial, modulus);
+  free (pool->w);
+  free (pool);
+}
+
+/* The worker of the calling thread */
+static fs2_worker_t *
+fs2_pool_worker (fs2_pool_t *pool)
+{
+  const int i = omp_get_thread_num ();
+
+  ASSERT_ALWAYS (i < pool->nr);
+  return pool->w + i;
+}
+
+/* Two vectors of at least len residues each for the calling thread */
+static spv_t *
+fs2_worker_spv (fs2_worker_t *w, const spv_size_t len)
+{
+  int k;
+
+  if (w->spv_len < len)
+    {
+      for (k = 0; k < 2; k++)
+	{
+	  sp_aligned_free (w->spv[k]);
+	  w->spv[k] = (spv_t) sp_aligned_malloc (len * sizeof (sp_t));
+	  ASSERT_ALWAYS (w->spv[k] != NULL);
+	}
+      w->spv_len = len;
+    }
+  return w->spv;
+}
+
 static void 
 ntt_sqr_reciprocal (mpzv_t, const mpzv_t, mpzspv_t, const spv_size_t, 
 		    const mpzspm_t);
@@ -227,9 +386,28 @@ ntt_coeff_mem (const unsigned long lmax, const mpz_t modulus, const int twice)
 
 size_t
 pm1fs2_memory_use (const unsigned long lmax, const mpz_t modulus, 
-		   const int use_ntt)
+		   const int use_ntt, const int on_disk)
 {
-  if (use_ntt)
+  if (use_ntt && on_disk)
+    {
+      /* The NTT vectors of g and of the DCT-I of h are on disk, see
+	 pm1fs2_disk_use(). F is written to disk as it is built, which 
+	 takes s_1/4 coefficients for F (when 4 divides s_1), s_1 for tmp
+	 and s_1/2 in NTT-ready format for F_ntt. After that,
+	 each thread keeps 2*lmax sp_t's for one prime of g and h, and 
+	 3*lmax more for the buffers of the iterators that read the next
+	 ones. Assume s_1 is close to lmax/2. */
+      
+      size_t n, m;
+      
+      m = mpz_size (modulus) * sizeof (mp_limb_t) + sizeof (mpz_t);
+      n = 5 * m * (lmax / 8) + ntt_coeff_mem (lmax, modulus, 0) * (lmax / 4)
+	  + (size_t) omp_get_max_threads () * sizeof (sp_t) * (5 * lmax);
+      outputf (OUTPUT_DEVVERBOSE, "pm1fs2_memory_use: Estimated memory use "
+	       "with lmax = %lu NTT on disk is %lu bytes\n", lmax, n);
+      return n;
+    }
+  else if (use_ntt)
     {
       /* We store lmax / 2 + 1 coefficients for the DCT-I of F and lmax 
 	 coefficients for G in NTT ready format. Each coefficient in 
@@ -271,12 +449,41 @@ pm1fs2_memory_use (const unsigned long lmax, const mpz_t modulus,
     }
 }
 
-/* return the possible lmax for given memory use and modulus */
+/* Disk space in bytes that the NTT code takes for transform length lmax 
+   when it stores the NTT vectors on disk. */
+
+size_t
+pm1fs2_disk_use (const unsigned long lmax, const mpz_t modulus)
+{
+  /* lmax/2 + 1 coefficients for the DCT-I of h and lmax for g, in NTT-ready 
+     format, and s_1/2 + 1 residues for F */
+  return ntt_coeff_mem (lmax, modulus, 0) * (size_t) (3 * lmax / 2 + 1)
+    + mpz_size (modulus) * sizeof (mp_limb_t) * (size_t) (lmax / 4 + 1);
+}
+
+/* return the possible lmax for given memory use and modulus. If disk != 0,
+   the NTT code stores its vectors in files, and may use disk bytes 
+   for them. */
 
 unsigned long
-pm1fs2_maxlen (const size_t memory, const mpz_t modulus, const int use_ntt)
+pm1fs2_maxlen (const size_t memory, const size_t disk, const mpz_t modulus, 
+	       const int use_ntt)
 {
-  if (use_ntt)
+  if (use_ntt && disk != 0)
+    {
+      size_t n, m, lmax;
+
+      m = mpz_size (modulus) * sizeof (mp_limb_t) + sizeof (mpz_t);
+      n = ntt_coeff_mem (1, modulus, 0);
+      /* See pm1fs2_memory_use() and pm1fs2_disk_use() */
+      lmax = memory / (5 * m / 8 + n / 4 + (size_t) omp_get_max_threads () 
+		       * sizeof (sp_t) * 5);
+      lmax = MIN (lmax, disk / (3 * n / 2 + m / 4));
+      if (lmax == 0)
+	return 0;
+      return 1UL << (ceil_log2 (lmax + 1) - 1); /* Rounded down to power of 2 */
+    }
+  else if (use_ntt)
     {
       size_t n, lmax = 1;
   
@@ -300,12 +507,27 @@ pm1fs2_maxlen (const size_t memory, const mpz_t modulus, const int use_ntt)
 
 size_t 
 pp1fs2_memory_use (const unsigned long lmax, const mpz_t modulus, 
-		   const int use_ntt, const int twopass)
+		   const int use_ntt, const int twopass, const int on_disk)
 {
   size_t n, m;
   
   m = mpz_size (modulus) * sizeof (mp_limb_t) + sizeof (mpz_t);
-  if (use_ntt)
+  if (use_ntt && on_disk)
+    {
+      /* The NTT vectors of g_x, g_y and of the DCT-I of h_x, h_y are on 
+	 disk, see pp1fs2_disk_use(). F is built as in pm1fs2_memory_use().
+	 After that, each thread keeps 2*lmax sp_t's for one prime of g_x 
+	 and g_y, and 6*lmax more for the buffers of the iterators that 
+	 read the next ones of g_x, g_y, h_x and h_y. Only the one pass 
+	 variant stores its vectors on disk. */
+
+      n = 5 * m * (lmax / 8) + ntt_coeff_mem (lmax, modulus, 0) * (lmax / 4)
+	  + (size_t) omp_get_max_threads () * sizeof (sp_t) * (8 * lmax);
+      outputf (OUTPUT_DEVVERBOSE, "pp1fs2_memory_use: Estimated memory use "
+	       "with lmax = %lu NTT on disk is %lu bytes\n", lmax, n);
+      return n;
+    }
+  else if (use_ntt)
     {
       /* In one pass mode, we store h_x_ntt and h_y_ntt, each of length 
 	 lmax/2(+1), and g_x_ntt and g_y_ntt, each of length lmax, all in 
@@ -342,14 +564,45 @@ pp1fs2_memory_use (const unsigned long lmax, const mpz_t modulus,
     }
 }
 
+/* Disk space in bytes that the one pass NTT code takes for transform 
+   length lmax when it stores the NTT vectors on disk. */
+
+size_t
+pp1fs2_disk_use (const unsigned long lmax, const mpz_t modulus)
+{
+  /* lmax/2 + 1 coefficients each for the DCT-I of h_x and h_y, lmax each
+     for g_x and g_y, in NTT-ready format for 2*modulus, and s_1/2 + 1 
+     residues for F */
+  return ntt_coeff_mem (lmax, modulus, 1) * (size_t) (3 * lmax + 2)
+    + mpz_size (modulus) * sizeof (mp_limb_t) * (size_t) (lmax / 4 + 1);
+}
+
+/* return the possible lmax for given memory use and modulus. If disk != 0,
+   the NTT code stores its vectors in files, and may use disk bytes for 
+   them; this is done by the one pass variant only. */
+
 unsigned long 
-pp1fs2_maxlen (const size_t memory, const mpz_t modulus, const int use_ntt, 
-	       const int twopass)
+pp1fs2_maxlen (const size_t memory, const size_t disk, const mpz_t modulus, 
+	       const int use_ntt, const int twopass)
 {
   size_t n, m;
   
   m = mpz_size (modulus) * sizeof (mp_limb_t) + sizeof (mpz_t);
-  if (use_ntt)
+  if (use_ntt && disk != 0)
+    {
+      size_t lmax;
+
+      ASSERT_ALWAYS (!twopass);
+      n = ntt_coeff_mem (1, modulus, 1);
+      /* See pp1fs2_memory_use() and pp1fs2_disk_use() */
+      lmax = memory / (5 * m / 8 + n / 4 + (size_t) omp_get_max_threads () 
+		       * sizeof (sp_t) * 8);
+      lmax = MIN (lmax, disk / (3 * n + m / 4));
+      if (lmax == 0)
+	return 0;
+      return 1UL << (ceil_log2 (lmax + 1) - 1); /* Rounded down to power of 2 */
+    }
+  else if (use_ntt)
     {
       n = ntt_coeff_mem (1, modulus, !twopass);
       if (twopass)
@@ -1351,24 +1604,53 @@ scale_by_chebyshev (listz_t R, const listz_t F, const unsigned long len,
 }
 
 
+/* Set r to the coefficient of V_i(Y), Y = X + 1/X, in (X - 1/X)^2 H(X), 
+   where H(X) = h_0 + \sum_{j=1}^{n} h_j V_j(Y) and h_j is in H[j]. As 
+   (X - 1/X)^2 = V_2(Y) - 2 and V_2(Y) V_j(Y) = V_{j+2}(Y) + V_{|j-2|}(Y),
+   this is h_{|i-2|} - 2 h_i + h_{i+2}, where h_j = 0 for j > n. */
+
+static void
+scale_V_term (mpz_t r, const listz_t H, const unsigned long n, 
+              const unsigned long i)
+{
+  const unsigned long k = (i >= 2UL) ? i - 2UL : 2UL - i;
+
+  if (k <= n)
+    mpz_set (r, H[k]);
+  else
+    mpz_set_ui (r, 0UL);
+  if (i <= n)
+    mpz_submul_ui (r, H[i], 2UL);
+  if (i + 2UL <= n)
+    mpz_add (r, r, H[i + 2UL]);
+}
+
+
 /* For a given reciprocal polynomial 
    F(x) = f_0 + sum_{i=1}^{deg} f_i V_i(x+1/x),
    compute F(\gamma x)F(\gamma^{-1} x), with Q = \gamma + 1 / \gamma
 
    If NTT is used, needs 4 * deg + 3 entries in tmp.
    If no NTT is used, needs 4 * deg + 2 + (memory use of list_sqr_reciprocal)
+   If R_handle != NULL, the 2 * deg + 1 coefficients of the result are 
+   written to R_handle instead of R. G(x)^2 is kept there while H(x)^2 is
+   computed, so that both need only 2 * deg + 1 entries of tmp rather 
+   than 4 * deg + 2, plus 2 more with NTT.
+   The threads use the workers in pool.
 */
 
 static void
-list_scale_V (listz_t R, const listz_t F, const mpres_t Q, 
-              const unsigned long deg, mpmod_t modulus, listz_t tmp, 
-              const unsigned long tmplen, 
-	      mpzspv_t dct, const mpzspm_t ntt_context)
+list_scale_V (listz_t R, listz_handle_t R_handle, const listz_t F, 
+              const mpres_t Q, const unsigned long deg, mpmod_t modulus, 
+              listz_t tmp, const unsigned long tmplen, 
+	      mpzspv_t dct, const mpzspm_t ntt_context, fs2_pool_t *pool)
 {
   mpres_t Vt;
   unsigned long i;
-  const listz_t G = tmp, H = tmp + 2 * deg + 1, newtmp = tmp + 4 * deg + 2;
-  const unsigned long newtmplen = tmplen - 4 * deg - 2;
+  const unsigned long Gmem = (R_handle == NULL) ? 4 * deg + 2 : 2 * deg + 1;
+  const listz_t G = tmp, newtmp = tmp + Gmem;
+  const listz_t H = (R_handle == NULL) ? tmp + 2 * deg + 1 : tmp;
+  const unsigned long newtmplen = tmplen - Gmem;
 #ifdef WANT_ASSERT
   mpz_t leading;
 #endif
@@ -1377,12 +1659,21 @@ list_scale_V (listz_t R, const listz_t F, const mpres_t Q,
     {
       ASSERT(tmplen >= 1);
       mpz_mul (tmp[0], F[0], F[0]);
-      mpz_mod (R[0], tmp[0], modulus->orig_modulus);
+      if (R_handle != NULL)
+        {
+          listz_iterator_t *iter = listz_iterator_init (R_handle, 0);
+          ASSERT_ALWAYS (iter != NULL);
+          mpz_mod (tmp[0], tmp[0], modulus->orig_modulus);
+          listz_iterator_write (iter, tmp[0]);
+          listz_iterator_clear (iter);
+        }
+      else
+        mpz_mod (R[0], tmp[0], modulus->orig_modulus);
       return;
     }
   
   /* Make sure newtmplen does not underflow */
-  ASSERT_ALWAYS (tmplen >= 4 * deg + 2);
+  ASSERT_ALWAYS (tmplen >= Gmem);
 #ifdef WANT_ASSERT
   mpz_init (leading);
   mpz_mul (leading, F[deg], F[deg]);
@@ -1408,9 +1699,9 @@ list_scale_V (listz_t R, const listz_t F, const mpres_t Q,
   {
     const int nr_chunks = omp_get_num_threads();
     const int thread_nr = omp_get_thread_num();
-    mpmod_t modulus_local;
+    fs2_worker_t *w = fs2_pool_worker (pool);
+    mpz_ptr Vi = w->r[0], Vi_1 = w->r[1];
     unsigned long l, start_i;
-    mpres_t Vi, Vi_1;
     
     l = (deg - 1) / nr_chunks + 1; /* l = ceil (deg / nr_chunks) */
     start_i = thread_nr * l + 1;
@@ -1419,20 +1710,12 @@ list_scale_V (listz_t R, const listz_t F, const mpres_t Q,
     else
       l = 0;
 
-    mpmod_init_set (modulus_local, modulus);
-    mpres_init (Vi_1, modulus_local);
-    mpres_init (Vi, modulus_local);
-    
-    V (Vi, Q, start_i, modulus_local);
-    mpres_div_2exp (Vi, Vi, 1, modulus_local);
-    V (Vi_1, Q, start_i - 1UL, modulus_local);
-    mpres_div_2exp (Vi_1, Vi_1, 1, modulus_local);
-    scale_by_chebyshev (G + start_i, F + start_i, l, modulus_local, 
+    V (Vi, Q, start_i, w->modulus);
+    mpres_div_2exp (Vi, Vi, 1, w->modulus);
+    V (Vi_1, Q, start_i - 1UL, w->modulus);
+    mpres_div_2exp (Vi_1, Vi_1, 1, w->modulus);
+    scale_by_chebyshev (G + start_i, F + start_i, l, w->modulus, 
                         Q, Vi_1, Vi);
-    
-    mpres_clear (Vi_1, modulus_local);
-    mpres_clear (Vi, modulus_local);
-    mpmod_clear (modulus_local);
   }
 
 
@@ -1465,6 +1748,19 @@ list_scale_V (listz_t R, const listz_t F, const mpres_t Q,
   list_output_poly (G, 2 * deg + 1, 0, 1, "/* list_scale_V */ G(x)^2 == ", 
 		    "\n", OUTPUT_TRACE);
 
+  if (R_handle != NULL)
+    {
+      /* Keep G(x)^2 in R_handle, H overwrites it in tmp */
+      listz_iterator_t *iter = listz_iterator_init (R_handle, 0);
+      ASSERT_ALWAYS (iter != NULL);
+      for (i = 0; i <= 2 * deg; i++)
+        {
+          mpz_mod (G[i], G[i], modulus->orig_modulus);
+          listz_iterator_write (iter, G[i]);
+        }
+      listz_iterator_clear (iter);
+    }
+
   /* Compute H[i-1] = U_i(Q)/2 * F[i] for i = 1, ..., deg */
 
 #if defined(_OPENMP)
@@ -1473,9 +1769,9 @@ list_scale_V (listz_t R, const listz_t F, const mpres_t Q,
   {
     const int nr_chunks = omp_get_num_threads();
     const int thread_nr = omp_get_thread_num();
-    mpmod_t modulus_local;
+    fs2_worker_t *w = fs2_pool_worker (pool);
+    mpz_ptr Ui = w->r[0], Ui_1 = w->r[1];
     unsigned long l, start_i;
-    mpres_t Ui, Ui_1;
     
     l = (deg - 1) / nr_chunks + 1; /* l = ceil(deg / nr_chunks) */
     start_i = thread_nr * l + 1UL;
@@ -1484,20 +1780,12 @@ list_scale_V (listz_t R, const listz_t F, const mpres_t Q,
     else
       l = 0;
     
-    mpmod_init_set (modulus_local, modulus);
-    mpres_init (Ui_1, modulus_local);
-    mpres_init (Ui, modulus_local);
-    
-    U (Ui_1, Ui, Q, start_i - 1, modulus_local);
-    mpres_div_2exp (Ui, Ui, 1, modulus_local);
-    mpres_div_2exp (Ui_1, Ui_1, 1, modulus_local);
+    U (Ui_1, Ui, Q, start_i - 1, w->modulus);
+    mpres_div_2exp (Ui, Ui, 1, w->modulus);
+    mpres_div_2exp (Ui_1, Ui_1, 1, w->modulus);
     
-    scale_by_chebyshev (H - 1 + start_i, F + start_i, l, modulus_local, 
+    scale_by_chebyshev (H - 1 + start_i, F + start_i, l, w->modulus, 
                         Q, Ui_1, Ui);
-    
-    mpres_clear (Ui_1, modulus_local);
-    mpres_clear (Ui, modulus_local);
-    mpmod_clear (modulus_local);
   }
 
   
@@ -1582,72 +1870,35 @@ list_scale_V (listz_t R, const listz_t F, const mpres_t Q,
 
 
   /* Multiply by (X - 1/X)^2 = X^2 - 2 + 1/X^2 and subtract from G */
-  ASSERT (newtmplen > 0UL);
-  if (deg == 1)
+  ASSERT (newtmplen > ((R_handle != NULL) ? 1UL : 0UL));
+  if (R_handle != NULL)
     {
-      /* H(X) has degree 2*deg-2 = 0, so H(X) = h_0
-	 H(X) * (X - 1/X)^2 = -2 h_0 + h_0 V_2(Y)  */
-      mpz_mul_2exp (newtmp[0], H[0], 1UL);
-      mpz_add (G[0], G[0], newtmp[0]); /* G[0] -= -2*H[0] */
-      mpz_sub (G[2], G[2], H[0]);
+      /* Update the coefficients of G(x)^2 in R_handle in place */
+      listz_iterator_t *iter = listz_iterator_init (R_handle, 0);
+      ASSERT_ALWAYS (iter != NULL);
+      for (i = 0; i <= 2 * deg; i++)
+        {
+          listz_iterator_read (iter, newtmp[1]);
+          scale_V_term (newtmp[0], H, 2 * deg - 2, i);
+          mpz_sub (newtmp[1], newtmp[1], newtmp[0]);
+          mpz_mod (newtmp[1], newtmp[1], modulus->orig_modulus);
+          listz_iterator_write (iter, newtmp[1]);
+          outputf (OUTPUT_TRACE, "list_scale_V: R[%lu] = %Zd\n", i, 
+                   newtmp[1]);
+        }
+      listz_iterator_clear (iter);
+#ifdef WANT_ASSERT
+      ASSERT (mpz_cmp (leading, newtmp[1]) == 0);
+      mpz_clear (leading);
+#endif
+      mpres_clear (Vt, modulus);
+      return;
     }
-  else if (deg == 2)
-    {
-      /* H(X) has degree 2*deg-2 = 2, , so 
-	 H(X) = h_0 + h_1 (X+1/X) + h_2 (X^2+1/X^2)
-
-	 H(X) * (X - 1/X)^2 =
-	 -2*(h_0 - h_2) - h_1 * V_1(Y) + (h_0 - 2*h_2) * V_2(Y) + 
-	 h_1 * V_3(Y) + h_2 * V_4(Y)
-      */
-      mpz_sub (newtmp[0], H[0], H[2]);          /* h_0 - h_2 */
-      mpz_mul_2exp (newtmp[0], newtmp[0], 1UL); /* 2*(h_0 - h_2) */
-      mpz_add (G[0], G[0], newtmp[0]);          /* G[0] -= -2*(h_0 - h_2) */
 
-      mpz_add (G[1], G[1], H[1]);               /* G[1] -= -h_1 */
-      mpz_sub (newtmp[0], newtmp[0], H[0]);     /* h_0 - 2*h_2 */
-      mpz_sub (G[2], G[2], newtmp[0]);          /* G[2] -= h_0 - 2*h_2 */
-      mpz_sub (G[3], G[3], H[1]);               /* G[3] -= h_1 */
-      mpz_sub (G[4], G[4], H[2]);               /* G[3] -= h_2 */
-    }
-  else
+  for (i = 0; i <= 2 * deg; i++)
     {
-      /* Let H(X) = h_0 + \sum_{i=1}^{n} h_i V_i(Y), Y = X+1/X. Then
-	 (x - 1/x)^2 H(X) = 
-	 -2(h_0 - h_2) +
-	 (- h_1 + h_3) V_1(Y) +
-	 \sum_{i=2}^{n-2} (h_{i-2} - 2h_i + h_{i+2}) V_i(Y) +
-	 (h_{n-3} - 2h_{n-1}) V_{n-1}(Y) +
-	 (h_{n-2} - 2h_n) V_n(Y) +
-	 h_{n-1} V_{n+1}(Y) +
-	 h_n V_{n+2}(Y)
-	 
-	 In our case, n = 2 * deg - 2
-      */
-      mpz_sub (newtmp[0], H[0], H[2]);
-      mpz_mul_2exp (newtmp[0], newtmp[0], 1UL); /* t[0] = 2*(h_0 - h_2) */
-      mpz_add (G[0], G[0], newtmp[0]);          /* G[0] -= -2*(h_0 - h_2) */
-      
-      mpz_add (G[1], G[1], H[1]);
-      mpz_sub (G[1], G[1], H[3]); /* G[1] -= -h_1 + h_3 */
-      
-      for (i = 2; i <= 2 * deg - 4; i++)
-	{
-	  mpz_mul_2exp (newtmp[0], H[i], 1);
-	  mpz_sub (newtmp[0], newtmp[0], H[i - 2]);
-	  mpz_sub (newtmp[0], newtmp[0], H[i + 2]); /* 2h_i-h_{i-2}-h_{i+2} */
-	  mpz_add (G[i], G[i], newtmp[0]); /* G[i] -= -2h_i+h_{i-2}+h_{i+2} */
-	}
-      
-      for ( ; i <= 2 * deg - 2; i++)
-	{
-	  mpz_mul_2exp (newtmp[0], H[i], 1UL);
-	  mpz_sub (newtmp[0], H[i - 2], newtmp[0]); /* h_{n-3} - 2h_{n-1} */
-	  mpz_sub (G[i], G[i], newtmp[0]);
-	}
-      
-      mpz_sub (G[i], G[i], H[i - 2]);
-      mpz_sub (G[i + 1], G[i + 1], H[i - 1]);
+      scale_V_term (newtmp[0], H, 2 * deg - 2, i);
+      mpz_sub (G[i], G[i], newtmp[0]);
     }
 
   for (i = 0; i <= 2 * deg; i++)
@@ -1785,17 +2036,34 @@ mem_poly_from_sets_V (sets_long_t *sets)
   return maxmem;
 }
 
+/* Returns 1 if the last step of poly_from_sets_V() squares, i.e., if its
+   last set has cardinality 2, so that it can write the polynomial to 
+   F_handle while it computes it. The sets are processed back-to-front, 
+   but for the first one, so the last one is the second set. */
+
+static int
+poly_from_sets_V_streams (sets_long_t *sets)
+{
+  return sets->nr > 1UL && sets_nextset (sets->sets)->card == 2UL;
+}
+
 /* Build a polynomial with roots r^2i, i in the sumset of the sets in "sets".
    The parameter Q = r + 1/r. This code uses the fact that the polynomials 
    are symmetric. Requires that the first set in "sets" has cardinality 2,
    all sets must be symmetric around 0. The resulting polynomial of degree 
    2*d is F(x) = f_0 + \sum_{1 <= i <= d} f_i (x^i + 1/x^i). The coefficient
-   f_i is stored in F[i], which therefore needs d+1 elements. */
+   f_i is stored in F[i], which therefore needs d+1 elements. 
+   If F_handle != NULL, the d+1 coefficients, reduced mod N, go to F_handle
+   instead. If poly_from_sets_V_streams (sets), the last step writes them 
+   there directly, and F needs only d/2+2 elements (or as many as 
+   mem_poly_from_sets_V() says, if that is more). Otherwise they are 
+   copied from F. */
 
 static unsigned long
-poly_from_sets_V (listz_t F, const mpres_t Q, sets_long_t *sets, 
-		  listz_t tmp, const unsigned long tmplen, mpmod_t modulus,
-		  mpzspv_t dct, const mpzspm_t ntt_context)
+poly_from_sets_V (listz_t F, listz_handle_t F_handle, const mpres_t Q, 
+		  sets_long_t *sets, listz_t tmp, const unsigned long tmplen, 
+		  mpmod_t modulus, mpzspv_t dct, const mpzspm_t ntt_context, 
+		  fs2_pool_t *pool)
 {
   unsigned long c, deg, i, nr;
   set_long_t *set = sets->sets;
@@ -1855,8 +2123,17 @@ poly_from_sets_V (listz_t F, const mpres_t Q, sets_long_t *sets,
 	  ASSERT_ALWAYS (set->elem[0] == -set->elem[c - 1]);
 	  V (Qt, Q, set->elem[0], modulus);
 	  V (Qt, Qt, 2UL, modulus);
-	  list_scale_V (F, F, Qt, deg, modulus, tmp, tmplen, dct, 
-	                ntt_context);
+	  if (F_handle != NULL && nr == 1UL)
+	    {
+	      /* The last set, write the result to F_handle */
+	      list_scale_V (NULL, F_handle, F, Qt, deg, modulus, tmp, tmplen,
+			    dct, ntt_context, pool);
+	      deg *= 2UL;
+	      F_handle = NULL;
+	      continue;
+	    }
+	  list_scale_V (F, NULL, F, Qt, deg, modulus, tmp, tmplen, dct, 
+	                ntt_context, pool);
 	  deg *= 2UL;
 	  ASSERT_ALWAYS (mpz_cmp_ui (F[deg], 1UL) == 0); /* Check it's monic */
 	}
@@ -1874,8 +2151,8 @@ poly_from_sets_V (listz_t F, const mpres_t Q, sets_long_t *sets,
 	      V (Qt, Q, set->elem[i], modulus);
 	      V (Qt, Qt, 2UL, modulus);
 	      ASSERT (mpz_cmp_ui (F[deg], 1UL) == 0); /* Check it's monic */
-	      list_scale_V (F + (2UL * i + 1UL) * (deg + 1UL), F, Qt, deg, 
-	                    modulus, tmp, tmplen, dct, ntt_context);
+	      list_scale_V (F + (2UL * i + 1UL) * (deg + 1UL), NULL, F, Qt, 
+	                    deg, modulus, tmp, tmplen, dct, ntt_context, pool);
 	      ASSERT (mpz_cmp_ui (F[(2UL * i + 1UL) * (deg + 1UL) + 2UL * deg], 
 	              1UL) == 0); /* Check it's monic */
 	    }
@@ -1914,12 +2191,29 @@ poly_from_sets_V (listz_t F, const mpres_t Q, sets_long_t *sets,
   mpres_clear (Qt, modulus);
   outputf (OUTPUT_DEVVERBOSE, ")");
 
+  if (F_handle != NULL)
+    {
+      /* The last step did not write to F_handle, copy F there */
+      listz_iterator_t *iter = listz_iterator_init (F_handle, 0);
+      ASSERT_ALWAYS (iter != NULL);
+      for (i = 0; i <= deg; i++)
+	{
+	  mpz_mod (F[i], F[i], modulus->orig_modulus);
+	  listz_iterator_write (iter, F[i]);
+	}
+      listz_iterator_clear (iter);
+    }
+
   return deg;
 }
 
+/* Build F with poly_from_sets_V(), in F or, if F_handle != NULL, in 
+   F_handle */
+
 static int
-build_F_ntt (listz_t F, const mpres_t P_1, sets_long_t *S_1,
-	     const faststage2_param_t *params, mpmod_t modulus)
+build_F_ntt (listz_t F, listz_handle_t F_handle, const mpres_t P_1, 
+	     sets_long_t *S_1, const faststage2_param_t *params, 
+	     mpmod_t modulus, fs2_pool_t *pool)
 {
   mpzspm_t F_ntt_context;
   mpzspv_t F_ntt;
@@ -1953,13 +2247,16 @@ build_F_ntt (listz_t F, const mpres_t P_1, sets_long_t *S_1,
   tmp = init_list2 (tmplen, (unsigned int) abs (modulus->bits));
   F_ntt = mpzspv_init (1UL << ceil_log2 (params->s_1 / 2 + 1), F_ntt_context);
 
-  i = poly_from_sets_V (F, P_1, S_1, tmp, tmplen, modulus, F_ntt,
-                        F_ntt_context);
+  i = poly_from_sets_V (F, F_handle, P_1, S_1, tmp, tmplen, modulus, F_ntt,
+                        F_ntt_context, pool);
   ASSERT_ALWAYS(2 * i == params->s_1);
-  ASSERT_ALWAYS(mpz_cmp_ui (F[i], 1UL) == 0);
+  ASSERT_ALWAYS(F_handle != NULL || mpz_cmp_ui (F[i], 1UL) == 0);
   
   print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
-  if (test_verbose (OUTPUT_TRACE))
+  if (F_handle != NULL)
+    listz_handle_output_poly (F_handle, params->s_1 / 2 + 1, 0, 1, 
+			      "f(x) = ", "/* PARI */ \n", OUTPUT_TRACE);
+  else if (test_verbose (OUTPUT_TRACE))
     {
       for (i = 0; i < params->s_1 / 2 + 1; i++)
 	outputf (OUTPUT_TRACE, "f_%lu = %Zd; /* PARI */\n", i, F[i]);
@@ -1979,184 +2276,187 @@ build_F_ntt (listz_t F, const mpres_t P_1, sets_long_t *S_1,
   return 0;
 }
 
-/* Compute g_i = x_0^{M-i} * r^{(M-i)^2} for 0 <= i < l. 
-   x_0 = b_1^{2*k_2 + (2*m_1 + 1) * P}. r = b_1^P. 
-   Stores the result in g[0 ... l] and/or in g_ntt[offset ... offset + l] */
-
 static void
-pm1_sequence_g (listz_t g_mpz, mpzspv_t g_ntt, const mpres_t b_1, 
-                const unsigned long P, const long M_param, 
-		const unsigned long l_param, const mpz_t m_1, const long k_2, 
-		mpmod_t modulus_param, const mpzspm_t ntt_context)
+ntt_file_writer_init (ntt_file_writer_t *w, mpzspv_file_t file, 
+		      const spv_size_t offset, const mpzspm_t ntt_context)
 {
-  mpres_t r[3], x_0, x_Mi;
-  mpz_t t;
-  unsigned long i;
-  long timestart, realstart;
-  long M = M_param;
-  unsigned long l = l_param, offset = 0UL;
-  mpmod_t modulus;
-  int want_output = 1;
-
-  outputf (OUTPUT_VERBOSE, "Computing g_i");
-  outputf (OUTPUT_DEVVERBOSE, "\npm1_sequence_g: P = %lu, M_param = %lu, "
-           "l_param = %lu, m_1 = %Zd, k_2 = %lu\n", 
-	   P, M_param, l_param, m_1, k_2);
-  timestart = cputime ();
-  realstart = realtime ();
+  w->file = file;
+  w->buf = NULL;
+  w->offset = offset;
+  w->fill = 0;
+  if (file != NULL)
+    {
+      w->buf = mpzspv_init (NTT_FILE_BLOCK, ntt_context);
+      ASSERT_ALWAYS (w->buf != NULL);
+    }
+}
 
-#ifdef _OPENMP
-#pragma omp parallel if (l > 100) private(r, x_0, x_Mi, t, i, M, l, offset, modulus, want_output)
-  {
-    /* When multi-threading, we adjust the parameters for each thread */
+static void
+ntt_file_writer_flush (ntt_file_writer_t *w)
+{
+  mpzspv_file_write (w->file, w->offset, w->buf, w->fill);
+  w->offset += w->fill;
+  w->fill = 0;
+}
 
-    const int nr_chunks = omp_get_num_threads();
-    const int thread_nr = omp_get_thread_num();
-    
-    l = (l_param - 1) / nr_chunks + 1; /* = ceil(l_param / nr_chunks) */
-    offset = thread_nr * l;
-    if (offset <= l_param)
-      l = MIN(l, l_param - offset);
-    else
-      l = 0;
-    outputf (OUTPUT_DEVVERBOSE, 
-             "pm1_sequence_g: thread %d has l = %lu, offset = %lu.\n", 
-             thread_nr, l, offset);
-    M = M_param - (long) offset;
-    
-    /* Let only the master thread print stuff */
-    want_output = (thread_nr == 0);
+static void
+ntt_file_writer_put (ntt_file_writer_t *w, mpz_t *r, 
+		     const mpzspm_t ntt_context)
+{
+  mpzspv_from_mpzv (w->buf, w->fill, r, 1UL, ntt_context);
+  if (++w->fill == NTT_FILE_BLOCK)
+    ntt_file_writer_flush (w);
+}
 
-    if (want_output)
-      outputf (OUTPUT_VERBOSE, " using %d threads", nr_chunks);
-#endif
+static void
+ntt_file_writer_clear (ntt_file_writer_t *w, const mpzspm_t ntt_context)
+{
+  if (w->file == NULL)
+    return;
+  ntt_file_writer_flush (w);
+  mpzspv_clear (w->buf, ntt_context);
+  w->buf = NULL;
+}
 
-  /* Make a private copy of the mpmod_t struct */
-  mpmod_init_set (modulus, modulus_param);
+/* Compute the part of the g_i sequence of pm1_sequence_g() for the calling 
+   thread. Must be called by all threads of a parallel region (or outside 
+   of any). 
+   
+   With X_0 = b_1^{(2*m_1 + 1) * P}, we have x_0 = b_1^{2*k_2} * X_0, so 
+   the values r^2, X_0^{-1} * r^{-2(M-i)+1} and X_0^{M-i} * r^{(M-i)^2} 
+   for the first i of a thread don't depend on k_2. Each thread keeps them 
+   in its worker, so all calls with the same pool must use the same b_1, 
+   P, M_param, l_param and m_1; only k_2 may change. */
 
-  mpz_init (t);
-  mpres_init (r[0], modulus);
-  mpres_init (r[1], modulus);
-  mpres_init (r[2], modulus);
-  mpres_init (x_0, modulus);
-  mpres_init (x_Mi, modulus);
+static void
+pm1_sequence_g_thread (listz_t g_mpz, mpzspv_t g_ntt, mpzspv_file_t g_file, 
+		       const mpres_t b_1, const unsigned long P, 
+		       const long M_param, const unsigned long l_param, 
+		       const mpz_t m_1, const long k_2, fs2_pool_t *pool, 
+		       const mpzspm_t ntt_context)
+{
+  const int nr_chunks = omp_get_num_threads();
+  const int thread_nr = omp_get_thread_num();
+  fs2_worker_t *w = fs2_pool_worker (pool);
+  mpz_ptr t = w->t;
+  unsigned long i, l, offset;
+  long M;
+  ntt_file_writer_t g_writer;
+
+  /* Adjust the parameters for this thread */
+  l = (l_param - 1) / nr_chunks + 1; /* = ceil(l_param / nr_chunks) */
+  offset = thread_nr * l;
+  if (offset <= l_param)
+    l = MIN(l, l_param - offset);
+  else
+    l = 0;
+  outputf (OUTPUT_DEVVERBOSE, 
+	   "pm1_sequence_g: thread %d has l = %lu, offset = %lu.\n", 
+	   thread_nr, l, offset);
+  M = M_param - (long) offset;
 
-  if (want_output)
+  if (thread_nr == 0 && test_verbose (OUTPUT_TRACE))
     {
-      if (test_verbose (OUTPUT_TRACE))
-	{ 
-	  mpres_get_z (t, b_1, modulus);
-	  outputf (OUTPUT_TRACE, "\n/* pm1_sequence_g */ N = %Zd; "
-		   "b_1 = Mod(%Zd, N); /* PARI */\n", modulus->orig_modulus, t);
-	  outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ P = %lu; M = %ld; "
-		   "m_1 = %Zd; /* PARI */\n", P, M, m_1);
-	  outputf (OUTPUT_TRACE, 
-		   "/* pm1_sequence_g */ r = b_1^P; /* PARI */\n");
-	  outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ x_0 = "
-		   "b_1^(2*%ld + (2*m_1 + 1)*P); /* PARI */\n", k_2);
-	}
+      mpres_get_z (t, b_1, w->modulus);
+      outputf (OUTPUT_TRACE, "\n/* pm1_sequence_g */ N = %Zd; "
+	       "b_1 = Mod(%Zd, N); /* PARI */\n", w->modulus->orig_modulus, t);
+      outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ P = %lu; M = %ld; "
+	       "m_1 = %Zd; /* PARI */\n", P, M_param, m_1);
+      outputf (OUTPUT_TRACE, 
+	       "/* pm1_sequence_g */ r = b_1^P; /* PARI */\n");
+      outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ x_0 = "
+	       "b_1^(2*%ld + (2*m_1 + 1)*P); /* PARI */\n", k_2);
     }
 
-  /* We use (M-(i+1))^2 = (M-i)^2 + 2*(-M+i) + 1 */
-  mpz_set_ui (t, P);
-  mpres_pow (r[0], b_1, t, modulus);     /* r[0] = b_1^P = r */
-  if (test_verbose (OUTPUT_TRACE))
+  if (l == 0)
+    return;
+
+  if (w->g_offset != offset || w->g_len != l)
     {
-      mpres_get_z (t, r[0], modulus);
-      outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ r == %Zd /* PARI C */\n", t);
+      /* We use (M-(i+1))^2 = (M-i)^2 + 2*(-M+i) + 1 */
+      mpz_set_ui (t, P);
+      mpres_pow (w->g_r[0], b_1, t, w->modulus);  /* g_r[0] = b_1^P = r */
+      mpz_set_si (t, M);
+      mpz_neg (t, t);
+      mpz_mul_2exp (t, t, 1UL);
+      mpz_add_ui (t, t, 1UL);
+      /* Warning: t might be negative here. */
+      mpres_pow (w->g_r[1], w->g_r[0], t, w->modulus); /* r^{-2M+1} */
+      mpz_set_si (t, M);
+      mpz_mul (t, t, t);                     /* t = M^2 */
+      mpres_pow (w->g_r[2], w->g_r[0], t, w->modulus); /* r^{M^2} */
+      mpres_sqr (w->g_r[0], w->g_r[0], w->modulus); /* g_r[0] = r^2 */
+
+      mpz_mul_2exp (t, m_1, 1UL);
+      mpz_add_ui (t, t, 1UL);
+      mpz_mul_ui (t, t, P);
+      mpres_pow (w->r[0], b_1, t, w->modulus); /* r[0] = X_0 */
+      mpz_set_si (t, M);
+      mpres_pow (w->r[1], w->r[0], t, w->modulus); /* r[1] = X_0^M */
+      mpres_mul (w->g_r[2], w->g_r[2], w->r[1], w->modulus);
+      mpres_invert (w->r[0], w->r[0], w->modulus);
+      mpres_mul (w->g_r[1], w->g_r[1], w->r[0], w->modulus);
+
+      w->g_offset = offset;
+      w->g_len = l;
     }
-  
-  /* FIXME: This is a huge mess, clean up some time */
 
-  mpz_set_si (t, M);
-  mpz_neg (t, t);
+  /* Now with y = b_1^{2*k_2},
+     r[1] = x_0^{-1} * r^{-2M+1} = g_r[1] * y^{-1} and
+     r[2] = x_0^M * r^{M^2} = g_r[2] * y^M */
+  mpz_set_si (t, k_2);
   mpz_mul_2exp (t, t, 1UL);
-  mpz_add_ui (t, t, 1UL);
-  /* Warning: t might be negative here. */
-  mpres_pow (r[1], r[0], t, modulus);    /* r[1] = r^{2(-M+i)+1}, i = 0 */
-  mpz_set_si (t, M);
-  mpz_mul (t, t, t);                     /* t = M^2 */
-  mpres_pow (r[2], r[0], t, modulus);    /* r[2] = r^{(M-i)^2}, i = 0 */
-  mpres_sqr (r[0], r[0], modulus); /* r[0] = r^2 */
-
-  mpz_mul_2exp (t, m_1, 1UL);
-  mpz_add_ui (t, t, 1UL);
-  mpz_mul_ui (t, t, P);
-  mpz_add_si (t, t, k_2);
-  mpz_add_si (t, t, k_2);
-  if (want_output)
-    outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ 2*%ld + (2*%Zd + 1)*P == "
-	     "%Zd /* PARI C */\n", k_2, m_1, t);
-
   /* Warning: t might be negative here. */
-  mpres_pow (x_0, b_1, t, modulus);  /* x_0 = b_1^{2*k_2 + (2*m_1 + 1)*P} */
-  if (want_output && test_verbose (OUTPUT_TRACE))
-    {
-      mpres_get_z (t, x_0, modulus);
-      outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ x_0 == %Zd /* PARI C */\n", 
-	       t);
-    }
-  
+  mpres_pow (w->r[0], b_1, t, w->modulus);       /* r[0] = y */
   mpz_set_si (t, M);
-  mpres_pow (x_Mi, x_0, t, modulus); /* x_Mi = x_0^{M-i}, i = 0 */
+  mpres_pow (w->r[2], w->r[0], t, w->modulus);
+  mpres_mul (w->r[2], w->r[2], w->g_r[2], w->modulus);
+  mpres_invert (w->r[0], w->r[0], w->modulus);
+  mpres_mul (w->r[1], w->g_r[1], w->r[0], w->modulus);
 
-  mpres_invert (x_0, x_0, modulus);  /* x_0 := x_0^{-1} now */
-  mpres_mul (r[1], r[1], x_0, modulus); /* r[1] = x_0^{-1} * r^{-2M+1} */
-  
-  mpres_mul (r[2], r[2], x_Mi, modulus); /* r[2] = x_0^M * r^{M^2} */
-  mpres_get_z (t, r[2], modulus);
+  ntt_file_writer_init (&g_writer, g_file, offset, ntt_context);
+  mpres_get_z (t, w->r[2], w->modulus);
   outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ g_%lu = %Zd; /* PARI */\n", 
 	   offset, t);
-  if (l > 0)
-    {
-      if (g_mpz != NULL)
-        mpz_set (g_mpz[offset], t);
-      if (g_ntt != NULL)
-        mpzspv_from_mpzv (g_ntt, offset, &t, 1UL, ntt_context);
-    }
+  if (g_mpz != NULL)
+    mpz_set (g_mpz[offset], t);
+  if (g_ntt != NULL)
+    mpzspv_from_mpzv (g_ntt, offset, &w->t, 1UL, ntt_context);
+  if (g_file != NULL)
+    ntt_file_writer_put (&g_writer, &w->t, ntt_context);
 
   /* So here we have for i = 0
-     r[2] = x_0^(M-i) * r^{(M-i)^2}
      r[1] = x_0^{-1} * r^{2(-M+i)+1}
-     r[0] = r^2
-     t = r[2]
+     g_r[0] = r^2
+     t = x_0^(M-i) * r^{(M-i)^2}
   */
 
   for (i = 1; i < l; i++)
     {
       if (g_mpz != NULL)
         {
-	  mpres_mul_z_to_z (g_mpz[offset + i], r[1], g_mpz[offset + i - 1], 
-			    modulus);
+	  mpres_mul_z_to_z (g_mpz[offset + i], w->r[1], g_mpz[offset + i - 1], 
+			    w->modulus);
 	  outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ g_%lu = %Zd;"
 		   " /* PARI */\n", offset + i, g_mpz[offset + i]);
         }
-      if (g_ntt != NULL)
+      if (g_ntt != NULL || g_file != NULL)
       {
-	  mpres_mul_z_to_z (t, r[1], t, modulus);
+	  mpres_mul_z_to_z (t, w->r[1], t, w->modulus);
 	  if (g_mpz == NULL) /* Only one should be non-NULL... */
 	      outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ g_%lu = %Zd;"
 		       " /* PARI */\n", offset + i, t);
-	  mpzspv_from_mpzv (g_ntt, offset + i, &t, 1UL, ntt_context);
+	  if (g_ntt != NULL)
+	    mpzspv_from_mpzv (g_ntt, offset + i, &w->t, 1UL, ntt_context);
+	  if (g_file != NULL)
+	    ntt_file_writer_put (&g_writer, &w->t, ntt_context);
       }
-      mpres_mul (r[1], r[1], r[0], modulus);
+      mpres_mul (w->r[1], w->r[1], w->g_r[0], w->modulus);
     }
 
-  mpres_clear (r[0], modulus);
-  mpres_clear (r[1], modulus);
-  mpres_clear (r[2], modulus);
-  mpres_clear (x_0, modulus);
-  mpres_clear (x_Mi, modulus);
-  mpz_clear (t);
-  mpmod_clear (modulus); /* Clear our private copy of modulus */
-
-#ifdef _OPENMP
-  }
-#endif
+  ntt_file_writer_clear (&g_writer, ntt_context);
 
-  print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
-  
-  if (test_verbose (OUTPUT_TRACE))
+  if (thread_nr == 0 && test_verbose (OUTPUT_TRACE))
     {
       for (i = 0; i < l_param; i++)
 	{
@@ -2164,19 +2464,56 @@ pm1_sequence_g (listz_t g_mpz, mpzspv_t g_ntt, const mpres_t b_1,
 		   "(M - %lu) * r^((M - %lu)^2) /* PARI C */\n", i, i, i);
 	}
       outputf (OUTPUT_TRACE, "/* pm1_sequence_g */ g(x) = g_0");
-      for (i = 1; i < l; i++)
+      for (i = 1; i < l_param; i++)
 	outputf (OUTPUT_TRACE, " + g_%lu * x^%lu", i, i);
       outputf (OUTPUT_TRACE, " /* PARI */\n");
     }
 }
 
+/* Compute g_i = x_0^{M-i} * r^{(M-i)^2} for 0 <= i < l. 
+   x_0 = b_1^{2*k_2 + (2*m_1 + 1) * P}. r = b_1^P. 
+   Stores the result in g[0 ... l] and/or in g_ntt[offset ... offset + l] 
+   and/or in g_file[0 ... l] */
+
+static void
+pm1_sequence_g (listz_t g_mpz, mpzspv_t g_ntt, mpzspv_file_t g_file, 
+		const mpres_t b_1, const unsigned long P, const long M_param, 
+		const unsigned long l_param, const mpz_t m_1, const long k_2, 
+		fs2_pool_t *pool, const mpzspm_t ntt_context)
+{
+  long timestart, realstart;
+
+  outputf (OUTPUT_VERBOSE, "Computing g_i");
+  outputf (OUTPUT_DEVVERBOSE, "\npm1_sequence_g: P = %lu, M_param = %lu, "
+           "l_param = %lu, m_1 = %Zd, k_2 = %lu\n", 
+	   P, M_param, l_param, m_1, k_2);
+  timestart = cputime ();
+  realstart = realtime ();
+
+#ifdef _OPENMP
+#pragma omp parallel if (l_param > 100)
+  {
+    if (omp_get_thread_num () == 0)
+      outputf (OUTPUT_VERBOSE, " using %d threads", omp_get_num_threads ());
+#endif
+    pm1_sequence_g_thread (g_mpz, g_ntt, g_file, b_1, P, M_param, l_param, 
+			   m_1, k_2, pool, ntt_context);
+#ifdef _OPENMP
+  }
+#endif
+
+  print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
+}
+
 
 /* Compute h_j = r^(-j^2) * f_j for 0 <= j < d as described in section 9 
-   of the paper. h == f is ok. */
+   of the paper. The f_j are read from f, the h_j are stored in h and/or
+   in h_ntt and/or in h_file. h == f is ok. */
 
 static void 
-pm1_sequence_h (listz_t h, mpzspv_t h_ntt, mpz_t *f, const mpres_t r, 
-		const unsigned long d, mpmod_t modulus_parm, 
+pm1_sequence_h (listz_handle_t h, mpzspv_t h_ntt, mpzspv_file_t h_file, 
+		listz_handle_t f, const mpres_t r, const unsigned long d, 
+		mpmod_t modulus_parm, fs2_pool_t *pool, 
 		const mpzspm_t ntt_context)
 {
   mpres_t invr;  /* r^{-1}. Can be shared between threads */
@@ -2206,11 +2543,13 @@ pm1_sequence_h (listz_t h, mpzspv_t h_ntt, mpz_t *f, const mpres_t r,
 #pragma omp parallel if (d > 100)
 #endif
   {
-    mpres_t fd[3]; /* finite differences table for r^{-i^2}*/
-    mpz_t t;       /* the h_j value as an mpz_t */
+    fs2_worker_t *w = fs2_pool_worker (pool);
+    mpres_t *fd = w->r; /* finite differences table for r^{-i^2}*/
+    mpz_ptr t = w->t;   /* the h_j value as an mpz_t */
     unsigned long j;
     unsigned long offset = 0UL, len = d;
-    mpmod_t modulus;
+    listz_iterator_t *f_iter, *h_iter = NULL;
+    ntt_file_writer_t h_writer;
 
     /* Adjust offset and length for this thread */
 #ifdef _OPENMP
@@ -2232,12 +2571,6 @@ pm1_sequence_h (listz_t h, mpzspv_t h_ntt, mpz_t *f, const mpres_t r,
     }
 #endif
     
-    mpmod_init_set (modulus, modulus_parm);
-    mpres_init (fd[0], modulus);
-    mpres_init (fd[1], modulus);
-    mpres_init (fd[2], modulus);
-    mpz_init (t);
-    
     /* We have (n + 1)^2 = n^2 + 2n + 1. For the finite differences we'll 
        need r^{-2}, r^{-(2n+1)}, r^{-n^2}. Init for n = 0. */
     
@@ -2245,36 +2578,51 @@ pm1_sequence_h (listz_t h, mpzspv_t h_ntt, mpz_t *f, const mpres_t r,
        separately in each thread has the advantage of putting it in
        local memory. May not make much difference overall */
 
-    mpres_sqr (fd[0], invr, modulus);       /* fd[0] = r^{-2} */
+    mpres_sqr (fd[0], invr, w->modulus);    /* fd[0] = r^{-2} */
     mpz_set_ui (t, offset);
     mpz_mul_2exp (t, t, 1UL);
     mpz_add_ui (t, t, 1UL);                 /* t = 2 * offset + 1 */
-    mpres_pow (fd[1], invr, t, modulus);    /* fd[1] = r^{-(2*offset+1)} */
+    mpres_pow (fd[1], invr, t, w->modulus); /* fd[1] = r^{-(2*offset+1)} */
     mpz_set_ui (t, offset);
     mpz_mul (t, t, t);                      /* t = offset^2 */
-    mpres_pow (fd[2], invr, t, modulus);    /* fd[2] = r^{-offset^2} */
+    mpres_pow (fd[2], invr, t, w->modulus); /* fd[2] = r^{-offset^2} */
+
+    /* If f is on disk, each thread reads its part of it with its own 
+       iterator. With h == f, it writes h through the same iterator. */
+    f_iter = listz_iterator_init (f, offset);
+    ASSERT_ALWAYS (f_iter != NULL);
+    if (h != NULL && h != f)
+      {
+        h_iter = listz_iterator_init (h, offset);
+        ASSERT_ALWAYS (h_iter != NULL);
+      }
+    ntt_file_writer_init (&h_writer, h_file, offset, ntt_context);
     
     /* Generate the sequence */
     for (j = offset; j < offset + len; j++)
       {
-	mpres_mul_z_to_z (t, fd[2], f[j], modulus);
+	listz_iterator_read (f_iter, t);
+	mpres_mul_z_to_z (t, fd[2], t, w->modulus);
 	outputf (OUTPUT_TRACE, 
 		 "/* pm1_sequence_h */ h_%lu = %Zd; /* PARI */\n", j, t);
 	
-	if (h != NULL)
-	  mpz_set (h[j], t);
+	if (h == f)
+	  listz_iterator_write (f_iter, t);
+	else if (h != NULL)
+	  listz_iterator_write (h_iter, t);
 	if (h_ntt != NULL)
-	  mpzspv_from_mpzv (h_ntt, j, &t, 1UL, ntt_context);
+	  mpzspv_from_mpzv (h_ntt, j, &w->t, 1UL, ntt_context);
+	if (h_file != NULL)
+	  ntt_file_writer_put (&h_writer, &w->t, ntt_context);
 	
-	mpres_mul (fd[2], fd[2], fd[1], modulus); /* fd[2] = r^{-j^2} */
-	mpres_mul (fd[1], fd[1], fd[0], modulus); /* fd[1] = r^{-2*j-1} */
+	mpres_mul (fd[2], fd[2], fd[1], w->modulus); /* fd[2] = r^{-j^2} */
+	mpres_mul (fd[1], fd[1], fd[0], w->modulus); /* fd[1] = r^{-2*j-1} */
       }
     
-    mpres_clear (fd[2], modulus);
-    mpres_clear (fd[1], modulus);
-    mpres_clear (fd[0], modulus);
-    mpz_clear (t);
-    mpmod_clear (modulus);
+    ntt_file_writer_clear (&h_writer, ntt_context);
+    if (h_iter != NULL)
+      listz_iterator_clear (h_iter);
+    listz_iterator_clear (f_iter);
   }
 
   mpres_clear (invr, modulus_parm);
@@ -2517,113 +2865,208 @@ ntt_sqr_reciprocal (mpzv_t R, const mpzv_t S, mpzspv_t dft,
 }
 
 
-/* Computes gcd(\prod_{0 <= i < len} (ntt[i + offset] + add[i]), N), 
-   the NTT residues are converted to integer residues (mod N) first.
-   If add == NULL, add[i] is assumed to be 0. */
+/* Multiply the residues ntt[i + offset] + add[i], 0 <= i < len, together. 
+   Must be called by all threads of a parallel region (or outside of any), 
+   each thread multiplies a part of the residues, taking a gcd with N 
+   of its partial product every NTT_GCD_CHECKPOINT residues. If one of 
+   these finds a factor, all threads stop and the factor is put in pool. 
+   Otherwise the partial products are multiplied together in a binary 
+   tree, the result ends up in the worker of thread 0. 
+   The NTT residues are converted to integer residues (mod N) first. If 
+   add == NULL, add[i] is assumed to be 0. If ntt == NULL, the NTT residues 
+   are read from ntt_file instead. */
 
 static void
-ntt_gcd (mpz_t f, mpz_t *product, mpzspv_t ntt, const unsigned long ntt_offset,
-	 const listz_t add, const unsigned long len_param, 
-	 const mpzspm_t ntt_context, mpmod_t modulus_param)
+ntt_gcd_thread (mpzspv_t ntt, mpzspv_file_t ntt_file, 
+		const unsigned long ntt_offset, const listz_t add, 
+		const unsigned long len_param, const mpzspm_t ntt_context, 
+		fs2_pool_t *pool)
 {
-  unsigned long i, j;
-  const unsigned long Rlen = MPZSPV_NORMALISE_STRIDE;
-  listz_t R;
-  unsigned long len = len_param, thread_offset = 0;
-  mpres_t tmpres, tmpprod, totalprod;
-  mpmod_t modulus;
-  long timestart, realstart;
-  
-  outputf (OUTPUT_VERBOSE, "Computing gcd of coefficients and N");
-  timestart = cputime ();
-  realstart = realtime ();
-
-  /* All the threads will multiply their partial products to this one. */
-  mpres_init (totalprod, modulus_param);
-  mpres_set_ui (totalprod, 1UL, modulus_param);
-
-#ifdef _OPENMP
-#pragma omp parallel if (len > 100) private(i, j, R, len, thread_offset, tmpres, tmpprod, modulus) shared(totalprod)
-  {
-    const int nr_chunks = omp_get_num_threads();
-    const int thread_nr = omp_get_thread_num();
+  const int nr_chunks = omp_get_num_threads();
+  const int thread_nr = omp_get_thread_num();
+  fs2_worker_t *w = fs2_pool_worker (pool);
+  const unsigned long Rlen = 
+    (ntt == NULL) ? NTT_FILE_BLOCK : MPZSPV_NORMALISE_STRIDE;
+  mpz_ptr tmpres = w->r[0];
+  unsigned long i, j, len, thread_offset, checkpoint = 0;
+  int step, found;
+
+  len = (len_param - 1) / nr_chunks + 1;
+  thread_offset = thread_nr * len;
+  if (thread_offset <= len_param)
+    len = MIN(len, len_param - thread_offset);
+  else
+    len = 0;
 
-    len = (len_param - 1) / nr_chunks + 1;
-    thread_offset = thread_nr * len;
-    if (thread_offset <= len_param)
-      len = MIN(len, len_param - thread_offset);
-    else
-      len = 0;
-#pragma omp master
+  if (w->R == NULL)
     {
-      outputf (OUTPUT_VERBOSE, " using %d threads", nr_chunks);
+      w->Rlen = MAX(NTT_FILE_BLOCK, MPZSPV_NORMALISE_STRIDE);
+      w->R = init_list2 (w->Rlen, (mpz_size (w->modulus->orig_modulus) + 2) * 
+			 GMP_NUMB_BITS);
     }
-#endif
-
-    /* Make a private copy of the mpmod_t struct */
-    mpmod_init_set (modulus, modulus_param);
-
-    R = init_list2 (Rlen, (mpz_size (modulus->orig_modulus) + 2) * 
-                           GMP_NUMB_BITS);
-    mpres_init (tmpres, modulus);
-    mpres_init (tmpprod, modulus);
-    mpres_set_ui (tmpprod, 1UL, modulus);
+  if (ntt == NULL && w->block == NULL)
+    {
+      ASSERT_ALWAYS (ntt_context == pool->ntt_context);
+      w->block = mpzspv_init (NTT_FILE_BLOCK, ntt_context);
+      ASSERT_ALWAYS (w->block != NULL);
+    }
+  mpres_set_ui (w->prod, 1UL, w->modulus);
     
-    for (i = 0; i < len; i += Rlen)
-      {
-	const unsigned long blocklen = MIN(len - i, Rlen);
+  for (i = 0; i < len; i += Rlen)
+    {
+      const unsigned long blocklen = MIN(len - i, Rlen);
 
-	/* Convert blocklen residues from NTT to integer representatives
-	   and store them in R */
-	mpzspv_to_mpzv (ntt, ntt_offset + thread_offset + i, R, blocklen, 
-			ntt_context);
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+      found = pool->found;
+      if (found)
+	break;
+
+      /* Convert blocklen residues from NTT to integer representatives
+	 and store them in R */
+      if (ntt != NULL)
+	mpzspv_to_mpzv (ntt, ntt_offset + thread_offset + i, w->R, blocklen, 
+			ntt_context);
+      else
+	{
+	  mpzspv_file_read (ntt_file, ntt_offset + thread_offset + i, 
+			    w->block, blocklen);
+	  mpzspv_to_mpzv (w->block, 0, w->R, blocklen, ntt_context);
+	}
 
-	/* Accumulate product in tmpprod */
-	for (j = 0; j < blocklen; j++)
-	  {
-	    outputf (OUTPUT_TRACE, "r_%lu = %Zd; /* PARI */\n", i, R[j]);
-	    if (add != NULL)
-	      mpz_add (R[j], R[j], add[i + thread_offset + j]);
-	    mpres_set_z_for_gcd (tmpres, R[j], modulus);
+      /* Accumulate product in w->prod */
+      for (j = 0; j < blocklen; j++)
+	{
+	  outputf (OUTPUT_TRACE, "r_%lu = %Zd; /* PARI */\n", i, w->R[j]);
+	  if (add != NULL)
+	    mpz_add (w->R[j], w->R[j], add[i + thread_offset + j]);
+	  mpres_set_z_for_gcd (tmpres, w->R[j], w->modulus);
 #define TEST_ZERO_RESULT
 #ifdef TEST_ZERO_RESULT
-	    if (mpres_is_zero (tmpres, modulus))
-	      outputf (OUTPUT_VERBOSE, "R_[%lu] = 0\n", i);
+	  if (mpres_is_zero (tmpres, w->modulus))
+	    outputf (OUTPUT_VERBOSE, "R_[%lu] = 0\n", i);
 #endif
-	    mpres_mul (tmpprod, tmpprod, tmpres, modulus); 
-	  }
-      }
+	  mpres_mul (w->prod, w->prod, tmpres, w->modulus); 
+	}
+
+      /* The last residues of this thread are checked by the final gcd */
+      if (i + blocklen - checkpoint < NTT_GCD_CHECKPOINT || 
+	  i + blocklen == len)
+	continue;
+      mpres_gcd (w->t, w->prod, w->modulus);
+      if (mpz_cmp_ui (w->t, 1UL) > 0)
+	{
 #ifdef _OPENMP
-#pragma omp critical
-    {
-      mpres_mul (totalprod, totalprod, tmpprod, modulus);
-    }
-#else
-    mpres_set (totalprod, tmpprod, modulus);
+#pragma omp critical (ntt_gcd)
 #endif
-    mpres_clear (tmpres, modulus);
-    mpres_clear (tmpprod, modulus);
-    mpmod_clear (modulus);
-    clear_list (R, Rlen);
+	  if (pool->found == 0)
+	    {
+	      mpz_set (pool->factor, w->t);
+	      mpres_set (pool->partial, w->prod, w->modulus);
+	      pool->partial_len = i + blocklen;
+	      pool->found_start = thread_offset + checkpoint;
+	      pool->found_end = thread_offset + i + blocklen;
 #ifdef _OPENMP
-  }
+#pragma omp atomic write
 #endif
+	      pool->found = 1;
+	    }
+	  break;
+	}
+      checkpoint = i + blocklen;
+    }
 
-  {
-    mpz_t n;
-    mpz_init (n);
-    mpz_set_ui (n, len_param);
-    mpres_set_z_for_gcd_fix (totalprod, totalprod, n, modulus_param);
-    mpz_clear (n);
-  }
+  /* Multiply the partial products together. With 2^k threads, this takes 
+     k rounds instead of 2^k - 1 multiplications in thread 0 */
+  for (step = 1; step < nr_chunks; step *= 2)
+    {
+#ifdef _OPENMP
+#pragma omp barrier
+#endif
+      if (thread_nr % (2 * step) == 0 && thread_nr + step < nr_chunks)
+	mpres_mul (w->prod, w->prod, pool->w[thread_nr + step].prod, 
+		   w->modulus);
+    }
+}
+
+/* To be called after ntt_gcd_thread() for len residues, outside of the 
+   parallel region or by thread 0 after a barrier. Puts the gcd of their 
+   product and N in f and, if product != NULL, the product in *product. 
+   If a checkpoint found a factor, puts that in f, the partial product 
+   in *product, the range of residues in which it was found in where[0] 
+   and where[1], and returns 1. Otherwise returns 0. */
+
+static int
+ntt_gcd_finish (mpz_t f, mpz_t *product, unsigned long *where, 
+		const unsigned long len, fs2_pool_t *pool, mpmod_t modulus)
+{
+  mpz_ptr prod = pool->w[0].prod;
+  unsigned long n_prod = len;
+  int found = pool->found;
+  mpz_t n;
+
+  if (found)
+    {
+      prod = pool->partial;
+      n_prod = pool->partial_len;
+      where[0] = pool->found_start;
+      where[1] = pool->found_end;
+      pool->found = 0;
+    }
+
+  mpz_init (n);
+  mpz_set_ui (n, n_prod);
+  mpres_set_z_for_gcd_fix (prod, prod, n, modulus);
+  mpz_clear (n);
 
   if (product != NULL)
-    mpres_get_z (*product, totalprod, modulus_param);
+    mpres_get_z (*product, prod, modulus);
+
+  if (found)
+    mpz_set (f, pool->factor);
+  else
+    mpres_gcd (f, prod, modulus);
+
+  return found;
+}
+
+/* Computes gcd(\prod_{0 <= i < len} (ntt[i + offset] + add[i]), N), 
+   see ntt_gcd_thread() */
+
+static void
+ntt_gcd (mpz_t f, mpz_t *product, mpzspv_t ntt, mpzspv_file_t ntt_file, 
+	 const unsigned long ntt_offset, const listz_t add, 
+	 const unsigned long len, const mpzspm_t ntt_context, 
+	 fs2_pool_t *pool, mpmod_t modulus)
+{
+  long timestart, realstart;
+  unsigned long where[2];
+  int found;
+  
+  outputf (OUTPUT_VERBOSE, "Computing gcd of coefficients and N");
+  timestart = cputime ();
+  realstart = realtime ();
 
-  mpres_gcd (f, totalprod, modulus_param);
-  mpres_clear (totalprod, modulus_param);
+#ifdef _OPENMP
+#pragma omp parallel if (len > 100)
+  {
+#pragma omp master
+    {
+      outputf (OUTPUT_VERBOSE, " using %d threads", omp_get_num_threads ());
+    }
+#endif
+    ntt_gcd_thread (ntt, ntt_file, ntt_offset, add, len, ntt_context, pool);
+#ifdef _OPENMP
+  }
+#endif
+
+  found = ntt_gcd_finish (f, product, where, len, pool, modulus);
 
   print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
+  if (found)
+    outputf (OUTPUT_VERBOSE, "Factor found by a checkpoint gcd in "
+	     "residues %lu to %lu\n", where[0], where[1] - 1);
 }
 
 
@@ -2645,6 +3088,7 @@ pm1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
   listz_t g, h, tmp, R;
   mpz_t mt;   /* All-purpose temp mpz_t */
   mpres_t mr; /* All-purpose temp mpres_t */
+  fs2_pool_t *pool;
   int youpi = ECM_NO_FACTOR_FOUND;
   long timetotalstart, realtotalstart, timestart;
 
@@ -2664,6 +3108,7 @@ pm1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
      reallocations will up to double the time for stage 2! */
   mpz_init (mt);
   mpres_init (mr, modulus);
+  pool = fs2_pool_init (modulus, NULL);
   lenF = params->s_1 / 2 + 1 + 1; /* Another +1 because poly_from_sets_V stores
 				     the leading 1 monomial for each factor */
   F = init_list2 (lenF, (unsigned int) abs (modulus->bits));
@@ -2707,7 +3152,8 @@ pm1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
   mpres_invert (mr, X, modulus);
   mpres_add (mr, mr, X, modulus);
 
-  i = poly_from_sets_V (F, mr, S_1, tmp, tmplen, modulus, NULL, NULL);
+  i = poly_from_sets_V (F, NULL, mr, S_1, tmp, tmplen, modulus, NULL, NULL, 
+			pool);
   ASSERT_ALWAYS(2 * i == params->s_1);
   ASSERT(mpz_cmp_ui (F[i], 1UL) == 0);
   free (S_1);
@@ -2726,7 +3172,15 @@ pm1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
   
   mpz_set_ui (mt, params->P);
   mpres_pow (mr, X, mt, modulus); /* mr = X^P */
-  pm1_sequence_h (F, NULL, F, mr, params->s_1 / 2 + 1, modulus, NULL); 
+  {
+    listz_handle_t F_handle;
+
+    F_handle = listz_handle_from_listz (F, lenF, modulus->orig_modulus);
+    ASSERT_ALWAYS (F_handle != NULL);
+    pm1_sequence_h (F_handle, NULL, NULL, F_handle, mr, params->s_1 / 2 + 1, 
+		    modulus, pool, NULL); 
+    free (F_handle); /* Not listz_handle_clear(), we still need F */
+  }
 
   /* Make a symmetric copy of F in h. It will have length 
      s_1 + 1 = 2*lenF - 1 */
@@ -2750,8 +3204,8 @@ pm1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
       const unsigned long M = params->l - 1L - params->s_1 / 2L;
       outputf (OUTPUT_VERBOSE, "Multi-point evaluation %lu of %lu:\n", 
                l + 1, params->s_2);
-      pm1_sequence_g (g, NULL, X, params->P, M, params->l, 
-		      params->m_1, S_2->elem[l], modulus, NULL);
+      pm1_sequence_g (g, NULL, NULL, X, params->P, M, params->l, 
+		      params->m_1, S_2->elem[l], pool, NULL);
 
       /* Do the convolution */
       /* Use the transposed "Middle Product" algorithm */
@@ -2863,6 +3317,7 @@ pm1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
   clear_list (R, lenR);    
   clear_list (tmp, tmplen);
 
+  fs2_pool_clear (pool, modulus);
   mpz_clear (mt);
   mpres_clear (mr, modulus);
 
@@ -2878,12 +3333,175 @@ pm1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
 }
 
 
+/* Create the files for pm1fs2_ntt() when the NTT vectors are stored on 
+   disk: params->file_stem.h for the DCT-I of h, params->file_stem.g for g, 
+   and params->file_stem.f for the s_1 / 2 + 1 coefficients of F. 
+   Returns a handle to the latter, or NULL if a file can't be created. */
+
+static listz_handle_t
+pm1fs2_ntt_files (mpzspv_file_t *h_file, mpzspv_file_t *g_file, 
+		  const faststage2_param_t *params, mpmod_t modulus, 
+		  const mpzspm_t ntt_context)
+{
+  const unsigned long lenF = params->s_1 / 2 + 1;
+  listz_handle_t F_handle = NULL;
+  char *filename;
+
+  filename = (char *) malloc (strlen (params->file_stem) + 3);
+  if (filename == NULL)
+    return NULL;
+  sprintf (filename, "%s.h", params->file_stem);
+  *h_file = mpzspv_file_init (filename, params->l / 2 + 1, ntt_context);
+  sprintf (filename, "%s.g", params->file_stem);
+  *g_file = mpzspv_file_init (filename, params->l, ntt_context);
+  sprintf (filename, "%s.f", params->file_stem);
+  if (*h_file != NULL && *g_file != NULL)
+    F_handle = listz_handle_init (filename, lenF, modulus->orig_modulus);
+  free (filename);
+
+  if (F_handle == NULL)
+    {
+      outputf (OUTPUT_ERROR, "Error: could not create the files %s.f, "
+	       "%s.g and %s.h\n", params->file_stem, params->file_stem,
+	       params->file_stem);
+      if (*h_file != NULL)
+	mpzspv_file_clear (*h_file);
+      if (*g_file != NULL)
+	mpzspv_file_clear (*g_file);
+      *h_file = *g_file = NULL;
+      return NULL;
+    }
+  outputf (OUTPUT_DEVVERBOSE, "Storing F, g and h in %s.f, %s.g and %s.h\n",
+	   params->file_stem, params->file_stem, params->file_stem);
+
+  return F_handle;
+}
+
+/* Same as mpzspv_to_dct1 (h, h, spvlen, dctlen, tmp, ntt_context) for the 
+   h stored in h_file. Each thread loads one prime at a time, and reads 
+   its next one in the background. */
+
+static void
+ntt_file_to_dct1 (mpzspv_file_t h_file, const spv_size_t spvlen, 
+		  const spv_size_t dctlen, const mpzspm_t ntt_context, 
+		  fs2_pool_t *pool)
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  {
+    const int nr_threads = omp_get_num_threads ();
+    /* 2 * (dctlen - 1) entries for tmp, dctlen for dct */
+    spv_t *buf = fs2_worker_spv (fs2_pool_worker (pool), 2 * (dctlen - 1));
+    mpzspv_file_iterator_t iter;
+    int j;
+    
+    /* The primes are dealt out statically, so that each thread knows 
+       which one it will need next */
+    iter = mpzspv_file_iterator_init (h_file, omp_get_thread_num (), 
+				      nr_threads);
+    for (j = omp_get_thread_num (); j < (int) ntt_context->sp_num; 
+	 j += nr_threads)
+      {
+	spv_set (buf[0], mpzspv_file_iterator_read (iter), spvlen);
+	spv_to_dct1 (buf[0], buf[0], spvlen, dctlen, buf[1], 
+		     ntt_context->spm[j]);
+	mpzspv_file_write_spv (h_file, j, 0, buf[0], dctlen);
+      }
+    mpzspv_file_iterator_clear (iter);
+  }
+}
+
+/* Same as mpzspv_mul_by_dct (g, h, len, ntt_context, <all steps>), but 
+   for g and h in memory (g_ntt, h_ntt) or on disk (g_file, h_file). Of 
+   the product, only coefficients [offset, offset + outlen[ are written 
+   back to g_file. On disk, the primes are dealt out statically among the 
+   threads of the enclosing parallel region, if any, and each thread reads
+   its next one in the background. If g2_file != NULL, the product of g2 
+   and the DCT-I h2 in g2_file and h2_file is added to that of g and h 
+   before the inverse transform, as the one pass variant of P+1 does. */
+
+static void
+ntt_mul_by_dct_thread (mpzspv_t g_ntt, const mpzspv_t h_ntt, 
+		       mpzspv_file_t g_file, mpzspv_file_t h_file, 
+		       mpzspv_file_t g2_file, mpzspv_file_t h2_file, 
+		       const spv_size_t len, const spv_size_t offset, 
+		       const spv_size_t outlen, const mpzspm_t ntt_context, 
+		       fs2_pool_t *pool)
+{
+  const int steps = NTT_MUL_STEP_FFT1 + NTT_MUL_STEP_MUL + NTT_MUL_STEP_IFFT;
+  const spv_size_t dctlen = len / 2 + 1;
+  const int nr_threads = omp_get_num_threads ();
+  mpzspv_file_iterator_t g_iter, h_iter, g2_iter = NULL, h2_iter = NULL;
+  spv_t *buf;
+  int j;
+
+  if (g_file == NULL)
+    {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (j = 0; j < (int) ntt_context->sp_num; j++)
+	spv_mul_by_dct (g_ntt[j], h_ntt[j], len, ntt_context->spm[j], 
+			steps);
+      return;
+    }
+
+  buf = fs2_worker_spv (fs2_pool_worker (pool), len);
+  g_iter = mpzspv_file_iterator_init (g_file, omp_get_thread_num (), 
+				      nr_threads);
+  h_iter = mpzspv_file_iterator_init (h_file, omp_get_thread_num (), 
+				      nr_threads);
+  if (g2_file != NULL)
+    {
+      g2_iter = mpzspv_file_iterator_init (g2_file, omp_get_thread_num (), 
+					   nr_threads);
+      h2_iter = mpzspv_file_iterator_init (h2_file, omp_get_thread_num (), 
+					   nr_threads);
+    }
+  for (j = omp_get_thread_num (); j < (int) ntt_context->sp_num; 
+       j += nr_threads)
+    {
+      const spm_t spm = ntt_context->spm[j];
+
+      spv_set (buf[0], mpzspv_file_iterator_read (g_iter), len);
+      spv_set (buf[1], mpzspv_file_iterator_read (h_iter), dctlen);
+      if (g2_file == NULL)
+	spv_mul_by_dct (buf[0], buf[1], len, spm, steps);
+      else
+	{
+	  spv_mul_by_dct (buf[0], buf[1], len, spm, 
+			  NTT_MUL_STEP_FFT1 + NTT_MUL_STEP_MUL);
+	  /* The DCT-I of h2 is only read, so it is used in the iterator's 
+	     buffer, and buf[1] takes g2 */
+	  spv_set (buf[1], mpzspv_file_iterator_read (g2_iter), len);
+	  spv_mul_by_dct (buf[1], mpzspv_file_iterator_read (h2_iter), len, 
+			  spm, NTT_MUL_STEP_FFT1 + NTT_MUL_STEP_MUL);
+	  spv_add (buf[0], buf[0], buf[1], len, spm->sp);
+	  spv_mul_by_dct (buf[0], NULL, len, spm, NTT_MUL_STEP_IFFT);
+	}
+      mpzspv_file_write_spv (g_file, j, offset, buf[0] + offset, outlen);
+    }
+  mpzspv_file_iterator_clear (g_iter);
+  mpzspv_file_iterator_clear (h_iter);
+  if (g2_file != NULL)
+    {
+      mpzspv_file_iterator_clear (g2_iter);
+      mpzspv_file_iterator_clear (h2_iter);
+    }
+#ifdef _OPENMP
+#pragma omp barrier
+#endif
+}
+
+
 int 
 pm1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus, 
 	const faststage2_param_t *params)
 {
   unsigned long nr;
   unsigned long l, lenF;
+  unsigned long where[2]; /* Residues where a checkpoint gcd found a factor */
   sets_long_t *S_1; /* This is stored as a set of sets (arithmetic 
                        progressions of prime length) */
   set_long_t *S_2; /* This is stored as a regular set */
@@ -2892,13 +3510,20 @@ pm1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 		  distinct coefficients. The sequence h_j will be stored in 
 		  the same memory and won't be a monic polynomial, so the 
 		  leading 1 monomial of F will be stored explicitly. Hence we 
-		  need s_1 / 2 + 1 entries. */
+		  need s_1 / 2 + 1 entries. With params->file_stem, F is 
+		  written to F_handle instead and may need only half as 
+		  many, see poly_from_sets_V(). */
+  listz_handle_t F_handle = NULL;
   mpzspm_t ntt_context;
-  mpzspv_t g_ntt, h_ntt;
+  mpzspv_t g_ntt = NULL, h_ntt = NULL;
+  mpzspv_file_t g_file = NULL, h_file = NULL; /* With params->file_stem, 
+                                                 used instead of g_ntt and 
+                                                 h_ntt */
   mpz_t mt;   /* All-purpose temp mpz_t */
   mpz_t product; /* Product of each multi-point evaluation */
   mpz_t *product_ptr = NULL;
   mpres_t tmpres; /* All-purpose temp mpres_t */
+  fs2_pool_t *pool;
   int youpi = ECM_NO_FACTOR_FOUND;
   long timetotalstart, realtotalstart, timestart, realstart;
 
@@ -2931,8 +3556,12 @@ pm1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
   /* Allocate all the memory we'll need for building f */
   mpz_init (mt);
   mpres_init (tmpres, modulus);
+  pool = fs2_pool_init (modulus, ntt_context);
   lenF = params->s_1 / 2 + 1 + 1; /* Another +1 because poly_from_sets_V stores
 				     the leading 1 monomial for each factor */
+  if (params->file_stem != NULL && poly_from_sets_V_streams (S_1))
+    lenF = params->s_1 / 4 + 1 + 1; /* Only the factor before the last 
+				       squaring is kept in F */
   {
     /* in some cases the above value of lenF is not enough, for example with
        s_1 = 10, which gives lenF = 7, but 9 entries are needed */
@@ -2943,6 +3572,23 @@ pm1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 
   F = init_list2 (lenF, (unsigned int) abs (modulus->bits));
 
+  if (params->file_stem != NULL)
+    {
+      F_handle = pm1fs2_ntt_files (&h_file, &g_file, params, modulus, 
+				   ntt_context);
+      if (F_handle == NULL)
+	{
+	  free (S_1);
+	  free (S_2);
+	  fs2_pool_clear (pool, modulus);
+	  mpz_clear (mt);
+	  mpres_clear (tmpres, modulus);
+	  mpzspm_clear (ntt_context);
+	  clear_list (F, lenF);
+	  return ECM_ERROR;
+	}
+    }
+
   mpres_get_z (mt, X, modulus); /* mpz_t copy of X for printing */
   outputf (OUTPUT_TRACE, 
 	   "N = %Zd; X = Mod(%Zd, N); /* PARI */\n", 
@@ -2979,10 +3625,18 @@ pm1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
   mpres_invert (tmpres, X, modulus);
   mpres_add (tmpres, tmpres, X, modulus);
 
-  if (build_F_ntt (F, tmpres, S_1, params, modulus) == ECM_ERROR)
+  if (build_F_ntt (F, F_handle, tmpres, S_1, params, modulus, pool) 
+      == ECM_ERROR)
     {
       free (S_1);
       free (S_2);
+      if (F_handle != NULL)
+	{
+	  listz_handle_clear (F_handle);
+	  mpzspv_file_clear (g_file);
+	  mpzspv_file_clear (h_file);
+	}
+      fs2_pool_clear (pool, modulus);
       mpz_clear (mt);
       mpres_clear (tmpres, modulus);
       mpzspm_clear (ntt_context);
@@ -2993,15 +3647,23 @@ pm1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
   free (S_1);
   S_1 = NULL;
   
-  h_ntt = mpzspv_init (params->l / 2 + 1, ntt_context);
+  if (F_handle != NULL)
+    clear_list (F, lenF);
+  else
+    {
+      F_handle = listz_handle_from_listz (F, lenF, modulus->orig_modulus);
+      ASSERT_ALWAYS (F_handle != NULL);
+      h_ntt = mpzspv_init (params->l / 2 + 1, ntt_context);
+    }
 
   mpz_set_ui (mt, params->P);
   mpres_pow (tmpres, X, mt, modulus); /* tmpres = X^P */
-  pm1_sequence_h (NULL, h_ntt, F, tmpres, params->s_1 / 2 + 1, modulus, 
-		  ntt_context);
+  pm1_sequence_h (NULL, h_ntt, h_file, F_handle, tmpres, 
+		  params->s_1 / 2 + 1, modulus, pool, ntt_context);
 
-  clear_list (F, lenF);
-  g_ntt = mpzspv_init (params->l, ntt_context);
+  listz_handle_clear (F_handle);
+  if (g_file == NULL)
+    g_ntt = mpzspv_init (params->l, ntt_context);
 
   /* Compute the DCT-I of h */
   outputf (OUTPUT_VERBOSE, "Computing DCT-I of h");
@@ -3011,8 +3673,12 @@ pm1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
   timestart = cputime ();
   realstart = realtime ();
   
-  mpzspv_to_dct1 (h_ntt, h_ntt, params->s_1 / 2 + 1, params->l / 2 + 1, 
-                  g_ntt, ntt_context);
+  if (h_file != NULL)
+    ntt_file_to_dct1 (h_file, params->s_1 / 2 + 1, params->l / 2 + 1, 
+		      ntt_context, pool);
+  else
+    mpzspv_to_dct1 (h_ntt, h_ntt, params->s_1 / 2 + 1, params->l / 2 + 1, 
+		    g_ntt, ntt_context);
   print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
   
   if (test_verbose (OUTPUT_RESVERBOSE))
@@ -3021,49 +3687,119 @@ pm1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
       product_ptr = &product;
     }
 
-  for (l = 0; l < params->s_2; l++)
-    {
-      const unsigned long M = params->l - 1L - params->s_1 / 2L;
+  /* The multi-point evaluations run in one parallel region, the threads 
+     go from one step to the next without being forked and joined again. 
+     The master thread finishes the gcd of one evaluation while the others 
+     start on the g_i of the next one, which are not used if a factor was 
+     found. */
+#ifdef _OPENMP
+#pragma omp parallel private(l)
+#endif
+  {
+    for (l = 0; ; l++)
+      {
+	const unsigned long M = params->l - 1L - params->s_1 / 2L;
 
-      outputf (OUTPUT_VERBOSE, "Multi-point evaluation %lu of %lu:\n", 
-               l + 1, params->s_2);
-      /* Compute the coefficients of the polynomial g(x) */
-      pm1_sequence_g (NULL, g_ntt, X, params->P, M, params->l, 
-		      params->m_1, S_2->elem[l], modulus, ntt_context);
+#ifdef _OPENMP
+#pragma omp master
+#endif
+	{
+	  if (l > 0)
+	    {
+	      int found = ntt_gcd_finish (mt, product_ptr, where, nr, pool, 
+					  modulus);
+	      print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
+	      if (found)
+		outputf (OUTPUT_VERBOSE, "Factor found by a checkpoint gcd "
+			 "in residues %lu to %lu of evaluation %lu\n", 
+			 where[0], where[1] - 1, l);
+	      outputf (OUTPUT_RESVERBOSE, "Product of R[i] = %Zd\n", product);
+	      /* If we found a factor, stop */
+	      if (mpz_cmp_ui (mt, 1UL) > 0)
+		{
+		  mpz_set (f, mt);
+		  youpi = ECM_FACTOR_FOUND_STEP2;
+		}
+	    }
+	  if (l < params->s_2 && youpi == ECM_NO_FACTOR_FOUND)
+	    {
+	      outputf (OUTPUT_VERBOSE, "Multi-point evaluation %lu of %lu:\n", 
+		       l + 1, params->s_2);
+	      outputf (OUTPUT_VERBOSE, "Computing g_i");
+#ifdef _OPENMP
+	      outputf (OUTPUT_VERBOSE, " using %d threads", 
+		       omp_get_num_threads ());
+#endif
+	      timestart = cputime ();
+	      realstart = realtime ();
+	    }
+	}
+	if (l == params->s_2)
+	  break;
 
-      /* Do the convolution */
-      outputf (OUTPUT_VERBOSE, "Computing g*h");
+	/* Compute the coefficients of the polynomial g(x) */
+	pm1_sequence_g_thread (NULL, g_ntt, g_file, X, params->P, M, params->l, 
+			       params->m_1, S_2->elem[l], pool, ntt_context);
 #ifdef _OPENMP
-      outputf (OUTPUT_VERBOSE, " using %d threads", omp_get_thread_limit());
+#pragma omp barrier
 #endif
-      timestart = cputime ();
-      realstart = realtime ();
-      mpzspv_mul_by_dct (g_ntt, h_ntt, params->l, ntt_context, 
-        NTT_MUL_STEP_FFT1 + NTT_MUL_STEP_MUL + NTT_MUL_STEP_IFFT);
-      print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
-      
-      /* Compute GCD of N and coefficients of product polynomial */
-      ntt_gcd (mt, product_ptr, g_ntt, params->s_1 / 2, NULL, nr, ntt_context, 
-	       modulus);
+	if (youpi != ECM_NO_FACTOR_FOUND)
+	  break;
 
-      outputf (OUTPUT_RESVERBOSE, "Product of R[i] = %Zd\n", product);
+	/* Do the convolution */
+#ifdef _OPENMP
+#pragma omp master
+#endif
+	{
+	  print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
+	  outputf (OUTPUT_VERBOSE, "Computing g*h");
+#ifdef _OPENMP
+	  outputf (OUTPUT_VERBOSE, " using %d threads", omp_get_num_threads ());
+#endif
+	  timestart = cputime ();
+	  realstart = realtime ();
+	}
+	ntt_mul_by_dct_thread (g_ntt, h_ntt, g_file, h_file, NULL, NULL, 
+			       params->l, params->s_1 / 2, nr, ntt_context, 
+			       pool);
 
-      /* If we found a factor, stop */
-      if (mpz_cmp_ui (mt, 1UL) > 0)
+	/* Compute GCD of N and coefficients of product polynomial */
+#ifdef _OPENMP
+#pragma omp master
+#endif
 	{
-	  mpz_set (f, mt);
-	  youpi = ECM_FACTOR_FOUND_STEP2;
-	  break;
+	  print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
+	  outputf (OUTPUT_VERBOSE, "Computing gcd of coefficients and N");
+#ifdef _OPENMP
+	  outputf (OUTPUT_VERBOSE, " using %d threads", omp_get_num_threads ());
+#endif
+	  timestart = cputime ();
+	  realstart = realtime ();
 	}
-    }
+	ntt_gcd_thread (g_ntt, g_file, params->s_1 / 2, NULL, nr, ntt_context, 
+			pool);
+#ifdef _OPENMP
+#pragma omp barrier
+#endif
+      }
+  }
 
   if (test_verbose (OUTPUT_RESVERBOSE))
     {
       product_ptr = NULL;
       mpz_clear (product);
     }
-  mpzspv_clear (g_ntt, ntt_context);
-  mpzspv_clear (h_ntt, ntt_context);
+  if (g_file != NULL)
+    {
+      mpzspv_file_clear (g_file);
+      mpzspv_file_clear (h_file);
+    }
+  else
+    {
+      mpzspv_clear (g_ntt, ntt_context);
+      mpzspv_clear (h_ntt, ntt_context);
+    }
+  fs2_pool_clear (pool, modulus);
   mpzspm_clear (ntt_context);
   mpres_clear (tmpres, modulus);
   mpz_clear (mt);
@@ -3413,23 +4149,27 @@ gfp_ext_rn2 (mpres_t *r_x, mpres_t *r_y, const mpres_t a_x, const mpres_t a_y,
 #endif
 
 /* Compute g_i = x_0^{M-i} * r^{(M-i)^2} for 0 <= i < l. 
-   x_0 = b_1^{2*k_2 + (2*m_1 + 1) * P}. r = b_1^P. */
+   x_0 = b_1^{2*k_2 + (2*m_1 + 1) * P}. r = b_1^P. 
+   The coordinates are stored in g_x, g_y and/or in g_x_ntt, g_y_ntt 
+   and/or in g_x_file, g_y_file. */
 
 static void
 pp1_sequence_g (listz_t g_x, listz_t g_y, mpzspv_t g_x_ntt, mpzspv_t g_y_ntt,
+		mpzspv_file_t g_x_file, mpzspv_file_t g_y_file, 
 		const mpres_t b1_x, const mpres_t b1_y, const unsigned long P, 
 		const mpres_t Delta, const long M_param, 
 		const unsigned long l_param, const mpz_t m_1, const long k_2, 
 		const mpmod_t modulus_param, const mpzspm_t ntt_context)
 {
   const unsigned long tmplen = 3;
-  const int want_x = (g_x != NULL || g_x_ntt != NULL);
-  const int want_y = (g_y != NULL || g_y_ntt != NULL);
+  const int want_x = (g_x != NULL || g_x_ntt != NULL || g_x_file != NULL);
+  const int want_y = (g_y != NULL || g_y_ntt != NULL || g_y_file != NULL);
   mpres_t r_x, r_y, x0_x, x0_y, v2,
       r1_x[2], r1_y[2], r2_x[2], r2_y[2], 
       v[2], tmp[3];
   mpz_t mt;
   mpmod_t modulus; /* Thread-local copy of modulus_param */
+  ntt_file_writer_t g_x_writer, g_y_writer;
   unsigned long i, l = l_param, offset = 0;
   long M = M_param;
   long timestart, realstart;
@@ -3443,7 +4183,7 @@ pp1_sequence_g (listz_t g_x, listz_t g_y, mpzspv_t g_x_ntt, mpzspv_t g_y_ntt,
   realstart = realtime ();
 
 #ifdef _OPENMP
-#pragma omp parallel if (l > 100) private(r_x, r_y, x0_x, x0_y, v2, r1_x, r1_y, r2_x, r2_y, v, tmp, mt, modulus, i, l, offset, M, want_output)
+#pragma omp parallel if (l > 100) private(r_x, r_y, x0_x, x0_y, v2, r1_x, r1_y, r2_x, r2_y, v, tmp, mt, modulus, g_x_writer, g_y_writer, i, l, offset, M, want_output)
   {
     /* When multi-threading, we adjust the parameters for each thread */
 
@@ -3479,6 +4219,8 @@ pp1_sequence_g (listz_t g_x, listz_t g_y, mpzspv_t g_x_ntt, mpzspv_t g_y_ntt,
     for (i = 0; i < tmplen; i++)
       mpres_init (tmp[i], modulus);
     mpz_init (mt);
+    ntt_file_writer_init (&g_x_writer, g_x_file, offset, ntt_context);
+    ntt_file_writer_init (&g_y_writer, g_y_file, offset, ntt_context);
     
     if (want_output && test_verbose (OUTPUT_TRACE))
       {
@@ -3549,6 +4291,16 @@ pp1_sequence_g (listz_t g_x, listz_t g_y, mpzspv_t g_x_ntt, mpzspv_t g_y_ntt,
             mpres_get_z (mt, r1_y[0], modulus);
             mpzspv_from_mpzv (g_y_ntt, offset, &mt, 1UL, ntt_context);
           }
+        if (g_x_file != NULL)
+          {
+            mpres_get_z (mt, r1_x[0], modulus);
+            ntt_file_writer_put (&g_x_writer, &mt, ntt_context);
+          }
+        if (g_y_file != NULL)
+          {
+            mpres_get_z (mt, r1_y[0], modulus);
+            ntt_file_writer_put (&g_y_writer, &mt, ntt_context);
+          }
       }
     
     
@@ -3576,6 +4328,16 @@ pp1_sequence_g (listz_t g_x, listz_t g_y, mpzspv_t g_x_ntt, mpzspv_t g_y_ntt,
             mpres_get_z (mt, r1_y[1], modulus);
             mpzspv_from_mpzv (g_y_ntt, offset + 1, &mt, 1UL, ntt_context);
           }
+        if (g_x_file != NULL)
+          {
+            mpres_get_z (mt, r1_x[1], modulus);
+            ntt_file_writer_put (&g_x_writer, &mt, ntt_context);
+          }
+        if (g_y_file != NULL)
+          {
+            mpres_get_z (mt, r1_y[1], modulus);
+            ntt_file_writer_put (&g_y_writer, &mt, ntt_context);
+          }
       }
     
     
@@ -3627,6 +4389,11 @@ pp1_sequence_g (listz_t g_x, listz_t g_y, mpzspv_t g_x_ntt, mpzspv_t g_y_ntt,
 		mpres_get_z (mt, r_x, modulus);
 		mpzspv_from_mpzv (g_x_ntt, offset + i, &mt, 1UL, ntt_context);
 	      }
+	    if (g_x_file != NULL)
+	      {
+		mpres_get_z (mt, r_x, modulus);
+		ntt_file_writer_put (&g_x_writer, &mt, ntt_context);
+	      }
 	  }
 	
 	if (want_y)
@@ -3644,6 +4411,11 @@ pp1_sequence_g (listz_t g_x, listz_t g_y, mpzspv_t g_x_ntt, mpzspv_t g_y_ntt,
 		mpres_get_z (mt, r_y, modulus);
 		mpzspv_from_mpzv (g_y_ntt, offset + i, &mt, 1UL, ntt_context);
 	      }
+	    if (g_y_file != NULL)
+	      {
+		mpres_get_z (mt, r_y, modulus);
+		ntt_file_writer_put (&g_y_writer, &mt, ntt_context);
+	      }
 	  }
 	
 	/* v[i] = v[i - 1] * V_2(a + 1/a) - v[i - 2] */
@@ -3678,6 +4450,8 @@ pp1_sequence_g (listz_t g_x, listz_t g_y, mpzspv_t g_x_ntt, mpzspv_t g_y_ntt,
       mpres_clear (tmp[i], modulus);
     mpz_clear (mt);
     mpmod_clear (modulus);
+    ntt_file_writer_clear (&g_x_writer, ntt_context);
+    ntt_file_writer_clear (&g_y_writer, ntt_context);
 #ifdef _OPENMP
   }
 #endif
@@ -3698,11 +4472,14 @@ pp1_sequence_g (listz_t g_x, listz_t g_y, mpzspv_t g_x_ntt, mpzspv_t g_y_ntt,
 
 
 /* Compute r[i] = b1^(-P*(k+i)^2) * f_i for i = 0, 1, ..., l-1, where "b1" is 
-   an element of norm 1 in the quadratic extension ring */
+   an element of norm 1 in the quadratic extension ring. The f_i are read 
+   from f, the coordinates of the r[i] are stored in h_x, h_y and/or in 
+   h_x_ntt, h_y_ntt and/or in h_x_file, h_y_file. */
 
 static void
 pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
-		const listz_t f, const mpres_t b1_x, const mpres_t b1_y, 
+		mpzspv_file_t h_x_file, mpzspv_file_t h_y_file, 
+		listz_handle_t f, const mpres_t b1_x, const mpres_t b1_y, 
 		const long k_param, const unsigned long l_param, 
 		const unsigned long P, const mpres_t Delta, 
 		mpmod_t modulus_param, const mpzspm_t ntt_context)
@@ -3713,8 +4490,8 @@ pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
   if (l_param == 0UL)
     return;
 
-  ASSERT (f != h_x);
-  ASSERT (f != h_y);
+  ASSERT (f->storage != 0 || f->data.mem != h_x);
+  ASSERT (f->storage != 0 || f->data.mem != h_y);
 
   outputf (OUTPUT_VERBOSE, "Computing h_x and h_y");
   timestart = cputime ();
@@ -3731,9 +4508,17 @@ pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
       outputf (OUTPUT_TRACE, "/* pp1_sequence_h */ b_1 = ");
       gfp_ext_print (b1_x, b1_y, modulus_param, OUTPUT_TRACE);
       outputf (OUTPUT_TRACE, "; r = b_1^P; rn = b_1^(-P); /* PARI */\n");
-      for (i = 0; i < l_param; i++)
-	outputf (OUTPUT_TRACE, 
-		 "/* pp1_sequence_h */ f_%lu = %Zd; /* PARI */\n", i, f[i]);
+      {
+	listz_iterator_t *f_iter = listz_iterator_init (f, 0);
+	ASSERT_ALWAYS (f_iter != NULL);
+	for (i = 0; i < l_param; i++)
+	  {
+	    listz_iterator_read (f_iter, t);
+	    outputf (OUTPUT_TRACE, 
+		     "/* pp1_sequence_h */ f_%lu = %Zd; /* PARI */\n", i, t);
+	  }
+	listz_iterator_clear (f_iter);
+      }
       mpz_clear (t);
     }
 
@@ -3745,9 +4530,11 @@ pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
     mpres_t s_x[3], s_y[3], s2_x[2], s2_y[2], v[2], V2, rn_x, rn_y, 
       tmp[2];
     mpmod_t modulus; /* Thread-local copy of modulus_param */
-    mpz_t mt;
+    mpz_t mt, f_i;
     unsigned long l = l_param, offset = 0;
     long k = k_param;
+    listz_iterator_t *f_iter;
+    ntt_file_writer_t h_x_writer, h_y_writer;
 
 #ifdef _OPENMP
     /* When multi-threading, we adjust the parameters for each thread */
@@ -3776,9 +4563,17 @@ pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
     k += (long) offset;
 
     mpz_init (mt);
+    mpz_init (f_i);
     /* Make thread-local copy of modulus */
     mpmod_init_set (modulus, modulus_param);
 
+    /* If f is on disk, each thread reads its part of it with its own 
+       iterator */
+    f_iter = listz_iterator_init (f, offset);
+    ASSERT_ALWAYS (f_iter != NULL);
+    ntt_file_writer_init (&h_x_writer, h_x_file, offset, ntt_context);
+    ntt_file_writer_init (&h_y_writer, h_y_file, offset, ntt_context);
+
     /* Init the local mpres_t variables */
     for (i = 0; i < 2; i++)
       {
@@ -3910,19 +4705,26 @@ pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
 	mpres_mul (s_y[i], s_y[i], Delta, modulus);
 	mpres_mul (s2_y[i], s2_y[i], Delta, modulus);
 	
+	listz_iterator_read (f_iter, f_i);
 	if (h_x != NULL)
-	  mpres_mul_z_to_z (h_x[i + offset], s_x[i], f[i + offset], modulus);
+	  mpres_mul_z_to_z (h_x[i + offset], s_x[i], f_i, modulus);
 	if (h_y != NULL)
-	  mpres_mul_z_to_z (h_y[i + offset], s_y[i], f[i + offset], modulus);
-	if (h_x_ntt != NULL)
+	  mpres_mul_z_to_z (h_y[i + offset], s_y[i], f_i, modulus);
+	if (h_x_ntt != NULL || h_x_file != NULL)
 	  {
-	    mpres_mul_z_to_z (mt, s_x[i], f[i + offset], modulus);
-	    mpzspv_from_mpzv (h_x_ntt, i + offset, &mt, 1UL, ntt_context);
+	    mpres_mul_z_to_z (mt, s_x[i], f_i, modulus);
+	    if (h_x_ntt != NULL)
+	      mpzspv_from_mpzv (h_x_ntt, i + offset, &mt, 1UL, ntt_context);
+	    if (h_x_file != NULL)
+	      ntt_file_writer_put (&h_x_writer, &mt, ntt_context);
 	  }
-	if (h_y_ntt != NULL)
+	if (h_y_ntt != NULL || h_y_file != NULL)
 	  {
-	    mpres_mul_z_to_z (mt, s_y[i], f[i + offset], modulus);
-	    mpzspv_from_mpzv (h_y_ntt, i + offset, &mt, 1UL, ntt_context);
+	    mpres_mul_z_to_z (mt, s_y[i], f_i, modulus);
+	    if (h_y_ntt != NULL)
+	      mpzspv_from_mpzv (h_y_ntt, i + offset, &mt, 1UL, ntt_context);
+	    if (h_y_file != NULL)
+	      ntt_file_writer_put (&h_y_writer, &mt, ntt_context);
 	  }
       }
     
@@ -3931,7 +4733,8 @@ pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
     
     for (i = 2; i < l; i++)
       {
-	if (h_x != NULL || h_x_ntt != NULL)
+	listz_iterator_read (f_iter, f_i);
+	if (h_x != NULL || h_x_ntt != NULL || h_x_file != NULL)
 	  {
 	    /* r[i] = r2[i-1] * v[i-2] - r2[i-2], with indices of r2 and i 
 	       taken modulo 2 */
@@ -3942,16 +4745,19 @@ pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
 	    mpres_mul (s2_x[i % 2], s2_x[1 - i % 2], v[1 - i % 2], modulus);
 	    mpres_sub (s2_x[i % 2], s2_x[i % 2], s_x[(i - 2) % 3], modulus);
 	    if (h_x != NULL)
-	      mpres_mul_z_to_z (h_x[i + offset], s_x[i % 3], f[i + offset], 
-				modulus);
-	    if (h_x_ntt != NULL)
+	      mpres_mul_z_to_z (h_x[i + offset], s_x[i % 3], f_i, modulus);
+	    if (h_x_ntt != NULL || h_x_file != NULL)
 	      {
-		mpres_mul_z_to_z (mt, s_x[i % 3], f[i + offset], modulus);
-		mpzspv_from_mpzv (h_x_ntt, i + offset, &mt, 1UL, ntt_context);
+		mpres_mul_z_to_z (mt, s_x[i % 3], f_i, modulus);
+		if (h_x_ntt != NULL)
+		  mpzspv_from_mpzv (h_x_ntt, i + offset, &mt, 1UL, 
+				    ntt_context);
+		if (h_x_file != NULL)
+		  ntt_file_writer_put (&h_x_writer, &mt, ntt_context);
 	      }
 	  }
 	
-	if (h_y != NULL || h_y_ntt != NULL)
+	if (h_y != NULL || h_y_ntt != NULL || h_y_file != NULL)
 	  {
 	    /* Same for y coordinate */
 	    mpres_mul (s_y[i % 3], s2_y[1 - i % 2], v[i % 2], modulus);
@@ -3959,12 +4765,15 @@ pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
 	    mpres_mul (s2_y[i % 2], s2_y[1 - i % 2], v[1 - i % 2], modulus);
 	    mpres_sub (s2_y[i % 2], s2_y[i % 2], s_y[(i - 2) % 3], modulus);
 	    if (h_y != NULL)
-	      mpres_mul_z_to_z (h_y[i + offset], s_y[i % 3], f[i + offset], 
-				modulus);
-	    if (h_y_ntt != NULL)
+	      mpres_mul_z_to_z (h_y[i + offset], s_y[i % 3], f_i, modulus);
+	    if (h_y_ntt != NULL || h_y_file != NULL)
 	      {
-		mpres_mul_z_to_z (mt, s_y[i % 3], f[i + offset], modulus);
-		mpzspv_from_mpzv (h_y_ntt, i + offset, &mt, 1UL, ntt_context);
+		mpres_mul_z_to_z (mt, s_y[i % 3], f_i, modulus);
+		if (h_y_ntt != NULL)
+		  mpzspv_from_mpzv (h_y_ntt, i + offset, &mt, 1UL, 
+				    ntt_context);
+		if (h_y_file != NULL)
+		  ntt_file_writer_put (&h_y_writer, &mt, ntt_context);
 	      }
 	  }
 	
@@ -3990,9 +4799,14 @@ pp1_sequence_h (listz_t h_x, listz_t h_y, mpzspv_t h_x_ntt, mpzspv_t h_y_ntt,
     for (i = 0; i < tmplen; i++)
       mpres_clear (tmp[i], modulus);
 
+    ntt_file_writer_clear (&h_x_writer, ntt_context);
+    ntt_file_writer_clear (&h_y_writer, ntt_context);
+    listz_iterator_clear (f_iter);
+
     /* Clear the thread-local copy of modulus */
     mpmod_clear (modulus);
 
+    mpz_clear (f_i);
     mpz_clear (mt);
   }
 
@@ -4023,11 +4837,13 @@ pp1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
 		  the same memory and won't be a monic polynomial, so the 
 		  leading 1 monomial of F will be stored explicitly. Hence we 
 		  need s_1 / 2 + 1 entries. */
+  listz_handle_t F_handle;
 
   listz_t g_x, g_y, fh_x, fh_y, h_x, h_y, tmp, R_x, R_y; 
   const unsigned long tmpreslen = 2UL;
   mpres_t b1_x, b1_y, Delta, tmpres[2];
   mpz_t mt;   /* All-purpose temp mpz_t */
+  fs2_pool_t *pool;
   int youpi = ECM_NO_FACTOR_FOUND;
   long timetotalstart, realtotalstart, timestart;
 
@@ -4093,7 +4909,10 @@ pp1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
   outputf (OUTPUT_VERBOSE, "Computing F from factored S_1");
   
   timestart = cputime ();
-  i = poly_from_sets_V (F, X, S_1, tmp, tmplen, modulus, NULL, NULL);
+  pool = fs2_pool_init (modulus, NULL);
+  i = poly_from_sets_V (F, NULL, X, S_1, tmp, tmplen, modulus, NULL, NULL, 
+			pool);
+  fs2_pool_clear (pool, modulus);
   ASSERT_ALWAYS(2 * i == params->s_1);
   ASSERT(mpz_cmp_ui (F[i], 1UL) == 0);
   free (S_1);
@@ -4127,10 +4946,12 @@ pp1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
     }
 
   /* Compute the h sequence h_j = b1^(P*-j^2) * f_j for 0 <= j <= s_1 */
-  pp1_sequence_h (fh_x, fh_y, NULL, NULL, F, b1_x, b1_y, 0L, 
-		  params->s_1 / 2 + 1, params->P, Delta, modulus, NULL);
+  F_handle = listz_handle_from_listz (F, lenF, modulus->orig_modulus);
+  ASSERT_ALWAYS (F_handle != NULL);
+  pp1_sequence_h (fh_x, fh_y, NULL, NULL, NULL, NULL, F_handle, b1_x, b1_y, 
+		  0L, params->s_1 / 2 + 1, params->P, Delta, modulus, NULL);
   /* We don't need F(x) any more */
-  clear_list (F, lenF);
+  listz_handle_clear (F_handle);
 
   /* Make a symmetric copy of fh in h. */
   for (i = 0; i < params->s_1 / 2 + 1; i++)
@@ -4155,9 +4976,9 @@ pp1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
       const long M = params->l - 1 - params->s_1 / 2;
       outputf (OUTPUT_VERBOSE, "Multi-point evaluation %lu of %lu:\n", 
                l + 1, params->s_2);
-      pp1_sequence_g (g_x, g_y, NULL, NULL, b1_x, b1_y, params->P, 
-		      Delta, M, params->l, params->m_1, S_2->elem[l], 
-		      modulus, NULL);
+      pp1_sequence_g (g_x, g_y, NULL, NULL, NULL, NULL, b1_x, b1_y, 
+		      params->P, Delta, M, params->l, params->m_1, 
+		      S_2->elem[l], modulus, NULL);
       
       /* Do the two convolution products */
       outputf (OUTPUT_VERBOSE, "TMulGen of g_x and h_x");
@@ -4244,6 +5065,73 @@ pp1fs2 (mpz_t f, const mpres_t X, mpmod_t modulus,
 }
 
 
+/* Create the files for pp1fs2_ntt() when the NTT vectors are stored on 
+   disk: params->file_stem.hx and .hy for the DCT-I of h_x and h_y, .gx and
+   .gy for g_x and g_y, and .f for the s_1 / 2 + 1 coefficients of F. 
+   Returns a handle to the latter, or NULL if a file can't be created. */
+
+static listz_handle_t
+pp1fs2_ntt_files (mpzspv_file_t *h_x_file, mpzspv_file_t *h_y_file, 
+		  mpzspv_file_t *g_x_file, mpzspv_file_t *g_y_file, 
+		  const faststage2_param_t *params, mpmod_t modulus, 
+		  const mpzspm_t ntt_context)
+{
+  const unsigned long lenF = params->s_1 / 2 + 1;
+  listz_handle_t F_handle = NULL;
+  char *filename;
+
+  filename = (char *) malloc (strlen (params->file_stem) + 4);
+  if (filename == NULL)
+    return NULL;
+  sprintf (filename, "%s.hx", params->file_stem);
+  *h_x_file = mpzspv_file_init (filename, params->l / 2 + 1, ntt_context);
+  sprintf (filename, "%s.hy", params->file_stem);
+  *h_y_file = mpzspv_file_init (filename, params->l / 2 + 1, ntt_context);
+  sprintf (filename, "%s.gx", params->file_stem);
+  *g_x_file = mpzspv_file_init (filename, params->l, ntt_context);
+  sprintf (filename, "%s.gy", params->file_stem);
+  *g_y_file = mpzspv_file_init (filename, params->l, ntt_context);
+  sprintf (filename, "%s.f", params->file_stem);
+  if (*h_x_file != NULL && *h_y_file != NULL && *g_x_file != NULL && 
+      *g_y_file != NULL)
+    F_handle = listz_handle_init (filename, lenF, modulus->orig_modulus);
+  free (filename);
+
+  if (F_handle == NULL)
+    {
+      outputf (OUTPUT_ERROR, "Error: could not create the files %s.f, "
+	       "%s.gx, %s.gy, %s.hx and %s.hy\n", params->file_stem, 
+	       params->file_stem, params->file_stem, params->file_stem, 
+	       params->file_stem);
+      if (*h_x_file != NULL)
+	mpzspv_file_clear (*h_x_file);
+      if (*h_y_file != NULL)
+	mpzspv_file_clear (*h_y_file);
+      if (*g_x_file != NULL)
+	mpzspv_file_clear (*g_x_file);
+      if (*g_y_file != NULL)
+	mpzspv_file_clear (*g_y_file);
+      *h_x_file = *h_y_file = *g_x_file = *g_y_file = NULL;
+      return NULL;
+    }
+  outputf (OUTPUT_DEVVERBOSE, "Storing F, g and h in %s.f, %s.gx, %s.gy, "
+	   "%s.hx and %s.hy\n", params->file_stem, params->file_stem, 
+	   params->file_stem, params->file_stem, params->file_stem);
+
+  return F_handle;
+}
+
+static void
+pp1fs2_ntt_files_clear (mpzspv_file_t h_x_file, mpzspv_file_t h_y_file, 
+			mpzspv_file_t g_x_file, mpzspv_file_t g_y_file)
+{
+  mpzspv_file_clear (h_x_file);
+  mpzspv_file_clear (h_y_file);
+  mpzspv_file_clear (g_x_file);
+  mpzspv_file_clear (g_y_file);
+}
+
+
 int 
 pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 	    const faststage2_param_t *params, const int twopass)
@@ -4258,17 +5146,24 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 		  distinct coefficients. The sequence h_j will be stored in 
 		  the same memory and won't be a monic polynomial, so the 
 		  leading 1 monomial of F will be stored explicitly. Hence we 
-		  need s_1 / 2 + 1 entries. */
+		  need s_1 / 2 + 1 entries. With params->file_stem, F is 
+		  written to F_handle instead and may need only half as 
+		  many, see poly_from_sets_V(). */
+  listz_handle_t F_handle = NULL;
   listz_t R = NULL;  /* Is used only for two-pass convolution, has nr 
 			entries. R is only ever referenced if twopass == 1,
 			but gcc does not realize that and complains about
 			uninitialized value, so we set it to NULL. */
   mpzspm_t ntt_context;
-  mpzspv_t g_x_ntt, g_y_ntt, h_x_ntt, h_y_ntt;
+  mpzspv_t g_x_ntt = NULL, g_y_ntt = NULL, h_x_ntt = NULL, h_y_ntt = NULL;
+  mpzspv_file_t g_x_file = NULL, g_y_file = NULL, h_x_file = NULL, 
+    h_y_file = NULL; /* With params->file_stem, used instead of the 
+			vectors in memory by the one pass variant */
   mpres_t b1_x, b1_y, Delta;
   mpz_t mt;   /* All-purpose temp mpz_t */
   mpz_t product;
   mpz_t *product_ptr = NULL;
+  fs2_pool_t *pool;
   int youpi = ECM_NO_FACTOR_FOUND;
   long timetotalstart, realtotalstart, timestart, realstart;
 
@@ -4277,6 +5172,8 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 
   ASSERT_ALWAYS (eulerphi (params->P) == params->s_1 * params->s_2);
   ASSERT_ALWAYS (params->s_1 < params->l);
+  /* Only the one pass variant stores its vectors on disk */
+  ASSERT_ALWAYS (params->file_stem == NULL || !twopass);
   nr = params->l - params->s_1; /* Number of points we evaluate */
 
   if (make_S_1_S_2 (&S_1, &S_2, params) == ECM_ERROR)
@@ -4309,10 +5206,14 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 
   print_CRT_primes (OUTPUT_DEVVERBOSE, "CRT modulus for evaluation = ", 
 		    ntt_context);
+  pool = fs2_pool_init (modulus, ntt_context);
 
   /* Allocate memory for F with correct amount of space for each mpz_t */
   lenF = params->s_1 / 2 + 1 + 1; /* Another +1 because poly_from_sets_V stores
 				     the leading 1 monomial for each factor */
+  if (params->file_stem != NULL && poly_from_sets_V_streams (S_1))
+    lenF = params->s_1 / 4 + 1 + 1; /* Only the factor before the last 
+				       squaring is kept in F */
   {
     /* in some cases the above value of lenF is not enough, for example with
        s_1 = 10, which gives lenF = 7, but 9 entries are needed */
@@ -4322,12 +5223,34 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
   }
 
   F = init_list2 (lenF, (unsigned int) abs (modulus->bits) + GMP_NUMB_BITS);
+
+  if (params->file_stem != NULL)
+    {
+      F_handle = pp1fs2_ntt_files (&h_x_file, &h_y_file, &g_x_file, 
+				   &g_y_file, params, modulus, ntt_context);
+      if (F_handle == NULL)
+	{
+	  free (S_1);
+	  free (S_2);
+	  fs2_pool_clear (pool, modulus);
+	  mpz_clear (mt);
+	  mpzspm_clear (ntt_context);
+	  clear_list (F, lenF);
+	  return ECM_ERROR;
+	}
+    }
   
   /* Build F */
-  if (build_F_ntt (F, X, S_1, params, modulus) == ECM_ERROR)
+  if (build_F_ntt (F, F_handle, X, S_1, params, modulus, pool) == ECM_ERROR)
     {
       free (S_1);
       free (S_2);
+      if (F_handle != NULL)
+	{
+	  listz_handle_clear (F_handle);
+	  pp1fs2_ntt_files_clear (h_x_file, h_y_file, g_x_file, g_y_file);
+	}
+      fs2_pool_clear (pool, modulus);
       mpz_clear (mt);
       mpzspm_clear (ntt_context);
       clear_list (F, lenF);
@@ -4336,6 +5259,14 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 
   free (S_1);
   S_1 = NULL;
+
+  if (F_handle != NULL)
+    clear_list (F, lenF);
+  else
+    {
+      F_handle = listz_handle_from_listz (F, lenF, modulus->orig_modulus);
+      ASSERT_ALWAYS (F_handle != NULL);
+    }
   
   mpres_init (b1_x, modulus);
   mpres_init (b1_y, modulus);
@@ -4358,26 +5289,33 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
     }
 
   /* Allocate remaining memory for h_ntt */
-  h_x_ntt = mpzspv_init (params->l / 2 + 1, ntt_context);
-  h_y_ntt = mpzspv_init (params->l / 2 + 1, ntt_context);
+  if (h_x_file == NULL)
+    {
+      h_x_ntt = mpzspv_init (params->l / 2 + 1, ntt_context);
+      h_y_ntt = mpzspv_init (params->l / 2 + 1, ntt_context);
+    }
   /* Compute the h_j sequence */
-  pp1_sequence_h (NULL, NULL, h_x_ntt, h_y_ntt, F, b1_x, b1_y, 0L, 
-		  params->s_1 / 2 + 1, params->P, Delta, modulus, 
-		  ntt_context);
+  pp1_sequence_h (NULL, NULL, h_x_ntt, h_y_ntt, h_x_file, h_y_file, F_handle,
+		  b1_x, b1_y, 0L, params->s_1 / 2 + 1, params->P, Delta, 
+		  modulus, ntt_context);
   /* We don't need F(x) any more */
-  clear_list (F, lenF);
+  listz_handle_clear (F_handle);
+  F_handle = NULL;
 
   /* compute the forward transform of h and store the distinct coefficients 
      in h_ntt */
-  g_x_ntt = mpzspv_init (params->l, ntt_context);
-  if (twopass)
+  if (g_x_file == NULL)
     {
-      g_y_ntt = g_x_ntt;
-      R = init_list2 (nr, (mpz_size (modulus->orig_modulus) + 2) *  
-                          GMP_NUMB_BITS);
+      g_x_ntt = mpzspv_init (params->l, ntt_context);
+      if (twopass)
+	{
+	  g_y_ntt = g_x_ntt;
+	  R = init_list2 (nr, (mpz_size (modulus->orig_modulus) + 2) *  
+			  GMP_NUMB_BITS);
+	}
+      else
+	g_y_ntt = mpzspv_init (params->l, ntt_context);
     }
-  else
-    g_y_ntt = mpzspv_init (params->l, ntt_context);
   
   /* Compute DCT-I of h_x and h_y */
   outputf (OUTPUT_VERBOSE, "Computing DCT-I of h_x");
@@ -4386,8 +5324,12 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 #endif
   timestart = cputime ();
   realstart = realtime ();
-  mpzspv_to_dct1 (h_x_ntt, h_x_ntt, params->s_1 / 2 + 1, params->l / 2 + 1,
-		  g_x_ntt, ntt_context);
+  if (h_x_file != NULL)
+    ntt_file_to_dct1 (h_x_file, params->s_1 / 2 + 1, params->l / 2 + 1, 
+		      ntt_context, pool);
+  else
+    mpzspv_to_dct1 (h_x_ntt, h_x_ntt, params->s_1 / 2 + 1, 
+		    params->l / 2 + 1, g_x_ntt, ntt_context);
   print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
 
   outputf (OUTPUT_VERBOSE, "Computing DCT-I of h_y");
@@ -4396,8 +5338,12 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 #endif
   timestart = cputime ();
   realstart = realtime ();
-  mpzspv_to_dct1 (h_y_ntt, h_y_ntt, params->s_1 / 2 + 1, params->l / 2 + 1,
-		  g_x_ntt, ntt_context);
+  if (h_y_file != NULL)
+    ntt_file_to_dct1 (h_y_file, params->s_1 / 2 + 1, params->l / 2 + 1, 
+		      ntt_context, pool);
+  else
+    mpzspv_to_dct1 (h_y_ntt, h_y_ntt, params->s_1 / 2 + 1, 
+		    params->l / 2 + 1, g_x_ntt, ntt_context);
   print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
 
   if (test_verbose (OUTPUT_RESVERBOSE))
@@ -4416,9 +5362,9 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 	{
 	  /* Two-pass variant. Two separate convolutions, 
 	     then addition in Z/NZ */
-	  pp1_sequence_g (NULL, NULL, g_x_ntt, NULL, b1_x, b1_y, params->P, 
-			  Delta, M, params->l, params->m_1, S_2->elem[l], 
-			  modulus, ntt_context);
+	  pp1_sequence_g (NULL, NULL, g_x_ntt, NULL, NULL, NULL, b1_x, b1_y, 
+			  params->P, Delta, M, params->l, params->m_1, 
+			  S_2->elem[l], modulus, ntt_context);
 
 	  /* Do the convolution product of g_x * h_x */
 	  outputf (OUTPUT_VERBOSE, "Computing g_x*h_x");
@@ -4434,9 +5380,9 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 	  print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
 
 	  /* Compute g_y sequence */
-	  pp1_sequence_g (NULL, NULL, NULL, g_y_ntt, b1_x, b1_y, params->P, 
-			  Delta, M, params->l, params->m_1, S_2->elem[l], 
-			  modulus, ntt_context);
+	  pp1_sequence_g (NULL, NULL, NULL, g_y_ntt, NULL, NULL, b1_x, b1_y, 
+			  params->P, Delta, M, params->l, params->m_1, 
+			  S_2->elem[l], modulus, ntt_context);
 	  
 	  /* Do the convolution product of g_y * (Delta * h_y) */
 	  outputf (OUTPUT_VERBOSE, "Computing g_y*h_y");
@@ -4450,16 +5396,42 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 	  print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
 	  
 	  /* Compute product of sum of coefficients and gcd with N */
-	  ntt_gcd (mt, product_ptr, g_y_ntt, params->s_1 / 2, R, nr, 
-		   ntt_context, modulus);
+	  ntt_gcd (mt, product_ptr, g_y_ntt, NULL, params->s_1 / 2, R, nr, 
+		   ntt_context, pool, modulus);
+	}
+      else if (g_x_file != NULL)
+	{
+	  /* One-pass variant on disk. The forward transforms, point-wise 
+	     products, addition and inverse transform are done for one 
+	     prime at a time */
+	  pp1_sequence_g (NULL, NULL, NULL, NULL, g_x_file, g_y_file, b1_x, 
+			  b1_y, params->P, Delta, M, params->l, params->m_1, 
+			  S_2->elem[l], modulus, ntt_context);
+
+	  outputf (OUTPUT_VERBOSE, "Computing g_x*h_x + g_y*h_y");
+#ifdef _OPENMP
+          outputf (OUTPUT_VERBOSE, " using %d threads", omp_get_thread_limit());
+#endif
+	  timestart = cputime ();
+	  realstart = realtime ();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+	  ntt_mul_by_dct_thread (NULL, NULL, g_x_file, h_x_file, g_y_file, 
+				 h_y_file, params->l, params->s_1 / 2, nr, 
+				 ntt_context, pool);
+	  print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
+
+	  ntt_gcd (mt, product_ptr, NULL, g_x_file, params->s_1 / 2, NULL, nr, 
+		   ntt_context, pool, modulus);
 	}
       else
 	{
 	  /* One-pass variant. Two forward transforms and point-wise products,
 	     then addition and single inverse transform */
-	  pp1_sequence_g (NULL, NULL, g_x_ntt, g_y_ntt, b1_x, b1_y, params->P, 
-			  Delta, M, params->l, params->m_1, S_2->elem[l], 
-			  modulus, ntt_context);
+	  pp1_sequence_g (NULL, NULL, g_x_ntt, g_y_ntt, NULL, NULL, b1_x, b1_y,
+			  params->P, Delta, M, params->l, params->m_1, 
+			  S_2->elem[l], modulus, ntt_context);
 
 	  outputf (OUTPUT_VERBOSE, "Computing forward NTT of g_x");
 #ifdef _OPENMP
@@ -4493,8 +5465,8 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
 	    NTT_MUL_STEP_IFFT);
 	  print_elapsed_time (OUTPUT_VERBOSE, timestart, realstart);
 	  
-	  ntt_gcd (mt, product_ptr, g_x_ntt, params->s_1 / 2, NULL, nr, 
-		   ntt_context, modulus);
+	  ntt_gcd (mt, product_ptr, g_x_ntt, NULL, params->s_1 / 2, NULL, nr, 
+		   ntt_context, pool, modulus);
 	}
       
       outputf (OUTPUT_RESVERBOSE, "Product of R[i] = %Zd\n", product);
@@ -4512,13 +5484,19 @@ pp1fs2_ntt (mpz_t f, const mpres_t X, mpmod_t modulus,
       product_ptr = NULL;
       mpz_clear (product);
     }
-  mpzspv_clear (g_x_ntt, ntt_context);
-  if (twopass)
-    clear_list (R, nr);
+  if (g_x_file != NULL)
+    pp1fs2_ntt_files_clear (h_x_file, h_y_file, g_x_file, g_y_file);
   else
-    mpzspv_clear (g_y_ntt, ntt_context);
-  mpzspv_clear (h_x_ntt, ntt_context);
-  mpzspv_clear (h_y_ntt, ntt_context);
+    {
+      mpzspv_clear (g_x_ntt, ntt_context);
+      if (twopass)
+	clear_list (R, nr);
+      else
+	mpzspv_clear (g_y_ntt, ntt_context);
+      mpzspv_clear (h_x_ntt, ntt_context);
+      mpzspv_clear (h_y_ntt, ntt_context);
+    }
+  fs2_pool_clear (pool, modulus);
   mpzspm_clear (ntt_context);
   mpz_clear (mt);
   mpres_clear (b1_x, modulus);
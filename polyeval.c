@@ -28,6 +28,10 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 # include <unistd.h> /* for unlink */
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 #ifndef MAX
 #define MAX(a,b) (((a) > (b)) ? (a) : (b))
@@ -35,8 +39,6 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 
 /* #define DEBUG_TREEDATA */
 
-extern unsigned int Fermat;
-
 #if defined(DEBUG) || defined(DEBUG_TREEDATA)
 void
 print_vect (listz_t t, unsigned int l)
@@ -55,10 +57,49 @@ print_vect (listz_t t, unsigned int l)
 }
 #endif
 
+static unsigned int TUpTree_space (unsigned int);
+
+#ifdef _OPENMP
+/* Same as TUpTree with TreeFile = NULL, but does the two subtrees of each
+ * node in separate tasks, each with the scratch list of the thread that
+ * runs it. The subtrees write to disjoint parts of b.
+ */
+static void
+TUpTree_task (listz_t b, listz_t *Tree, unsigned int k, int dolvl,
+              unsigned int sh, mpz_t n, tree_scratch_t s)
+{
+    unsigned int m, l;
+
+    if (k < POLY_TREE_TASK_THRESHOLD)
+      {
+        TUpTree (b, Tree, k, tree_scratch_get (s), dolvl, sh, n, NULL);
+        return;
+      }
+
+    m = k / 2;
+    l = k - m;
+
+    if (dolvl == 0 || dolvl == -1)
+      TUpTree (b, Tree, k, tree_scratch_get (s), 0, sh, n, NULL);
+
+    if (dolvl > 0 || dolvl == -1)
+      {
+        if (dolvl > 0)
+          dolvl--;
+#pragma omp task
+        TUpTree_task (b, Tree + 1, l, dolvl, sh, n, s);
+#pragma omp task
+        TUpTree_task (b + l, Tree + 1, m, dolvl, sh + l, n, s);
+      }
+}
+#endif
+
 /* Computes TUpTree as described in ref[1]. k is the degree of the
  * polynomial at the root of the tree. sh is the shift we need to
  * apply to find the actual coefficients of the polynomial at the root
  * of the tree.
+ * With OpenMP, when the tree is in memory, the subtrees with at least
+ * POLY_TREE_TASK_THRESHOLD leaves are done in separate tasks.
  */
 
 void
@@ -72,6 +113,25 @@ TUpTree (listz_t b, listz_t *Tree, unsigned int k, listz_t tmp, int dolvl,
     
     if (k == 1)
       return;
+
+#ifdef _OPENMP
+    if (TreeFile == NULL && k >= 2 * POLY_TREE_TASK_THRESHOLD
+        && !omp_in_parallel () && omp_get_max_threads () > 1)
+      {
+        tree_scratch_t s;
+        unsigned int Fermat = ECM_FERMAT;
+
+        tree_scratch_init (s, tmp, TUpTree_space (l) + l);
+#pragma omp parallel num_threads(s->nthreads)
+        {
+          ECM_FERMAT = Fermat; /* in the context of each thread of the team */
+#pragma omp master
+          TUpTree_task (b, Tree, k, dolvl, sh, n, s);
+        }
+        tree_scratch_clear (s);
+        return;
+      }
+#endif
    
 #ifdef DEBUG
     fprintf (ECM_STDOUT, "In TupTree, k = %d.\n", k);
@@ -234,10 +294,10 @@ polyeval_tellegen (listz_t b, unsigned int k, listz_t *Tree, listz_t tmp,
 	     TMulGen_space (k - 1, k - 1, k - 1));
 #endif
 
-    if (Fermat)
+    if (ECM_FERMAT)
       {
         /* Schoenhage-Strassen can't do a half product faster than a full */
-        F_mul (T, invF, b, k, DEFAULT, Fermat, T + 2 * k);
+        F_mul (T, invF, b, k, DEFAULT, ECM_FERMAT, T + 2 * k);
         list_mod (T, T + k - 1, k, n);
       }
     else
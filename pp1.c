@@ -325,16 +325,27 @@ pp1 (mpz_t f, mpz_t p, mpz_t n, mpz_t go, double *B1done, double B1,
       if (use_ntt)
 	{
 	  unsigned long t, t2 = 0;
+	  size_t disk = 0;
 	  /* See what transform length that the NTT can handle (due to limited 
-	     primes and limited memory) */
+	     primes and limited memory). With a -treefile, the NTT vectors
+	     are stored on disk, which also limits the length. Only the one 
+	     pass variant does that. */
 	  t = mpzspm_max_len (n);
 	  lmax_NTT = MIN (lmax, t);
-	  if (maxmem != 0.)
+	  if (TreeFilename != NULL)
+	    disk = MAX (ecm_disk_free (TreeFilename), 1);
+	  if (disk != 0)
 	    {
-	      t = pp1fs2_maxlen (double_to_size (maxmem), n, use_ntt, 0);
+	      t = pp1fs2_maxlen ((maxmem != 0.) ? double_to_size (maxmem) : 
+				 SIZE_MAX, disk, n, use_ntt, 0);
+	      lmax_NTT = MIN (lmax_NTT, t);
+	    }
+	  else if (maxmem != 0.)
+	    {
+	      t = pp1fs2_maxlen (double_to_size (maxmem), 0, n, use_ntt, 0);
 	      t = MIN (t, lmax_NTT);
 	      /* Maybe the two pass variant lets us use a longer transform */
-	      t2 = pp1fs2_maxlen (double_to_size (maxmem), n, use_ntt, 1);
+	      t2 = pp1fs2_maxlen (double_to_size (maxmem), 0, n, use_ntt, 1);
 	      t2 = MIN (t2, lmax_NTT);
 	      if (t2 > t)
 		{
@@ -351,7 +362,7 @@ pp1 (mpz_t f, mpz_t p, mpz_t n, mpz_t go, double *B1done, double B1,
       if (maxmem != 0.)
 	{
 	  unsigned long t;
-	  t = pp1fs2_maxlen (double_to_size (maxmem), n, 0, 0);
+	  t = pp1fs2_maxlen (double_to_size (maxmem), 0, n, 0, 0);
 	  lmax_noNTT = MIN (lmax_noNTT, t);
 	  outputf (OUTPUT_DEVVERBOSE, "non-NTT can handle lmax <= %lu\n", 
 		   lmax_noNTT);
@@ -372,7 +383,7 @@ pp1 (mpz_t f, mpz_t p, mpz_t n, mpz_t go, double *B1done, double B1,
       if (faststage2_params.l > lmax_NTT)
 	use_ntt = 0;
       
-      if (maxmem != 0.)
+      if (maxmem != 0. || (use_ntt && TreeFilename != NULL))
 	{
 	  unsigned long MB;
 	  char *s;
@@ -383,10 +394,14 @@ pp1 (mpz_t f, mpz_t p, mpz_t n, mpz_t go, double *B1done, double B1,
 	  else
 	    s = " one pass";
 
-	  MB = pp1fs2_memory_use (faststage2_params.l, n, use_ntt, twopass)
-	    / 1048576;
+	  MB = pp1fs2_memory_use (faststage2_params.l, n, use_ntt, twopass,
+				  TreeFilename != NULL) / 1048576;
 	  outputf (OUTPUT_VERBOSE, "Using lmax = %lu with%s NTT which takes "
-		   "about %luMB of memory\n", faststage2_params.l, s, MB);
+		   "about %luMB of memory", faststage2_params.l, s, MB);
+	  if (use_ntt && TreeFilename != NULL)
+	    outputf (OUTPUT_VERBOSE, " and %luMB of disk", 
+		     pp1fs2_disk_use (faststage2_params.l, n) / 1048576);
+	  outputf (OUTPUT_VERBOSE, "\n");
 	}
   }
 
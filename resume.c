@@ -28,10 +28,20 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #endif
 #include <gmp.h>
 #include "ecm.h"
+#include "ecm-impl.h"
 #include "ecm-ecm.h"
 #ifdef HAVE_FCNTL_H
 #include <fcntl.h>
 #endif
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#define RESUME_MMAP 1
+#else
+#define RESUME_MMAP 0
+#endif
 
 #if defined (_MSC_VER) || defined (__MINGW32__)
 /* needed to declare GetComputerName() for write_resumefile_line() */
@@ -584,7 +594,7 @@ write_resumefile (char *fn, int method, mpz_t N, ecm_params params,
   
 
   /* Now can call write_resumefile_line to write in the file */
-  if (params->gpu == 0)
+  if (params->gpu_number_of_curves == 0)
     {
       /* Reduce stage 1 residue wrt new cofactor, in case a factor was 
          found */
@@ -610,7 +620,7 @@ write_resumefile (char *fn, int method, mpz_t N, ecm_params params,
 				 comment);
 	}
     }
-  else /* gpu case */
+  else /* several curves at once (gpu or cpu) */
     {
       size_t n_bits = mpz_sizeinbase(N, 2);
       for (i = 0; i < params->gpu_number_of_curves; i++)
@@ -646,15 +656,612 @@ write_resumefile (char *fn, int method, mpz_t N, ecm_params params,
 }
 
 
-/* For the batch mode */
-/* Write the batch exponent s in a file */
-/* Return the number of bytes written */
+/* Binary resume files.
+
+   A binary resume file holds the same residues as a text one, in a form
+   that is read without parsing. It starts with RESUME_BIN_HEADER bytes:
+   the magic string RESUME_BIN_MAGIC, the format version and 4 zero bytes.
+   Then comes one record per residue: the number of bytes of its payload
+   and a checksum of the payload, 32 bits each, followed by the payload:
+     - the method, param + 1, the curve type and a zero byte,
+     - the 64 bits of the double B1done,
+     - the integers N, X, Y, SIGMA, A, X0 and Y0 (0 when absent), each as
+       its number of bytes (32 bits) followed by its bytes, the least
+       significant one first,
+     - the strings N (the expression of N, empty if there is none), PROGRAM,
+       WHO, TIME and COMMENT, each as its length (16 bits) followed by its
+       characters.
+   All words are little-endian, so that a file written on one machine (say
+   the one which ran stage 1 on a GPU) can be read on any other. The file is
+   mapped with mmap when available, otherwise read into memory. */
+
+#define RESUME_BIN_MAGIC "GMP-ECM\033"
+#define RESUME_BIN_VERSION 1
+#define RESUME_BIN_HEADER 16
+
+typedef struct
+{
+  unsigned char *data;
+  size_t len, alloc;
+} resume_buf_t;
+
+static uint64_t
+get_le (const unsigned char *p, int bytes)
+{
+  uint64_t v = 0;
+
+  while (bytes-- > 0)
+    v = (v << 8) | p[bytes];
+  return v;
+}
+
+static void
+put_le (unsigned char *p, uint64_t v, int bytes)
+{
+  int i;
+
+  for (i = 0; i < bytes; i++, v >>= 8)
+    p[i] = (unsigned char) v;
+}
+
+/* FNV-1a hash of the len bytes at p */
+static uint32_t
+resume_bin_checksum (const unsigned char *p, size_t len)
+{
+  uint32_t h = 2166136261U;
+
+  while (len-- > 0)
+    h = (h ^ *p++) * 16777619U;
+  return h;
+}
+
+/* Makes room for n more bytes at the end of b, and returns a pointer to
+   them */
+static unsigned char *
+resume_buf_grow (resume_buf_t *b, size_t n)
+{
+  unsigned char *p;
+
+  if (b->len + n > b->alloc)
+    {
+      b->alloc = 2 * (b->len + n);
+      b->data = (unsigned char *) realloc (b->data, b->alloc);
+      if (b->data == NULL)
+        {
+          fprintf (stderr, "Cannot allocate memory in resume_buf_grow\n");
+          exit (EXIT_FAILURE);
+        }
+    }
+  p = b->data + b->len;
+  b->len += n;
+  return p;
+}
+
+static void
+resume_buf_put_mpz (resume_buf_t *b, mpz_t z)
+{
+  size_t n = (mpz_sgn (z) == 0) ? 0 : (mpz_sizeinbase (z, 2) + 7) / 8;
+
+  put_le (resume_buf_grow (b, 4), n, 4);
+  if (n > 0)
+    mpz_export (resume_buf_grow (b, n), NULL, -1, 1, 0, 0, z);
+}
+
+static void
+resume_buf_put_str (resume_buf_t *b, const char *s)
+{
+  size_t n = (s == NULL) ? 0 : strlen (s);
+
+  if (n > 65535)
+    n = 65535;
+  put_le (resume_buf_grow (b, 2), n, 2);
+  memcpy (resume_buf_grow (b, n), s, n);
+}
+
+static int
+resume_get_mpz (mpz_t z, const unsigned char **p, const unsigned char *end)
+{
+  size_t n;
+
+  if (end - *p < 4)
+    return 0;
+  n = get_le (*p, 4);
+  *p += 4;
+  if ((size_t) (end - *p) < n)
+    return 0;
+  mpz_import (z, n, -1, 1, 0, 0, *p);
+  *p += n;
+  return 1;
+}
+
+/* Reads a string into s, which has room for len characters including the
+   terminating null. A longer string is truncated. */
+static int
+resume_get_str (char *s, size_t len, const unsigned char **p,
+                const unsigned char *end)
+{
+  size_t n;
+
+  if (end - *p < 2)
+    return 0;
+  n = get_le (*p, 2);
+  *p += 2;
+  if ((size_t) (end - *p) < n)
+    return 0;
+  if (s != NULL)
+    {
+      memcpy (s, *p, (n < len) ? n : len - 1);
+      s[(n < len) ? n : len - 1] = 0;
+    }
+  *p += n;
+  return 1;
+}
+
+static void
+resume_record_init (resume_record_t *r)
+{
+  r->method = ECM_ECM;
+  mpz_init (r->x);
+  mpz_init (r->y);
+  mpcandi_t_init (&r->n);
+  mpz_init (r->sigma);
+  mpz_init (r->A);
+  mpz_init (r->x0);
+  mpz_init (r->y0);
+  r->Etype = ECM_EC_TYPE_MONTGOMERY;
+  r->param = ECM_PARAM_SUYAMA;
+  r->B1done = 0.0;
+  r->program[0] = r->who[0] = r->rtime[0] = r->comment[0] = 0;
+}
+
+static void
+resume_record_clear (resume_record_t *r)
+{
+  mpz_clear (r->x);
+  mpz_clear (r->y);
+  mpcandi_t_free (&r->n);
+  mpz_clear (r->sigma);
+  mpz_clear (r->A);
+  mpz_clear (r->x0);
+  mpz_clear (r->y0);
+}
+
+/* Appends the record of r to the binary resume file file, using b as
+   buffer. Returns 1 on success, 0 on error. */
+static int
+resume_write_bin (FILE *file, resume_record_t *r, resume_buf_t *b)
+{
+  unsigned char *p;
+  uint64_t B1bits;
+
+  b->len = 0;
+  p = resume_buf_grow (b, 8 + 4 + 8);
+  p[8] = (unsigned char) r->method;
+  p[9] = (unsigned char) (r->param + 1);
+  p[10] = (unsigned char) r->Etype;
+  p[11] = 0;
+  memcpy (&B1bits, &r->B1done, 8);
+  put_le (p + 12, B1bits, 8);
+  resume_buf_put_mpz (b, r->n.n);
+  resume_buf_put_mpz (b, r->x);
+  resume_buf_put_mpz (b, r->y);
+  resume_buf_put_mpz (b, r->sigma);
+  resume_buf_put_mpz (b, r->A);
+  resume_buf_put_mpz (b, r->x0);
+  resume_buf_put_mpz (b, r->y0);
+  resume_buf_put_str (b, r->n.cpExpr);
+  resume_buf_put_str (b, r->program);
+  resume_buf_put_str (b, r->who);
+  resume_buf_put_str (b, r->rtime);
+  resume_buf_put_str (b, r->comment);
+
+  put_le (b->data, b->len - 8, 4);
+  put_le (b->data + 4, resume_bin_checksum (b->data + 8, b->len - 8), 4);
+  return fwrite (b->data, 1, b->len, file) == b->len;
+}
+
+/* Parses the len bytes of the payload of a record at p into r. Returns 1
+   on success, 0 if the payload is malformed. */
+static int
+resume_parse_bin (resume_record_t *r, const unsigned char *p, size_t len)
+{
+  const unsigned char *end = p + len;
+  char expr[65536];
+  uint64_t B1bits;
+  mpz_t N;
+  int ok;
+
+  if (len < 12)
+    return 0;
+  r->method = p[0];
+  r->param = (int) p[1] - 1;
+  r->Etype = p[2];
+  B1bits = get_le (p + 4, 8);
+  memcpy (&r->B1done, &B1bits, 8);
+  p += 12;
+
+  mpz_init (N);
+  ok = resume_get_mpz (N, &p, end) && resume_get_mpz (r->x, &p, end)
+    && resume_get_mpz (r->y, &p, end) && resume_get_mpz (r->sigma, &p, end)
+    && resume_get_mpz (r->A, &p, end) && resume_get_mpz (r->x0, &p, end)
+    && resume_get_mpz (r->y0, &p, end)
+    && resume_get_str (expr, sizeof (expr), &p, end)
+    && resume_get_str (r->program, 256, &p, end)
+    && resume_get_str (r->who, 256, &p, end)
+    && resume_get_str (r->rtime, 256, &p, end)
+    && resume_get_str (r->comment, 256, &p, end)
+    && mpz_sgn (N) > 0 && r->method <= ECM_PP1;
+  if (ok)
+    {
+      mpcandi_t_add_candidate (&r->n, N, (expr[0] != 0) ? expr : NULL, 0);
+      mpz_mod (r->x, r->x, N);
+      mpz_mod (r->y, r->y, N);
+    }
+  mpz_clear (N);
+  return ok;
+}
+
+/* Reads the next residue of the binary file of R into r. Returns 1 if a
+   residue was read, 0 at the end of the file. Records with a bad checksum
+   are skipped, like the lines of a text file. */
+static int
+resume_read_bin (resume_reader_t *R, resume_record_t *r)
+{
+  while (R->size - R->pos >= 8)
+    {
+      const unsigned char *p = R->map + R->pos;
+      size_t len = get_le (p, 4);
+
+      if (len > R->size - R->pos - 8)
+        {
+          fprintf (stderr, "Binary resume file is truncated\n");
+          R->pos = R->size;
+          return 0;
+        }
+      R->pos += 8 + len;
+      if (resume_bin_checksum (p + 8, len) != get_le (p + 4, 4))
+        fprintf (stderr, "Resume file record has bad checksum\n");
+      else if (!resume_parse_bin (r, p + 8, len))
+        fprintf (stderr, "Resume file record is malformed\n");
+      else
+        return 1;
+    }
+  return 0;
+}
+
+/* Reads the next residue of R, in either format, into r */
+static int
+resume_read_record (resume_reader_t *R, resume_record_t *r)
+{
+  if (R->fd == NULL)
+    return resume_read_bin (R, r);
+
+  /* the optional fields */
+  mpz_set_ui (r->y, 0);
+  mpz_set_ui (r->x0, 0);
+  mpz_set_ui (r->y0, 0);
+  return read_resumefile_line (&r->method, r->x, r->y, &r->n, r->sigma, r->A,
+                               r->x0, r->y0, &r->Etype, &r->param,
+                               &r->B1done, r->program, r->who, r->rtime,
+                               r->comment, R->fd);
+}
+
+/* Opens the resume file fn (stdin if fn is "-"), which can be a text or a
+   binary one. Returns 0 on success, 1 on error. */
 int
-write_s_in_file (char *fn, mpz_t s)
+resume_reader_open (resume_reader_t *R, const char *fn)
 {
+  char magic[8];
   FILE *file;
-  int ret = 0;
+  size_t n;
+
+  R->fd = NULL;
+  R->map = NULL;
+  R->size = R->pos = 0;
+  R->nahead = R->alloc = 0;
+  R->ahead = NULL;
+
+  /* a binary file cannot be mapped from stdin */
+  if (strcmp (fn, "-") == 0)
+    {
+      R->fd = stdin;
+      return 0;
+    }
+
+  file = fopen (fn, "rb");
+  if (file == NULL)
+    return 1;
+  n = fread (magic, 1, 8, file);
+  fclose (file);
+  if (n < 8 || memcmp (magic, RESUME_BIN_MAGIC, 8) != 0)
+    {
+      R->fd = fopen (fn, "r");
+      return R->fd == NULL;
+    }
+
+#if RESUME_MMAP
+  {
+    int fd = open (fn, O_RDONLY);
+    struct stat st;
+
+    if (fd < 0)
+      return 1;
+    if (fstat (fd, &st) != 0)
+      {
+        close (fd);
+        return 1;
+      }
+    R->size = st.st_size;
+    R->map = (unsigned char *) mmap (NULL, R->size, PROT_READ, MAP_PRIVATE,
+                                     fd, 0);
+    close (fd);
+    if (R->map == (unsigned char *) MAP_FAILED)
+      {
+        R->map = NULL;
+        return 1;
+      }
+#ifdef MADV_SEQUENTIAL
+    /* the records are read once, in order */
+    madvise (R->map, R->size, MADV_SEQUENTIAL);
+#endif
+  }
+#else
+  file = fopen (fn, "rb");
+  if (file == NULL)
+    return 1;
+  fseek (file, 0, SEEK_END);
+  R->size = ftell (file);
+  rewind (file);
+  R->map = (unsigned char *) malloc (R->size);
+  if (R->map == NULL || fread (R->map, 1, R->size, file) != R->size)
+    {
+      fclose (file);
+      free (R->map);
+      R->map = NULL;
+      return 1;
+    }
+  fclose (file);
+#endif
+
+  if (R->size < RESUME_BIN_HEADER
+      || get_le (R->map + 8, 4) != RESUME_BIN_VERSION)
+    {
+      fprintf (stderr, "Resume file %s has an unknown binary format\n", fn);
+      resume_reader_close (R);
+      return 1;
+    }
+  R->pos = RESUME_BIN_HEADER;
+  return 0;
+}
+
+void
+resume_reader_close (resume_reader_t *R)
+{
+  unsigned int i;
+
+  if (R->fd != NULL && R->fd != stdin)
+    fclose (R->fd);
+  R->fd = NULL;
+  if (R->map != NULL)
+#if RESUME_MMAP
+    munmap (R->map, R->size);
+#else
+    free (R->map);
+#endif
+  R->map = NULL;
+  for (i = 0; i < R->alloc; i++)
+    resume_record_clear (R->ahead + i);
+  free (R->ahead);
+  R->ahead = NULL;
+  R->nahead = R->alloc = 0;
+}
+
+/* Returns the k-th residue after the ones returned by resume_reader_next
+   (k = 0 for the next one), reading it ahead if needed, or NULL if the
+   file has fewer residues. It remains valid until the next call to
+   resume_reader_next. */
+resume_record_t *
+resume_reader_peek (resume_reader_t *R, unsigned int k)
+{
+  while (R->nahead <= k)
+    {
+      if (R->nahead == R->alloc)
+        {
+          unsigned int i, alloc = 2 * R->alloc + 1;
+
+          R->ahead = (resume_record_t *)
+            realloc (R->ahead, alloc * sizeof (resume_record_t));
+          if (R->ahead == NULL)
+            {
+              fprintf (stderr, "Cannot allocate memory in "
+                       "resume_reader_peek\n");
+              exit (EXIT_FAILURE);
+            }
+          for (i = R->alloc; i < alloc; i++)
+            resume_record_init (R->ahead + i);
+          R->alloc = alloc;
+        }
+      if (!resume_read_record (R, R->ahead + R->nahead))
+        return NULL;
+      R->nahead++;
+    }
+  return R->ahead + k;
+}
+
+/* Drops the first residue read ahead, keeping its entry for later use */
+static void
+resume_reader_pop (resume_reader_t *R)
+{
+  resume_record_t r = R->ahead[0];
 
+  memmove (R->ahead, R->ahead + 1, (R->nahead - 1) * sizeof (resume_record_t));
+  R->ahead[--R->nahead] = r;
+}
+
+/* Same as read_resumefile_line, for the next residue of R */
+int
+resume_reader_next (resume_reader_t *R, int *method, mpz_t x, mpz_t y,
+                    mpcandi_t *n, mpz_t sigma, mpz_t A, mpz_t x0, mpz_t y0,
+                    int *Etype, int *param, double *b1, char *program,
+                    char *who, char *rtime, char *comment)
+{
+  resume_record_t *r;
+
+  /* nothing read ahead: read the text file as without R */
+  if (R->nahead == 0 && R->fd != NULL)
+    return read_resumefile_line (method, x, y, n, sigma, A, x0, y0, Etype,
+                                 param, b1, program, who, rtime, comment,
+                                 R->fd);
+
+  r = resume_reader_peek (R, 0);
+  if (r == NULL)
+    return 0;
+  *method = r->method;
+  mpz_set (x, r->x);
+  mpz_set (y, r->y);
+  mpcandi_t_add_candidate (n, r->n.n, r->n.cpExpr, 0);
+  mpz_set (sigma, r->sigma);
+  mpz_set (A, r->A);
+  mpz_set (x0, r->x0);
+  mpz_set (y0, r->y0);
+  *Etype = r->Etype;
+  *param = r->param;
+  *b1 = r->B1done;
+  if (program != NULL)
+    strcpy (program, r->program);
+  if (who != NULL)
+    strcpy (who, r->who);
+  if (rtime != NULL)
+    strcpy (rtime, r->rtime);
+  if (comment != NULL)
+    strcpy (comment, r->comment);
+  resume_reader_pop (R);
+  return 1;
+}
+
+/* Writes r as a line of a text resume file */
+static void
+resume_write_text (FILE *file, resume_record_t *r)
+{
+  mpz_t checksum;
+
+  mpz_init (checksum);
+  mpz_set_d (checksum, r->B1done);
+  fprintf (file, "METHOD=%s;", (r->method == ECM_PM1) ? "P-1"
+           : (r->method == ECM_PP1) ? "P+1" : "ECM");
+  if (r->method == ECM_ECM)
+    {
+      if (r->param != ECM_PARAM_DEFAULT)
+        {
+          fprintf (file, " PARAM=%d;", r->param);
+          mpz_mul_ui (checksum, checksum, (r->param + 1) % CHKSUMMOD);
+        }
+      if (r->Etype != ECM_EC_TYPE_MONTGOMERY)
+        fprintf (file, " ETYPE=%d;", r->Etype);
+      if (mpz_sgn (r->sigma) != 0)
+        {
+          gmp_fprintf (file, " SIGMA=%Zd;", r->sigma);
+          mpz_mul_ui (checksum, checksum, mpz_fdiv_ui (r->sigma, CHKSUMMOD));
+        }
+      if (mpz_sgn (r->A) != 0)
+        {
+          gmp_fprintf (file, " A=%Zd;", r->A);
+          mpz_mul_ui (checksum, checksum, mpz_fdiv_ui (r->A, CHKSUMMOD));
+        }
+    }
+  fprintf (file, " B1=%.0f; N=", r->B1done);
+  if (r->n.cpExpr)
+    fprintf (file, "%s", r->n.cpExpr);
+  else
+    mpz_out_str (file, 10, r->n.n);
+  gmp_fprintf (file, "; X=0x%Zx;", r->x);
+  mpz_mul_ui (checksum, checksum, mpz_fdiv_ui (r->n.n, CHKSUMMOD));
+  mpz_mul_ui (checksum, checksum, mpz_fdiv_ui (r->x, CHKSUMMOD));
+  fprintf (file, " CHECKSUM=%u;",
+           (unsigned int) mpz_fdiv_ui (checksum, CHKSUMMOD));
+  mpz_clear (checksum);
+  if (r->program[0] != 0)
+    fprintf (file, " PROGRAM=%s;", r->program);
+  if (mpz_sgn (r->y) != 0)
+    gmp_fprintf (file, " Y=0x%Zx;", r->y);
+  gmp_fprintf (file, " X0=0x%Zx;", r->x0);
+  if (mpz_sgn (r->y0) != 0)
+    gmp_fprintf (file, " Y0=0x%Zx;", r->y0);
+  if (r->who[0] != 0)
+    fprintf (file, " WHO=%s;", r->who);
+  if (r->comment[0] != 0)
+    fprintf (file, " COMMENT=%s;", r->comment);
+  if (r->rtime[0] != 0)
+    fprintf (file, " TIME=%s;", r->rtime);
+  fprintf (file, "\n");
+}
+
+/* Converts the resume file in to the other format: a text file to a binary
+   one and a binary file to a text one, written to out. Returns 0 on
+   success, 1 on error. */
+int
+resume_convert (const char *in, const char *out)
+{
+  resume_reader_t R;
+  resume_record_t *r;
+  resume_buf_t b = {NULL, 0, 0};
+  unsigned long count = 0;
+  FILE *file;
+  int binary, ok = 1;
+
+  if (resume_reader_open (&R, in) != 0)
+    {
+      fprintf (stderr, "Could not open file %s for reading\n", in);
+      return 1;
+    }
+  binary = R.fd == NULL;
+  file = fopen (out, binary ? "w" : "wb");
+  if (file == NULL)
+    {
+      fprintf (stderr, "Could not open file %s for writing\n", out);
+      resume_reader_close (&R);
+      return 1;
+    }
+
+  if (!binary)
+    {
+      unsigned char header[RESUME_BIN_HEADER];
+
+      memset (header, 0, RESUME_BIN_HEADER);
+      memcpy (header, RESUME_BIN_MAGIC, 8);
+      put_le (header + 8, RESUME_BIN_VERSION, 4);
+      ok = fwrite (header, 1, RESUME_BIN_HEADER, file) == RESUME_BIN_HEADER;
+    }
+  while (ok && (r = resume_reader_peek (&R, 0)) != NULL)
+    {
+      if (binary)
+        resume_write_text (file, r);
+      else
+        ok = resume_write_bin (file, r, &b);
+      resume_reader_pop (&R);
+      count++;
+    }
+  ok = (fclose (file) == 0) && ok;
+  resume_reader_close (&R);
+  free (b.data);
+
+  if (!ok)
+    {
+      fprintf (stderr, "Could not write file %s\n", out);
+      return 1;
+    }
+  printf ("Converted %lu residues of %s to the %s format in %s\n", count, in,
+          binary ? "text" : "binary", out);
+  return 0;
+}
+
+/* For the batch mode */
+/* Write the batch exponent s for B1 and param in a file, in the format of
+   the cache files (see cachefile.c) */
+/* Return the number of bytes written */
+int
+write_s_in_file (char *fn, mpz_t s, double B1, int param)
+{
 #ifdef DEBUG
   if (fn == NULL)
     {
@@ -663,23 +1270,20 @@ write_s_in_file (char *fn, mpz_t s)
     }
 #endif
   
-  file = fopen (fn, "wb");
-  if (file == NULL)
+  if (batch_s_write (fn, s, B1, param) != 0)
     {
-      fprintf (stderr, "Could not open file %s for writing\n", fn);
+      fprintf (stderr, "Could not write file %s\n", fn);
       return 0;
     }
   
-  ret = mpz_out_raw (file, s);
-  
-  fclose (file);
-  return ret;
+  return CACHEFILE_HEADER + mpz_size (s) * sizeof (mp_limb_t);
 }
 
 /* For the batch mode */
-/* read the batch exponent s from a file */
+/* read the batch exponent s for B1 and param from a file, written by
+   write_s_in_file, or by mpz_out_raw in earlier versions */
 int
-read_s_from_file (mpz_t s, char *fn, double B1) 
+read_s_from_file (mpz_t s, char *fn, double B1, int param) 
 {
   FILE *file;
   mpz_t tmp, tmp2;
@@ -700,6 +1304,27 @@ read_s_from_file (mpz_t s, char *fn, double B1)
       fprintf (stderr, "Could not open file %s for reading\n", fn);
       return 1;
     }
+
+  ret = batch_s_read (s, fn, B1, param);
+  if (ret == 1)
+    {
+      fclose (file);
+      fprintf (stderr, "Error, the value of the batch product in %s "
+               "does not correspond to B1=%1.0f and param=%d.\n", fn, B1,
+               param);
+      return 1;
+    }
+  else if (ret == 2)
+    {
+      fclose (file);
+      fprintf (stderr, "read_s_from_file: could not read %s\n", fn);
+      return 1;
+    }
+  else if (ret == 0) /* the header identifies B1, no further check needed */
+    {
+      fclose (file);
+      return 0;
+    }
  
   ret = mpz_inp_raw (s, file);
   if (ret == 0)
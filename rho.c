@@ -72,10 +72,18 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 
 void rhoinit (int, int); /* used in stage2.c */
 
+#if defined(TESTDRIVE)
 static double *rhotable = NULL;
 static int invh = 0;
 static double h = 0.;
 static int tablemax = 0;
+#else
+/* the table of the current context, see ecm_ctx_get */
+#define rhotable (ECM_CTX->rhotable)
+#define invh (ECM_CTX->rho_invh)
+#define h (ECM_CTX->rho_h)
+#define tablemax (ECM_CTX->rho_tablemax)
+#endif
 #if defined(TESTDRIVE)
 #define PRIME_PI_MAX 10000
 #define PRIME_PI_MAP(x) (((x)+1)/2)
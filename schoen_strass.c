@@ -38,9 +38,9 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #define CHECKSUM 1
 */
 
-static mpz_t gt;
-static int gt_inited = 0;
-unsigned int Fermat;
+/* temporary of the current context, freed by F_clear */
+#define gt (ECM_CTX->gt)
+#define gt_inited (ECM_CTX->gt_inited)
 
 #define CACHESIZE 512U
 
@@ -30,7 +30,6 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #endif
 #ifdef TESTDRIVE
 #include <stdio.h>
-FILE *ECM_STDOUT, *ECM_STDERR;
 #endif
 
 /*****************************************************************
@@ -28,6 +28,7 @@ MA 02110-1301, USA.
 #define _SP_H
 
 #include "config.h"
+#include <stdio.h> /* needed for "FILE *" */
 #include <stdlib.h>
 #include "basicdefs.h"
 #include "ecm-gmp.h"
@@ -46,6 +47,8 @@ extern size_t PREREVERTDIVISION_NTT_THRESHOLD;
 extern size_t POLYINVERT_NTT_THRESHOLD;
 extern size_t POLYEVALT_NTT_THRESHOLD;
 extern size_t MPZSPV_NORMALISE_STRIDE;
+extern size_t NTT_GFP_FOURSTEP_THRESHOLD;
+extern size_t MPZSPV_TO_MPZV_TREE_THRESHOLD;
 #endif
 
 #include <gmp.h>
@@ -95,6 +98,22 @@ typedef mp_limb_t UDItype;
    and the naive method for fewer moduli. We must have I0_THRESHOLD >= 1. */
 #define I0_THRESHOLD 7
 
+/* mpzspv_to_mpzv uses the product tree for sp_num >= this threshold, and
+   the quadratic explicit CRT below: since the latter only uses mpn_addmul_1,
+   the tree is faster only when the top products use fast multiplication.
+   This default is overridden by the value tune finds in ecm-params.h */
+#if !defined (TUNE) && !defined (NTT_GFP_FOURSTEP_THRESHOLD)
+#define NTT_GFP_FOURSTEP_THRESHOLD 20
+#endif
+#if !defined (TUNE) && !defined (MPZSPV_TO_MPZV_TREE_THRESHOLD)
+#define MPZSPV_TO_MPZV_TREE_THRESHOLD 1024
+#endif
+/* in mpzspv_to_mpzv, the subtrees of 2^MPZSPV_TO_MPZV_LEAF_DEPTH moduli
+   are handled by a linear combination */
+#ifndef MPZSPV_TO_MPZV_LEAF_DEPTH
+#define MPZSPV_TO_MPZV_LEAF_DEPTH 6
+#endif
+
 /*********
  * TYPES *
  *********/
@@ -140,11 +159,17 @@ typedef sp_t * spv_t;
 /* length of a spv */
 typedef unsigned long spv_size_t;
 
+/* the transform lengths are smaller than 2^NTT_GFP_MAX_LOG2_LEN */
+#define NTT_GFP_MAX_LOG2_LEN 32
+
 typedef struct
 {
   spv_t ntt_roots;
   spv_size_t twiddle_size;
   spv_t twiddle;
+  spv_t twiddle_shoup;  /* sp_mul_shoup_pre of the twiddle factors */
+  spv_t fourstep[NTT_GFP_MAX_LOG2_LEN]; /* tables of the four-step transform
+                                           of length 2^i, or NULL */
 } __sp_nttdata;
 
 typedef __sp_nttdata sp_nttdata_t[1];
@@ -196,9 +221,15 @@ typedef struct
     mpzv_t crt1, crt2;
     sp_t *crt3, **crt4, *crt5;
 
-    /* product tree to speed up conversion from mpz to sp */
+    /* product tree to speed up the CRT precomputation and the conversions
+       between mpz and sp */
     mpzv_t *T;            /* product tree */
     unsigned int d;       /* ceil(log(sp_num)/log(2)) */
+
+    unsigned int refs;    /* number of mpzspm_init calls not yet cleared */
+
+    void *map;            /* if not NULL, the cache file the sp_t arrays */
+    size_t map_size;      /* point into, see cachefile_map */
   } __mpzspm_struct;
 
 typedef __mpzspm_struct * mpzspm_t;
@@ -209,6 +240,22 @@ typedef __mpzspm_struct * mpzspm_t;
 
 typedef spv_t * mpzspv_t;
 
+/* mpzspv_t stored in a file, see mpzspv_file_init() */
+
+typedef struct
+  {
+    struct __listz_handle_struct *handle; /* one entry per prime */
+    spv_size_t len;       /* number of residues per prime */
+    mpzspm_t mpzspm;
+  } __mpzspv_file_struct;
+
+typedef __mpzspv_file_struct * mpzspv_file_t;
+
+/* Reads the primes of a mpzspv_file_t in turn, see 
+   mpzspv_file_iterator_init() */
+
+typedef struct __listz_iterator_struct * mpzspv_file_iterator_t;
+
 
 /*************
  * FUNCTIONS *
@@ -425,6 +472,48 @@ sp_sqr (sp_t x, sp_t m, sp_t d)
   return sp_udiv_rem (u, v, m, d);
 }
 
+/* Shoup's multiplication by a constant w modulo m: with
+   wp = floor(w * 2^SP_TYPE_BITS / m), we get q = floor(x * wp / 2^SP_TYPE_BITS)
+   which is floor(x * w / m) or one less, thus x * w - q * m is in [0, 2m)
+   and can be computed modulo 2^SP_TYPE_BITS. This needs one high product
+   and two low products, instead of two full products for sp_mul.
+   Since w * 2^SP_TYPE_BITS - wp * m = w * r mod m, where r = 2^SP_TYPE_BITS
+   mod m, wp is obtained from an exact division, with minv = 1/m mod
+   2^SP_TYPE_BITS, which avoids a hardware division. */
+static inline sp_t
+sp_mul_shoup_pre (sp_t w, sp_t r, sp_t minv, sp_t m, sp_t d)
+{
+  return ((sp_t) 0 - sp_mul (w, r, m, d)) * minv;
+}
+
+/* Set *r = 2^SP_TYPE_BITS mod m and *minv = 1/m mod 2^SP_TYPE_BITS for
+   sp_mul_shoup_pre, with Newton's iteration for the inverse: each step
+   doubles the number of correct bits, starting from 3 */
+static inline void
+sp_mul_shoup_init (sp_t *r, sp_t *minv, sp_t m)
+{
+  int i;
+
+  *r = ((sp_t) 0 - m) % m;
+  for (*minv = m, i = 0; i < 5; i++)
+    *minv *= (sp_t) 2 - m * *minv;
+}
+
+/* x*w mod m, where wp = sp_mul_shoup_pre (w, ...), for any x < 2^SP_TYPE_BITS */
+static inline sp_t
+sp_mul_shoup (sp_t x, sp_t w, sp_t wp, sp_t m)
+{
+  sp_t q, r;
+#if SP_TYPE_BITS == W_TYPE_SIZE
+  ATTRIBUTE_UNUSED mp_limb_t tmp;
+  umul_ppmm (q, tmp, x, wp);
+#else
+  q = (sp_t) (((mp_limb_t) x * wp) >> SP_TYPE_BITS);
+#endif
+  r = x * w - q * m;
+  return (r >= m) ? r - m : r;
+}
+
 #define sp_neg(x,m) ((x) == (sp_t) 0 ? (sp_t) 0 : (m) - (x))
 
 /* Returns x^a % m, uses a right-to-left powering ladder */
@@ -488,12 +577,15 @@ void spv_random (spv_t, spv_size_t, sp_t);
 
 void spv_ntt_gfp_dif (spv_t, spv_size_t, spm_t);
 void spv_ntt_gfp_dit (spv_t, spv_size_t, spm_t);
+int spv_ntt_gfp_fourstep_init (spm_t, spv_size_t);
+void spv_ntt_gfp_fourstep_clear (spm_t);
 
 /* mpzspm */
 
 spv_size_t mpzspm_max_len (mpz_t);
 mpzspm_t mpzspm_init (spv_size_t, mpz_t);
 void mpzspm_clear (mpzspm_t);
+void mpzspm_clear_cache (void);
 
 /* mpzspv */
 
@@ -523,10 +615,26 @@ void mpzspv_mul_ntt (mpzspv_t, spv_size_t, mpzspv_t, spv_size_t, spv_size_t,
     mpzspv_t, spv_size_t, spv_size_t, spv_size_t, int, spv_size_t, mpzspm_t, 
     int);
 void mpzspv_random (mpzspv_t, spv_size_t, spv_size_t, mpzspm_t);
+void spv_to_dct1 (spv_t, const spv_t, spv_size_t, spv_size_t, spv_t, 
+    const spm_t);
 void mpzspv_to_dct1 (mpzspv_t, mpzspv_t, spv_size_t, spv_size_t, mpzspv_t, 
     mpzspm_t);
+void spv_mul_by_dct (spv_t, const spv_t, spv_size_t, const spm_t, int);
 void mpzspv_mul_by_dct (mpzspv_t, const mpzspv_t, spv_size_t, const mpzspm_t, 
     int);
 void mpzspv_sqr_reciprocal (mpzspv_t, spv_size_t, const mpzspm_t);
+mpzspv_file_t mpzspv_file_init (const char *, spv_size_t, mpzspm_t);
+void mpzspv_file_clear (mpzspv_file_t);
+void mpzspv_file_read_spv (mpzspv_file_t, unsigned int, spv_size_t, spv_t, 
+    spv_size_t);
+void mpzspv_file_write_spv (mpzspv_file_t, unsigned int, spv_size_t, 
+    const spv_t, spv_size_t);
+void mpzspv_file_read (mpzspv_file_t, spv_size_t, mpzspv_t, spv_size_t);
+void mpzspv_file_write (mpzspv_file_t, spv_size_t, const mpzspv_t, 
+    spv_size_t);
+mpzspv_file_iterator_t mpzspv_file_iterator_init (mpzspv_file_t, 
+    unsigned int, unsigned int);
+spv_t mpzspv_file_iterator_read (mpzspv_file_iterator_t);
+void mpzspv_file_iterator_clear (mpzspv_file_iterator_t);
 
 #endif /* _SP_H */
@@ -49,7 +49,8 @@ nttdata_init (const sp_t sp, const sp_t mul_c,
 		const sp_t prim_root, const spv_size_t log2_len,
 		sp_nttdata_t data, spv_size_t breakover)
 {
-  spv_t r, t;
+  spv_t r, t, s;
+  sp_t r0, minv;
   spv_size_t i, j, k;
 
   r = data->ntt_roots = 
@@ -69,15 +70,35 @@ nttdata_init (const sp_t sp, const sp_t mul_c,
       sp_aligned_free (r);
       return 0;
     }
+  s = data->twiddle_shoup = (spv_t) sp_aligned_malloc (sizeof(sp_t) << k);
+  if (s == NULL)
+    {
+      sp_aligned_free (t);
+      sp_aligned_free (r);
+      return 0;
+    }
   data->twiddle_size = 1 << k;
 
+  sp_mul_shoup_init (&r0, &minv, sp);
+
+  /* u = t[j] * 2^SP_TYPE_BITS mod sp gives s[j], see sp_mul_shoup_pre */
   for (i = k; i; i--) 
     {
       sp_t w = r[i];
-      for (j = t[0] = 1; j < ((spv_size_t) 1 << (i-1)); j++) 
-      	t[j] = sp_mul (t[j-1], w, sp, mul_c);
+      sp_t wp = sp_mul_shoup_pre (w, r0, minv, sp, mul_c);
+      sp_t u = r0;
+
+      t[0] = 1;
+      s[0] = ((sp_t) 0 - u) * minv;
+      for (j = 1; j < ((spv_size_t) 1 << (i-1)); j++) 
+        {
+      	  t[j] = sp_mul_shoup (t[j-1], w, wp, sp);
+          u = sp_mul_shoup (u, w, wp, sp);
+          s[j] = ((sp_t) 0 - u) * minv;
+        }
 
       t += j;
+      s += j;
     }
   return 1;
 }
@@ -87,6 +108,7 @@ nttdata_clear(sp_nttdata_t data)
 {
   sp_aligned_free(data->ntt_roots);
   sp_aligned_free(data->twiddle);
+  sp_aligned_free(data->twiddle_shoup);
 }
 
 /* Compute some constants, including a primitive n'th root of unity. 
@@ -98,7 +120,7 @@ spm_init (spv_size_t n, sp_t sp, mp_size_t k)
 {
   sp_t a, b, bd, sc;
   spv_size_t q, nc, ntt_power;
-  spm_t spm = (spm_t) malloc (sizeof (__spm_struct));
+  spm_t spm = (spm_t) calloc (1, sizeof (__spm_struct));
   if (spm == NULL)
     return NULL;
 
@@ -230,7 +252,12 @@ spm_init (spv_size_t n, sp_t sp, mp_size_t k)
           spm->scratch = (spv_t) sp_aligned_malloc (MAX_NTT_BLOCK_SIZE *
                                                     sizeof(sp_t));
           if (spm->scratch != NULL)
-            return spm;
+            {
+              if (spv_ntt_gfp_fourstep_init (spm, ntt_power) == 0)
+                return spm;
+              spv_ntt_gfp_fourstep_clear (spm);
+              sp_aligned_free (spm->scratch);
+            }
           nttdata_clear (spm->inttdata);
         }
       nttdata_clear (spm->nttdata);
@@ -244,6 +271,7 @@ spm_clear (spm_t spm)
 {
   nttdata_clear (spm->nttdata);
   nttdata_clear (spm->inttdata);
+  spv_ntt_gfp_fourstep_clear (spm);
   sp_aligned_free (spm->scratch);
   free (spm);
 }
@@ -33,8 +33,6 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #include "ecm-impl.h"
 #include "sp.h"
 
-extern unsigned int Fermat;
-
 /* r <- Dickson(n,a)(x) */
 static void 
 dickson (mpz_t r, mpz_t x, unsigned int n, int a)
@@ -346,10 +344,10 @@ stage2 (mpz_t f, void *X, mpmod_t modulus, unsigned long dF, unsigned long k,
 
   st0 = cputime ();
 
-  Fermat = 0;
+  ECM_FERMAT = 0;
   if (modulus->repr == ECM_MOD_BASE2 && modulus->Fermat > 0)
     {
-      Fermat = modulus->Fermat;
+      ECM_FERMAT = modulus->Fermat;
       use_ntt = 0; /* don't use NTT for Fermat numbers */
     }
 
@@ -764,7 +762,7 @@ clear_T:
   if (use_ntt)
     mpzspm_clear (mpzspm);
   
-  if (Fermat)
+  if (ECM_FERMAT)
     F_clear ();
   
 
@@ -0,0 +1,469 @@
+/* stage2bsgs.c - baby-step giant-step stage 2 of ECM for many curves.
+
+Copyright 2026 Paul Zimmermann, Alexander Kruppa.
+
+This file is part of the ECM Library.
+
+The ECM Library is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+The ECM Library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with the ECM Library; see the file COPYING.LIB.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* The standard continuation with Montgomery's prime pairing, for the
+   stage 1 residues of many curves (as computed by gpu_ecm or
+   cpu_batch_ecm), with small B2.
+
+   Each prime B2min < p <= B2 is written p = m*D - j or p = m*D + j with
+   0 < j < D and gcd(j, D) = 1, and x(m*D*Q) - x(j*Q) vanishes mod a prime
+   factor of n if p*Q is zero mod that factor, thus a pair (m, j) covers
+   both m*D-j and m*D+j. A prime p = m*D + j (0 < j < D) is covered by
+   (m, j) or by (m+1, D-j); choosing the pairs in increasing order of p,
+   and (m+1, D-j) for a prime that is not covered yet, gives the least
+   number of pairs. The pairs only depend on B2min, B2 and D, and are
+   computed once for all curves.
+
+   For each curve, the baby steps x(j*Q) are made affine with one modular
+   inversion for BSGS_BATCH of them, from several curves at once (see
+   compute_all_inverses), then each pair costs two multiplications, with
+   the giant steps m*D*Q in projective coordinates. */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ecm-impl.h"
+#include "getprime_r.h"
+#include "addlaws.h"
+
+#define BSGS_BATCH 16384 /* baby steps made affine together */
+
+typedef struct
+{
+  unsigned long D;
+  unsigned long nb;    /* number of baby steps */
+  unsigned long *j;    /* the baby steps 0 < j < D with gcd(j, D) = 1 */
+  uint64_t m0, m1;     /* the giant steps m*D for m0 <= m <= m1 */
+  uint32_t *pair;      /* the baby steps (as indices in j) paired with m*D */
+  uint64_t *start;     /* are pair[start[m-m0]] to pair[start[m-m0+1]-1] */
+  uint64_t npairs, nprimes;
+} bsgs_plan_t;
+
+/* Chooses D that minimizes the number of multiplications for one curve:
+   6 for each giant step, 6 for each odd j < D, and about 4 to make a
+   baby step affine. */
+static unsigned long
+bsgs_choose_D (uint64_t B2min, uint64_t B2)
+{
+  unsigned long D, bestD = 30;
+  double c, best = 1e300;
+
+  for (D = 30; D <= 1UL << 22 && D / 2 <= B2 - B2min + 30; D += 30)
+    {
+      c = 6.0 * (double) (B2 - B2min) / (double) D + 3.0 * (double) D
+        + 4.0 * (double) eulerphi (D);
+      if (c < best)
+        {
+          best = c;
+          bestD = D;
+        }
+    }
+  return bestD;
+}
+
+/* Computes the pairs for the primes B2min < p <= B2. Returns 0 on success,
+   1 if there is not enough memory. */
+static int
+bsgs_plan_init (bsgs_plan_t *plan, uint64_t B2min, uint64_t B2)
+{
+  unsigned long D, j, *idx = NULL;
+  unsigned char *covered = NULL;
+  uint64_t p, m, M, J, q, base, len, alloc;
+  prime_info_t prime_info;
+
+  memset (plan, 0, sizeof (bsgs_plan_t));
+  plan->D = D = bsgs_choose_D (B2min, B2);
+  plan->nb = eulerphi (D);
+  plan->j = (unsigned long *) malloc (plan->nb * sizeof (unsigned long));
+  idx = (unsigned long *) malloc (D * sizeof (unsigned long));
+  /* covered[(q - base) / 2] is set for the odd q > p that are covered */
+  base = B2min + 1;
+  len = (B2 - B2min) / 2 + D + 2;
+  covered = (unsigned char *) calloc (len / 8 + 1, 1);
+  alloc = 1024;
+  plan->pair = (uint32_t *) malloc (alloc * sizeof (uint32_t));
+  plan->m0 = B2min / D + 1;
+  plan->m1 = B2 / D + 1;
+  plan->start = (uint64_t *) calloc (plan->m1 - plan->m0 + 2,
+                                     sizeof (uint64_t));
+  if (plan->j == NULL || idx == NULL || covered == NULL || plan->pair == NULL
+      || plan->start == NULL)
+    goto error;
+
+  for (j = 1, plan->nb = 0; j < D; j++)
+    if (gcd (j, D) == 1)
+      {
+        idx[j] = plan->nb;
+        plan->j[plan->nb++] = j;
+      }
+
+  prime_info_init (prime_info);
+  for (p = getprime_mt (prime_info); p <= B2; p = getprime_mt (prime_info))
+    {
+      if (p <= B2min || D % p == 0)
+        continue;
+      plan->nprimes++;
+      if (covered[(p - base) / 16] & (1 << ((p - base) / 2 % 8)))
+        continue;
+      /* p = m*D + j is covered by (M, J) = (m+1, D-j), which also covers
+         M*D + J */
+      m = p / D;
+      M = m + 1;
+      J = D - (p - m * D);
+      q = M * D + J;
+      covered[(q - base) / 16] |= 1 << ((q - base) / 2 % 8);
+      if (plan->npairs == alloc)
+        {
+          uint32_t *t;
+
+          alloc *= 2;
+          t = (uint32_t *) realloc (plan->pair, alloc * sizeof (uint32_t));
+          if (t == NULL)
+            {
+              prime_info_clear (prime_info);
+              goto error;
+            }
+          plan->pair = t;
+        }
+      plan->pair[plan->npairs++] = idx[J];
+      plan->start[M - plan->m0 + 1] = plan->npairs;
+    }
+  prime_info_clear (prime_info);
+
+  /* the giant steps without pairs */
+  for (m = plan->m0; m <= plan->m1; m++)
+    if (plan->start[m - plan->m0 + 1] < plan->start[m - plan->m0])
+      plan->start[m - plan->m0 + 1] = plan->start[m - plan->m0];
+
+  free (idx);
+  free (covered);
+  return 0;
+
+ error:
+  free (idx);
+  free (covered);
+  free (plan->j);
+  free (plan->pair);
+  free (plan->start);
+  return 1;
+}
+
+static void
+bsgs_plan_clear (bsgs_plan_t *plan)
+{
+  free (plan->j);
+  free (plan->pair);
+  free (plan->start);
+}
+
+/* Computes the projective baby steps (X[i]:Z[i]) = j*Q for the j of plan,
+   where Q = (x:1), with b = (A+2)/4 */
+static void
+bsgs_baby_steps (mpres_t *X, mpres_t *Z, bsgs_plan_t *plan, mpres_t x,
+                 mpres_t b, mpmod_t n)
+{
+  mpres_t x2, z2, xc, zc, xp, zp, z1, u, v, w;
+  unsigned long j, i;
+
+  mpres_init (x2, n);
+  mpres_init (z2, n);
+  mpres_init (xc, n);
+  mpres_init (zc, n);
+  mpres_init (xp, n);
+  mpres_init (zp, n);
+  mpres_init (z1, n);
+  mpres_init (u, n);
+  mpres_init (v, n);
+  mpres_init (w, n);
+
+  mpres_set_ui (z1, 1, n);
+  duplicate (x2, z2, x, z1, n, b, u, v, w); /* 2Q */
+  mpres_set (xc, x, n);                     /* jQ */
+  mpres_set (zc, z1, n);
+  mpres_set (xp, x, n);                     /* (j-2)Q, with x(-Q) = x(Q) */
+  mpres_set (zp, z1, n);
+  for (j = 1, i = 0; i < plan->nb; j += 2)
+    {
+      if (j > 1)
+        {
+          /* jQ = (j-2)Q + 2Q, whose difference is (j-4)Q */
+          add3 (xp, zp, xc, zc, x2, z2, xp, zp, n, u, v, w);
+          mpres_swap (xc, xp, n);
+          mpres_swap (zc, zp, n);
+        }
+      if (plan->j[i] == j)
+        {
+          mpres_set (X[i], xc, n);
+          mpres_set (Z[i], zc, n);
+          i++;
+        }
+    }
+
+  mpres_clear (x2, n);
+  mpres_clear (z2, n);
+  mpres_clear (xc, n);
+  mpres_clear (zc, n);
+  mpres_clear (xp, n);
+  mpres_clear (zp, n);
+  mpres_clear (z1, n);
+  mpres_clear (u, n);
+  mpres_clear (v, n);
+  mpres_clear (w, n);
+}
+
+/* Sets f to the gcd of n and the product of x(m*D*Q) - x(j*Q) over the
+   pairs (m, j) of plan, where Q = (x:1) and xj[i] are the affine baby
+   steps. Returns ECM_FACTOR_FOUND_STEP2 if f <> 1. */
+static int
+bsgs_giant_steps (mpz_t f, bsgs_plan_t *plan, mpres_t *xj, mpres_t x,
+                  mpres_t b, mpmod_t n)
+{
+  mpres_t xd, zd, xg, zg, xp, zp, g, t, u, v, w;
+  mpz_t e;
+  uint64_t m, i;
+  int ret;
+
+  mpres_init (xd, n);
+  mpres_init (zd, n);
+  mpres_init (xg, n);
+  mpres_init (zg, n);
+  mpres_init (xp, n);
+  mpres_init (zp, n);
+  mpres_init (g, n);
+  mpres_init (t, n);
+  mpres_init (u, n);
+  mpres_init (v, n);
+  mpres_init (w, n);
+  mpz_init (e);
+
+  /* D*Q, (m0-1)*D*Q and m0*D*Q */
+  mpres_set (xd, x, n);
+  mpres_set_ui (zd, 1, n);
+  mpz_set_ui (e, plan->D);
+  ecm_mul (xd, zd, e, n, b);
+  mpres_set (xg, xd, n);
+  mpres_set (zg, zd, n);
+  mpz_set_ui (e, plan->m0);
+  ecm_mul (xg, zg, e, n, b);
+  mpres_set (xp, xd, n);
+  mpres_set (zp, zd, n);
+  if (plan->m0 > 1)
+    {
+      mpz_set_ui (e, plan->m0 - 1);
+      ecm_mul (xp, zp, e, n, b);
+    }
+
+  mpres_set_ui (g, 1, n);
+  for (m = plan->m0; m <= plan->m1; m++)
+    {
+      if (m > plan->m0)
+        {
+          /* (m+1)*D*Q from m*D*Q, D*Q and (m-1)*D*Q; (m0-1)*D*Q is zero
+             when m0 = 1, but then m0*D*Q = D*Q is doubled */
+          if (m == plan->m0 + 1 && plan->m0 == 1)
+            duplicate (xp, zp, xg, zg, n, b, u, v, w);
+          else
+            add3 (xp, zp, xg, zg, xd, zd, xp, zp, n, u, v, w);
+          mpres_swap (xg, xp, n);
+          mpres_swap (zg, zp, n);
+        }
+      for (i = plan->start[m - plan->m0]; i < plan->start[m - plan->m0 + 1];
+           i++)
+        {
+          mpres_mul (t, xj[plan->pair[i]], zg, n);
+          mpres_sub (t, xg, t, n);
+          mpres_mul (g, g, t, n);
+        }
+    }
+
+  mpres_gcd (f, g, n);
+  ret = (mpz_cmp_ui (f, 1) == 0) ? ECM_NO_FACTOR_FOUND
+                                 : ECM_FACTOR_FOUND_STEP2;
+
+  mpres_clear (xd, n);
+  mpres_clear (zd, n);
+  mpres_clear (xg, n);
+  mpres_clear (zg, n);
+  mpres_clear (xp, n);
+  mpres_clear (zp, n);
+  mpres_clear (g, n);
+  mpres_clear (t, n);
+  mpres_clear (u, n);
+  mpres_clear (v, n);
+  mpres_clear (w, n);
+  mpz_clear (e);
+  return ret;
+}
+
+/* Returns non-zero if ecm_stage2_bsgs should be used for B2min and B2,
+   rather than stage2 for each curve */
+int
+stage2_bsgs_wanted (mpz_t B2min, mpz_t B2)
+{
+  return mpz_cmp_d (B2, STAGE2_BSGS_MAX_B2) <= 0 && mpz_cmp (B2min, B2) < 0;
+}
+
+/* Stage 2 for B2min < p <= B2 on the nb_curves curves with param 3 and
+   sigma = firstsigma + i, with the stage 1 points of x-coordinate x[i],
+   for the curves with found[i] = ECM_NO_FACTOR_FOUND. When a factor is
+   found with curve i, it is put in x[i], and found[i] is set to
+   ECM_FACTOR_FOUND_STEP2. Returns ECM_FACTOR_FOUND_STEP2 if a factor was
+   found, ECM_NO_FACTOR_FOUND if not, and ECM_ERROR if there is not
+   enough memory. */
+int
+ecm_stage2_bsgs (mpz_t *x, int *found, unsigned int nb_curves,
+                 unsigned int firstsigma, mpmod_t n, mpz_t B2min, mpz_t B2,
+                 int (*stop_asap)(void))
+{
+  bsgs_plan_t plan;
+  unsigned int i, c0, c1, block;
+  unsigned long k, nx;
+  mpres_t *X, *Z, *inv, *xQ, *b;
+  char *takeit;
+  mpz_t f;
+  int ret = ECM_NO_FACTOR_FOUND;
+  long st = cputime ();
+
+  if (bsgs_plan_init (&plan, mpz_get_d (B2min), mpz_get_d (B2)) != 0)
+    return ECM_ERROR;
+  outputf (OUTPUT_VERBOSE, "Baby-step giant-step Step 2 with D=%lu: %" PRIu64
+           " pairs for %" PRIu64 " primes, computed in %ldms\n", plan.D,
+           plan.npairs, plan.nprimes, elltime (st, cputime ()));
+
+  block = BSGS_BATCH / plan.nb;
+  if (block == 0)
+    block = 1;
+  if (block > nb_curves)
+    block = nb_curves;
+  nx = (unsigned long) block * plan.nb;
+  X = (mpres_t *) malloc (nx * sizeof (mpres_t));
+  Z = (mpres_t *) malloc ((nx + 1) * sizeof (mpres_t));
+  inv = (mpres_t *) malloc (nx * sizeof (mpres_t));
+  xQ = (mpres_t *) malloc (block * sizeof (mpres_t));
+  b = (mpres_t *) malloc (block * sizeof (mpres_t));
+  takeit = (char *) malloc (nx);
+  if (X == NULL || Z == NULL || inv == NULL || xQ == NULL || b == NULL
+      || takeit == NULL)
+    {
+      free (X);
+      free (Z);
+      free (inv);
+      free (xQ);
+      free (b);
+      free (takeit);
+      bsgs_plan_clear (&plan);
+      return ECM_ERROR;
+    }
+  for (k = 0; k < nx; k++)
+    {
+      mpres_init (X[k], n);
+      mpres_init (Z[k], n);
+      mpres_init (inv[k], n);
+    }
+  mpres_init (Z[nx], n);
+  for (i = 0; i < block; i++)
+    {
+      mpres_init (xQ[i], n);
+      mpres_init (b[i], n);
+    }
+  mpz_init (f);
+
+  for (c0 = 0; c0 < nb_curves; c0 = c1)
+    {
+      c1 = (nb_curves - c0 > block) ? c0 + block : nb_curves;
+      if (stop_asap != NULL && (*stop_asap) ())
+        break;
+
+      /* the baby steps of all curves of the block */
+      for (i = c0; i < c1; i++)
+        {
+          unsigned long o = (unsigned long) (i - c0) * plan.nb;
+          int alive = (found[i] == ECM_NO_FACTOR_FOUND);
+
+          if (alive)
+            {
+              mpres_set_z (xQ[i - c0], x[i], n);
+              A_from_sigma (f, i + firstsigma, n->orig_modulus);
+              mpres_set_z (b[i - c0], f, n);
+              mpres_add_ui (b[i - c0], b[i - c0], 2, n);
+              mpres_div_2exp (b[i - c0], b[i - c0], 2, n); /* (A+2)/4 */
+              bsgs_baby_steps (X + o, Z + o, &plan, xQ[i - c0], b[i - c0], n);
+            }
+          memset (takeit + o, alive, plan.nb);
+        }
+      for (k = (unsigned long) (c1 - c0) * plan.nb; k < nx; k++)
+        takeit[k] = 0;
+
+      /* one inversion for all of them; a curve with a baby step that is
+         not invertible gives a factor */
+      while (compute_all_inverses (f, inv, Z, nx, n, takeit) == 0)
+        for (i = c0; i < c1; i++)
+          {
+            unsigned long o = (unsigned long) (i - c0) * plan.nb;
+
+            if (memchr (takeit + o, 2, plan.nb) == NULL)
+              continue;
+            for (k = 0; takeit[o + k] != 2; k++);
+            mpres_gcd (x[i], Z[o + k], n);
+            found[i] = ECM_FACTOR_FOUND_STEP2;
+            ret = ECM_FACTOR_FOUND_STEP2;
+            memset (takeit + o, 0, plan.nb);
+          }
+
+      for (i = c0; i < c1; i++)
+        {
+          unsigned long o = (unsigned long) (i - c0) * plan.nb;
+
+          if (found[i] != ECM_NO_FACTOR_FOUND)
+            continue;
+          for (k = 0; k < plan.nb; k++)
+            mpres_mul (X[o + k], X[o + k], inv[o + k], n);
+          if (bsgs_giant_steps (f, &plan, X + o, xQ[i - c0], b[i - c0], n)
+              != ECM_NO_FACTOR_FOUND)
+            {
+              mpz_set (x[i], f);
+              found[i] = ECM_FACTOR_FOUND_STEP2;
+              ret = ECM_FACTOR_FOUND_STEP2;
+            }
+        }
+    }
+
+  mpz_clear (f);
+  for (k = 0; k < nx; k++)
+    {
+      mpres_clear (X[k], n);
+      mpres_clear (Z[k], n);
+      mpres_clear (inv[k], n);
+    }
+  mpres_clear (Z[nx], n);
+  for (i = 0; i < block; i++)
+    {
+      mpres_clear (xQ[i], n);
+      mpres_clear (b[i], n);
+    }
+  free (X);
+  free (Z);
+  free (inv);
+  free (xQ);
+  free (b);
+  free (takeit);
+  bsgs_plan_clear (&plan);
+  return ret;
+}
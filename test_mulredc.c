@@ -171,6 +171,35 @@ call_mulredc1 (const int N, mp_limb_t *z, const mp_limb_t x, const mp_limb_t *y,
 }
 #endif
 
+/* Non-zero if the cpu can run the MULX/ADX kernels */
+static int adx = 0;
+
+/* Checks that {z, N} + cy*2^(N*GMP_NUMB_BITS), the result of a mulredc
+   function, is x*y/2^(N*GMP_NUMB_BITS) mod m. Overwrites z. */
+static void
+check_mulredc (mp_size_t N, mp_limb_t *z, mp_limb_t cy, const mp_limb_t *x,
+               const mp_limb_t *y, const mp_limb_t *m, mp_limb_t *tmp,
+               mp_limb_t *tmp2, mp_limb_t *tmp3)
+{
+  int j;
+
+  z[N] = cy;
+  /* Check with pure gmp : multiply by 2^(N*GMP_NUMB_BITS) and compare. */
+  for (j=0; j < N; ++j) {
+    tmp[j] = 0;
+    tmp[j+N] = z[j]; 
+  }
+  tmp[2*N] = z[N];
+  mpn_tdiv_qr(tmp2, tmp3, 0, tmp, 2*N+1, m, N);
+  for (j=0; j < N; ++j)
+    z[j] = tmp3[j]; 
+
+  mpn_mul_n(tmp, x, y, N);
+  mpn_tdiv_qr(tmp2, tmp3, 0, tmp, 2*N, m, N);
+  
+  assert(mpn_cmp(z, tmp3, N) == 0);
+}
+
 void test(mp_size_t N, int k)
 {
   mp_limb_t *x, *y, *yp, *z, *m, invm, cy, cy2, *tmp, *tmp2, *tmp3;
@@ -241,26 +270,26 @@ void test(mp_size_t N, int k)
         }
     }
     
+#ifdef HAVE_MULREDC_ADX
+    if (adx && N <= MULREDC_ADX_MAX)
+      {
+        /* Test the MULX/ADX kernels, both for x*y and x^2 */
+        cy = mulredc_adx_table[N] (z, x, yp, m, invm);
+        check_mulredc (N, z, cy, x, yp, m, tmp, tmp2, tmp3);
+        cy = sqrredc_adx_table[N] (z, x, m, invm);
+        check_mulredc (N, z, cy, x, x, m, tmp, tmp2, tmp3);
+      }
+#endif
+
+    if (N > 20)
+      continue;
+
     /* Mixed mul and redc */
     cy = call_mulredc (N, z, x, yp, m, invm);
     
     if (cy)
       printf("!");
-    z[N] = cy;
-    /* Check with pure gmp : multiply by 2^(N*GMP_NUMB_BITS) and compare. */
-    for (j=0; j < N; ++j) {
-      tmp[j] = 0;
-      tmp[j+N] = z[j]; 
-    }
-    tmp[2*N] = z[N];
-    mpn_tdiv_qr(tmp2, tmp3, 0, tmp, 2*N+1, m, N);
-    for (j=0; j < N; ++j)
-      z[j] = tmp3[j]; 
-
-    mpn_mul_n(tmp, x, yp, N);
-    mpn_tdiv_qr(tmp2, tmp3, 0, tmp, 2*N, m, N);
-    
-    assert(mpn_cmp(z, tmp3, N) == 0);
+    check_mulredc (N, z, cy, x, yp, m, tmp, tmp2, tmp3);
 
 #if defined(HAVE_NATIVE_MULREDC1_N)
     /* Test mulredc1_n() */
@@ -287,7 +316,13 @@ void test(mp_size_t N, int k)
 
 int main(int argc, char** argv)
 {
-  int i, len;
+  int i, len, maxlen = 20;
+
+#ifdef HAVE_MULREDC_ADX
+  adx = mulredc_adx_available ();
+  if (adx)
+    maxlen = MULREDC_ADX_MAX;
+#endif
 
   if (argc > 1) /* Test a specific length */
   {
@@ -298,7 +333,7 @@ int main(int argc, char** argv)
   }
 
   for (;;) {
-    for (i = 1; i <= 20; ++i) {
+    for (i = 1; i <= maxlen; ++i) {
       test(i, 1000);
     }
 #if 0
@@ -0,0 +1,462 @@
+/* threads.c - run several curves at once in separate threads (-t option).
+
+Copyright 2022 Paul Zimmermann, Alexander Kruppa, Cyril Bouvier.
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 3 of the License, or (at your
+option) any later version.
+
+This program is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; see the file COPYING.  If not, see
+http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA. */
+
+/* The main loop of main.c performs one curve at a time. With -t n, when
+   it asks for a curve, we run this curve together with the next n-1 ones
+   (same input number and parameters) in n threads, and keep the results
+   of the extra curves for the next calls. A precomputed curve is used only
+   if the input number and the parameters did not change in the meantime,
+   thus the output and the error messages (which are buffered for each
+   curve), the save file and the factors found are exactly those of a run
+   without -t, in the same order.
+
+   When a curve finds a factor, the curves after it on the same number are
+   stopped, since the input number will change and their results would be
+   discarded anyway. When a curve fails with an error, all the curves after
+   it are stopped and discarded, since main () stops there. The batch
+   exponent s (for -param 1, 2 or 3) is computed only once and shared
+   between all threads.
+
+   With -resume, each residue of the file has its own starting point, so
+   the other curves of a round are those of the next residues, read ahead
+   from the file. Their output is also given back in the order of the file,
+   and the residues main () skips (for example because the cofactor is a
+   probable prime) are skipped in the pool too. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ecm-impl.h"
+#include "ecm-ecm.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* curve run by the current thread, and whether it was stopped because an
+   earlier curve on the same number found a factor */
+static curve_job_t *pool_job = NULL;
+static int pool_stopped = 0;
+#ifdef _OPENMP
+#pragma omp threadprivate (pool_job, pool_stopped)
+#endif
+
+/* the stop_asap function given by the caller, if any */
+static int (*pool_user_stop) (void) = NULL;
+
+static int
+pool_stop_asap (void)
+{
+  int i;
+
+  if (pool_user_stop != NULL && (*pool_user_stop) ())
+    return 1;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+  i = pool_job->stop;
+  if (i)
+    {
+      pool_stopped = 1;
+      return 1;
+    }
+  return 0;
+}
+
+void
+curve_pool_init (curve_pool_t *pool, unsigned int nthreads)
+{
+  unsigned int i;
+
+  pool->nthreads = nthreads;
+  pool->njobs = 0;
+  pool->next = 0;
+  pool->resume = NULL;
+  pool->jobs = (curve_job_t *) malloc (nthreads * sizeof (curve_job_t));
+  if (pool->jobs == NULL)
+    {
+      fprintf (stderr, "Cannot allocate memory in curve_pool_init\n");
+      exit (1);
+    }
+  for (i = 0; i < nthreads; i++)
+    {
+      curve_job_t *job = pool->jobs + i;
+
+      /* each curve has its own random state, seeded at first use */
+      ecm_init (job->params);
+      mpz_init (job->n);
+      mpz_init (job->x);
+      mpz_init (job->y);
+      mpz_init (job->sigma);
+      mpz_init (job->B2min);
+      mpz_init (job->f);
+      job->out = NULL;
+      job->err = NULL;
+    }
+}
+
+void
+curve_pool_clear (curve_pool_t *pool)
+{
+  unsigned int i;
+
+  for (i = 0; i < pool->nthreads; i++)
+    {
+      curve_job_t *job = pool->jobs + i;
+
+      ecm_clear (job->params);
+      mpz_clear (job->n);
+      mpz_clear (job->x);
+      mpz_clear (job->y);
+      mpz_clear (job->sigma);
+      mpz_clear (job->B2min);
+      mpz_clear (job->f);
+      if (job->out != NULL)
+        fclose (job->out);
+      if (job->err != NULL)
+        fclose (job->err);
+    }
+  free (pool->jobs);
+}
+
+/* Return the batch parametrization ecm () uses for n with the parameters p,
+   in which case the exponent s can be shared, or 0 if it uses none or
+   fails before computing s because the representation is not MODMULN */
+static int
+batch_param (mpz_t n, ecm_params p)
+{
+  mpmod_t modulus;
+  int repr, param, ret, verbose;
+  ecm_ctx_t ctx = ECM_CTX;
+  FILE *os, *es;
+
+  if (p->method != ECM_ECM || !ECM_IS_DEFAULT_B1_DONE (p->B1done))
+    return 0;
+  if (p->param != ECM_PARAM_DEFAULT && !IS_BATCH_MODE (p->param))
+    return 0;
+
+  /* same choice as in ecm (), with the streams and verbosity of the
+     context of this thread given back afterwards */
+  os = ctx->os;
+  es = ctx->es;
+  verbose = ctx->verbose;
+  ctx->os = p->os;
+  ctx->es = p->es;
+  ctx->verbose = OUTPUT_ALWAYS;
+  ret = mpmod_init (modulus, n, p->repr);
+  ctx->os = os;
+  ctx->es = es;
+  ctx->verbose = verbose;
+  if (ret != 0)
+    return 0;
+  repr = modulus->repr;
+  mpmod_clear (modulus);
+  param = (p->param != ECM_PARAM_DEFAULT) ? p->param
+    : get_default_param (p->sigma_is_A, p->B1done, repr);
+  return (IS_BATCH_MODE (param) && repr == ECM_MOD_MODMULN) ? param : 0;
+}
+
+/* Set the input parameters of job from p. The parameters that change from
+   one curve to the next (B1, B2min) are set by the caller. */
+static void
+job_set_params (curve_job_t *job, mpz_t n, ecm_params p,
+                unsigned int nthreads)
+{
+  ecm_params_ptr q = job->params;
+
+  mpz_set (job->n, n);
+  q->method = p->method;
+  mpz_set (q->x, p->x);
+  mpz_set (q->y, p->y);
+  q->param = p->param;
+  mpz_set (q->sigma, p->sigma);
+  q->sigma_is_A = p->sigma_is_A;
+  q->E->type = p->E->type;
+  q->E->law = p->E->law;
+  mpz_set (q->E->a1, p->E->a1);
+  mpz_set (q->E->a2, p->E->a2);
+  mpz_set (q->E->a3, p->E->a3);
+  mpz_set (q->E->a4, p->E->a4);
+  mpz_set (q->E->a6, p->E->a6);
+  q->E->disc = p->E->disc;
+  mpz_set (q->E->sq[0], p->E->sq[0]);
+  mpz_set (q->go, p->go);
+  q->B1done = p->B1done;
+  mpz_set (q->B2, p->B2);
+  q->k = p->k;
+  q->S = p->S;
+  q->repr = p->repr;
+  q->nobase2step2 = p->nobase2step2;
+  q->verbose = p->verbose;
+  q->chkfilename = p->chkfilename;
+  q->TreeFilename = p->TreeFilename;
+  q->maxmem = p->maxmem / nthreads; /* the limit is for the whole process */
+  q->stage1time = p->stage1time;
+  q->use_ntt = p->use_ntt;
+  q->stop_asap = pool_stop_asap;
+  q->batch_last_B1_used = p->batch_last_B1_used;
+  q->gw_k = p->gw_k;
+  q->gw_b = p->gw_b;
+  q->gw_n = p->gw_n;
+  q->gw_c = p->gw_c;
+  q->cachedir = p->cachedir;
+
+  /* save the input values which are overwritten by ecm_factor */
+  mpz_set (job->x, p->x);
+  mpz_set (job->y, p->y);
+  mpz_set (job->sigma, p->sigma);
+  job->B1done = p->B1done;
+
+  if (job->out != NULL)
+    fclose (job->out);
+  if (job->err != NULL)
+    fclose (job->err);
+  job->out = tmpfile ();
+  job->err = tmpfile ();
+  if (job->out == NULL || job->err == NULL)
+    {
+      fprintf (stderr, "Cannot create temporary file in job_set_params\n");
+      exit (1);
+    }
+  q->os = job->out;
+  q->es = job->err;
+}
+
+/* With -resume, set the input of job to the residue r, as main () does for
+   the residue it is about to run */
+static void
+job_set_residue (curve_job_t *job, resume_record_t *r)
+{
+  ecm_params_ptr q = job->params;
+
+  mpz_set (job->n, r->n.n);
+  q->method = r->method;
+  mpz_set (q->x, r->x);
+  mpz_set (q->y, r->y);
+  q->param = r->param;
+  q->E->type = r->Etype;
+  if (r->Etype == ECM_EC_TYPE_WEIERSTRASS || r->Etype == ECM_EC_TYPE_HESSIAN
+      || r->Etype == ECM_EC_TYPE_TWISTED_HESSIAN)
+    q->sigma_is_A = -1;
+  else
+    q->sigma_is_A = mpz_sgn (r->sigma) == 0;
+  mpz_set (q->sigma, (q->sigma_is_A) ? r->A : r->sigma);
+  q->B1done = r->B1done;
+
+  mpz_set (job->x, q->x);
+  mpz_set (job->y, q->y);
+  mpz_set (job->sigma, q->sigma);
+  job->B1done = q->B1done;
+}
+
+/* Return non-zero if job was computed with the same input as a call to
+   ecm_factor (f, n, B1, p) */
+static int
+job_matches (curve_job_t *job, mpz_t n, double B1, ecm_params p)
+{
+  ecm_params_ptr q = job->params;
+
+  return job->valid && mpz_cmp (job->n, n) == 0 && job->B1 == B1
+    && q->method == p->method && mpz_cmp (job->x, p->x) == 0
+    && mpz_cmp (job->y, p->y) == 0 && mpz_cmp (job->sigma, p->sigma) == 0
+    && q->param == p->param && q->sigma_is_A == p->sigma_is_A
+    && q->E->type == p->E->type && mpz_cmp (q->E->a4, p->E->a4) == 0
+    && mpz_cmp (q->E->a6, p->E->a6) == 0 && mpz_cmp (q->go, p->go) == 0
+    && job->B1done == p->B1done && mpz_cmp (job->B2min, p->B2min) == 0
+    && mpz_cmp (q->B2, p->B2) == 0 && q->use_ntt == p->use_ntt;
+}
+
+/* Copy the contents of the temporary file from to the stream to */
+static void
+job_replay (FILE *from, FILE *to)
+{
+  char buf[4096];
+  size_t l;
+
+  rewind (from);
+  while ((l = fread (buf, 1, sizeof (buf), from)) > 0)
+    fwrite (buf, 1, l, to);
+  fflush (to);
+}
+
+static void
+job_run (curve_pool_t *pool, unsigned int index)
+{
+  curve_job_t *job = pool->jobs + index;
+  unsigned int i;
+
+  pool_job = job;
+  pool_stopped = 0;
+  job->result = ecm_factor (job->f, job->n, job->B1, job->params);
+  if (job->result != ECM_NO_FACTOR_FOUND)
+    /* stop the next curves on the same number, or all of them after an
+       error, since main () stops there */
+    for (i = index + 1; i < pool->njobs && (job->result == ECM_ERROR
+                                            || pool->jobs[i].first
+                                               == job->first);
+         i++)
+      {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+        pool->jobs[i].stop = 1;
+      }
+  /* a curve stopped early is incomplete, unless the caller asked to stop,
+     in which case it is handled as without -t */
+  job->valid = !pool_stopped;
+}
+
+/* Run ncurves curves, the first one with parameters p and bound B1, and
+   the next ones with B1 incremented as with the -I option if incB1 > 0.
+   With -resume, the next ones are for the next residues of the file, and
+   ncurves is the number of residues left if smaller. */
+static void
+pool_run (curve_pool_t *pool, mpz_t n, double B1, ecm_params p,
+          unsigned int ncurves, double incB1)
+{
+  unsigned int i;
+  int param, shared_s;
+  mpz_t B2min;
+
+  if (pool->resume != NULL)
+    for (ncurves = 1; ncurves < pool->nthreads
+           && resume_reader_peek (pool->resume, ncurves - 1) != NULL;
+         ncurves++);
+
+  param = batch_param (n, p);
+  shared_s = param != 0;
+  /* compute the batch exponent once for all threads, as in ecm () */
+  if (shared_s && (B1 != p->batch_last_B1_used
+                   || mpz_cmp_ui (p->batch_s, 1) <= 0))
+    {
+      long st = cputime ();
+
+      cachefile_set_dir (p->cachedir);
+      batch_s_update (p->batch_s, B1, &p->batch_last_B1_used, param);
+      if (p->verbose >= OUTPUT_VERBOSE)
+        printf ("Computing batch product (of %" PRIu64 " bits) of primes up "
+                "to B1=%1.0f took %ldms\n",
+                (uint64_t) mpz_sizeinbase (p->batch_s, 2), B1,
+                elltime (st, cputime ()));
+    }
+
+  mpz_init_set (B2min, p->B2min);
+  for (i = 0; i < ncurves; i++)
+    {
+      curve_job_t *job = pool->jobs + i;
+      int job_param = param;
+
+      job_set_params (job, n, p, pool->nthreads);
+      if (pool->resume != NULL && i > 0)
+        {
+          job_set_residue (job, resume_reader_peek (pool->resume, i - 1));
+          job_param = batch_param (job->n, job->params);
+        }
+      job->first = (i > 0 && mpz_cmp (job->n, pool->jobs[i - 1].n) == 0)
+        ? pool->jobs[i - 1].first : i;
+      job->stop = 0;
+      job->B1 = B1;
+      mpz_set (job->B2min, B2min);
+      mpz_set (job->params->B2min, B2min);
+      /* the curves with the B1 of s use it directly, without a copy */
+      job->shared_s = shared_s && job_param == param
+        && B1 == p->batch_last_B1_used;
+      if (job->shared_s)
+        {
+          job->own_s[0] = job->params->batch_s[0];
+          job->params->batch_s[0] = p->batch_s[0];
+        }
+      else if (job_param != 0) /* ecm () will compute s for this B1 */
+        mpz_set_ui (job->params->batch_s, 1);
+      else
+        mpz_set (job->params->batch_s, p->batch_s);
+
+      /* next curve, as in main () */
+      if (incB1 > 0.0)
+        {
+          double NewB1 = calc_B1_AutoIncrement (B1, incB1);
+          if (mpz_cmp_d (B2min, B1) <= 0)
+            mpz_set_d (B2min, NewB1);
+          B1 = NewB1;
+        }
+    }
+  mpz_clear (B2min);
+
+  pool_user_stop = p->stop_asap;
+  pool->njobs = ncurves;
+  pool->next = 0;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(pool->nthreads)
+#endif
+  {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for (i = 0; i < ncurves; i++)
+      job_run (pool, i);
+#ifdef _OPENMP
+    /* the other threads of the team outlive the pool job: free the NTT
+       tables of their default context now, since no ecm_clear will */
+    if (omp_get_thread_num () != 0)
+      ecm_ctx_clear (NULL);
+#endif
+  }
+
+  for (i = 0; i < ncurves; i++)
+    if (pool->jobs[i].shared_s)
+      pool->jobs[i].params->batch_s[0] = pool->jobs[i].own_s[0];
+}
+
+/* Same as ecm_factor (f, n, B1, p), where ncurves is the number of curves
+   the caller still wants to perform with the same parameters (including
+   this one), and incB1 is the -I value (0 if none). With -resume, n and p
+   are those of the current residue, and ncurves is not used. Return the
+   result of ecm_factor, after printing the output of the curve. */
+int
+curve_pool_factor (curve_pool_t *pool, mpz_t f, mpz_t n, double B1,
+                   ecm_params p, unsigned int ncurves, double incB1)
+{
+  curve_job_t *job;
+
+  if (pool->resume != NULL) /* skip the residues main () skipped */
+    while (pool->next < pool->njobs
+           && !job_matches (pool->jobs + pool->next, n, B1, p))
+      pool->next++;
+  else if (pool->next < pool->njobs
+           && !job_matches (pool->jobs + pool->next, n, B1, p))
+    pool->next = pool->njobs; /* discard the remaining curves */
+
+  if (pool->next == pool->njobs)
+    pool_run (pool, n, B1, p, (ncurves < pool->nthreads) ? ncurves
+              : pool->nthreads, incB1);
+
+  job = pool->jobs + pool->next++;
+  if (job->result == ECM_ERROR)
+    pool->next = pool->njobs; /* the next curves are not given out */
+
+  job_replay (job->out, stdout);
+  /* ecm_factor writes the errors to stdout if p->es is NULL */
+  job_replay (job->err, (p->es != NULL) ? p->es : stdout);
+
+  mpz_set (f, job->f);
+  mpz_set (p->x, job->params->x);
+  mpz_set (p->y, job->params->y);
+  mpz_set (p->sigma, job->params->sigma);
+  p->B1done = job->params->B1done;
+  return job->result;
+}
@@ -28,6 +28,11 @@ http://www.gnu.org/licenses/ or write to the Free Software Foundation, Inc.,
 #define MAX_LOG2_LEN 18 /* 2 * 131072 */
 #define MAX_LEN (1U << max_log2_len)
 #define MAX_LOG2_MPZSPV_NORMALISE_STRIDE (MIN (12, max_log2_len))
+/* mpzspv_to_mpzv is timed for sp_num = 2^n with n in [MIN, MAX),
+   converting TUNE_CRT_LEN residues at once */
+#define MIN_LOG2_MPZSPV_TO_MPZV_SP_NUM 5
+#define MAX_LOG2_MPZSPV_TO_MPZV_SP_NUM 13
+#define TUNE_CRT_LEN 16
 /* we currently optimize GMP-ECM for a 200-digit number */
 #define M_str "29799904256775982671863388319999573561548825027149399972531599612392671227006866151136667908641695103422986028076864929902803267437351318167549013218980573566942647077444419419003164546362008247462049"
 
@@ -79,6 +84,9 @@ int min_log2_len = 3;
 
 size_t MPZMOD_THRESHOLD;
 size_t REDC_THRESHOLD;
+size_t KBNC_THRESHOLD;
+size_t DWT_THRESHOLD;
+size_t BASE2_FFT_THRESHOLD;
 size_t NTT_GFP_TWIDDLE_DIF_BREAKOVER = MAX_LOG2_LEN;
 size_t NTT_GFP_TWIDDLE_DIT_BREAKOVER = MAX_LOG2_LEN;
 size_t MUL_NTT_THRESHOLD;
@@ -86,6 +94,8 @@ size_t PREREVERTDIVISION_NTT_THRESHOLD;
 size_t POLYINVERT_NTT_THRESHOLD;
 size_t POLYEVALT_NTT_THRESHOLD;
 size_t MPZSPV_NORMALISE_STRIDE = 256;
+size_t MPZSPV_TO_MPZV_TREE_THRESHOLD = ~(size_t) 0;
+size_t NTT_GFP_FOURSTEP_THRESHOLD = ~(size_t) 0;
 
 void
 mpz_quick_random (mpz_t x, mpz_t M)
@@ -102,20 +112,49 @@ tune_mpres_mul (mp_size_t limbs, int repr)
   mpz_t N, p, q;
   unsigned int __k = 1, __i;
   long __st;
+  unsigned long k;
+  long c;
+  int n = limbs * GMP_NUMB_BITS - 32;
 
   mpz_init (N);
   mpz_init (p);
   mpz_init (q);
   
-  /* No need to generate a probable prime, just ensure N is not
-     divisible by 2 or 3 */
-  do
+  if (repr == ECM_MOD_BASE2 || repr == ECM_MOD_DWT)
     {
-      mpz_urandomb (N, gmp_randstate, limbs * GMP_NUMB_BITS);
-      while (mpz_gcd_ui (NULL, N, 6) != 1)
-        mpz_add_ui (N, N, 1);
+      /* N = 2^n-1, of limbs limbs */
+      k = 1;
+      c = -1;
+      mpz_set_ui (N, 1);
+      mpz_mul_2exp (N, N, n);
+      mpz_sub_ui (N, N, 1);
+    }
+  else if (repr == ECM_MOD_KBNC)
+    {
+      /* N = k*2^n+c with k < 2^32 and |c| < 2^23 odd, of limbs limbs */
+      k = 2 * gmp_urandomb_ui (gmp_randstate, 31) + 1;
+      c = 2 * (long) gmp_urandomb_ui (gmp_randstate, 22) + 1;
+      if (gmp_urandomb_ui (gmp_randstate, 1))
+        c = -c;
+      mpz_set_ui (N, k);
+      mpz_mul_2exp (N, N, n);
+      if (c < 0)
+        mpz_sub_ui (N, N, (unsigned long) -c);
+      else
+        mpz_add_ui (N, N, (unsigned long) c);
+    }
+  else
+    {
+      /* No need to generate a probable prime, just ensure N is not
+         divisible by 2 or 3 */
+      do
+        {
+          mpz_urandomb (N, gmp_randstate, limbs * GMP_NUMB_BITS);
+          while (mpz_gcd_ui (NULL, N, 6) != 1)
+            mpz_add_ui (N, N, 1);
+        }
+      while ((mp_size_t) mpz_size (N) != limbs);
     }
-  while ((mp_size_t) mpz_size (N) != limbs);
   
   if (repr == ECM_MOD_MPZ)
     mpmod_init_MPZ (modulus, N);
@@ -123,6 +162,12 @@ tune_mpres_mul (mp_size_t limbs, int repr)
     mpmod_init_MODMULN (modulus, N);
   else if (repr == ECM_MOD_REDC)
     mpmod_init_REDC (modulus, N);
+  else if (repr == ECM_MOD_KBNC)
+    mpmod_init_KBNC (modulus, k, n, c, N);
+  else if (repr == ECM_MOD_BASE2)
+    mpmod_init_BASE2 (modulus, -n, N);
+  else if (repr == ECM_MOD_DWT)
+    mpmod_init_DWT (modulus, k, n, c, N);
 
   mpz_urandomm (p, gmp_randstate, N);
   mpz_urandomm (q, gmp_randstate, N);
@@ -214,6 +259,92 @@ tune_mpres_mul_redc (size_t n)
   return tune_mpres_mul (n, ECM_MOD_REDC);
 }
 
+double
+tune_mpres_mul_kbnc (size_t n)
+{
+  return tune_mpres_mul (n, ECM_MOD_KBNC);
+}
+
+double
+tune_mpres_mul_base2 (size_t n)
+{
+  return tune_mpres_mul (n, ECM_MOD_BASE2);
+}
+
+/* mpres_mul modulo 2^(limbs*GMP_NUMB_BITS)+1, with mpn_mul_fft if fft is
+   non-zero, otherwise with mpz_mul and base2mod. limbs is rounded up to a
+   multiple of 8, for which mpn_mul_fft can be used. */
+double
+tune_mpres_mul_base2_fft (size_t limbs, int fft)
+{
+  mpmod_t modulus;
+  mpres_t x, y, z;
+  mpz_t N, p;
+  unsigned int __k = 1, __i;
+  long __st;
+  int n;
+
+  limbs = (limbs + 7) & ~((size_t) 7);
+  n = limbs * GMP_NUMB_BITS;
+  mpz_init (N);
+  mpz_init (p);
+  mpz_set_ui (N, 1);
+  mpz_mul_2exp (N, N, n);
+  mpz_add_ui (N, N, 1);
+
+  BASE2_FFT_THRESHOLD = fft ? limbs : limbs + 1;
+  mpmod_init_BASE2 (modulus, n, N);
+  mpres_init (x, modulus);
+  mpres_init (y, modulus);
+  mpres_init (z, modulus);
+  mpz_urandomm (p, gmp_randstate, N);
+  mpres_set_z (x, p, modulus);
+  mpz_urandomm (p, gmp_randstate, N);
+  mpres_set_z (y, p, modulus);
+
+  TUNE_FUNC_LOOP (mpres_mul (z, x, y, modulus));
+
+  mpres_clear (x, modulus);
+  mpres_clear (y, modulus);
+  mpres_clear (z, modulus);
+  mpmod_clear (modulus);
+  mpz_clear (N);
+  mpz_clear (p);
+
+  return (double) __k / (double) __st;
+}
+
+double
+tune_mpres_mul_base2_nofft (size_t n)
+{
+  return tune_mpres_mul_base2_fft (n, 0);
+}
+
+double
+tune_mpres_mul_base2_withfft (size_t n)
+{
+  return tune_mpres_mul_base2_fft (n, 1);
+}
+
+double
+tune_mpres_mul_dwt (size_t n)
+{
+  return tune_mpres_mul (n, ECM_MOD_DWT);
+}
+
+/* the representation mpmod_init chooses for a number without special form,
+   from the thresholds MPZMOD_THRESHOLD and REDC_THRESHOLD */
+double
+tune_mpres_mul_nobase2 (size_t n)
+{
+  if (n < MPZMOD_THRESHOLD)
+    return tune_mpres_mul (n, ECM_MOD_MODMULN);
+  else if (n < REDC_THRESHOLD)
+    return tune_mpres_mul (n, ECM_MOD_MPZ);
+  else
+    return tune_mpres_mul (n, ECM_MOD_REDC);
+}
+
 TUNE_FUNC_START (tune_spv_ntt_gfp_dif)
   NTT_GFP_TWIDDLE_DIF_BREAKOVER = n;
   TUNE_FUNC_LOOP (spv_ntt_gfp_dif (spv, max_log2_len, spm));
@@ -226,6 +357,20 @@ TUNE_FUNC_START (tune_spv_ntt_gfp_dit)
 TUNE_FUNC_END (tune_spv_ntt_gfp_dit_recursive)
 
 
+TUNE_FUNC_START (tune_spv_ntt_gfp_radix2)
+  NTT_GFP_FOURSTEP_THRESHOLD = ~(size_t) 0;
+  ASSERT_ALWAYS (spv_ntt_gfp_fourstep_init (spm, max_log2_len) == 0);
+  TUNE_FUNC_LOOP (spv_ntt_gfp_dif (spv, n, spm); spv_ntt_gfp_dit (spv, n, spm));
+TUNE_FUNC_END (tune_spv_ntt_gfp_radix2)
+
+
+TUNE_FUNC_START (tune_spv_ntt_gfp_fourstep)
+  NTT_GFP_FOURSTEP_THRESHOLD = n;
+  ASSERT_ALWAYS (spv_ntt_gfp_fourstep_init (spm, max_log2_len) == 0);
+  TUNE_FUNC_LOOP (spv_ntt_gfp_dif (spv, n, spm); spv_ntt_gfp_dit (spv, n, spm));
+TUNE_FUNC_END (tune_spv_ntt_gfp_fourstep)
+
+
 TUNE_FUNC_START (tune_ntt_mul)
   MUL_NTT_THRESHOLD = 0;
 
@@ -303,6 +448,59 @@ TUNE_FUNC_START (tune_mpzspv_normalise)
 TUNE_FUNC_END (tune_mpzspv_normalise)
 
 
+/* mpzspv_to_mpzv with about 2^log2_sp_num primes, with the product tree
+   if tree is non-zero, otherwise with the quadratic explicit CRT */
+double
+tune_mpzspv_to_mpzv (size_t log2_sp_num, int tree)
+{
+  mpzspm_t spm_n;
+  mpzspv_t spv_n;
+  mpzv_t v;
+  mpz_t N;
+  unsigned int i, __k = 1, __i;
+  long __st;
+
+  /* the primes must cover about len * N^2 */
+  mpz_init (N);
+  mpz_urandomb (N, gmp_randstate, ((size_t) SP_NUMB_BITS << log2_sp_num) / 2);
+  mpz_setbit (N, ((size_t) SP_NUMB_BITS << log2_sp_num) / 2);
+  spm_n = mpzspm_init (TUNE_CRT_LEN, N);
+  ASSERT_ALWAYS (spm_n != NULL);
+  spv_n = mpzspv_init (TUNE_CRT_LEN, spm_n);
+  ASSERT_ALWAYS (spv_n != NULL);
+  v = init_list (TUNE_CRT_LEN);
+  for (i = 0; i < TUNE_CRT_LEN; i++)
+    mpz_quick_random (v[i], N);
+  mpzspv_from_mpzv (spv_n, 0, v, TUNE_CRT_LEN, spm_n);
+
+  MPZSPV_TO_MPZV_TREE_THRESHOLD = tree ? 0 : ~(size_t) 0;
+  TUNE_FUNC_LOOP (mpzspv_to_mpzv (spv_n, 0, v, TUNE_CRT_LEN, spm_n));
+
+  if (tune_verbose)
+    fprintf (stderr, "tune_mpzspv_to_mpzv(%u, %d) = %f\n", spm_n->sp_num,
+             tree, (double) __k / (double) __st);
+
+  clear_list (v, TUNE_CRT_LEN);
+  mpzspv_clear (spv_n, spm_n);
+  mpzspm_clear (spm_n);
+  mpz_clear (N);
+
+  return (double) __k / (double) __st;
+}
+
+double
+tune_mpzspv_to_mpzv_naive (size_t n)
+{
+  return tune_mpzspv_to_mpzv (n, 0);
+}
+
+double
+tune_mpzspv_to_mpzv_tree (size_t n)
+{
+  return tune_mpzspv_to_mpzv (n, 1);
+}
+
+
 TUNE_FUNC_START (tune_ecm_mul_lo_n)
   mp_limb_t rp[2 * MPN_MUL_LO_THRESHOLD];
   mp_limb_t xp[MPN_MUL_LO_THRESHOLD];
@@ -507,6 +705,9 @@ main (int argc, char **argv)
   z = init_list (MAX_LEN);
   t = init_list (list_mul_mem (MAX_LEN / 2) + 3 * MAX_LEN / 2);
   
+  /* the twiddle tables must be large enough for all breakovers we try */
+  NTT_GFP_TWIDDLE_DIF_BREAKOVER = max_log2_len;
+  NTT_GFP_TWIDDLE_DIT_BREAKOVER = max_log2_len;
   mpzspm = mpzspm_init (MAX_LEN, M);
   ASSERT_ALWAYS (mpzspm != NULL);
   mpzspv = mpzspv_init (MAX_LEN, mpzspm);
@@ -535,6 +736,23 @@ main (int argc, char **argv)
   
   printf ("#define REDC_THRESHOLD %lu\n", (unsigned long) REDC_THRESHOLD);
 
+  KBNC_THRESHOLD = crossover2 (tune_mpres_mul_nobase2, tune_mpres_mul_kbnc,
+      1, 512, 10);
+
+  printf ("#define KBNC_THRESHOLD %lu\n", (unsigned long) KBNC_THRESHOLD);
+
+  DWT_THRESHOLD = crossover (tune_mpres_mul_base2, tune_mpres_mul_dwt,
+      64, 16384);
+
+  printf ("#define DWT_THRESHOLD %lu\n", (unsigned long) DWT_THRESHOLD);
+
+  BASE2_FFT_THRESHOLD = crossover (tune_mpres_mul_base2_nofft,
+      tune_mpres_mul_base2_withfft, 64, 2048);
+  BASE2_FFT_THRESHOLD = (BASE2_FFT_THRESHOLD + 7) & ~((size_t) 7);
+
+  printf ("#define BASE2_FFT_THRESHOLD %lu\n",
+          (unsigned long) BASE2_FFT_THRESHOLD);
+
   mpn_mul_lo_threshold[0] = 0;
   mpn_mul_lo_threshold[1] = 0;
 
@@ -560,6 +778,19 @@ main (int argc, char **argv)
 
   printf ("#define NTT_GFP_TWIDDLE_DIT_BREAKOVER %lu\n",
       (unsigned long) NTT_GFP_TWIDDLE_DIT_BREAKOVER);
+
+  /* the four-step transform only applies above the breakovers */
+  NTT_GFP_FOURSTEP_THRESHOLD = crossover2 (tune_spv_ntt_gfp_radix2,
+      tune_spv_ntt_gfp_fourstep, 1 + MAX (NTT_GFP_TWIDDLE_DIF_BREAKOVER,
+      NTT_GFP_TWIDDLE_DIT_BREAKOVER), max_log2_len + 1, 1);
+
+  printf ("#define NTT_GFP_FOURSTEP_THRESHOLD %lu\n",
+      (unsigned long) NTT_GFP_FOURSTEP_THRESHOLD);
+
+  /* the following transforms use the four-step tables of this threshold */
+  for (i = 0; i < mpzspm->sp_num; i++)
+    ASSERT_ALWAYS (spv_ntt_gfp_fourstep_init (mpzspm->spm[i],
+                                              max_log2_len) == 0);
   
   MUL_NTT_THRESHOLD = 1 << crossover2 (tune_list_mul, tune_ntt_mul, 1,
       max_log2_len, 2);
@@ -590,6 +821,13 @@ main (int argc, char **argv)
   printf ("#define MPZSPV_NORMALISE_STRIDE %lu\n", 
       (unsigned long) MPZSPV_NORMALISE_STRIDE);
 
+  MPZSPV_TO_MPZV_TREE_THRESHOLD = 1 << crossover (tune_mpzspv_to_mpzv_naive,
+      tune_mpzspv_to_mpzv_tree, MIN_LOG2_MPZSPV_TO_MPZV_SP_NUM,
+      MAX_LOG2_MPZSPV_TO_MPZV_SP_NUM);
+
+  printf ("#define MPZSPV_TO_MPZV_TREE_THRESHOLD %lu\n",
+      (unsigned long) MPZSPV_TO_MPZV_TREE_THRESHOLD);
+
   mpzspv_clear (mpzspv, mpzspm);
   mpzspm_clear (mpzspm);
   
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+
+# Generates mulredc_adx.c, the mulredc and sqrredc kernels using the BMI2
+# instruction MULX and the ADX instructions ADCX and ADOX, for 1 to MAX
+# limbs. Usage: ./autogen_adx.py > mulredc_adx.c
+#
+# MULX does not touch the flags, and ADCX and ADOX propagate their carries
+# in CF and OF respectively, so each row a[0..L-1] += v[0..L-1] * r runs two
+# independent carry chains: one for adding the high word of v[j-1] * r to
+# the low word of v[j] * r, and one for adding the result to a[j].
+#
+# mulredc_adx_N computes the 2N-limb product row by row, then does the N
+# REDC steps, storing the carry of step i into the limb it zeroed (as
+# GMP's redc_1 does), and adds these carries to the upper half at the end.
+# sqrredc_adx_N computes the N(N-1)/2 products x[i]*x[j] with i < j only,
+# then doubles them and adds the squares x[i]^2 in one pass.
+
+import sys
+
+MAX = 32
+
+def reg(j):
+    """The pair of registers for the product of limb j of a row"""
+    return ("l0", "h0") if j % 2 == 0 else ("l1", "h1")
+
+def row_asm(name, L, add):
+    o = []
+    o.append("static inline mp_limb_t")
+    o.append("%s_%d (mp_ptr t, mp_srcptr v, mp_limb_t r)" % (name, L))
+    o.append("{")
+    o.append("  mp_limb_t l0, h0, l1, h1, z;")
+    o.append("")
+    o.append("  __asm__ __volatile__ (")
+    o.append('    "xorl %k[z], %k[z]\\n\\t"')
+    for j in range(L):
+        l, h = reg(j)
+        ph = reg(j + 1)[1]
+        o.append('    "mulx %d(%%[v]), %%[%s], %%[%s]\\n\\t"' % (8 * j, l, h))
+        if add:
+            if j > 0:
+                o.append('    "adox %%[%s], %%[%s]\\n\\t"' % (ph, l))
+            o.append('    "adcx %d(%%[t]), %%[%s]\\n\\t"' % (8 * j, l))
+        elif j > 0:
+            o.append('    "adcx %%[%s], %%[%s]\\n\\t"' % (ph, l))
+        o.append('    "movq %%[%s], %d(%%[t])\\n\\t"' % (l, 8 * j))
+    h = reg(L - 1)[1]
+    if add:
+        o.append('    "adox %%[z], %%[%s]\\n\\t"' % h)
+    o.append('    "adcx %%[z], %%[%s]"' % h)
+    o.append('    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),')
+    o.append('      [h1] "=&r" (h1), [z] "=&r" (z)')
+    o.append('    : [t] "r" (t), [v] "r" (v), "d" (r)')
+    o.append('    : "cc", "memory");')
+    o.append("  return %s;" % h)
+    o.append("}")
+    return "\n".join(o)
+
+def sqr_diag(N):
+    o = []
+    o.append("static inline void")
+    o.append("sqr_diag_adx_%d (mp_ptr t, mp_srcptr x)" % N)
+    o.append("{")
+    o.append("  mp_limb_t l, h, s;")
+    o.append("")
+    o.append("  __asm__ __volatile__ (")
+    o.append('    "xorl %k[s], %k[s]\\n\\t"')
+    for j in range(N):
+        o.append('    "movq %d(%%[x]), %%%%rdx\\n\\t"' % (8 * j))
+        o.append('    "mulx %%rdx, %[l], %[h]\\n\\t"')
+        for k, w in ((2 * j, "l"), (2 * j + 1, "h")):
+            o.append('    "movq %d(%%[t]), %%[s]\\n\\t"' % (8 * k))
+            o.append('    "adcx %[s], %[s]\\n\\t"')
+            o.append('    "adox %%[s], %%[%s]\\n\\t"' % w)
+            end = "" if k == 2 * N - 1 else "\\n\\t"
+            o.append('    "movq %%[%s], %d(%%[t])%s"' % (w, 8 * k, end))
+    o.append('    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)')
+    o.append('    : [t] "r" (t), [x] "r" (x)')
+    o.append('    : "rdx", "cc", "memory");')
+    o.append("}")
+    return "\n".join(o)
+
+def add_n(N):
+    o = []
+    o.append("static inline mp_limb_t")
+    o.append("add_n_adx_%d (mp_ptr z, mp_srcptr x, mp_srcptr y)" % N)
+    o.append("{")
+    o.append("  mp_limb_t s, c;")
+    o.append("")
+    o.append("  __asm__ __volatile__ (")
+    for j in range(N):
+        o.append('    "movq %d(%%[x]), %%[s]\\n\\t"' % (8 * j))
+        o.append('    "%s %d(%%[y]), %%[s]\\n\\t"'
+                 % ("addq" if j == 0 else "adcq", 8 * j))
+        o.append('    "movq %%[s], %d(%%[z])\\n\\t"' % (8 * j))
+    o.append('    "sbbq %[c], %[c]"')
+    o.append('    : [s] "=&r" (s), [c] "=&r" (c)')
+    o.append('    : [z] "r" (z), [x] "r" (x), [y] "r" (y)')
+    o.append('    : "cc", "memory");')
+    o.append("  return -c;")
+    o.append("}")
+    return "\n".join(o)
+
+def mulredc(N):
+    return """static mp_limb_t
+mulredc_adx_%(N)d (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[%(N2)d];
+  int i;
+
+  t[%(N)d] = mul_adx_%(N)d (t, y, x[0]);
+  for (i = 1; i < %(N)d; i++)
+    t[i + %(N)d] = addmul_adx_%(N)d (t + i, y, x[i]);
+  for (i = 0; i < %(N)d; i++)
+    t[i] = addmul_adx_%(N)d (t + i, m, t[i] * invm);
+  return add_n_adx_%(N)d (z, t + %(N)d, t);
+}""" % {"N": N, "N2": 2 * N}
+
+def sqrredc(N):
+    o = []
+    o.append("static mp_limb_t")
+    o.append("sqrredc_adx_%d (mp_ptr z, mp_srcptr x, mp_srcptr m, "
+             "mp_limb_t invm)" % N)
+    o.append("{")
+    o.append("  mp_limb_t t[%d];" % (2 * N))
+    o.append("  int i;")
+    o.append("")
+    o.append("  for (i = 0; i < %d; i++)" % N)
+    o.append("    t[i] = 0;")
+    o.append("  t[%d] = 0;" % (2 * N - 1))
+    for i in range(N - 1):
+        o.append("  t[%d] = addmul_adx_%d (t + %d, x + %d, x[%d]);"
+                 % (i + N, N - 1 - i, 2 * i + 1, i + 1, i))
+    o.append("  sqr_diag_adx_%d (t, x);" % N)
+    o.append("  for (i = 0; i < %d; i++)" % N)
+    o.append("    t[i] = addmul_adx_%d (t + i, m, t[i] * invm);" % N)
+    o.append("  return add_n_adx_%d (z, t + %d, t);" % (N, N))
+    o.append("}")
+    return "\n".join(o)
+
+def table(name, N):
+    o = ["const %s_fn %s_adx_table[MULREDC_ADX_MAX + 1] = {" % (name, name),
+         "  NULL,"]
+    for n in range(1, N + 1):
+        o.append("  %s_adx_%d%s" % (name, n, "," if n < N else ""))
+    o.append("};")
+    return "\n".join(o)
+
+out = []
+out.append("""/* mulredc_adx.c - mulredc and sqrredc using MULX, ADCX and ADOX.
+
+   Generated by autogen_adx.py, do not edit. */
+
+#include "mulredc.h"
+
+#if MULREDC_ADX_MAX != %d
+#error "MULREDC_ADX_MAX does not match autogen_adx.py"
+#endif
+""" % MAX)
+for L in range(1, MAX + 1):
+    out.append(row_asm("mul_adx", L, False))
+    out.append("")
+    out.append(row_asm("addmul_adx", L, True))
+    out.append("")
+for N in range(1, MAX + 1):
+    out.append(sqr_diag(N))
+    out.append("")
+    out.append(add_n(N))
+    out.append("")
+for N in range(1, MAX + 1):
+    out.append(mulredc(N))
+    out.append("")
+    out.append(sqrredc(N))
+    out.append("")
+out.append(table("mulredc", MAX))
+out.append("")
+out.append(table("sqrredc", MAX))
+out.append("")
+out.append("""int
+mulredc_adx_available (void)
+{
+  __builtin_cpu_init ();
+  return __builtin_cpu_supports ("bmi2") && __builtin_cpu_supports ("adx");
+}""")
+sys.stdout.write("\n".join(out) + "\n")
@@ -64,4 +64,21 @@ extern mp_limb_t mulredc1_18(mp_limb_t *, const mp_limb_t, const mp_limb_t *, co
 extern mp_limb_t mulredc1_19(mp_limb_t *, const mp_limb_t, const mp_limb_t *, const mp_limb_t *, mp_limb_t) MULREDC_ABI;
 extern mp_limb_t mulredc1_20(mp_limb_t *, const mp_limb_t, const mp_limb_t *, const mp_limb_t *, mp_limb_t) MULREDC_ABI;
 
+/* Kernels using MULX, ADCX and ADOX (see autogen_adx.py), with the usual
+   calling convention since they are in C. Table entry n is for n limbs.
+   They may only be called if mulredc_adx_available() returns non-zero. */
+#ifdef HAVE_MULREDC_ADX
+#define MULREDC_ADX_MAX 32
+
+typedef mp_limb_t (*mulredc_fn) (mp_limb_t *, const mp_limb_t *,
+                                 const mp_limb_t *, const mp_limb_t *,
+                                 mp_limb_t);
+typedef mp_limb_t (*sqrredc_fn) (mp_limb_t *, const mp_limb_t *,
+                                 const mp_limb_t *, mp_limb_t);
+
+extern const mulredc_fn mulredc_adx_table[MULREDC_ADX_MAX + 1];
+extern const sqrredc_fn sqrredc_adx_table[MULREDC_ADX_MAX + 1];
+extern int mulredc_adx_available (void);
+#endif
+
 #endif
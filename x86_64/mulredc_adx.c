@@ -0,0 +1,13832 @@
+/* mulredc_adx.c - mulredc and sqrredc using MULX, ADCX and ADOX.
+
+   Generated by autogen_adx.py, do not edit. */
+
+#include "mulredc.h"
+
+#if MULREDC_ADX_MAX != 32
+#error "MULREDC_ADX_MAX does not match autogen_adx.py"
+#endif
+
+static inline mp_limb_t
+mul_adx_1 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_1 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_2 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_2 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_3 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_3 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_4 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_4 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_5 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_5 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_6 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_6 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_7 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_7 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_8 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_8 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_9 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_9 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_10 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_10 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_11 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_11 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_12 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_12 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_13 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_13 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_14 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_14 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_15 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_15 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_16 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_16 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_17 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_17 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_18 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_18 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_19 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_19 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_20 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_20 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_21 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_21 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_22 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_22 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_23 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_23 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_24 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_24 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 184(%[t]), %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_25 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_25 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 184(%[t]), %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 192(%[t]), %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_26 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_26 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 184(%[t]), %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 192(%[t]), %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 200(%[t]), %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_27 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_27 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 184(%[t]), %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 192(%[t]), %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 200(%[t]), %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 208(%[t]), %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_28 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_28 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 184(%[t]), %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 192(%[t]), %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 200(%[t]), %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 208(%[t]), %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 216(%[t]), %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_29 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "mulx 224(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 224(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_29 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 184(%[t]), %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 192(%[t]), %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 200(%[t]), %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 208(%[t]), %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 216(%[t]), %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "mulx 224(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 224(%[t]), %[l0]\n\t"
+    "movq %[l0], 224(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_30 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "mulx 224(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 224(%[t])\n\t"
+    "mulx 232(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 232(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_30 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 184(%[t]), %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 192(%[t]), %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 200(%[t]), %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 208(%[t]), %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 216(%[t]), %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "mulx 224(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 224(%[t]), %[l0]\n\t"
+    "movq %[l0], 224(%[t])\n\t"
+    "mulx 232(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 232(%[t]), %[l1]\n\t"
+    "movq %[l1], 232(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+mul_adx_31 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "mulx 224(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 224(%[t])\n\t"
+    "mulx 232(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 232(%[t])\n\t"
+    "mulx 240(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 240(%[t])\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+addmul_adx_31 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 184(%[t]), %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 192(%[t]), %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 200(%[t]), %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 208(%[t]), %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 216(%[t]), %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "mulx 224(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 224(%[t]), %[l0]\n\t"
+    "movq %[l0], 224(%[t])\n\t"
+    "mulx 232(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 232(%[t]), %[l1]\n\t"
+    "movq %[l1], 232(%[t])\n\t"
+    "mulx 240(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 240(%[t]), %[l0]\n\t"
+    "movq %[l0], 240(%[t])\n\t"
+    "adox %[z], %[h0]\n\t"
+    "adcx %[z], %[h0]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h0;
+}
+
+static inline mp_limb_t
+mul_adx_32 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "mulx 224(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 224(%[t])\n\t"
+    "mulx 232(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 232(%[t])\n\t"
+    "mulx 240(%[v]), %[l0], %[h0]\n\t"
+    "adcx %[h1], %[l0]\n\t"
+    "movq %[l0], 240(%[t])\n\t"
+    "mulx 248(%[v]), %[l1], %[h1]\n\t"
+    "adcx %[h0], %[l1]\n\t"
+    "movq %[l1], 248(%[t])\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline mp_limb_t
+addmul_adx_32 (mp_ptr t, mp_srcptr v, mp_limb_t r)
+{
+  mp_limb_t l0, h0, l1, h1, z;
+
+  __asm__ __volatile__ (
+    "xorl %k[z], %k[z]\n\t"
+    "mulx 0(%[v]), %[l0], %[h0]\n\t"
+    "adcx 0(%[t]), %[l0]\n\t"
+    "movq %[l0], 0(%[t])\n\t"
+    "mulx 8(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 8(%[t]), %[l1]\n\t"
+    "movq %[l1], 8(%[t])\n\t"
+    "mulx 16(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 16(%[t]), %[l0]\n\t"
+    "movq %[l0], 16(%[t])\n\t"
+    "mulx 24(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 24(%[t]), %[l1]\n\t"
+    "movq %[l1], 24(%[t])\n\t"
+    "mulx 32(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 32(%[t]), %[l0]\n\t"
+    "movq %[l0], 32(%[t])\n\t"
+    "mulx 40(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 40(%[t]), %[l1]\n\t"
+    "movq %[l1], 40(%[t])\n\t"
+    "mulx 48(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 48(%[t]), %[l0]\n\t"
+    "movq %[l0], 48(%[t])\n\t"
+    "mulx 56(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 56(%[t]), %[l1]\n\t"
+    "movq %[l1], 56(%[t])\n\t"
+    "mulx 64(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 64(%[t]), %[l0]\n\t"
+    "movq %[l0], 64(%[t])\n\t"
+    "mulx 72(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 72(%[t]), %[l1]\n\t"
+    "movq %[l1], 72(%[t])\n\t"
+    "mulx 80(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 80(%[t]), %[l0]\n\t"
+    "movq %[l0], 80(%[t])\n\t"
+    "mulx 88(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 88(%[t]), %[l1]\n\t"
+    "movq %[l1], 88(%[t])\n\t"
+    "mulx 96(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 96(%[t]), %[l0]\n\t"
+    "movq %[l0], 96(%[t])\n\t"
+    "mulx 104(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 104(%[t]), %[l1]\n\t"
+    "movq %[l1], 104(%[t])\n\t"
+    "mulx 112(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 112(%[t]), %[l0]\n\t"
+    "movq %[l0], 112(%[t])\n\t"
+    "mulx 120(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 120(%[t]), %[l1]\n\t"
+    "movq %[l1], 120(%[t])\n\t"
+    "mulx 128(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 128(%[t]), %[l0]\n\t"
+    "movq %[l0], 128(%[t])\n\t"
+    "mulx 136(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 136(%[t]), %[l1]\n\t"
+    "movq %[l1], 136(%[t])\n\t"
+    "mulx 144(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 144(%[t]), %[l0]\n\t"
+    "movq %[l0], 144(%[t])\n\t"
+    "mulx 152(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 152(%[t]), %[l1]\n\t"
+    "movq %[l1], 152(%[t])\n\t"
+    "mulx 160(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 160(%[t]), %[l0]\n\t"
+    "movq %[l0], 160(%[t])\n\t"
+    "mulx 168(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 168(%[t]), %[l1]\n\t"
+    "movq %[l1], 168(%[t])\n\t"
+    "mulx 176(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 176(%[t]), %[l0]\n\t"
+    "movq %[l0], 176(%[t])\n\t"
+    "mulx 184(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 184(%[t]), %[l1]\n\t"
+    "movq %[l1], 184(%[t])\n\t"
+    "mulx 192(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 192(%[t]), %[l0]\n\t"
+    "movq %[l0], 192(%[t])\n\t"
+    "mulx 200(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 200(%[t]), %[l1]\n\t"
+    "movq %[l1], 200(%[t])\n\t"
+    "mulx 208(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 208(%[t]), %[l0]\n\t"
+    "movq %[l0], 208(%[t])\n\t"
+    "mulx 216(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 216(%[t]), %[l1]\n\t"
+    "movq %[l1], 216(%[t])\n\t"
+    "mulx 224(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 224(%[t]), %[l0]\n\t"
+    "movq %[l0], 224(%[t])\n\t"
+    "mulx 232(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 232(%[t]), %[l1]\n\t"
+    "movq %[l1], 232(%[t])\n\t"
+    "mulx 240(%[v]), %[l0], %[h0]\n\t"
+    "adox %[h1], %[l0]\n\t"
+    "adcx 240(%[t]), %[l0]\n\t"
+    "movq %[l0], 240(%[t])\n\t"
+    "mulx 248(%[v]), %[l1], %[h1]\n\t"
+    "adox %[h0], %[l1]\n\t"
+    "adcx 248(%[t]), %[l1]\n\t"
+    "movq %[l1], 248(%[t])\n\t"
+    "adox %[z], %[h1]\n\t"
+    "adcx %[z], %[h1]"
+    : [l0] "=&r" (l0), [h0] "=&r" (h0), [l1] "=&r" (l1),
+      [h1] "=&r" (h1), [z] "=&r" (z)
+    : [t] "r" (t), [v] "r" (v), "d" (r)
+    : "cc", "memory");
+  return h1;
+}
+
+static inline void
+sqr_diag_adx_1 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_1 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_2 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_2 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_3 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_3 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_4 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_4 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_5 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_5 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_6 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_6 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_7 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_7 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_8 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_8 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_9 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_9 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_10 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_10 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_11 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_11 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_12 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_12 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_13 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_13 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_14 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_14 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_15 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_15 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_16 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_16 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_17 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_17 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_18 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_18 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_19 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_19 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_20 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_20 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_21 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_21 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_22 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_22 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_23 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_23 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_24 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])\n\t"
+    "movq 184(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 368(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 368(%[t])\n\t"
+    "movq 376(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 376(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_24 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "movq 184(%[x]), %[s]\n\t"
+    "adcq 184(%[y]), %[s]\n\t"
+    "movq %[s], 184(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_25 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])\n\t"
+    "movq 184(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 368(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 368(%[t])\n\t"
+    "movq 376(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 376(%[t])\n\t"
+    "movq 192(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 384(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 384(%[t])\n\t"
+    "movq 392(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 392(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_25 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "movq 184(%[x]), %[s]\n\t"
+    "adcq 184(%[y]), %[s]\n\t"
+    "movq %[s], 184(%[z])\n\t"
+    "movq 192(%[x]), %[s]\n\t"
+    "adcq 192(%[y]), %[s]\n\t"
+    "movq %[s], 192(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_26 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])\n\t"
+    "movq 184(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 368(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 368(%[t])\n\t"
+    "movq 376(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 376(%[t])\n\t"
+    "movq 192(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 384(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 384(%[t])\n\t"
+    "movq 392(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 392(%[t])\n\t"
+    "movq 200(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 400(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 400(%[t])\n\t"
+    "movq 408(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 408(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_26 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "movq 184(%[x]), %[s]\n\t"
+    "adcq 184(%[y]), %[s]\n\t"
+    "movq %[s], 184(%[z])\n\t"
+    "movq 192(%[x]), %[s]\n\t"
+    "adcq 192(%[y]), %[s]\n\t"
+    "movq %[s], 192(%[z])\n\t"
+    "movq 200(%[x]), %[s]\n\t"
+    "adcq 200(%[y]), %[s]\n\t"
+    "movq %[s], 200(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_27 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])\n\t"
+    "movq 184(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 368(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 368(%[t])\n\t"
+    "movq 376(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 376(%[t])\n\t"
+    "movq 192(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 384(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 384(%[t])\n\t"
+    "movq 392(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 392(%[t])\n\t"
+    "movq 200(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 400(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 400(%[t])\n\t"
+    "movq 408(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 408(%[t])\n\t"
+    "movq 208(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 416(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 416(%[t])\n\t"
+    "movq 424(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 424(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_27 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "movq 184(%[x]), %[s]\n\t"
+    "adcq 184(%[y]), %[s]\n\t"
+    "movq %[s], 184(%[z])\n\t"
+    "movq 192(%[x]), %[s]\n\t"
+    "adcq 192(%[y]), %[s]\n\t"
+    "movq %[s], 192(%[z])\n\t"
+    "movq 200(%[x]), %[s]\n\t"
+    "adcq 200(%[y]), %[s]\n\t"
+    "movq %[s], 200(%[z])\n\t"
+    "movq 208(%[x]), %[s]\n\t"
+    "adcq 208(%[y]), %[s]\n\t"
+    "movq %[s], 208(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_28 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])\n\t"
+    "movq 184(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 368(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 368(%[t])\n\t"
+    "movq 376(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 376(%[t])\n\t"
+    "movq 192(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 384(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 384(%[t])\n\t"
+    "movq 392(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 392(%[t])\n\t"
+    "movq 200(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 400(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 400(%[t])\n\t"
+    "movq 408(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 408(%[t])\n\t"
+    "movq 208(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 416(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 416(%[t])\n\t"
+    "movq 424(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 424(%[t])\n\t"
+    "movq 216(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 432(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 432(%[t])\n\t"
+    "movq 440(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 440(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_28 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "movq 184(%[x]), %[s]\n\t"
+    "adcq 184(%[y]), %[s]\n\t"
+    "movq %[s], 184(%[z])\n\t"
+    "movq 192(%[x]), %[s]\n\t"
+    "adcq 192(%[y]), %[s]\n\t"
+    "movq %[s], 192(%[z])\n\t"
+    "movq 200(%[x]), %[s]\n\t"
+    "adcq 200(%[y]), %[s]\n\t"
+    "movq %[s], 200(%[z])\n\t"
+    "movq 208(%[x]), %[s]\n\t"
+    "adcq 208(%[y]), %[s]\n\t"
+    "movq %[s], 208(%[z])\n\t"
+    "movq 216(%[x]), %[s]\n\t"
+    "adcq 216(%[y]), %[s]\n\t"
+    "movq %[s], 216(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_29 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])\n\t"
+    "movq 184(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 368(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 368(%[t])\n\t"
+    "movq 376(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 376(%[t])\n\t"
+    "movq 192(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 384(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 384(%[t])\n\t"
+    "movq 392(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 392(%[t])\n\t"
+    "movq 200(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 400(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 400(%[t])\n\t"
+    "movq 408(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 408(%[t])\n\t"
+    "movq 208(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 416(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 416(%[t])\n\t"
+    "movq 424(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 424(%[t])\n\t"
+    "movq 216(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 432(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 432(%[t])\n\t"
+    "movq 440(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 440(%[t])\n\t"
+    "movq 224(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 448(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 448(%[t])\n\t"
+    "movq 456(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 456(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_29 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "movq 184(%[x]), %[s]\n\t"
+    "adcq 184(%[y]), %[s]\n\t"
+    "movq %[s], 184(%[z])\n\t"
+    "movq 192(%[x]), %[s]\n\t"
+    "adcq 192(%[y]), %[s]\n\t"
+    "movq %[s], 192(%[z])\n\t"
+    "movq 200(%[x]), %[s]\n\t"
+    "adcq 200(%[y]), %[s]\n\t"
+    "movq %[s], 200(%[z])\n\t"
+    "movq 208(%[x]), %[s]\n\t"
+    "adcq 208(%[y]), %[s]\n\t"
+    "movq %[s], 208(%[z])\n\t"
+    "movq 216(%[x]), %[s]\n\t"
+    "adcq 216(%[y]), %[s]\n\t"
+    "movq %[s], 216(%[z])\n\t"
+    "movq 224(%[x]), %[s]\n\t"
+    "adcq 224(%[y]), %[s]\n\t"
+    "movq %[s], 224(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_30 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])\n\t"
+    "movq 184(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 368(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 368(%[t])\n\t"
+    "movq 376(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 376(%[t])\n\t"
+    "movq 192(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 384(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 384(%[t])\n\t"
+    "movq 392(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 392(%[t])\n\t"
+    "movq 200(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 400(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 400(%[t])\n\t"
+    "movq 408(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 408(%[t])\n\t"
+    "movq 208(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 416(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 416(%[t])\n\t"
+    "movq 424(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 424(%[t])\n\t"
+    "movq 216(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 432(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 432(%[t])\n\t"
+    "movq 440(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 440(%[t])\n\t"
+    "movq 224(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 448(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 448(%[t])\n\t"
+    "movq 456(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 456(%[t])\n\t"
+    "movq 232(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 464(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 464(%[t])\n\t"
+    "movq 472(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 472(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_30 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "movq 184(%[x]), %[s]\n\t"
+    "adcq 184(%[y]), %[s]\n\t"
+    "movq %[s], 184(%[z])\n\t"
+    "movq 192(%[x]), %[s]\n\t"
+    "adcq 192(%[y]), %[s]\n\t"
+    "movq %[s], 192(%[z])\n\t"
+    "movq 200(%[x]), %[s]\n\t"
+    "adcq 200(%[y]), %[s]\n\t"
+    "movq %[s], 200(%[z])\n\t"
+    "movq 208(%[x]), %[s]\n\t"
+    "adcq 208(%[y]), %[s]\n\t"
+    "movq %[s], 208(%[z])\n\t"
+    "movq 216(%[x]), %[s]\n\t"
+    "adcq 216(%[y]), %[s]\n\t"
+    "movq %[s], 216(%[z])\n\t"
+    "movq 224(%[x]), %[s]\n\t"
+    "adcq 224(%[y]), %[s]\n\t"
+    "movq %[s], 224(%[z])\n\t"
+    "movq 232(%[x]), %[s]\n\t"
+    "adcq 232(%[y]), %[s]\n\t"
+    "movq %[s], 232(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_31 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])\n\t"
+    "movq 184(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 368(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 368(%[t])\n\t"
+    "movq 376(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 376(%[t])\n\t"
+    "movq 192(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 384(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 384(%[t])\n\t"
+    "movq 392(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 392(%[t])\n\t"
+    "movq 200(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 400(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 400(%[t])\n\t"
+    "movq 408(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 408(%[t])\n\t"
+    "movq 208(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 416(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 416(%[t])\n\t"
+    "movq 424(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 424(%[t])\n\t"
+    "movq 216(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 432(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 432(%[t])\n\t"
+    "movq 440(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 440(%[t])\n\t"
+    "movq 224(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 448(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 448(%[t])\n\t"
+    "movq 456(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 456(%[t])\n\t"
+    "movq 232(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 464(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 464(%[t])\n\t"
+    "movq 472(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 472(%[t])\n\t"
+    "movq 240(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 480(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 480(%[t])\n\t"
+    "movq 488(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 488(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_31 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "movq 184(%[x]), %[s]\n\t"
+    "adcq 184(%[y]), %[s]\n\t"
+    "movq %[s], 184(%[z])\n\t"
+    "movq 192(%[x]), %[s]\n\t"
+    "adcq 192(%[y]), %[s]\n\t"
+    "movq %[s], 192(%[z])\n\t"
+    "movq 200(%[x]), %[s]\n\t"
+    "adcq 200(%[y]), %[s]\n\t"
+    "movq %[s], 200(%[z])\n\t"
+    "movq 208(%[x]), %[s]\n\t"
+    "adcq 208(%[y]), %[s]\n\t"
+    "movq %[s], 208(%[z])\n\t"
+    "movq 216(%[x]), %[s]\n\t"
+    "adcq 216(%[y]), %[s]\n\t"
+    "movq %[s], 216(%[z])\n\t"
+    "movq 224(%[x]), %[s]\n\t"
+    "adcq 224(%[y]), %[s]\n\t"
+    "movq %[s], 224(%[z])\n\t"
+    "movq 232(%[x]), %[s]\n\t"
+    "adcq 232(%[y]), %[s]\n\t"
+    "movq %[s], 232(%[z])\n\t"
+    "movq 240(%[x]), %[s]\n\t"
+    "adcq 240(%[y]), %[s]\n\t"
+    "movq %[s], 240(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static inline void
+sqr_diag_adx_32 (mp_ptr t, mp_srcptr x)
+{
+  mp_limb_t l, h, s;
+
+  __asm__ __volatile__ (
+    "xorl %k[s], %k[s]\n\t"
+    "movq 0(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 0(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 0(%[t])\n\t"
+    "movq 8(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 8(%[t])\n\t"
+    "movq 8(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 16(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 16(%[t])\n\t"
+    "movq 24(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 24(%[t])\n\t"
+    "movq 16(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 32(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 32(%[t])\n\t"
+    "movq 40(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 40(%[t])\n\t"
+    "movq 24(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 48(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 48(%[t])\n\t"
+    "movq 56(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 56(%[t])\n\t"
+    "movq 32(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 64(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 64(%[t])\n\t"
+    "movq 72(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 72(%[t])\n\t"
+    "movq 40(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 80(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 80(%[t])\n\t"
+    "movq 88(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 88(%[t])\n\t"
+    "movq 48(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 96(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 96(%[t])\n\t"
+    "movq 104(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 104(%[t])\n\t"
+    "movq 56(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 112(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 112(%[t])\n\t"
+    "movq 120(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 120(%[t])\n\t"
+    "movq 64(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 128(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 128(%[t])\n\t"
+    "movq 136(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 136(%[t])\n\t"
+    "movq 72(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 144(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 144(%[t])\n\t"
+    "movq 152(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 152(%[t])\n\t"
+    "movq 80(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 160(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 160(%[t])\n\t"
+    "movq 168(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 168(%[t])\n\t"
+    "movq 88(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 176(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 176(%[t])\n\t"
+    "movq 184(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 184(%[t])\n\t"
+    "movq 96(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 192(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 192(%[t])\n\t"
+    "movq 200(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 200(%[t])\n\t"
+    "movq 104(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 208(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 208(%[t])\n\t"
+    "movq 216(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 216(%[t])\n\t"
+    "movq 112(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 224(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 224(%[t])\n\t"
+    "movq 232(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 232(%[t])\n\t"
+    "movq 120(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 240(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 240(%[t])\n\t"
+    "movq 248(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 248(%[t])\n\t"
+    "movq 128(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 256(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 256(%[t])\n\t"
+    "movq 264(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 264(%[t])\n\t"
+    "movq 136(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 272(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 272(%[t])\n\t"
+    "movq 280(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 280(%[t])\n\t"
+    "movq 144(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 288(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 288(%[t])\n\t"
+    "movq 296(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 296(%[t])\n\t"
+    "movq 152(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 304(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 304(%[t])\n\t"
+    "movq 312(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 312(%[t])\n\t"
+    "movq 160(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 320(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 320(%[t])\n\t"
+    "movq 328(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 328(%[t])\n\t"
+    "movq 168(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 336(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 336(%[t])\n\t"
+    "movq 344(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 344(%[t])\n\t"
+    "movq 176(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 352(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 352(%[t])\n\t"
+    "movq 360(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 360(%[t])\n\t"
+    "movq 184(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 368(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 368(%[t])\n\t"
+    "movq 376(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 376(%[t])\n\t"
+    "movq 192(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 384(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 384(%[t])\n\t"
+    "movq 392(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 392(%[t])\n\t"
+    "movq 200(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 400(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 400(%[t])\n\t"
+    "movq 408(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 408(%[t])\n\t"
+    "movq 208(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 416(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 416(%[t])\n\t"
+    "movq 424(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 424(%[t])\n\t"
+    "movq 216(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 432(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 432(%[t])\n\t"
+    "movq 440(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 440(%[t])\n\t"
+    "movq 224(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 448(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 448(%[t])\n\t"
+    "movq 456(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 456(%[t])\n\t"
+    "movq 232(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 464(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 464(%[t])\n\t"
+    "movq 472(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 472(%[t])\n\t"
+    "movq 240(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 480(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 480(%[t])\n\t"
+    "movq 488(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 488(%[t])\n\t"
+    "movq 248(%[x]), %%rdx\n\t"
+    "mulx %%rdx, %[l], %[h]\n\t"
+    "movq 496(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[l]\n\t"
+    "movq %[l], 496(%[t])\n\t"
+    "movq 504(%[t]), %[s]\n\t"
+    "adcx %[s], %[s]\n\t"
+    "adox %[s], %[h]\n\t"
+    "movq %[h], 504(%[t])"
+    : [l] "=&r" (l), [h] "=&r" (h), [s] "=&r" (s)
+    : [t] "r" (t), [x] "r" (x)
+    : "rdx", "cc", "memory");
+}
+
+static inline mp_limb_t
+add_n_adx_32 (mp_ptr z, mp_srcptr x, mp_srcptr y)
+{
+  mp_limb_t s, c;
+
+  __asm__ __volatile__ (
+    "movq 0(%[x]), %[s]\n\t"
+    "addq 0(%[y]), %[s]\n\t"
+    "movq %[s], 0(%[z])\n\t"
+    "movq 8(%[x]), %[s]\n\t"
+    "adcq 8(%[y]), %[s]\n\t"
+    "movq %[s], 8(%[z])\n\t"
+    "movq 16(%[x]), %[s]\n\t"
+    "adcq 16(%[y]), %[s]\n\t"
+    "movq %[s], 16(%[z])\n\t"
+    "movq 24(%[x]), %[s]\n\t"
+    "adcq 24(%[y]), %[s]\n\t"
+    "movq %[s], 24(%[z])\n\t"
+    "movq 32(%[x]), %[s]\n\t"
+    "adcq 32(%[y]), %[s]\n\t"
+    "movq %[s], 32(%[z])\n\t"
+    "movq 40(%[x]), %[s]\n\t"
+    "adcq 40(%[y]), %[s]\n\t"
+    "movq %[s], 40(%[z])\n\t"
+    "movq 48(%[x]), %[s]\n\t"
+    "adcq 48(%[y]), %[s]\n\t"
+    "movq %[s], 48(%[z])\n\t"
+    "movq 56(%[x]), %[s]\n\t"
+    "adcq 56(%[y]), %[s]\n\t"
+    "movq %[s], 56(%[z])\n\t"
+    "movq 64(%[x]), %[s]\n\t"
+    "adcq 64(%[y]), %[s]\n\t"
+    "movq %[s], 64(%[z])\n\t"
+    "movq 72(%[x]), %[s]\n\t"
+    "adcq 72(%[y]), %[s]\n\t"
+    "movq %[s], 72(%[z])\n\t"
+    "movq 80(%[x]), %[s]\n\t"
+    "adcq 80(%[y]), %[s]\n\t"
+    "movq %[s], 80(%[z])\n\t"
+    "movq 88(%[x]), %[s]\n\t"
+    "adcq 88(%[y]), %[s]\n\t"
+    "movq %[s], 88(%[z])\n\t"
+    "movq 96(%[x]), %[s]\n\t"
+    "adcq 96(%[y]), %[s]\n\t"
+    "movq %[s], 96(%[z])\n\t"
+    "movq 104(%[x]), %[s]\n\t"
+    "adcq 104(%[y]), %[s]\n\t"
+    "movq %[s], 104(%[z])\n\t"
+    "movq 112(%[x]), %[s]\n\t"
+    "adcq 112(%[y]), %[s]\n\t"
+    "movq %[s], 112(%[z])\n\t"
+    "movq 120(%[x]), %[s]\n\t"
+    "adcq 120(%[y]), %[s]\n\t"
+    "movq %[s], 120(%[z])\n\t"
+    "movq 128(%[x]), %[s]\n\t"
+    "adcq 128(%[y]), %[s]\n\t"
+    "movq %[s], 128(%[z])\n\t"
+    "movq 136(%[x]), %[s]\n\t"
+    "adcq 136(%[y]), %[s]\n\t"
+    "movq %[s], 136(%[z])\n\t"
+    "movq 144(%[x]), %[s]\n\t"
+    "adcq 144(%[y]), %[s]\n\t"
+    "movq %[s], 144(%[z])\n\t"
+    "movq 152(%[x]), %[s]\n\t"
+    "adcq 152(%[y]), %[s]\n\t"
+    "movq %[s], 152(%[z])\n\t"
+    "movq 160(%[x]), %[s]\n\t"
+    "adcq 160(%[y]), %[s]\n\t"
+    "movq %[s], 160(%[z])\n\t"
+    "movq 168(%[x]), %[s]\n\t"
+    "adcq 168(%[y]), %[s]\n\t"
+    "movq %[s], 168(%[z])\n\t"
+    "movq 176(%[x]), %[s]\n\t"
+    "adcq 176(%[y]), %[s]\n\t"
+    "movq %[s], 176(%[z])\n\t"
+    "movq 184(%[x]), %[s]\n\t"
+    "adcq 184(%[y]), %[s]\n\t"
+    "movq %[s], 184(%[z])\n\t"
+    "movq 192(%[x]), %[s]\n\t"
+    "adcq 192(%[y]), %[s]\n\t"
+    "movq %[s], 192(%[z])\n\t"
+    "movq 200(%[x]), %[s]\n\t"
+    "adcq 200(%[y]), %[s]\n\t"
+    "movq %[s], 200(%[z])\n\t"
+    "movq 208(%[x]), %[s]\n\t"
+    "adcq 208(%[y]), %[s]\n\t"
+    "movq %[s], 208(%[z])\n\t"
+    "movq 216(%[x]), %[s]\n\t"
+    "adcq 216(%[y]), %[s]\n\t"
+    "movq %[s], 216(%[z])\n\t"
+    "movq 224(%[x]), %[s]\n\t"
+    "adcq 224(%[y]), %[s]\n\t"
+    "movq %[s], 224(%[z])\n\t"
+    "movq 232(%[x]), %[s]\n\t"
+    "adcq 232(%[y]), %[s]\n\t"
+    "movq %[s], 232(%[z])\n\t"
+    "movq 240(%[x]), %[s]\n\t"
+    "adcq 240(%[y]), %[s]\n\t"
+    "movq %[s], 240(%[z])\n\t"
+    "movq 248(%[x]), %[s]\n\t"
+    "adcq 248(%[y]), %[s]\n\t"
+    "movq %[s], 248(%[z])\n\t"
+    "sbbq %[c], %[c]"
+    : [s] "=&r" (s), [c] "=&r" (c)
+    : [z] "r" (z), [x] "r" (x), [y] "r" (y)
+    : "cc", "memory");
+  return -c;
+}
+
+static mp_limb_t
+mulredc_adx_1 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[2];
+  int i;
+
+  t[1] = mul_adx_1 (t, y, x[0]);
+  for (i = 1; i < 1; i++)
+    t[i + 1] = addmul_adx_1 (t + i, y, x[i]);
+  for (i = 0; i < 1; i++)
+    t[i] = addmul_adx_1 (t + i, m, t[i] * invm);
+  return add_n_adx_1 (z, t + 1, t);
+}
+
+static mp_limb_t
+sqrredc_adx_1 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[2];
+  int i;
+
+  for (i = 0; i < 1; i++)
+    t[i] = 0;
+  t[1] = 0;
+  sqr_diag_adx_1 (t, x);
+  for (i = 0; i < 1; i++)
+    t[i] = addmul_adx_1 (t + i, m, t[i] * invm);
+  return add_n_adx_1 (z, t + 1, t);
+}
+
+static mp_limb_t
+mulredc_adx_2 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[4];
+  int i;
+
+  t[2] = mul_adx_2 (t, y, x[0]);
+  for (i = 1; i < 2; i++)
+    t[i + 2] = addmul_adx_2 (t + i, y, x[i]);
+  for (i = 0; i < 2; i++)
+    t[i] = addmul_adx_2 (t + i, m, t[i] * invm);
+  return add_n_adx_2 (z, t + 2, t);
+}
+
+static mp_limb_t
+sqrredc_adx_2 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[4];
+  int i;
+
+  for (i = 0; i < 2; i++)
+    t[i] = 0;
+  t[3] = 0;
+  t[2] = addmul_adx_1 (t + 1, x + 1, x[0]);
+  sqr_diag_adx_2 (t, x);
+  for (i = 0; i < 2; i++)
+    t[i] = addmul_adx_2 (t + i, m, t[i] * invm);
+  return add_n_adx_2 (z, t + 2, t);
+}
+
+static mp_limb_t
+mulredc_adx_3 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[6];
+  int i;
+
+  t[3] = mul_adx_3 (t, y, x[0]);
+  for (i = 1; i < 3; i++)
+    t[i + 3] = addmul_adx_3 (t + i, y, x[i]);
+  for (i = 0; i < 3; i++)
+    t[i] = addmul_adx_3 (t + i, m, t[i] * invm);
+  return add_n_adx_3 (z, t + 3, t);
+}
+
+static mp_limb_t
+sqrredc_adx_3 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[6];
+  int i;
+
+  for (i = 0; i < 3; i++)
+    t[i] = 0;
+  t[5] = 0;
+  t[3] = addmul_adx_2 (t + 1, x + 1, x[0]);
+  t[4] = addmul_adx_1 (t + 3, x + 2, x[1]);
+  sqr_diag_adx_3 (t, x);
+  for (i = 0; i < 3; i++)
+    t[i] = addmul_adx_3 (t + i, m, t[i] * invm);
+  return add_n_adx_3 (z, t + 3, t);
+}
+
+static mp_limb_t
+mulredc_adx_4 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[8];
+  int i;
+
+  t[4] = mul_adx_4 (t, y, x[0]);
+  for (i = 1; i < 4; i++)
+    t[i + 4] = addmul_adx_4 (t + i, y, x[i]);
+  for (i = 0; i < 4; i++)
+    t[i] = addmul_adx_4 (t + i, m, t[i] * invm);
+  return add_n_adx_4 (z, t + 4, t);
+}
+
+static mp_limb_t
+sqrredc_adx_4 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[8];
+  int i;
+
+  for (i = 0; i < 4; i++)
+    t[i] = 0;
+  t[7] = 0;
+  t[4] = addmul_adx_3 (t + 1, x + 1, x[0]);
+  t[5] = addmul_adx_2 (t + 3, x + 2, x[1]);
+  t[6] = addmul_adx_1 (t + 5, x + 3, x[2]);
+  sqr_diag_adx_4 (t, x);
+  for (i = 0; i < 4; i++)
+    t[i] = addmul_adx_4 (t + i, m, t[i] * invm);
+  return add_n_adx_4 (z, t + 4, t);
+}
+
+static mp_limb_t
+mulredc_adx_5 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[10];
+  int i;
+
+  t[5] = mul_adx_5 (t, y, x[0]);
+  for (i = 1; i < 5; i++)
+    t[i + 5] = addmul_adx_5 (t + i, y, x[i]);
+  for (i = 0; i < 5; i++)
+    t[i] = addmul_adx_5 (t + i, m, t[i] * invm);
+  return add_n_adx_5 (z, t + 5, t);
+}
+
+static mp_limb_t
+sqrredc_adx_5 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[10];
+  int i;
+
+  for (i = 0; i < 5; i++)
+    t[i] = 0;
+  t[9] = 0;
+  t[5] = addmul_adx_4 (t + 1, x + 1, x[0]);
+  t[6] = addmul_adx_3 (t + 3, x + 2, x[1]);
+  t[7] = addmul_adx_2 (t + 5, x + 3, x[2]);
+  t[8] = addmul_adx_1 (t + 7, x + 4, x[3]);
+  sqr_diag_adx_5 (t, x);
+  for (i = 0; i < 5; i++)
+    t[i] = addmul_adx_5 (t + i, m, t[i] * invm);
+  return add_n_adx_5 (z, t + 5, t);
+}
+
+static mp_limb_t
+mulredc_adx_6 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[12];
+  int i;
+
+  t[6] = mul_adx_6 (t, y, x[0]);
+  for (i = 1; i < 6; i++)
+    t[i + 6] = addmul_adx_6 (t + i, y, x[i]);
+  for (i = 0; i < 6; i++)
+    t[i] = addmul_adx_6 (t + i, m, t[i] * invm);
+  return add_n_adx_6 (z, t + 6, t);
+}
+
+static mp_limb_t
+sqrredc_adx_6 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[12];
+  int i;
+
+  for (i = 0; i < 6; i++)
+    t[i] = 0;
+  t[11] = 0;
+  t[6] = addmul_adx_5 (t + 1, x + 1, x[0]);
+  t[7] = addmul_adx_4 (t + 3, x + 2, x[1]);
+  t[8] = addmul_adx_3 (t + 5, x + 3, x[2]);
+  t[9] = addmul_adx_2 (t + 7, x + 4, x[3]);
+  t[10] = addmul_adx_1 (t + 9, x + 5, x[4]);
+  sqr_diag_adx_6 (t, x);
+  for (i = 0; i < 6; i++)
+    t[i] = addmul_adx_6 (t + i, m, t[i] * invm);
+  return add_n_adx_6 (z, t + 6, t);
+}
+
+static mp_limb_t
+mulredc_adx_7 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[14];
+  int i;
+
+  t[7] = mul_adx_7 (t, y, x[0]);
+  for (i = 1; i < 7; i++)
+    t[i + 7] = addmul_adx_7 (t + i, y, x[i]);
+  for (i = 0; i < 7; i++)
+    t[i] = addmul_adx_7 (t + i, m, t[i] * invm);
+  return add_n_adx_7 (z, t + 7, t);
+}
+
+static mp_limb_t
+sqrredc_adx_7 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[14];
+  int i;
+
+  for (i = 0; i < 7; i++)
+    t[i] = 0;
+  t[13] = 0;
+  t[7] = addmul_adx_6 (t + 1, x + 1, x[0]);
+  t[8] = addmul_adx_5 (t + 3, x + 2, x[1]);
+  t[9] = addmul_adx_4 (t + 5, x + 3, x[2]);
+  t[10] = addmul_adx_3 (t + 7, x + 4, x[3]);
+  t[11] = addmul_adx_2 (t + 9, x + 5, x[4]);
+  t[12] = addmul_adx_1 (t + 11, x + 6, x[5]);
+  sqr_diag_adx_7 (t, x);
+  for (i = 0; i < 7; i++)
+    t[i] = addmul_adx_7 (t + i, m, t[i] * invm);
+  return add_n_adx_7 (z, t + 7, t);
+}
+
+static mp_limb_t
+mulredc_adx_8 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[16];
+  int i;
+
+  t[8] = mul_adx_8 (t, y, x[0]);
+  for (i = 1; i < 8; i++)
+    t[i + 8] = addmul_adx_8 (t + i, y, x[i]);
+  for (i = 0; i < 8; i++)
+    t[i] = addmul_adx_8 (t + i, m, t[i] * invm);
+  return add_n_adx_8 (z, t + 8, t);
+}
+
+static mp_limb_t
+sqrredc_adx_8 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[16];
+  int i;
+
+  for (i = 0; i < 8; i++)
+    t[i] = 0;
+  t[15] = 0;
+  t[8] = addmul_adx_7 (t + 1, x + 1, x[0]);
+  t[9] = addmul_adx_6 (t + 3, x + 2, x[1]);
+  t[10] = addmul_adx_5 (t + 5, x + 3, x[2]);
+  t[11] = addmul_adx_4 (t + 7, x + 4, x[3]);
+  t[12] = addmul_adx_3 (t + 9, x + 5, x[4]);
+  t[13] = addmul_adx_2 (t + 11, x + 6, x[5]);
+  t[14] = addmul_adx_1 (t + 13, x + 7, x[6]);
+  sqr_diag_adx_8 (t, x);
+  for (i = 0; i < 8; i++)
+    t[i] = addmul_adx_8 (t + i, m, t[i] * invm);
+  return add_n_adx_8 (z, t + 8, t);
+}
+
+static mp_limb_t
+mulredc_adx_9 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[18];
+  int i;
+
+  t[9] = mul_adx_9 (t, y, x[0]);
+  for (i = 1; i < 9; i++)
+    t[i + 9] = addmul_adx_9 (t + i, y, x[i]);
+  for (i = 0; i < 9; i++)
+    t[i] = addmul_adx_9 (t + i, m, t[i] * invm);
+  return add_n_adx_9 (z, t + 9, t);
+}
+
+static mp_limb_t
+sqrredc_adx_9 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[18];
+  int i;
+
+  for (i = 0; i < 9; i++)
+    t[i] = 0;
+  t[17] = 0;
+  t[9] = addmul_adx_8 (t + 1, x + 1, x[0]);
+  t[10] = addmul_adx_7 (t + 3, x + 2, x[1]);
+  t[11] = addmul_adx_6 (t + 5, x + 3, x[2]);
+  t[12] = addmul_adx_5 (t + 7, x + 4, x[3]);
+  t[13] = addmul_adx_4 (t + 9, x + 5, x[4]);
+  t[14] = addmul_adx_3 (t + 11, x + 6, x[5]);
+  t[15] = addmul_adx_2 (t + 13, x + 7, x[6]);
+  t[16] = addmul_adx_1 (t + 15, x + 8, x[7]);
+  sqr_diag_adx_9 (t, x);
+  for (i = 0; i < 9; i++)
+    t[i] = addmul_adx_9 (t + i, m, t[i] * invm);
+  return add_n_adx_9 (z, t + 9, t);
+}
+
+static mp_limb_t
+mulredc_adx_10 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[20];
+  int i;
+
+  t[10] = mul_adx_10 (t, y, x[0]);
+  for (i = 1; i < 10; i++)
+    t[i + 10] = addmul_adx_10 (t + i, y, x[i]);
+  for (i = 0; i < 10; i++)
+    t[i] = addmul_adx_10 (t + i, m, t[i] * invm);
+  return add_n_adx_10 (z, t + 10, t);
+}
+
+static mp_limb_t
+sqrredc_adx_10 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[20];
+  int i;
+
+  for (i = 0; i < 10; i++)
+    t[i] = 0;
+  t[19] = 0;
+  t[10] = addmul_adx_9 (t + 1, x + 1, x[0]);
+  t[11] = addmul_adx_8 (t + 3, x + 2, x[1]);
+  t[12] = addmul_adx_7 (t + 5, x + 3, x[2]);
+  t[13] = addmul_adx_6 (t + 7, x + 4, x[3]);
+  t[14] = addmul_adx_5 (t + 9, x + 5, x[4]);
+  t[15] = addmul_adx_4 (t + 11, x + 6, x[5]);
+  t[16] = addmul_adx_3 (t + 13, x + 7, x[6]);
+  t[17] = addmul_adx_2 (t + 15, x + 8, x[7]);
+  t[18] = addmul_adx_1 (t + 17, x + 9, x[8]);
+  sqr_diag_adx_10 (t, x);
+  for (i = 0; i < 10; i++)
+    t[i] = addmul_adx_10 (t + i, m, t[i] * invm);
+  return add_n_adx_10 (z, t + 10, t);
+}
+
+static mp_limb_t
+mulredc_adx_11 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[22];
+  int i;
+
+  t[11] = mul_adx_11 (t, y, x[0]);
+  for (i = 1; i < 11; i++)
+    t[i + 11] = addmul_adx_11 (t + i, y, x[i]);
+  for (i = 0; i < 11; i++)
+    t[i] = addmul_adx_11 (t + i, m, t[i] * invm);
+  return add_n_adx_11 (z, t + 11, t);
+}
+
+static mp_limb_t
+sqrredc_adx_11 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[22];
+  int i;
+
+  for (i = 0; i < 11; i++)
+    t[i] = 0;
+  t[21] = 0;
+  t[11] = addmul_adx_10 (t + 1, x + 1, x[0]);
+  t[12] = addmul_adx_9 (t + 3, x + 2, x[1]);
+  t[13] = addmul_adx_8 (t + 5, x + 3, x[2]);
+  t[14] = addmul_adx_7 (t + 7, x + 4, x[3]);
+  t[15] = addmul_adx_6 (t + 9, x + 5, x[4]);
+  t[16] = addmul_adx_5 (t + 11, x + 6, x[5]);
+  t[17] = addmul_adx_4 (t + 13, x + 7, x[6]);
+  t[18] = addmul_adx_3 (t + 15, x + 8, x[7]);
+  t[19] = addmul_adx_2 (t + 17, x + 9, x[8]);
+  t[20] = addmul_adx_1 (t + 19, x + 10, x[9]);
+  sqr_diag_adx_11 (t, x);
+  for (i = 0; i < 11; i++)
+    t[i] = addmul_adx_11 (t + i, m, t[i] * invm);
+  return add_n_adx_11 (z, t + 11, t);
+}
+
+static mp_limb_t
+mulredc_adx_12 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[24];
+  int i;
+
+  t[12] = mul_adx_12 (t, y, x[0]);
+  for (i = 1; i < 12; i++)
+    t[i + 12] = addmul_adx_12 (t + i, y, x[i]);
+  for (i = 0; i < 12; i++)
+    t[i] = addmul_adx_12 (t + i, m, t[i] * invm);
+  return add_n_adx_12 (z, t + 12, t);
+}
+
+static mp_limb_t
+sqrredc_adx_12 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[24];
+  int i;
+
+  for (i = 0; i < 12; i++)
+    t[i] = 0;
+  t[23] = 0;
+  t[12] = addmul_adx_11 (t + 1, x + 1, x[0]);
+  t[13] = addmul_adx_10 (t + 3, x + 2, x[1]);
+  t[14] = addmul_adx_9 (t + 5, x + 3, x[2]);
+  t[15] = addmul_adx_8 (t + 7, x + 4, x[3]);
+  t[16] = addmul_adx_7 (t + 9, x + 5, x[4]);
+  t[17] = addmul_adx_6 (t + 11, x + 6, x[5]);
+  t[18] = addmul_adx_5 (t + 13, x + 7, x[6]);
+  t[19] = addmul_adx_4 (t + 15, x + 8, x[7]);
+  t[20] = addmul_adx_3 (t + 17, x + 9, x[8]);
+  t[21] = addmul_adx_2 (t + 19, x + 10, x[9]);
+  t[22] = addmul_adx_1 (t + 21, x + 11, x[10]);
+  sqr_diag_adx_12 (t, x);
+  for (i = 0; i < 12; i++)
+    t[i] = addmul_adx_12 (t + i, m, t[i] * invm);
+  return add_n_adx_12 (z, t + 12, t);
+}
+
+static mp_limb_t
+mulredc_adx_13 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[26];
+  int i;
+
+  t[13] = mul_adx_13 (t, y, x[0]);
+  for (i = 1; i < 13; i++)
+    t[i + 13] = addmul_adx_13 (t + i, y, x[i]);
+  for (i = 0; i < 13; i++)
+    t[i] = addmul_adx_13 (t + i, m, t[i] * invm);
+  return add_n_adx_13 (z, t + 13, t);
+}
+
+static mp_limb_t
+sqrredc_adx_13 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[26];
+  int i;
+
+  for (i = 0; i < 13; i++)
+    t[i] = 0;
+  t[25] = 0;
+  t[13] = addmul_adx_12 (t + 1, x + 1, x[0]);
+  t[14] = addmul_adx_11 (t + 3, x + 2, x[1]);
+  t[15] = addmul_adx_10 (t + 5, x + 3, x[2]);
+  t[16] = addmul_adx_9 (t + 7, x + 4, x[3]);
+  t[17] = addmul_adx_8 (t + 9, x + 5, x[4]);
+  t[18] = addmul_adx_7 (t + 11, x + 6, x[5]);
+  t[19] = addmul_adx_6 (t + 13, x + 7, x[6]);
+  t[20] = addmul_adx_5 (t + 15, x + 8, x[7]);
+  t[21] = addmul_adx_4 (t + 17, x + 9, x[8]);
+  t[22] = addmul_adx_3 (t + 19, x + 10, x[9]);
+  t[23] = addmul_adx_2 (t + 21, x + 11, x[10]);
+  t[24] = addmul_adx_1 (t + 23, x + 12, x[11]);
+  sqr_diag_adx_13 (t, x);
+  for (i = 0; i < 13; i++)
+    t[i] = addmul_adx_13 (t + i, m, t[i] * invm);
+  return add_n_adx_13 (z, t + 13, t);
+}
+
+static mp_limb_t
+mulredc_adx_14 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[28];
+  int i;
+
+  t[14] = mul_adx_14 (t, y, x[0]);
+  for (i = 1; i < 14; i++)
+    t[i + 14] = addmul_adx_14 (t + i, y, x[i]);
+  for (i = 0; i < 14; i++)
+    t[i] = addmul_adx_14 (t + i, m, t[i] * invm);
+  return add_n_adx_14 (z, t + 14, t);
+}
+
+static mp_limb_t
+sqrredc_adx_14 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[28];
+  int i;
+
+  for (i = 0; i < 14; i++)
+    t[i] = 0;
+  t[27] = 0;
+  t[14] = addmul_adx_13 (t + 1, x + 1, x[0]);
+  t[15] = addmul_adx_12 (t + 3, x + 2, x[1]);
+  t[16] = addmul_adx_11 (t + 5, x + 3, x[2]);
+  t[17] = addmul_adx_10 (t + 7, x + 4, x[3]);
+  t[18] = addmul_adx_9 (t + 9, x + 5, x[4]);
+  t[19] = addmul_adx_8 (t + 11, x + 6, x[5]);
+  t[20] = addmul_adx_7 (t + 13, x + 7, x[6]);
+  t[21] = addmul_adx_6 (t + 15, x + 8, x[7]);
+  t[22] = addmul_adx_5 (t + 17, x + 9, x[8]);
+  t[23] = addmul_adx_4 (t + 19, x + 10, x[9]);
+  t[24] = addmul_adx_3 (t + 21, x + 11, x[10]);
+  t[25] = addmul_adx_2 (t + 23, x + 12, x[11]);
+  t[26] = addmul_adx_1 (t + 25, x + 13, x[12]);
+  sqr_diag_adx_14 (t, x);
+  for (i = 0; i < 14; i++)
+    t[i] = addmul_adx_14 (t + i, m, t[i] * invm);
+  return add_n_adx_14 (z, t + 14, t);
+}
+
+static mp_limb_t
+mulredc_adx_15 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[30];
+  int i;
+
+  t[15] = mul_adx_15 (t, y, x[0]);
+  for (i = 1; i < 15; i++)
+    t[i + 15] = addmul_adx_15 (t + i, y, x[i]);
+  for (i = 0; i < 15; i++)
+    t[i] = addmul_adx_15 (t + i, m, t[i] * invm);
+  return add_n_adx_15 (z, t + 15, t);
+}
+
+static mp_limb_t
+sqrredc_adx_15 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[30];
+  int i;
+
+  for (i = 0; i < 15; i++)
+    t[i] = 0;
+  t[29] = 0;
+  t[15] = addmul_adx_14 (t + 1, x + 1, x[0]);
+  t[16] = addmul_adx_13 (t + 3, x + 2, x[1]);
+  t[17] = addmul_adx_12 (t + 5, x + 3, x[2]);
+  t[18] = addmul_adx_11 (t + 7, x + 4, x[3]);
+  t[19] = addmul_adx_10 (t + 9, x + 5, x[4]);
+  t[20] = addmul_adx_9 (t + 11, x + 6, x[5]);
+  t[21] = addmul_adx_8 (t + 13, x + 7, x[6]);
+  t[22] = addmul_adx_7 (t + 15, x + 8, x[7]);
+  t[23] = addmul_adx_6 (t + 17, x + 9, x[8]);
+  t[24] = addmul_adx_5 (t + 19, x + 10, x[9]);
+  t[25] = addmul_adx_4 (t + 21, x + 11, x[10]);
+  t[26] = addmul_adx_3 (t + 23, x + 12, x[11]);
+  t[27] = addmul_adx_2 (t + 25, x + 13, x[12]);
+  t[28] = addmul_adx_1 (t + 27, x + 14, x[13]);
+  sqr_diag_adx_15 (t, x);
+  for (i = 0; i < 15; i++)
+    t[i] = addmul_adx_15 (t + i, m, t[i] * invm);
+  return add_n_adx_15 (z, t + 15, t);
+}
+
+static mp_limb_t
+mulredc_adx_16 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[32];
+  int i;
+
+  t[16] = mul_adx_16 (t, y, x[0]);
+  for (i = 1; i < 16; i++)
+    t[i + 16] = addmul_adx_16 (t + i, y, x[i]);
+  for (i = 0; i < 16; i++)
+    t[i] = addmul_adx_16 (t + i, m, t[i] * invm);
+  return add_n_adx_16 (z, t + 16, t);
+}
+
+static mp_limb_t
+sqrredc_adx_16 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[32];
+  int i;
+
+  for (i = 0; i < 16; i++)
+    t[i] = 0;
+  t[31] = 0;
+  t[16] = addmul_adx_15 (t + 1, x + 1, x[0]);
+  t[17] = addmul_adx_14 (t + 3, x + 2, x[1]);
+  t[18] = addmul_adx_13 (t + 5, x + 3, x[2]);
+  t[19] = addmul_adx_12 (t + 7, x + 4, x[3]);
+  t[20] = addmul_adx_11 (t + 9, x + 5, x[4]);
+  t[21] = addmul_adx_10 (t + 11, x + 6, x[5]);
+  t[22] = addmul_adx_9 (t + 13, x + 7, x[6]);
+  t[23] = addmul_adx_8 (t + 15, x + 8, x[7]);
+  t[24] = addmul_adx_7 (t + 17, x + 9, x[8]);
+  t[25] = addmul_adx_6 (t + 19, x + 10, x[9]);
+  t[26] = addmul_adx_5 (t + 21, x + 11, x[10]);
+  t[27] = addmul_adx_4 (t + 23, x + 12, x[11]);
+  t[28] = addmul_adx_3 (t + 25, x + 13, x[12]);
+  t[29] = addmul_adx_2 (t + 27, x + 14, x[13]);
+  t[30] = addmul_adx_1 (t + 29, x + 15, x[14]);
+  sqr_diag_adx_16 (t, x);
+  for (i = 0; i < 16; i++)
+    t[i] = addmul_adx_16 (t + i, m, t[i] * invm);
+  return add_n_adx_16 (z, t + 16, t);
+}
+
+static mp_limb_t
+mulredc_adx_17 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[34];
+  int i;
+
+  t[17] = mul_adx_17 (t, y, x[0]);
+  for (i = 1; i < 17; i++)
+    t[i + 17] = addmul_adx_17 (t + i, y, x[i]);
+  for (i = 0; i < 17; i++)
+    t[i] = addmul_adx_17 (t + i, m, t[i] * invm);
+  return add_n_adx_17 (z, t + 17, t);
+}
+
+static mp_limb_t
+sqrredc_adx_17 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[34];
+  int i;
+
+  for (i = 0; i < 17; i++)
+    t[i] = 0;
+  t[33] = 0;
+  t[17] = addmul_adx_16 (t + 1, x + 1, x[0]);
+  t[18] = addmul_adx_15 (t + 3, x + 2, x[1]);
+  t[19] = addmul_adx_14 (t + 5, x + 3, x[2]);
+  t[20] = addmul_adx_13 (t + 7, x + 4, x[3]);
+  t[21] = addmul_adx_12 (t + 9, x + 5, x[4]);
+  t[22] = addmul_adx_11 (t + 11, x + 6, x[5]);
+  t[23] = addmul_adx_10 (t + 13, x + 7, x[6]);
+  t[24] = addmul_adx_9 (t + 15, x + 8, x[7]);
+  t[25] = addmul_adx_8 (t + 17, x + 9, x[8]);
+  t[26] = addmul_adx_7 (t + 19, x + 10, x[9]);
+  t[27] = addmul_adx_6 (t + 21, x + 11, x[10]);
+  t[28] = addmul_adx_5 (t + 23, x + 12, x[11]);
+  t[29] = addmul_adx_4 (t + 25, x + 13, x[12]);
+  t[30] = addmul_adx_3 (t + 27, x + 14, x[13]);
+  t[31] = addmul_adx_2 (t + 29, x + 15, x[14]);
+  t[32] = addmul_adx_1 (t + 31, x + 16, x[15]);
+  sqr_diag_adx_17 (t, x);
+  for (i = 0; i < 17; i++)
+    t[i] = addmul_adx_17 (t + i, m, t[i] * invm);
+  return add_n_adx_17 (z, t + 17, t);
+}
+
+static mp_limb_t
+mulredc_adx_18 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[36];
+  int i;
+
+  t[18] = mul_adx_18 (t, y, x[0]);
+  for (i = 1; i < 18; i++)
+    t[i + 18] = addmul_adx_18 (t + i, y, x[i]);
+  for (i = 0; i < 18; i++)
+    t[i] = addmul_adx_18 (t + i, m, t[i] * invm);
+  return add_n_adx_18 (z, t + 18, t);
+}
+
+static mp_limb_t
+sqrredc_adx_18 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[36];
+  int i;
+
+  for (i = 0; i < 18; i++)
+    t[i] = 0;
+  t[35] = 0;
+  t[18] = addmul_adx_17 (t + 1, x + 1, x[0]);
+  t[19] = addmul_adx_16 (t + 3, x + 2, x[1]);
+  t[20] = addmul_adx_15 (t + 5, x + 3, x[2]);
+  t[21] = addmul_adx_14 (t + 7, x + 4, x[3]);
+  t[22] = addmul_adx_13 (t + 9, x + 5, x[4]);
+  t[23] = addmul_adx_12 (t + 11, x + 6, x[5]);
+  t[24] = addmul_adx_11 (t + 13, x + 7, x[6]);
+  t[25] = addmul_adx_10 (t + 15, x + 8, x[7]);
+  t[26] = addmul_adx_9 (t + 17, x + 9, x[8]);
+  t[27] = addmul_adx_8 (t + 19, x + 10, x[9]);
+  t[28] = addmul_adx_7 (t + 21, x + 11, x[10]);
+  t[29] = addmul_adx_6 (t + 23, x + 12, x[11]);
+  t[30] = addmul_adx_5 (t + 25, x + 13, x[12]);
+  t[31] = addmul_adx_4 (t + 27, x + 14, x[13]);
+  t[32] = addmul_adx_3 (t + 29, x + 15, x[14]);
+  t[33] = addmul_adx_2 (t + 31, x + 16, x[15]);
+  t[34] = addmul_adx_1 (t + 33, x + 17, x[16]);
+  sqr_diag_adx_18 (t, x);
+  for (i = 0; i < 18; i++)
+    t[i] = addmul_adx_18 (t + i, m, t[i] * invm);
+  return add_n_adx_18 (z, t + 18, t);
+}
+
+static mp_limb_t
+mulredc_adx_19 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[38];
+  int i;
+
+  t[19] = mul_adx_19 (t, y, x[0]);
+  for (i = 1; i < 19; i++)
+    t[i + 19] = addmul_adx_19 (t + i, y, x[i]);
+  for (i = 0; i < 19; i++)
+    t[i] = addmul_adx_19 (t + i, m, t[i] * invm);
+  return add_n_adx_19 (z, t + 19, t);
+}
+
+static mp_limb_t
+sqrredc_adx_19 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[38];
+  int i;
+
+  for (i = 0; i < 19; i++)
+    t[i] = 0;
+  t[37] = 0;
+  t[19] = addmul_adx_18 (t + 1, x + 1, x[0]);
+  t[20] = addmul_adx_17 (t + 3, x + 2, x[1]);
+  t[21] = addmul_adx_16 (t + 5, x + 3, x[2]);
+  t[22] = addmul_adx_15 (t + 7, x + 4, x[3]);
+  t[23] = addmul_adx_14 (t + 9, x + 5, x[4]);
+  t[24] = addmul_adx_13 (t + 11, x + 6, x[5]);
+  t[25] = addmul_adx_12 (t + 13, x + 7, x[6]);
+  t[26] = addmul_adx_11 (t + 15, x + 8, x[7]);
+  t[27] = addmul_adx_10 (t + 17, x + 9, x[8]);
+  t[28] = addmul_adx_9 (t + 19, x + 10, x[9]);
+  t[29] = addmul_adx_8 (t + 21, x + 11, x[10]);
+  t[30] = addmul_adx_7 (t + 23, x + 12, x[11]);
+  t[31] = addmul_adx_6 (t + 25, x + 13, x[12]);
+  t[32] = addmul_adx_5 (t + 27, x + 14, x[13]);
+  t[33] = addmul_adx_4 (t + 29, x + 15, x[14]);
+  t[34] = addmul_adx_3 (t + 31, x + 16, x[15]);
+  t[35] = addmul_adx_2 (t + 33, x + 17, x[16]);
+  t[36] = addmul_adx_1 (t + 35, x + 18, x[17]);
+  sqr_diag_adx_19 (t, x);
+  for (i = 0; i < 19; i++)
+    t[i] = addmul_adx_19 (t + i, m, t[i] * invm);
+  return add_n_adx_19 (z, t + 19, t);
+}
+
+static mp_limb_t
+mulredc_adx_20 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[40];
+  int i;
+
+  t[20] = mul_adx_20 (t, y, x[0]);
+  for (i = 1; i < 20; i++)
+    t[i + 20] = addmul_adx_20 (t + i, y, x[i]);
+  for (i = 0; i < 20; i++)
+    t[i] = addmul_adx_20 (t + i, m, t[i] * invm);
+  return add_n_adx_20 (z, t + 20, t);
+}
+
+static mp_limb_t
+sqrredc_adx_20 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[40];
+  int i;
+
+  for (i = 0; i < 20; i++)
+    t[i] = 0;
+  t[39] = 0;
+  t[20] = addmul_adx_19 (t + 1, x + 1, x[0]);
+  t[21] = addmul_adx_18 (t + 3, x + 2, x[1]);
+  t[22] = addmul_adx_17 (t + 5, x + 3, x[2]);
+  t[23] = addmul_adx_16 (t + 7, x + 4, x[3]);
+  t[24] = addmul_adx_15 (t + 9, x + 5, x[4]);
+  t[25] = addmul_adx_14 (t + 11, x + 6, x[5]);
+  t[26] = addmul_adx_13 (t + 13, x + 7, x[6]);
+  t[27] = addmul_adx_12 (t + 15, x + 8, x[7]);
+  t[28] = addmul_adx_11 (t + 17, x + 9, x[8]);
+  t[29] = addmul_adx_10 (t + 19, x + 10, x[9]);
+  t[30] = addmul_adx_9 (t + 21, x + 11, x[10]);
+  t[31] = addmul_adx_8 (t + 23, x + 12, x[11]);
+  t[32] = addmul_adx_7 (t + 25, x + 13, x[12]);
+  t[33] = addmul_adx_6 (t + 27, x + 14, x[13]);
+  t[34] = addmul_adx_5 (t + 29, x + 15, x[14]);
+  t[35] = addmul_adx_4 (t + 31, x + 16, x[15]);
+  t[36] = addmul_adx_3 (t + 33, x + 17, x[16]);
+  t[37] = addmul_adx_2 (t + 35, x + 18, x[17]);
+  t[38] = addmul_adx_1 (t + 37, x + 19, x[18]);
+  sqr_diag_adx_20 (t, x);
+  for (i = 0; i < 20; i++)
+    t[i] = addmul_adx_20 (t + i, m, t[i] * invm);
+  return add_n_adx_20 (z, t + 20, t);
+}
+
+static mp_limb_t
+mulredc_adx_21 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[42];
+  int i;
+
+  t[21] = mul_adx_21 (t, y, x[0]);
+  for (i = 1; i < 21; i++)
+    t[i + 21] = addmul_adx_21 (t + i, y, x[i]);
+  for (i = 0; i < 21; i++)
+    t[i] = addmul_adx_21 (t + i, m, t[i] * invm);
+  return add_n_adx_21 (z, t + 21, t);
+}
+
+static mp_limb_t
+sqrredc_adx_21 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[42];
+  int i;
+
+  for (i = 0; i < 21; i++)
+    t[i] = 0;
+  t[41] = 0;
+  t[21] = addmul_adx_20 (t + 1, x + 1, x[0]);
+  t[22] = addmul_adx_19 (t + 3, x + 2, x[1]);
+  t[23] = addmul_adx_18 (t + 5, x + 3, x[2]);
+  t[24] = addmul_adx_17 (t + 7, x + 4, x[3]);
+  t[25] = addmul_adx_16 (t + 9, x + 5, x[4]);
+  t[26] = addmul_adx_15 (t + 11, x + 6, x[5]);
+  t[27] = addmul_adx_14 (t + 13, x + 7, x[6]);
+  t[28] = addmul_adx_13 (t + 15, x + 8, x[7]);
+  t[29] = addmul_adx_12 (t + 17, x + 9, x[8]);
+  t[30] = addmul_adx_11 (t + 19, x + 10, x[9]);
+  t[31] = addmul_adx_10 (t + 21, x + 11, x[10]);
+  t[32] = addmul_adx_9 (t + 23, x + 12, x[11]);
+  t[33] = addmul_adx_8 (t + 25, x + 13, x[12]);
+  t[34] = addmul_adx_7 (t + 27, x + 14, x[13]);
+  t[35] = addmul_adx_6 (t + 29, x + 15, x[14]);
+  t[36] = addmul_adx_5 (t + 31, x + 16, x[15]);
+  t[37] = addmul_adx_4 (t + 33, x + 17, x[16]);
+  t[38] = addmul_adx_3 (t + 35, x + 18, x[17]);
+  t[39] = addmul_adx_2 (t + 37, x + 19, x[18]);
+  t[40] = addmul_adx_1 (t + 39, x + 20, x[19]);
+  sqr_diag_adx_21 (t, x);
+  for (i = 0; i < 21; i++)
+    t[i] = addmul_adx_21 (t + i, m, t[i] * invm);
+  return add_n_adx_21 (z, t + 21, t);
+}
+
+static mp_limb_t
+mulredc_adx_22 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[44];
+  int i;
+
+  t[22] = mul_adx_22 (t, y, x[0]);
+  for (i = 1; i < 22; i++)
+    t[i + 22] = addmul_adx_22 (t + i, y, x[i]);
+  for (i = 0; i < 22; i++)
+    t[i] = addmul_adx_22 (t + i, m, t[i] * invm);
+  return add_n_adx_22 (z, t + 22, t);
+}
+
+static mp_limb_t
+sqrredc_adx_22 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[44];
+  int i;
+
+  for (i = 0; i < 22; i++)
+    t[i] = 0;
+  t[43] = 0;
+  t[22] = addmul_adx_21 (t + 1, x + 1, x[0]);
+  t[23] = addmul_adx_20 (t + 3, x + 2, x[1]);
+  t[24] = addmul_adx_19 (t + 5, x + 3, x[2]);
+  t[25] = addmul_adx_18 (t + 7, x + 4, x[3]);
+  t[26] = addmul_adx_17 (t + 9, x + 5, x[4]);
+  t[27] = addmul_adx_16 (t + 11, x + 6, x[5]);
+  t[28] = addmul_adx_15 (t + 13, x + 7, x[6]);
+  t[29] = addmul_adx_14 (t + 15, x + 8, x[7]);
+  t[30] = addmul_adx_13 (t + 17, x + 9, x[8]);
+  t[31] = addmul_adx_12 (t + 19, x + 10, x[9]);
+  t[32] = addmul_adx_11 (t + 21, x + 11, x[10]);
+  t[33] = addmul_adx_10 (t + 23, x + 12, x[11]);
+  t[34] = addmul_adx_9 (t + 25, x + 13, x[12]);
+  t[35] = addmul_adx_8 (t + 27, x + 14, x[13]);
+  t[36] = addmul_adx_7 (t + 29, x + 15, x[14]);
+  t[37] = addmul_adx_6 (t + 31, x + 16, x[15]);
+  t[38] = addmul_adx_5 (t + 33, x + 17, x[16]);
+  t[39] = addmul_adx_4 (t + 35, x + 18, x[17]);
+  t[40] = addmul_adx_3 (t + 37, x + 19, x[18]);
+  t[41] = addmul_adx_2 (t + 39, x + 20, x[19]);
+  t[42] = addmul_adx_1 (t + 41, x + 21, x[20]);
+  sqr_diag_adx_22 (t, x);
+  for (i = 0; i < 22; i++)
+    t[i] = addmul_adx_22 (t + i, m, t[i] * invm);
+  return add_n_adx_22 (z, t + 22, t);
+}
+
+static mp_limb_t
+mulredc_adx_23 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[46];
+  int i;
+
+  t[23] = mul_adx_23 (t, y, x[0]);
+  for (i = 1; i < 23; i++)
+    t[i + 23] = addmul_adx_23 (t + i, y, x[i]);
+  for (i = 0; i < 23; i++)
+    t[i] = addmul_adx_23 (t + i, m, t[i] * invm);
+  return add_n_adx_23 (z, t + 23, t);
+}
+
+static mp_limb_t
+sqrredc_adx_23 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[46];
+  int i;
+
+  for (i = 0; i < 23; i++)
+    t[i] = 0;
+  t[45] = 0;
+  t[23] = addmul_adx_22 (t + 1, x + 1, x[0]);
+  t[24] = addmul_adx_21 (t + 3, x + 2, x[1]);
+  t[25] = addmul_adx_20 (t + 5, x + 3, x[2]);
+  t[26] = addmul_adx_19 (t + 7, x + 4, x[3]);
+  t[27] = addmul_adx_18 (t + 9, x + 5, x[4]);
+  t[28] = addmul_adx_17 (t + 11, x + 6, x[5]);
+  t[29] = addmul_adx_16 (t + 13, x + 7, x[6]);
+  t[30] = addmul_adx_15 (t + 15, x + 8, x[7]);
+  t[31] = addmul_adx_14 (t + 17, x + 9, x[8]);
+  t[32] = addmul_adx_13 (t + 19, x + 10, x[9]);
+  t[33] = addmul_adx_12 (t + 21, x + 11, x[10]);
+  t[34] = addmul_adx_11 (t + 23, x + 12, x[11]);
+  t[35] = addmul_adx_10 (t + 25, x + 13, x[12]);
+  t[36] = addmul_adx_9 (t + 27, x + 14, x[13]);
+  t[37] = addmul_adx_8 (t + 29, x + 15, x[14]);
+  t[38] = addmul_adx_7 (t + 31, x + 16, x[15]);
+  t[39] = addmul_adx_6 (t + 33, x + 17, x[16]);
+  t[40] = addmul_adx_5 (t + 35, x + 18, x[17]);
+  t[41] = addmul_adx_4 (t + 37, x + 19, x[18]);
+  t[42] = addmul_adx_3 (t + 39, x + 20, x[19]);
+  t[43] = addmul_adx_2 (t + 41, x + 21, x[20]);
+  t[44] = addmul_adx_1 (t + 43, x + 22, x[21]);
+  sqr_diag_adx_23 (t, x);
+  for (i = 0; i < 23; i++)
+    t[i] = addmul_adx_23 (t + i, m, t[i] * invm);
+  return add_n_adx_23 (z, t + 23, t);
+}
+
+static mp_limb_t
+mulredc_adx_24 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[48];
+  int i;
+
+  t[24] = mul_adx_24 (t, y, x[0]);
+  for (i = 1; i < 24; i++)
+    t[i + 24] = addmul_adx_24 (t + i, y, x[i]);
+  for (i = 0; i < 24; i++)
+    t[i] = addmul_adx_24 (t + i, m, t[i] * invm);
+  return add_n_adx_24 (z, t + 24, t);
+}
+
+static mp_limb_t
+sqrredc_adx_24 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[48];
+  int i;
+
+  for (i = 0; i < 24; i++)
+    t[i] = 0;
+  t[47] = 0;
+  t[24] = addmul_adx_23 (t + 1, x + 1, x[0]);
+  t[25] = addmul_adx_22 (t + 3, x + 2, x[1]);
+  t[26] = addmul_adx_21 (t + 5, x + 3, x[2]);
+  t[27] = addmul_adx_20 (t + 7, x + 4, x[3]);
+  t[28] = addmul_adx_19 (t + 9, x + 5, x[4]);
+  t[29] = addmul_adx_18 (t + 11, x + 6, x[5]);
+  t[30] = addmul_adx_17 (t + 13, x + 7, x[6]);
+  t[31] = addmul_adx_16 (t + 15, x + 8, x[7]);
+  t[32] = addmul_adx_15 (t + 17, x + 9, x[8]);
+  t[33] = addmul_adx_14 (t + 19, x + 10, x[9]);
+  t[34] = addmul_adx_13 (t + 21, x + 11, x[10]);
+  t[35] = addmul_adx_12 (t + 23, x + 12, x[11]);
+  t[36] = addmul_adx_11 (t + 25, x + 13, x[12]);
+  t[37] = addmul_adx_10 (t + 27, x + 14, x[13]);
+  t[38] = addmul_adx_9 (t + 29, x + 15, x[14]);
+  t[39] = addmul_adx_8 (t + 31, x + 16, x[15]);
+  t[40] = addmul_adx_7 (t + 33, x + 17, x[16]);
+  t[41] = addmul_adx_6 (t + 35, x + 18, x[17]);
+  t[42] = addmul_adx_5 (t + 37, x + 19, x[18]);
+  t[43] = addmul_adx_4 (t + 39, x + 20, x[19]);
+  t[44] = addmul_adx_3 (t + 41, x + 21, x[20]);
+  t[45] = addmul_adx_2 (t + 43, x + 22, x[21]);
+  t[46] = addmul_adx_1 (t + 45, x + 23, x[22]);
+  sqr_diag_adx_24 (t, x);
+  for (i = 0; i < 24; i++)
+    t[i] = addmul_adx_24 (t + i, m, t[i] * invm);
+  return add_n_adx_24 (z, t + 24, t);
+}
+
+static mp_limb_t
+mulredc_adx_25 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[50];
+  int i;
+
+  t[25] = mul_adx_25 (t, y, x[0]);
+  for (i = 1; i < 25; i++)
+    t[i + 25] = addmul_adx_25 (t + i, y, x[i]);
+  for (i = 0; i < 25; i++)
+    t[i] = addmul_adx_25 (t + i, m, t[i] * invm);
+  return add_n_adx_25 (z, t + 25, t);
+}
+
+static mp_limb_t
+sqrredc_adx_25 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[50];
+  int i;
+
+  for (i = 0; i < 25; i++)
+    t[i] = 0;
+  t[49] = 0;
+  t[25] = addmul_adx_24 (t + 1, x + 1, x[0]);
+  t[26] = addmul_adx_23 (t + 3, x + 2, x[1]);
+  t[27] = addmul_adx_22 (t + 5, x + 3, x[2]);
+  t[28] = addmul_adx_21 (t + 7, x + 4, x[3]);
+  t[29] = addmul_adx_20 (t + 9, x + 5, x[4]);
+  t[30] = addmul_adx_19 (t + 11, x + 6, x[5]);
+  t[31] = addmul_adx_18 (t + 13, x + 7, x[6]);
+  t[32] = addmul_adx_17 (t + 15, x + 8, x[7]);
+  t[33] = addmul_adx_16 (t + 17, x + 9, x[8]);
+  t[34] = addmul_adx_15 (t + 19, x + 10, x[9]);
+  t[35] = addmul_adx_14 (t + 21, x + 11, x[10]);
+  t[36] = addmul_adx_13 (t + 23, x + 12, x[11]);
+  t[37] = addmul_adx_12 (t + 25, x + 13, x[12]);
+  t[38] = addmul_adx_11 (t + 27, x + 14, x[13]);
+  t[39] = addmul_adx_10 (t + 29, x + 15, x[14]);
+  t[40] = addmul_adx_9 (t + 31, x + 16, x[15]);
+  t[41] = addmul_adx_8 (t + 33, x + 17, x[16]);
+  t[42] = addmul_adx_7 (t + 35, x + 18, x[17]);
+  t[43] = addmul_adx_6 (t + 37, x + 19, x[18]);
+  t[44] = addmul_adx_5 (t + 39, x + 20, x[19]);
+  t[45] = addmul_adx_4 (t + 41, x + 21, x[20]);
+  t[46] = addmul_adx_3 (t + 43, x + 22, x[21]);
+  t[47] = addmul_adx_2 (t + 45, x + 23, x[22]);
+  t[48] = addmul_adx_1 (t + 47, x + 24, x[23]);
+  sqr_diag_adx_25 (t, x);
+  for (i = 0; i < 25; i++)
+    t[i] = addmul_adx_25 (t + i, m, t[i] * invm);
+  return add_n_adx_25 (z, t + 25, t);
+}
+
+static mp_limb_t
+mulredc_adx_26 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[52];
+  int i;
+
+  t[26] = mul_adx_26 (t, y, x[0]);
+  for (i = 1; i < 26; i++)
+    t[i + 26] = addmul_adx_26 (t + i, y, x[i]);
+  for (i = 0; i < 26; i++)
+    t[i] = addmul_adx_26 (t + i, m, t[i] * invm);
+  return add_n_adx_26 (z, t + 26, t);
+}
+
+static mp_limb_t
+sqrredc_adx_26 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[52];
+  int i;
+
+  for (i = 0; i < 26; i++)
+    t[i] = 0;
+  t[51] = 0;
+  t[26] = addmul_adx_25 (t + 1, x + 1, x[0]);
+  t[27] = addmul_adx_24 (t + 3, x + 2, x[1]);
+  t[28] = addmul_adx_23 (t + 5, x + 3, x[2]);
+  t[29] = addmul_adx_22 (t + 7, x + 4, x[3]);
+  t[30] = addmul_adx_21 (t + 9, x + 5, x[4]);
+  t[31] = addmul_adx_20 (t + 11, x + 6, x[5]);
+  t[32] = addmul_adx_19 (t + 13, x + 7, x[6]);
+  t[33] = addmul_adx_18 (t + 15, x + 8, x[7]);
+  t[34] = addmul_adx_17 (t + 17, x + 9, x[8]);
+  t[35] = addmul_adx_16 (t + 19, x + 10, x[9]);
+  t[36] = addmul_adx_15 (t + 21, x + 11, x[10]);
+  t[37] = addmul_adx_14 (t + 23, x + 12, x[11]);
+  t[38] = addmul_adx_13 (t + 25, x + 13, x[12]);
+  t[39] = addmul_adx_12 (t + 27, x + 14, x[13]);
+  t[40] = addmul_adx_11 (t + 29, x + 15, x[14]);
+  t[41] = addmul_adx_10 (t + 31, x + 16, x[15]);
+  t[42] = addmul_adx_9 (t + 33, x + 17, x[16]);
+  t[43] = addmul_adx_8 (t + 35, x + 18, x[17]);
+  t[44] = addmul_adx_7 (t + 37, x + 19, x[18]);
+  t[45] = addmul_adx_6 (t + 39, x + 20, x[19]);
+  t[46] = addmul_adx_5 (t + 41, x + 21, x[20]);
+  t[47] = addmul_adx_4 (t + 43, x + 22, x[21]);
+  t[48] = addmul_adx_3 (t + 45, x + 23, x[22]);
+  t[49] = addmul_adx_2 (t + 47, x + 24, x[23]);
+  t[50] = addmul_adx_1 (t + 49, x + 25, x[24]);
+  sqr_diag_adx_26 (t, x);
+  for (i = 0; i < 26; i++)
+    t[i] = addmul_adx_26 (t + i, m, t[i] * invm);
+  return add_n_adx_26 (z, t + 26, t);
+}
+
+static mp_limb_t
+mulredc_adx_27 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[54];
+  int i;
+
+  t[27] = mul_adx_27 (t, y, x[0]);
+  for (i = 1; i < 27; i++)
+    t[i + 27] = addmul_adx_27 (t + i, y, x[i]);
+  for (i = 0; i < 27; i++)
+    t[i] = addmul_adx_27 (t + i, m, t[i] * invm);
+  return add_n_adx_27 (z, t + 27, t);
+}
+
+static mp_limb_t
+sqrredc_adx_27 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[54];
+  int i;
+
+  for (i = 0; i < 27; i++)
+    t[i] = 0;
+  t[53] = 0;
+  t[27] = addmul_adx_26 (t + 1, x + 1, x[0]);
+  t[28] = addmul_adx_25 (t + 3, x + 2, x[1]);
+  t[29] = addmul_adx_24 (t + 5, x + 3, x[2]);
+  t[30] = addmul_adx_23 (t + 7, x + 4, x[3]);
+  t[31] = addmul_adx_22 (t + 9, x + 5, x[4]);
+  t[32] = addmul_adx_21 (t + 11, x + 6, x[5]);
+  t[33] = addmul_adx_20 (t + 13, x + 7, x[6]);
+  t[34] = addmul_adx_19 (t + 15, x + 8, x[7]);
+  t[35] = addmul_adx_18 (t + 17, x + 9, x[8]);
+  t[36] = addmul_adx_17 (t + 19, x + 10, x[9]);
+  t[37] = addmul_adx_16 (t + 21, x + 11, x[10]);
+  t[38] = addmul_adx_15 (t + 23, x + 12, x[11]);
+  t[39] = addmul_adx_14 (t + 25, x + 13, x[12]);
+  t[40] = addmul_adx_13 (t + 27, x + 14, x[13]);
+  t[41] = addmul_adx_12 (t + 29, x + 15, x[14]);
+  t[42] = addmul_adx_11 (t + 31, x + 16, x[15]);
+  t[43] = addmul_adx_10 (t + 33, x + 17, x[16]);
+  t[44] = addmul_adx_9 (t + 35, x + 18, x[17]);
+  t[45] = addmul_adx_8 (t + 37, x + 19, x[18]);
+  t[46] = addmul_adx_7 (t + 39, x + 20, x[19]);
+  t[47] = addmul_adx_6 (t + 41, x + 21, x[20]);
+  t[48] = addmul_adx_5 (t + 43, x + 22, x[21]);
+  t[49] = addmul_adx_4 (t + 45, x + 23, x[22]);
+  t[50] = addmul_adx_3 (t + 47, x + 24, x[23]);
+  t[51] = addmul_adx_2 (t + 49, x + 25, x[24]);
+  t[52] = addmul_adx_1 (t + 51, x + 26, x[25]);
+  sqr_diag_adx_27 (t, x);
+  for (i = 0; i < 27; i++)
+    t[i] = addmul_adx_27 (t + i, m, t[i] * invm);
+  return add_n_adx_27 (z, t + 27, t);
+}
+
+static mp_limb_t
+mulredc_adx_28 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[56];
+  int i;
+
+  t[28] = mul_adx_28 (t, y, x[0]);
+  for (i = 1; i < 28; i++)
+    t[i + 28] = addmul_adx_28 (t + i, y, x[i]);
+  for (i = 0; i < 28; i++)
+    t[i] = addmul_adx_28 (t + i, m, t[i] * invm);
+  return add_n_adx_28 (z, t + 28, t);
+}
+
+static mp_limb_t
+sqrredc_adx_28 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[56];
+  int i;
+
+  for (i = 0; i < 28; i++)
+    t[i] = 0;
+  t[55] = 0;
+  t[28] = addmul_adx_27 (t + 1, x + 1, x[0]);
+  t[29] = addmul_adx_26 (t + 3, x + 2, x[1]);
+  t[30] = addmul_adx_25 (t + 5, x + 3, x[2]);
+  t[31] = addmul_adx_24 (t + 7, x + 4, x[3]);
+  t[32] = addmul_adx_23 (t + 9, x + 5, x[4]);
+  t[33] = addmul_adx_22 (t + 11, x + 6, x[5]);
+  t[34] = addmul_adx_21 (t + 13, x + 7, x[6]);
+  t[35] = addmul_adx_20 (t + 15, x + 8, x[7]);
+  t[36] = addmul_adx_19 (t + 17, x + 9, x[8]);
+  t[37] = addmul_adx_18 (t + 19, x + 10, x[9]);
+  t[38] = addmul_adx_17 (t + 21, x + 11, x[10]);
+  t[39] = addmul_adx_16 (t + 23, x + 12, x[11]);
+  t[40] = addmul_adx_15 (t + 25, x + 13, x[12]);
+  t[41] = addmul_adx_14 (t + 27, x + 14, x[13]);
+  t[42] = addmul_adx_13 (t + 29, x + 15, x[14]);
+  t[43] = addmul_adx_12 (t + 31, x + 16, x[15]);
+  t[44] = addmul_adx_11 (t + 33, x + 17, x[16]);
+  t[45] = addmul_adx_10 (t + 35, x + 18, x[17]);
+  t[46] = addmul_adx_9 (t + 37, x + 19, x[18]);
+  t[47] = addmul_adx_8 (t + 39, x + 20, x[19]);
+  t[48] = addmul_adx_7 (t + 41, x + 21, x[20]);
+  t[49] = addmul_adx_6 (t + 43, x + 22, x[21]);
+  t[50] = addmul_adx_5 (t + 45, x + 23, x[22]);
+  t[51] = addmul_adx_4 (t + 47, x + 24, x[23]);
+  t[52] = addmul_adx_3 (t + 49, x + 25, x[24]);
+  t[53] = addmul_adx_2 (t + 51, x + 26, x[25]);
+  t[54] = addmul_adx_1 (t + 53, x + 27, x[26]);
+  sqr_diag_adx_28 (t, x);
+  for (i = 0; i < 28; i++)
+    t[i] = addmul_adx_28 (t + i, m, t[i] * invm);
+  return add_n_adx_28 (z, t + 28, t);
+}
+
+static mp_limb_t
+mulredc_adx_29 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[58];
+  int i;
+
+  t[29] = mul_adx_29 (t, y, x[0]);
+  for (i = 1; i < 29; i++)
+    t[i + 29] = addmul_adx_29 (t + i, y, x[i]);
+  for (i = 0; i < 29; i++)
+    t[i] = addmul_adx_29 (t + i, m, t[i] * invm);
+  return add_n_adx_29 (z, t + 29, t);
+}
+
+static mp_limb_t
+sqrredc_adx_29 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[58];
+  int i;
+
+  for (i = 0; i < 29; i++)
+    t[i] = 0;
+  t[57] = 0;
+  t[29] = addmul_adx_28 (t + 1, x + 1, x[0]);
+  t[30] = addmul_adx_27 (t + 3, x + 2, x[1]);
+  t[31] = addmul_adx_26 (t + 5, x + 3, x[2]);
+  t[32] = addmul_adx_25 (t + 7, x + 4, x[3]);
+  t[33] = addmul_adx_24 (t + 9, x + 5, x[4]);
+  t[34] = addmul_adx_23 (t + 11, x + 6, x[5]);
+  t[35] = addmul_adx_22 (t + 13, x + 7, x[6]);
+  t[36] = addmul_adx_21 (t + 15, x + 8, x[7]);
+  t[37] = addmul_adx_20 (t + 17, x + 9, x[8]);
+  t[38] = addmul_adx_19 (t + 19, x + 10, x[9]);
+  t[39] = addmul_adx_18 (t + 21, x + 11, x[10]);
+  t[40] = addmul_adx_17 (t + 23, x + 12, x[11]);
+  t[41] = addmul_adx_16 (t + 25, x + 13, x[12]);
+  t[42] = addmul_adx_15 (t + 27, x + 14, x[13]);
+  t[43] = addmul_adx_14 (t + 29, x + 15, x[14]);
+  t[44] = addmul_adx_13 (t + 31, x + 16, x[15]);
+  t[45] = addmul_adx_12 (t + 33, x + 17, x[16]);
+  t[46] = addmul_adx_11 (t + 35, x + 18, x[17]);
+  t[47] = addmul_adx_10 (t + 37, x + 19, x[18]);
+  t[48] = addmul_adx_9 (t + 39, x + 20, x[19]);
+  t[49] = addmul_adx_8 (t + 41, x + 21, x[20]);
+  t[50] = addmul_adx_7 (t + 43, x + 22, x[21]);
+  t[51] = addmul_adx_6 (t + 45, x + 23, x[22]);
+  t[52] = addmul_adx_5 (t + 47, x + 24, x[23]);
+  t[53] = addmul_adx_4 (t + 49, x + 25, x[24]);
+  t[54] = addmul_adx_3 (t + 51, x + 26, x[25]);
+  t[55] = addmul_adx_2 (t + 53, x + 27, x[26]);
+  t[56] = addmul_adx_1 (t + 55, x + 28, x[27]);
+  sqr_diag_adx_29 (t, x);
+  for (i = 0; i < 29; i++)
+    t[i] = addmul_adx_29 (t + i, m, t[i] * invm);
+  return add_n_adx_29 (z, t + 29, t);
+}
+
+static mp_limb_t
+mulredc_adx_30 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[60];
+  int i;
+
+  t[30] = mul_adx_30 (t, y, x[0]);
+  for (i = 1; i < 30; i++)
+    t[i + 30] = addmul_adx_30 (t + i, y, x[i]);
+  for (i = 0; i < 30; i++)
+    t[i] = addmul_adx_30 (t + i, m, t[i] * invm);
+  return add_n_adx_30 (z, t + 30, t);
+}
+
+static mp_limb_t
+sqrredc_adx_30 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[60];
+  int i;
+
+  for (i = 0; i < 30; i++)
+    t[i] = 0;
+  t[59] = 0;
+  t[30] = addmul_adx_29 (t + 1, x + 1, x[0]);
+  t[31] = addmul_adx_28 (t + 3, x + 2, x[1]);
+  t[32] = addmul_adx_27 (t + 5, x + 3, x[2]);
+  t[33] = addmul_adx_26 (t + 7, x + 4, x[3]);
+  t[34] = addmul_adx_25 (t + 9, x + 5, x[4]);
+  t[35] = addmul_adx_24 (t + 11, x + 6, x[5]);
+  t[36] = addmul_adx_23 (t + 13, x + 7, x[6]);
+  t[37] = addmul_adx_22 (t + 15, x + 8, x[7]);
+  t[38] = addmul_adx_21 (t + 17, x + 9, x[8]);
+  t[39] = addmul_adx_20 (t + 19, x + 10, x[9]);
+  t[40] = addmul_adx_19 (t + 21, x + 11, x[10]);
+  t[41] = addmul_adx_18 (t + 23, x + 12, x[11]);
+  t[42] = addmul_adx_17 (t + 25, x + 13, x[12]);
+  t[43] = addmul_adx_16 (t + 27, x + 14, x[13]);
+  t[44] = addmul_adx_15 (t + 29, x + 15, x[14]);
+  t[45] = addmul_adx_14 (t + 31, x + 16, x[15]);
+  t[46] = addmul_adx_13 (t + 33, x + 17, x[16]);
+  t[47] = addmul_adx_12 (t + 35, x + 18, x[17]);
+  t[48] = addmul_adx_11 (t + 37, x + 19, x[18]);
+  t[49] = addmul_adx_10 (t + 39, x + 20, x[19]);
+  t[50] = addmul_adx_9 (t + 41, x + 21, x[20]);
+  t[51] = addmul_adx_8 (t + 43, x + 22, x[21]);
+  t[52] = addmul_adx_7 (t + 45, x + 23, x[22]);
+  t[53] = addmul_adx_6 (t + 47, x + 24, x[23]);
+  t[54] = addmul_adx_5 (t + 49, x + 25, x[24]);
+  t[55] = addmul_adx_4 (t + 51, x + 26, x[25]);
+  t[56] = addmul_adx_3 (t + 53, x + 27, x[26]);
+  t[57] = addmul_adx_2 (t + 55, x + 28, x[27]);
+  t[58] = addmul_adx_1 (t + 57, x + 29, x[28]);
+  sqr_diag_adx_30 (t, x);
+  for (i = 0; i < 30; i++)
+    t[i] = addmul_adx_30 (t + i, m, t[i] * invm);
+  return add_n_adx_30 (z, t + 30, t);
+}
+
+static mp_limb_t
+mulredc_adx_31 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[62];
+  int i;
+
+  t[31] = mul_adx_31 (t, y, x[0]);
+  for (i = 1; i < 31; i++)
+    t[i + 31] = addmul_adx_31 (t + i, y, x[i]);
+  for (i = 0; i < 31; i++)
+    t[i] = addmul_adx_31 (t + i, m, t[i] * invm);
+  return add_n_adx_31 (z, t + 31, t);
+}
+
+static mp_limb_t
+sqrredc_adx_31 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[62];
+  int i;
+
+  for (i = 0; i < 31; i++)
+    t[i] = 0;
+  t[61] = 0;
+  t[31] = addmul_adx_30 (t + 1, x + 1, x[0]);
+  t[32] = addmul_adx_29 (t + 3, x + 2, x[1]);
+  t[33] = addmul_adx_28 (t + 5, x + 3, x[2]);
+  t[34] = addmul_adx_27 (t + 7, x + 4, x[3]);
+  t[35] = addmul_adx_26 (t + 9, x + 5, x[4]);
+  t[36] = addmul_adx_25 (t + 11, x + 6, x[5]);
+  t[37] = addmul_adx_24 (t + 13, x + 7, x[6]);
+  t[38] = addmul_adx_23 (t + 15, x + 8, x[7]);
+  t[39] = addmul_adx_22 (t + 17, x + 9, x[8]);
+  t[40] = addmul_adx_21 (t + 19, x + 10, x[9]);
+  t[41] = addmul_adx_20 (t + 21, x + 11, x[10]);
+  t[42] = addmul_adx_19 (t + 23, x + 12, x[11]);
+  t[43] = addmul_adx_18 (t + 25, x + 13, x[12]);
+  t[44] = addmul_adx_17 (t + 27, x + 14, x[13]);
+  t[45] = addmul_adx_16 (t + 29, x + 15, x[14]);
+  t[46] = addmul_adx_15 (t + 31, x + 16, x[15]);
+  t[47] = addmul_adx_14 (t + 33, x + 17, x[16]);
+  t[48] = addmul_adx_13 (t + 35, x + 18, x[17]);
+  t[49] = addmul_adx_12 (t + 37, x + 19, x[18]);
+  t[50] = addmul_adx_11 (t + 39, x + 20, x[19]);
+  t[51] = addmul_adx_10 (t + 41, x + 21, x[20]);
+  t[52] = addmul_adx_9 (t + 43, x + 22, x[21]);
+  t[53] = addmul_adx_8 (t + 45, x + 23, x[22]);
+  t[54] = addmul_adx_7 (t + 47, x + 24, x[23]);
+  t[55] = addmul_adx_6 (t + 49, x + 25, x[24]);
+  t[56] = addmul_adx_5 (t + 51, x + 26, x[25]);
+  t[57] = addmul_adx_4 (t + 53, x + 27, x[26]);
+  t[58] = addmul_adx_3 (t + 55, x + 28, x[27]);
+  t[59] = addmul_adx_2 (t + 57, x + 29, x[28]);
+  t[60] = addmul_adx_1 (t + 59, x + 30, x[29]);
+  sqr_diag_adx_31 (t, x);
+  for (i = 0; i < 31; i++)
+    t[i] = addmul_adx_31 (t + i, m, t[i] * invm);
+  return add_n_adx_31 (z, t + 31, t);
+}
+
+static mp_limb_t
+mulredc_adx_32 (mp_ptr z, mp_srcptr x, mp_srcptr y, mp_srcptr m,
+                mp_limb_t invm)
+{
+  mp_limb_t t[64];
+  int i;
+
+  t[32] = mul_adx_32 (t, y, x[0]);
+  for (i = 1; i < 32; i++)
+    t[i + 32] = addmul_adx_32 (t + i, y, x[i]);
+  for (i = 0; i < 32; i++)
+    t[i] = addmul_adx_32 (t + i, m, t[i] * invm);
+  return add_n_adx_32 (z, t + 32, t);
+}
+
+static mp_limb_t
+sqrredc_adx_32 (mp_ptr z, mp_srcptr x, mp_srcptr m, mp_limb_t invm)
+{
+  mp_limb_t t[64];
+  int i;
+
+  for (i = 0; i < 32; i++)
+    t[i] = 0;
+  t[63] = 0;
+  t[32] = addmul_adx_31 (t + 1, x + 1, x[0]);
+  t[33] = addmul_adx_30 (t + 3, x + 2, x[1]);
+  t[34] = addmul_adx_29 (t + 5, x + 3, x[2]);
+  t[35] = addmul_adx_28 (t + 7, x + 4, x[3]);
+  t[36] = addmul_adx_27 (t + 9, x + 5, x[4]);
+  t[37] = addmul_adx_26 (t + 11, x + 6, x[5]);
+  t[38] = addmul_adx_25 (t + 13, x + 7, x[6]);
+  t[39] = addmul_adx_24 (t + 15, x + 8, x[7]);
+  t[40] = addmul_adx_23 (t + 17, x + 9, x[8]);
+  t[41] = addmul_adx_22 (t + 19, x + 10, x[9]);
+  t[42] = addmul_adx_21 (t + 21, x + 11, x[10]);
+  t[43] = addmul_adx_20 (t + 23, x + 12, x[11]);
+  t[44] = addmul_adx_19 (t + 25, x + 13, x[12]);
+  t[45] = addmul_adx_18 (t + 27, x + 14, x[13]);
+  t[46] = addmul_adx_17 (t + 29, x + 15, x[14]);
+  t[47] = addmul_adx_16 (t + 31, x + 16, x[15]);
+  t[48] = addmul_adx_15 (t + 33, x + 17, x[16]);
+  t[49] = addmul_adx_14 (t + 35, x + 18, x[17]);
+  t[50] = addmul_adx_13 (t + 37, x + 19, x[18]);
+  t[51] = addmul_adx_12 (t + 39, x + 20, x[19]);
+  t[52] = addmul_adx_11 (t + 41, x + 21, x[20]);
+  t[53] = addmul_adx_10 (t + 43, x + 22, x[21]);
+  t[54] = addmul_adx_9 (t + 45, x + 23, x[22]);
+  t[55] = addmul_adx_8 (t + 47, x + 24, x[23]);
+  t[56] = addmul_adx_7 (t + 49, x + 25, x[24]);
+  t[57] = addmul_adx_6 (t + 51, x + 26, x[25]);
+  t[58] = addmul_adx_5 (t + 53, x + 27, x[26]);
+  t[59] = addmul_adx_4 (t + 55, x + 28, x[27]);
+  t[60] = addmul_adx_3 (t + 57, x + 29, x[28]);
+  t[61] = addmul_adx_2 (t + 59, x + 30, x[29]);
+  t[62] = addmul_adx_1 (t + 61, x + 31, x[30]);
+  sqr_diag_adx_32 (t, x);
+  for (i = 0; i < 32; i++)
+    t[i] = addmul_adx_32 (t + i, m, t[i] * invm);
+  return add_n_adx_32 (z, t + 32, t);
+}
+
+const mulredc_fn mulredc_adx_table[MULREDC_ADX_MAX + 1] = {
+  NULL,
+  mulredc_adx_1,
+  mulredc_adx_2,
+  mulredc_adx_3,
+  mulredc_adx_4,
+  mulredc_adx_5,
+  mulredc_adx_6,
+  mulredc_adx_7,
+  mulredc_adx_8,
+  mulredc_adx_9,
+  mulredc_adx_10,
+  mulredc_adx_11,
+  mulredc_adx_12,
+  mulredc_adx_13,
+  mulredc_adx_14,
+  mulredc_adx_15,
+  mulredc_adx_16,
+  mulredc_adx_17,
+  mulredc_adx_18,
+  mulredc_adx_19,
+  mulredc_adx_20,
+  mulredc_adx_21,
+  mulredc_adx_22,
+  mulredc_adx_23,
+  mulredc_adx_24,
+  mulredc_adx_25,
+  mulredc_adx_26,
+  mulredc_adx_27,
+  mulredc_adx_28,
+  mulredc_adx_29,
+  mulredc_adx_30,
+  mulredc_adx_31,
+  mulredc_adx_32
+};
+
+const sqrredc_fn sqrredc_adx_table[MULREDC_ADX_MAX + 1] = {
+  NULL,
+  sqrredc_adx_1,
+  sqrredc_adx_2,
+  sqrredc_adx_3,
+  sqrredc_adx_4,
+  sqrredc_adx_5,
+  sqrredc_adx_6,
+  sqrredc_adx_7,
+  sqrredc_adx_8,
+  sqrredc_adx_9,
+  sqrredc_adx_10,
+  sqrredc_adx_11,
+  sqrredc_adx_12,
+  sqrredc_adx_13,
+  sqrredc_adx_14,
+  sqrredc_adx_15,
+  sqrredc_adx_16,
+  sqrredc_adx_17,
+  sqrredc_adx_18,
+  sqrredc_adx_19,
+  sqrredc_adx_20,
+  sqrredc_adx_21,
+  sqrredc_adx_22,
+  sqrredc_adx_23,
+  sqrredc_adx_24,
+  sqrredc_adx_25,
+  sqrredc_adx_26,
+  sqrredc_adx_27,
+  sqrredc_adx_28,
+  sqrredc_adx_29,
+  sqrredc_adx_30,
+  sqrredc_adx_31,
+  sqrredc_adx_32
+};
+
+int
+mulredc_adx_available (void)
+{
+  __builtin_cpu_init ();
+  return __builtin_cpu_supports ("bmi2") && __builtin_cpu_supports ("adx");
+}
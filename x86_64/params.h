@@ -7,11 +7,16 @@
 #define LIST_MUL_TABLE {0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,1,1,1,1,1,1,1,1,1,3,1,1,1}
 #define MPZMOD_THRESHOLD 54
 #define REDC_THRESHOLD 512
+#define KBNC_THRESHOLD 38
+#define DWT_THRESHOLD 814
+#define BASE2_FFT_THRESHOLD 448
 #define MPN_MUL_LO_THRESHOLD_TABLE {0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}
 #define NTT_GFP_TWIDDLE_DIF_BREAKOVER 17
 #define NTT_GFP_TWIDDLE_DIT_BREAKOVER 17
+#define NTT_GFP_FOURSTEP_THRESHOLD 20
 #define MUL_NTT_THRESHOLD 16384
 #define PREREVERTDIVISION_NTT_THRESHOLD 32
 #define POLYINVERT_NTT_THRESHOLD 512
 #define POLYEVALT_NTT_THRESHOLD 512
 #define MPZSPV_NORMALISE_STRIDE 512
+#define MPZSPV_TO_MPZV_TREE_THRESHOLD 1024